@@ -487,6 +487,76 @@ struct get_mm_stats_t
 
 } __attribute__((packed));
 
+/*! \struct telemetry_sample_t
+    \brief Telemetry sample, groups not requested (or which failed to be sampled) are left zeroed
+           and their bit cleared in groups_valid
+*/
+struct telemetry_sample_t
+{
+    uint64_t timestamp;                           /**< SP timer ticks when the sample was taken */
+    telemetry_group_e groups_requested;           /**< TELEMETRY_GROUP bit mask asked for */
+    telemetry_group_e groups_valid;               /**< TELEMETRY_GROUP bit mask actually sampled */
+    struct get_sp_stats_t sp_stats;               /**< TELEMETRY_GROUP_SP_STATS */
+    uint8_t pad[4];                               /**< Padding for alignment */
+    struct get_mm_stats_t mm_stats;               /**< TELEMETRY_GROUP_MM_STATS */
+    struct asic_frequencies_t asic_frequencies;   /**< TELEMETRY_GROUP_ASIC_FREQUENCIES */
+    struct module_voltage_t module_voltage;       /**< TELEMETRY_GROUP_MODULE_VOLTAGE */
+    struct asic_voltage_t asic_voltage;           /**< TELEMETRY_GROUP_ASIC_VOLTAGE */
+    struct module_power_t module_power;           /**< TELEMETRY_GROUP_MODULE_POWER */
+    struct current_temperature_t temperature;     /**< TELEMETRY_GROUP_MODULE_TEMPERATURE */
+} __attribute__((packed, aligned(8)));
+
+/*! \def FIRMWARE_LOAD_STATS_MAX_IMAGES
+    \brief Number of images reported by the firmware load stats (Machine, Master and Worker Minion)
+*/
+#define FIRMWARE_LOAD_STATS_MAX_IMAGES 3
+
+/*! \struct firmware_load_image_stats_t
+    \brief Stage timings of a minion firmware image load by SP BL2, all times in microseconds.
+           Flash reads run in the flash driver task while the previous chunk is hashed/decrypted,
+           so only the part of the flash time which was not overlapped shows in flash_wait_us
+*/
+struct firmware_load_image_stats_t
+{
+    uint32_t image_type;    /**< ESPERANTO_IMAGE_TYPE of the image */
+    int32_t status;         /**< 0 loaded, negative load failed, 1 not loaded */
+    uint32_t bytes;         /**< Code and data bytes read from flash */
+    uint32_t chunks;        /**< Number of chunks streamed */
+    uint64_t start_us;      /**< Load start, relative to the first image load start */
+    uint64_t header_us;     /**< Blocked on the header read, ~0 when prefetched in time */
+    uint64_t verify_us;     /**< Header verification and keys derivation */
+    uint64_t flash_wait_us; /**< Blocked on code and data flash reads */
+    uint64_t crypto_us;     /**< Hash and decrypt updates */
+    uint64_t final_us;      /**< BSS clear, hash final and compare */
+    uint64_t total_us;      /**< Whole image load */
+} __attribute__((packed, aligned(8)));
+
+/*! \struct firmware_load_stats_t
+    \brief Minion firmware load stats, images are listed in load order
+*/
+struct firmware_load_stats_t
+{
+    struct firmware_load_image_stats_t images[FIRMWARE_LOAD_STATS_MAX_IMAGES]; /**< Per image stats */
+    uint64_t total_us;   /**< All the images load */
+    uint32_t chunk_size; /**< Size of the streamed chunks in bytes */
+    uint32_t pad;        /**< Padding for alignment */
+} __attribute__((packed, aligned(8)));
+
+/*! \def FIRMWARE_PARTITION_MAX_BLOCKS
+    \brief Maximum number of flash erase blocks in a firmware partition (4MB partition, 64KB blocks)
+*/
+#define FIRMWARE_PARTITION_MAX_BLOCKS 64
+
+/*! \struct firmware_partition_hashes_t
+    \brief CRC32 (standard, zlib compatible) of each erase block of the passive firmware partition
+*/
+struct firmware_partition_hashes_t
+{
+    uint32_t block_size;                           /**< Size of a block in bytes */
+    uint32_t block_count;                          /**< Number of blocks in the partition */
+    uint32_t crc32[FIRMWARE_PARTITION_MAX_BLOCKS]; /**< CRC32 of each block */
+} __attribute__((packed, aligned(8)));
+
 struct shire_cache_config_t
 {
     uint16_t scp_size; /* L2 SCP size */
@@ -1543,4 +1613,66 @@ struct device_mgmt_set_vmin_lut_cmd_t
     struct asset_info_t vmin_lut;       /**< LUT frequency/voltage values */
 } __attribute__((packed, aligned(8)));
 
+/*! \struct device_mgmt_telemetry_batch_cmd_t
+    \brief Command to get several telemetry groups with a single request
+*/
+struct device_mgmt_telemetry_batch_cmd_t
+{
+    dev_mgmt_cmd_header_t command_info; /**< Command header */
+    telemetry_group_e groups;           /**< TELEMETRY_GROUP bit mask */
+    uint8_t pad[4];                     /**< Padding for alignment */
+} __attribute__((packed, aligned(8)));
+
+/*! \struct device_mgmt_telemetry_batch_rsp_t
+    \brief Response for telemetry batch command
+*/
+struct device_mgmt_telemetry_batch_rsp_t
+{
+    struct dev_mgmt_rsp_header_t rsp_hdr;
+    struct telemetry_sample_t sample; /**< Telemetry sample */
+} __attribute__((packed, aligned(8)));
+
+/*! \struct device_mgmt_telemetry_stream_cmd_t
+    \brief Command to start or stop the telemetry stream. While enabled, SP logs a
+           telemetry_sample_t as TRACE_CUSTOM_TYPE_SP_TELEMETRY event into the SP stats trace
+           buffer every period_ms (rounded up to the DM sampling period). The response is a
+           device_mgmt_default_rsp_t.
+*/
+struct device_mgmt_telemetry_stream_cmd_t
+{
+    dev_mgmt_cmd_header_t command_info; /**< Command header */
+    telemetry_group_e groups;           /**< TELEMETRY_GROUP bit mask, 0 stops the stream */
+    uint32_t period_ms;                 /**< Sampling period in milliseconds */
+} __attribute__((packed, aligned(8)));
+
+/*! \struct device_mgmt_firmware_load_stats_rsp_t
+    \brief Response for get firmware load stats command
+*/
+struct device_mgmt_firmware_load_stats_rsp_t
+{
+    struct dev_mgmt_rsp_header_t rsp_hdr;
+    struct firmware_load_stats_t stats; /**< Firmware load stats */
+} __attribute__((packed, aligned(8)));
+
+/*! \struct device_mgmt_firmware_partition_hashes_rsp_t
+    \brief Response for get firmware partition hashes command
+*/
+struct device_mgmt_firmware_partition_hashes_rsp_t
+{
+    struct dev_mgmt_rsp_header_t rsp_hdr;
+    struct firmware_partition_hashes_t hashes; /**< Passive partition blocks hashes */
+} __attribute__((packed, aligned(8)));
+
+/*! \struct device_mgmt_firmware_update_delta_cmd_t
+    \brief Command to update the firmware writing only the selected blocks of the passive
+           partition. As for DM_CMD_SET_FIRMWARE_UPDATE, the whole image must have been written to
+           the scratch region first, the whole partition is verified against it before the
+           partitions swap. The response is a device_mgmt_default_rsp_t.
+*/
+struct device_mgmt_firmware_update_delta_cmd_t
+{
+    dev_mgmt_cmd_header_t command_info; /**< Command header */
+    uint64_t block_mask;                /**< Bit n set to write the n-th block */
+} __attribute__((packed, aligned(8)));
+
 #endif /* ET_DEVICE_MGMT_API_RPC_TYPES_H */
@@ -114,6 +114,11 @@ enum DM_CMD
     DM_CMD_GET_FRU = 71,                                /**<  */
     DM_CMD_SET_VMIN_LUT = 72,                           /**<  */
     DM_CMD_GET_VMIN_LUT = 73,                           /**<  */
+    DM_CMD_GET_TELEMETRY_BATCH = 74,                    /**< Several telemetry groups in one request */
+    DM_CMD_SET_TELEMETRY_STREAM = 75,                   /**< Periodic telemetry push to SP stats trace */
+    DM_CMD_GET_FIRMWARE_LOAD_STATS = 76,                /**< Minion firmware load stage timings */
+    DM_CMD_GET_FIRMWARE_PARTITION_HASHES = 77,          /**< CRC32 of the passive partition blocks */
+    DM_CMD_SET_FIRMWARE_UPDATE_DELTA = 78,              /**< Firmware update of the changed blocks only */
     DM_CMD_MDI_BEGIN = 128,                             /**<  */
     DM_CMD_MDI_SELECT_HART = 128,                       /**<  */
     DM_CMD_MDI_UNSELECT_HART = 129,                     /**<  */
@@ -440,4 +445,21 @@ enum STATS_CONTROL
     STATS_CONTROL_RESET_TRACEBUF = 4, /**<  */
 };
 
+typedef uint32_t telemetry_group_e;
+
+/*! \enum TELEMETRY_GROUP
+    \brief Telemetry groups, bit mask used by the telemetry batch and stream commands
+*/
+enum TELEMETRY_GROUP
+{
+    TELEMETRY_GROUP_SP_STATS = 0x1,            /**< SP operating point stats */
+    TELEMETRY_GROUP_MM_STATS = 0x2,            /**< MM compute resources stats */
+    TELEMETRY_GROUP_ASIC_FREQUENCIES = 0x4,    /**< Clock domains frequencies */
+    TELEMETRY_GROUP_MODULE_VOLTAGE = 0x8,      /**< PMIC reported voltages */
+    TELEMETRY_GROUP_ASIC_VOLTAGE = 0x10,       /**< ASIC voltages */
+    TELEMETRY_GROUP_MODULE_POWER = 0x20,       /**< Module power */
+    TELEMETRY_GROUP_MODULE_TEMPERATURE = 0x40, /**< Module current temperature */
+    TELEMETRY_GROUP_ALL = 0x7F,                /**< All the groups above */
+};
+
 #endif /* ET_DEVICE_MGMT_API_SPEC_H */
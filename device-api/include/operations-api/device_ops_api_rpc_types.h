@@ -70,6 +70,26 @@ struct p2pdma_write_node {
 
 } __attribute__((packed));
 
+/*! \struct kernel_launch_batch_node
+    \brief Node containing one kernel launch of a kernel launch batch
+*/
+struct kernel_launch_batch_node {
+  uint64_t  code_start_address; /**< Starting address of the location of the Compute Kernel code */
+  uint64_t  pointer_to_args; /**< Pointer to kernel arguments, already present in device memory */
+  uint64_t  shire_mask; /**< BitMask indicating Compute Shires that is used to execute this Kernel */
+
+} __attribute__((packed));
+
+/*! \struct kernel_launch_batch_result
+    \brief Timings of one kernel launch of a kernel launch batch. Every launch but the last executed one
+           completed, the status of the last one is the status of the batch
+*/
+struct kernel_launch_batch_result {
+  uint64_t  device_cmd_start_ts; /**< Timestamp (in cycles) at which the kernel was launched */
+  uint64_t  device_cmd_execute_dur; /**< Time transpired between kernel launch and kernel completion */
+
+} __attribute__((packed));
+
 /*! \struct kernel_rsp_error_ptr_t
     \brief This contains U-mode exception buffer pointer and U-mode trace buffer pointer
 */
@@ -202,6 +222,35 @@ struct device_ops_kernel_launch_rsp_t {
                                     to provide user option to retrieve the respective contents when a Kernel execution fails */
 } __attribute__((packed, aligned(8)));
 
+/*! \struct device_ops_kernel_launch_batch_cmd_t
+    \brief Launch a chain of kernels back-to-back on the target. Each launch starts once the previous one
+           has completed successfully, the first failing launch terminates the chain.
+           Only CMD_FLAGS_BARRIER_ENABLE and CMD_FLAGS_KERNEL_LAUNCH_FLUSH_L3 are honored, the latter
+           applies to every launch of the batch.
+*/
+struct device_ops_kernel_launch_batch_cmd_t {
+  struct cmd_header_t command_info;
+  uint64_t  exception_buffer; /**< Pointer to the exception buffer shared by all the launches of the batch */
+  struct kernel_launch_batch_node  list[]; /**< Array of kernel launches executed in order, up to DEVICE_OPS_KERNEL_LAUNCH_BATCH_NODES_MAX.
+            The number of launches is derived from the command size */
+} __attribute__((packed, aligned(8)));
+
+/*! \struct device_ops_kernel_launch_batch_rsp_t
+    \brief Aggregated response and per launch results of a kernel launch batch
+*/
+struct device_ops_kernel_launch_batch_rsp_t {
+  struct rsp_header_t response_info; /**< Response header */
+  uint64_t  device_cmd_start_ts; /**< Timestamp (in cycles) at which the command was dispatched */
+  uint64_t  device_cmd_execute_dur; /**< Time transpired between the first kernel launch and the batch completion */
+  uint64_t  device_cmd_wait_dur; /**< Time transpired between command arrival and dispatch */
+  dev_ops_api_kernel_launch_response_e  status; /**< Status of the first failing launch, KERNEL_COMPLETED if all of them completed */
+  uint16_t  num_results; /**< Number of launches executed, i.e. number of entries in results */
+  uint16_t  pad; /**< Padding for alignment */
+  struct kernel_rsp_error_ptr_t  error_ptrs; /**< Exception and Trace buffers of the failing launch, zero if all of them completed */
+  struct kernel_launch_batch_result  results[]; /**< Per launch results, in launch order. Launches after a failing one are not executed
+            and have no entry */
+} __attribute__((packed, aligned(8)));
+
 /*! \struct device_ops_kernel_abort_cmd_t
     \brief Command to abort a currently running kernel on the device
 */
@@ -308,6 +357,56 @@ struct device_ops_p2pdma_writelist_rsp_t {
   uint32_t  pad; /**< Padding for alignment */
 } __attribute__((packed, aligned(8)));
 
+/*! \struct device_ops_memset_cmd_t
+    \brief Fill a device memory region with a pattern. The work is split among all the harts of the requested
+           compute shires, which write the region with vector stores and evict it to memory before completing.
+*/
+struct device_ops_memset_cmd_t {
+  struct cmd_header_t command_info;
+  uint64_t  dst_device_phy_addr; /**< Device physical address of the region to fill */
+  uint64_t  size; /**< Size in bytes of the region to fill, multiple of pattern_size */
+  uint64_t  shire_mask; /**< BitMask indicating Compute Shires used to perform the operation */
+  uint32_t  pattern; /**< Fill pattern, only the lower pattern_size bytes are used */
+  uint8_t  pattern_size; /**< Size in bytes of the fill pattern: 1, 2 or 4 */
+  uint8_t  pad[3]; /**< Padding for alignment */
+} __attribute__((packed, aligned(8)));
+
+/*! \struct device_ops_memset_rsp_t
+    \brief Device memset command response
+*/
+struct device_ops_memset_rsp_t {
+  struct rsp_header_t response_info; /**< Response header */
+  uint64_t  device_cmd_start_ts; /**< Timestamp (in cycles) at which the command was dispatched */
+  uint64_t  device_cmd_execute_dur; /**< Time transpired between command dispatch and command completion */
+  uint64_t  device_cmd_wait_dur; /**< Time transpired between command arrival and dispatch */
+  dev_ops_api_mem_op_response_e  status; /**< Status of the memset operation */
+  uint32_t  pad; /**< Padding for alignment */
+} __attribute__((packed, aligned(8)));
+
+/*! \struct device_ops_memcpy_local_cmd_t
+    \brief Copy between two non overlapping device memory regions of the same device. The work is split among all
+           the harts of the requested compute shires, and the destination is evicted to memory before completing.
+*/
+struct device_ops_memcpy_local_cmd_t {
+  struct cmd_header_t command_info;
+  uint64_t  src_device_phy_addr; /**< Device physical address to copy from */
+  uint64_t  dst_device_phy_addr; /**< Device physical address to copy to */
+  uint64_t  size; /**< Size in bytes of the copy */
+  uint64_t  shire_mask; /**< BitMask indicating Compute Shires used to perform the operation */
+} __attribute__((packed, aligned(8)));
+
+/*! \struct device_ops_memcpy_local_rsp_t
+    \brief Device local memcpy command response
+*/
+struct device_ops_memcpy_local_rsp_t {
+  struct rsp_header_t response_info; /**< Response header */
+  uint64_t  device_cmd_start_ts; /**< Timestamp (in cycles) at which the command was dispatched */
+  uint64_t  device_cmd_execute_dur; /**< Time transpired between command dispatch and command completion */
+  uint64_t  device_cmd_wait_dur; /**< Time transpired between command arrival and dispatch */
+  dev_ops_api_mem_op_response_e  status; /**< Status of the memcpy operation */
+  uint32_t  pad; /**< Padding for alignment */
+} __attribute__((packed, aligned(8)));
+
 /*! \struct device_ops_trace_rt_config_cmd_t
     \brief Configure the trace configuration
 */
@@ -41,6 +41,11 @@
 */
 #define DEVICE_OPS_DMA_LIST_NODES_MAX             4
 
+/*! \def DEVICE_OPS_KERNEL_LAUNCH_BATCH_NODES_MAX
+    \brief Maximum number of kernel launches supported in device-ops kernel launch batch command
+*/
+#define DEVICE_OPS_KERNEL_LAUNCH_BATCH_NODES_MAX  8
+
 /* Device Ops API Enumerations */
 
 typedef uint32_t trace_rt_type_e;
@@ -130,6 +135,7 @@ enum DEV_OPS_API_KERNEL_LAUNCH_RESPONSE {
   DEV_OPS_API_KERNEL_LAUNCH_RESPONSE_INVALID_ARGS_INVALID_SHIRE_MASK = 12, /**<  */
   DEV_OPS_API_KERNEL_LAUNCH_RESPONSE_USER_ERROR = 13, /**<  */
   DEV_OPS_API_KERNEL_LAUNCH_RESPONSE_INVALID_ARGS_INVALID_STACK_CFG = 14, /**<  */
+  DEV_OPS_API_KERNEL_LAUNCH_RESPONSE_INVALID_ARGS_INVALID_BATCH_SIZE = 15, /**< Kernel launch batch is empty or has more than DEVICE_OPS_KERNEL_LAUNCH_BATCH_NODES_MAX launches */
 };
 
 typedef uint32_t dev_ops_api_kernel_abort_response_e;
@@ -167,6 +173,24 @@ enum DEV_OPS_API_DMA_RESPONSE {
   DEV_OPS_API_DMA_RESPONSE_DRIVER_ABORT_FAILED = 12, /**<  */
 };
 
+typedef uint32_t dev_ops_api_mem_op_response_e;
+
+/*! \enum DEV_OPS_API_MEM_OP_RESPONSE
+    \brief Status of a device side memset or local memcpy operation
+*/
+enum DEV_OPS_API_MEM_OP_RESPONSE {
+  DEV_OPS_API_MEM_OP_RESPONSE_COMPLETE = 0, /**<  */
+  DEV_OPS_API_MEM_OP_RESPONSE_UNEXPECTED_ERROR = 1, /**<  */
+  DEV_OPS_API_MEM_OP_RESPONSE_INVALID_ADDRESS = 2, /**< Source or destination region is not in host managed DRAM */
+  DEV_OPS_API_MEM_OP_RESPONSE_INVALID_SIZE = 3, /**< Size is zero, or not a multiple of the memset pattern size */
+  DEV_OPS_API_MEM_OP_RESPONSE_INVALID_SHIRE_MASK = 4, /**< Shire mask is zero or contains non available shires */
+  DEV_OPS_API_MEM_OP_RESPONSE_INVALID_PATTERN_SIZE = 5, /**< Memset pattern size is not 1, 2 or 4 bytes */
+  DEV_OPS_API_MEM_OP_RESPONSE_SHIRES_NOT_READY = 6, /**<  */
+  DEV_OPS_API_MEM_OP_RESPONSE_HOST_ABORTED = 7, /**<  */
+  DEV_OPS_API_MEM_OP_RESPONSE_ERROR = 8, /**< Compute minions failed to complete the operation */
+  DEV_OPS_API_MEM_OP_RESPONSE_CM_IFACE_MULTICAST_FAILED = 9, /**<  */
+};
+
 typedef uint32_t dev_ops_api_echo_response_e;
 
 /*! \enum DEV_OPS_API_ECHO_RESPONSE
@@ -293,6 +317,12 @@ enum device_ops_api_msg_e {
     DEV_OPS_API_MID_DEVICE_OPS_P2PDMA_READLIST_RSP, /**< < P2P DMA readlist command response */
     DEV_OPS_API_MID_DEVICE_OPS_P2PDMA_WRITELIST_CMD, /**< < Single list command to perform multiple P2P DMA write transfers */
     DEV_OPS_API_MID_DEVICE_OPS_P2PDMA_WRITELIST_RSP, /**< < P2P DMA writelist command response */
+    DEV_OPS_API_MID_DEVICE_OPS_KERNEL_LAUNCH_BATCH_CMD, /**< < Launch a chain of kernels back-to-back on the target */
+    DEV_OPS_API_MID_DEVICE_OPS_KERNEL_LAUNCH_BATCH_RSP, /**< < Aggregated response and per launch results of a kernel launch batch */
+    DEV_OPS_API_MID_DEVICE_OPS_MEMSET_CMD, /**< < Fill a device memory region with a pattern using the compute minions */
+    DEV_OPS_API_MID_DEVICE_OPS_MEMSET_RSP, /**< < Device memset command response */
+    DEV_OPS_API_MID_DEVICE_OPS_MEMCPY_LOCAL_CMD, /**< < Copy between two device memory regions of the same device using the compute minions */
+    DEV_OPS_API_MID_DEVICE_OPS_MEMCPY_LOCAL_RSP, /**< < Device local memcpy command response */
     DEV_OPS_API_MID_LAST  = 1023
 };
 
@@ -18,6 +18,8 @@
         flash_fs_write_partition
         flash_fs_erase_partition
         flash_fs_update_partition
+        flash_fs_update_partition_blocks
+        flash_fs_get_partition_block_crcs
         flash_fs_swap_primary_boot_partition
         flash_fs_get_boot_counters
         flash_fs_increment_completed_boot_count
@@ -1042,6 +1044,25 @@ int flash_fs_erase_partition(uint32_t partition_address, uint32_t partition_size
     return 0;
 }
 
+static int get_passive_partition_address(uint32_t *passive_partition_address)
+{
+    /* Check for active partition and get the passive partition address */
+    if (0 == sg_flash_fs_bl2_info.active_partition)
+    {
+        *passive_partition_address = sg_flash_fs_bl2_info.flash_size / 2;
+    }
+    else if (1 == sg_flash_fs_bl2_info.active_partition)
+    {
+        *passive_partition_address = 0;
+    }
+    else
+    {
+        return ERROR_SPI_FLASH_NO_VALID_PARTITION;
+    }
+
+    return 0;
+}
+
 /************************************************************************
 *
 *   FUNCTION
@@ -1079,17 +1100,8 @@ int flash_fs_update_partition(void *buffer, uint64_t buffer_size, uint32_t chunk
         return ERROR_SPI_FLASH_INVALID_ARGUMENTS;
     }
 
-    /* Check for active partition and get the passive partition address to store the
-     new firmware image */
-    if (0 == sg_flash_fs_bl2_info.active_partition)
-    {
-        passive_partition_address = sg_flash_fs_bl2_info.flash_size / 2;
-    }
-    else if (1 == sg_flash_fs_bl2_info.active_partition)
-    {
-        passive_partition_address = 0;
-    }
-    else
+    /* Get the passive partition address to store the new firmware image */
+    if (0 != get_passive_partition_address(&passive_partition_address))
     {
         return ERROR_SPI_FLASH_NO_VALID_PARTITION;
     }
@@ -1123,6 +1135,157 @@ int flash_fs_update_partition(void *buffer, uint64_t buffer_size, uint32_t chunk
     return 0;
 }
 
+/************************************************************************
+*
+*   FUNCTION
+*
+*       flash_fs_update_partition_blocks
+*
+*   DESCRIPTION
+*
+*       This function erases and writes only the selected blocks of the
+*       passive partition, the other blocks are left untouched.
+*
+*   INPUTS
+*
+*       buffer                 data of the whole partition
+*       buffer_size            size of the data buffer
+*       chunk_size             size of data to be written to flash at the time (up to 256B)
+*       block_mask             bit n set to update the n-th SPI_FLASH_BLOCK_SIZE block
+*       blocks_written         number of blocks erased and written
+*
+*   OUTPUTS
+*
+*       none
+*
+***********************************************************************/
+
+int flash_fs_update_partition_blocks(void *buffer, uint64_t buffer_size, uint32_t chunk_size,
+                                     uint64_t block_mask, uint32_t *blocks_written)
+{
+    uint32_t passive_partition_address;
+    uint32_t partition_size;
+    uint32_t block_count;
+    uint32_t block_address;
+
+    partition_size = sg_flash_fs_bl2_info.flash_size / 2;
+    block_count = partition_size / SPI_FLASH_BLOCK_SIZE;
+    *blocks_written = 0;
+
+    if (buffer_size != partition_size)
+    {
+        MESSAGE_ERROR("flash_fs_update_partition_blocks: update image buffer size is not equal \
+                        to partition size!\n");
+        return ERROR_SPI_FLASH_INVALID_ARGUMENTS;
+    }
+
+    if ((block_count > FIRMWARE_PARTITION_MAX_BLOCKS) ||
+        ((block_count < 64) && (0 != (block_mask >> block_count))))
+    {
+        MESSAGE_ERROR("flash_fs_update_partition_blocks: invalid block mask!\n");
+        return ERROR_SPI_FLASH_INVALID_ARGUMENTS;
+    }
+
+    if (0 != get_passive_partition_address(&passive_partition_address))
+    {
+        return ERROR_SPI_FLASH_NO_VALID_PARTITION;
+    }
+
+    Log_Write(LOG_LEVEL_CRITICAL, "[ETFP] Updating changed blocks (mask %lx) ...\n", block_mask);
+
+    for (uint32_t block = 0; block < block_count; block++)
+    {
+        if (0 == (block_mask & (1ull << block)))
+        {
+            continue;
+        }
+
+        block_address = passive_partition_address + block * SPI_FLASH_BLOCK_SIZE;
+        if (0 != spi_flash_block_erase(sg_flash_fs_bl2_info.flash_id, block_address))
+        {
+            MESSAGE_ERROR("flash_fs_update_partition_blocks: failed to erase block %u!\n", block);
+            return ERROR_SPI_FLASH_PARTITION_ERASE_FAILED;
+        }
+
+        if (0 != flash_fs_write_partition(block_address,
+                                          (uint8_t *)buffer + block * SPI_FLASH_BLOCK_SIZE,
+                                          SPI_FLASH_BLOCK_SIZE, chunk_size))
+        {
+            MESSAGE_ERROR("flash_fs_update_partition_blocks: failed to write block %u!\n", block);
+            return ERROR_SPI_FLASH_PARTITION_PROGRAM_FAILED;
+        }
+        (*blocks_written)++;
+    }
+
+    Log_Write(LOG_LEVEL_CRITICAL, "[ETFP] %u of %u blocks programmed successfully\n",
+              *blocks_written, block_count);
+
+    return 0;
+}
+
+/************************************************************************
+*
+*   FUNCTION
+*
+*       flash_fs_get_partition_block_crcs
+*
+*   DESCRIPTION
+*
+*       This function computes the CRC32 of every SPI_FLASH_BLOCK_SIZE
+*       block of the passive partition.
+*
+*   INPUTS
+*
+*       crcs                   CRC32 of each block
+*       max_blocks             size of the crcs array
+*       block_count            number of blocks in the partition
+*
+*   OUTPUTS
+*
+*       none
+*
+***********************************************************************/
+
+int flash_fs_get_partition_block_crcs(uint32_t *crcs, uint32_t max_blocks, uint32_t *block_count)
+{
+    uint32_t passive_partition_address;
+    uint32_t page[SPI_FLASH_PAGE_SIZE / sizeof(uint32_t)];
+    uint32_t address;
+    uint32_t crc;
+
+    *block_count = (sg_flash_fs_bl2_info.flash_size / 2) / SPI_FLASH_BLOCK_SIZE;
+    if (*block_count > max_blocks)
+    {
+        MESSAGE_ERROR("flash_fs_get_partition_block_crcs: too many blocks (%u)!\n", *block_count);
+        return ERROR_SPI_FLASH_INVALID_ARGUMENTS;
+    }
+
+    if (0 != get_passive_partition_address(&passive_partition_address))
+    {
+        return ERROR_SPI_FLASH_NO_VALID_PARTITION;
+    }
+
+    for (uint32_t block = 0; block < *block_count; block++)
+    {
+        crc = 0;
+        address = passive_partition_address + block * SPI_FLASH_BLOCK_SIZE;
+        for (uint32_t offset = 0; offset < SPI_FLASH_BLOCK_SIZE; offset += SPI_FLASH_PAGE_SIZE)
+        {
+            if (0 != SPI_Flash_Read_Page(sg_flash_fs_bl2_info.flash_id, address + offset, page,
+                                         SPI_FLASH_PAGE_SIZE))
+            {
+                MESSAGE_ERROR("flash_fs_get_partition_block_crcs: failed to read block %u!\n",
+                              block);
+                return ERROR_SPI_FLASH_NORMAL_RD_FAILED;
+            }
+            crc32(page, SPI_FLASH_PAGE_SIZE, &crc);
+        }
+        crcs[block] = crc;
+    }
+
+    return 0;
+}
+
 /************************************************************************
 *
 *   FUNCTION
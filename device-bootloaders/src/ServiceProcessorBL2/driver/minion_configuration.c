@@ -1354,26 +1354,29 @@ int Minion_Load_Authenticate_Firmware(void)
         return FW_SW_CERTS_LOAD_ERROR;
     }
 
-    if (0 != load_firmware(ESPERANTO_IMAGE_TYPE_MACHINE_MINION))
+    /* Images are loaded in this order, the header of the next one is prefetched while the current
+       one is being finalized */
+    static const ESPERANTO_IMAGE_TYPE_t images[] = { ESPERANTO_IMAGE_TYPE_MACHINE_MINION,
+                                                     ESPERANTO_IMAGE_TYPE_MASTER_MINION,
+                                                     ESPERANTO_IMAGE_TYPE_WORKER_MINION };
+    uint32_t loaded_count;
+
+    if (0 != load_firmware_images(images, sizeof(images) / sizeof(images[0]), &loaded_count))
     {
-        Log_Write(LOG_LEVEL_ERROR, "Failed to load Machine Minion firmware!\n");
-        return FW_MACH_LOAD_ERROR;
-    }
-    Log_Write(LOG_LEVEL_INFO, "MACH FW loaded.\n");
-
-    if (0 != load_firmware(ESPERANTO_IMAGE_TYPE_MASTER_MINION))
-    {
-        Log_Write(LOG_LEVEL_ERROR, "Failed to load Master Minion firmware!\n");
-        return FW_MM_LOAD_ERROR;
-    }
-    Log_Write(LOG_LEVEL_INFO, "MM FW loaded.\n");
-
-    if (0 != load_firmware(ESPERANTO_IMAGE_TYPE_WORKER_MINION))
-    {
-        Log_Write(LOG_LEVEL_ERROR, "Failed to load Worker Minion firmware!\n");
-        return FW_CM_LOAD_ERROR;
+        switch (loaded_count)
+        {
+            case 0:
+                Log_Write(LOG_LEVEL_ERROR, "Failed to load Machine Minion firmware!\n");
+                return FW_MACH_LOAD_ERROR;
+            case 1:
+                Log_Write(LOG_LEVEL_ERROR, "Failed to load Master Minion firmware!\n");
+                return FW_MM_LOAD_ERROR;
+            default:
+                Log_Write(LOG_LEVEL_ERROR, "Failed to load Worker Minion firmware!\n");
+                return FW_CM_LOAD_ERROR;
+        }
     }
-    Log_Write(LOG_LEVEL_INFO, "WM FW loaded.\n");
+    Log_Write(LOG_LEVEL_INFO, "MACH/MM/WM FW loaded.\n");
 
     return SUCCESS;
 }
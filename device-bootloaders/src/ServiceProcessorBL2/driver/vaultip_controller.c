@@ -30,6 +30,9 @@
 /*#include "bl2_pll.h" */
 #include "bl2_timer.h"
 #include "bl2_vaultip_controller.h"
+#include "interrupt.h"
+#include "FreeRTOS.h"
+#include "task.h"
 
 #include "hwinc/sp_cru_reset.h"
 #include "hwinc/sp_misc.h"
@@ -280,6 +283,11 @@ static int vaultip_read_output_token(VAULTIP_OUTPUT_TOKEN_t *poutput_token, uint
             MESSAGE_ERROR("MODULE_STATUS = 0x%08x\n", module_status.R);
             return -1;
         }
+        /* let the flash driver task stream the next firmware chunk while VaultIP works */
+        if (!INT_Is_Trap_Context() && (xTaskGetSchedulerState() != taskSCHEDULER_NOT_STARTED))
+        {
+            taskYIELD();
+        }
     }
 
     /* read the output token */
@@ -16,6 +16,7 @@
 #include <stdbool.h>
 #include <stdlib.h>
 #include "service_processor_BL2_data.h"
+#include "dm.h"
 
 /*! \fn int load_firmware(const ESPERANTO_IMAGE_TYPE_t image_type)
     \brief Interface to process the load firmware service 
@@ -23,6 +24,25 @@
     \returns none
 */
 int load_firmware(const ESPERANTO_IMAGE_TYPE_t image_type);
+
+/*! \fn int load_firmware_images(const ESPERANTO_IMAGE_TYPE_t *image_types, uint32_t count,
+                                 uint32_t *loaded_count)
+    \brief Load several firmware images in order. Code and data are streamed by chunks so that
+           flash reads overlap with hashing/decryption, and the header of the next image is read
+           while the current one is being finalized
+    \param image_types types of the firmware images, in load order
+    \param count number of images
+    \param loaded_count number of images successfully loaded (can be NULL)
+    \returns 0 on success, -1 when any image failed to load
+*/
+int load_firmware_images(const ESPERANTO_IMAGE_TYPE_t *image_types, uint32_t count,
+                         uint32_t *loaded_count);
+
+/*! \fn const struct firmware_load_stats_t *get_firmware_load_stats(void)
+    \brief Stage timings of the last load_firmware/load_firmware_images call
+    \returns pointer to the firmware load stats
+*/
+const struct firmware_load_stats_t *get_firmware_load_stats(void);
 ESPERANTO_IMAGE_FILE_HEADER_t *get_master_minion_image_file_header(void);
 ESPERANTO_IMAGE_FILE_HEADER_t *get_worker_minion_image_file_header(void);
 ESPERANTO_IMAGE_FILE_HEADER_t *get_machine_minion_image_file_header(void);
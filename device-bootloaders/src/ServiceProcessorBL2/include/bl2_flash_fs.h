@@ -113,6 +113,30 @@ int flash_fs_erase_partition(uint32_t partition_address, uint32_t partition_size
 */
 int flash_fs_update_partition(void *buffer, uint64_t buffer_size, uint32_t chunk_size);
 
+/*! \fn int flash_fs_update_partition_blocks(void *buffer, uint64_t buffer_size, uint32_t chunk_size,
+                                              uint64_t block_mask, uint32_t *blocks_written)
+    \brief This function erases and writes only the selected blocks of the passive partition.
+    \param buffer - data of the whole partition
+    \param buffer_size - size of the data buffer, must be the partition size
+    \param chunk_size - size of data to be written to flash at the time (up to 256B)
+    \param block_mask - bit n set to update the n-th SPI_FLASH_BLOCK_SIZE block
+    \param blocks_written - number of blocks erased and written
+    \return The function call status, pass/fail.
+*/
+int flash_fs_update_partition_blocks(void *buffer, uint64_t buffer_size, uint32_t chunk_size,
+                                     uint64_t block_mask, uint32_t *blocks_written);
+
+/*! \fn int flash_fs_get_partition_block_crcs(uint32_t *crcs, uint32_t max_blocks,
+                                               uint32_t *block_count)
+    \brief This function computes the CRC32 of every SPI_FLASH_BLOCK_SIZE block of the
+           passive partition.
+    \param crcs - CRC32 of each block
+    \param max_blocks - size of the crcs array
+    \param block_count - number of blocks in the partition
+    \return The function call status, pass/fail.
+*/
+int flash_fs_get_partition_block_crcs(uint32_t *crcs, uint32_t max_blocks, uint32_t *block_count);
+
 /*! \fn int flash_fs_read(bool active, void *buffer, uint64_t buffer_size, uint32_t chunk_size)
     \brief This function reads the data from give flash partition
     \param active - true for active partition else false
@@ -15,6 +15,12 @@ int flashfs_drv_get_config_data(void *buffer);
 int flashfs_drv_get_file_size(ESPERANTO_FLASH_REGION_ID_t region_id, uint32_t *size);
 int flashfs_drv_read_file(ESPERANTO_FLASH_REGION_ID_t region_id, uint32_t offset, void *buffer,
                           uint32_t buffer_size);
+
+/* Split version of flashfs_drv_read_file(), lets the caller work while the flash driver task reads.
+   Only one read can be pending, and it must be waited for before issuing any other request */
+int flashfs_drv_read_file_start(ESPERANTO_FLASH_REGION_ID_t region_id, uint32_t offset, void *buffer,
+                                uint32_t buffer_size);
+int flashfs_drv_read_file_wait(void);
 int flashfs_drv_reset_boot_counters(void);
 int flashfs_drv_increment_completed_boot_count(void);
 
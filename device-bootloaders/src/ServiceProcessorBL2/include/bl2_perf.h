@@ -27,4 +27,15 @@
 */
 void process_performance_request(tag_id_t tag_id, msg_id_t msg_id, void *buffer);
 
+/*! \fn int32_t perf_collect_telemetry_sample(telemetry_group_e groups,
+                                              struct telemetry_sample_t *sample)
+    \brief Collects the requested telemetry groups from the values periodically
+    sampled by the DM task
+    \param groups TELEMETRY_GROUP bit mask
+    \param sample Pointer to sample to fill, groups not collected are zeroed
+    \returns STATUS_SUCCESS if all the requested groups were collected, error code
+    of the last failing group otherwise
+*/
+int32_t perf_collect_telemetry_sample(telemetry_group_e groups, struct telemetry_sample_t *sample);
+
 #endif
@@ -58,4 +58,15 @@ static inline uint64_t timer_convert_ticks_to_ms(uint64_t ticks)
     return portTICK_RATE_MS * ticks / 1000;
 }
 
+/*! \fn static inline uint64_t timer_convert_ticks_to_us(uint64_t ticks)
+    \brief This function converts timer ticks to microseconds.
+    \param ticks ticks value
+    \return microseconds value
+*/
+static inline uint64_t timer_convert_ticks_to_us(uint64_t ticks)
+{
+    /* Still need to fine tune the timing of the clocks */
+    return portTICK_RATE_MS * ticks;
+}
+
 #endif
@@ -13,5 +13,6 @@
 void init_dm_sampling_task(void);
 void dm_sampling_task_semaphore_take(void);
 void dm_sampling_task_semaphore_give(void);
+void dm_task_set_telemetry_stream(telemetry_group_e groups, uint32_t period_ms);
 
 #endif
@@ -168,6 +168,8 @@ static inline int8_t pc_vq_process_pending_command(vq_cb_t *vq_cached, vq_cb_t *
             case DM_CMD_GET_SP_STATS:
             case DM_CMD_GET_MM_STATS:
             case DM_CMD_SET_STATS_RUN_CONTROL:
+            case DM_CMD_GET_TELEMETRY_BATCH:
+            case DM_CMD_SET_TELEMETRY_STREAM:
             case DM_CMD_GET_ASIC_FREQUENCIES ... DM_CMD_GET_ASIC_LATENCY:
                 process_performance_request(tag_id, msg_id, (void *)buffer);
                 break;
@@ -181,6 +183,9 @@ static inline int8_t pc_vq_process_pending_command(vq_cb_t *vq_cached, vq_cb_t *
                 Trace_Process_CMD(tag_id, msg_id, (void *)buffer);
                 break;
             case DM_CMD_RESET_ETSOC:
+            case DM_CMD_GET_FIRMWARE_LOAD_STATS:
+            case DM_CMD_GET_FIRMWARE_PARTITION_HASHES:
+            case DM_CMD_SET_FIRMWARE_UPDATE_DELTA:
                 /* Process firmware service request cmd */
                 firmware_service_process_request(tag_id, msg_id, (void *)buffer);
                 break;
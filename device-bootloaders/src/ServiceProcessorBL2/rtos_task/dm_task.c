@@ -13,6 +13,7 @@
 *   FUNCTIONS
 *
 *       - init_dm_sampling_task
+*       - dm_task_set_telemetry_stream
 *
 ***********************************************************************/
 #include <inttypes.h>
@@ -30,6 +31,7 @@
 #include "dm_task.h"
 #include "perf_mgmt.h"
 #include "thermal_pwr_mgmt.h"
+#include "bl2_perf.h"
 
 /* GLobals */
 /* DM Task */
@@ -40,11 +42,20 @@ static StaticTask_t g_staticTask_ptr;
 SemaphoreHandle_t dm_sampling_semaphore_handle = NULL;
 StaticSemaphore_t dm_sampling_semaphore_buffer;
 
+/* Telemetry stream configuration, written by the command dispatcher, read by the DM task */
+static struct
+{
+    telemetry_group_e groups;
+    uint32_t period_ms;
+    uint32_t elapsed_ms;
+} g_telemetry_stream = { 0 };
+
 /* Task entry functions */
 static void dm_task_entry(void *pvParameters);
 
 /* Functions to log dev stats */
 static void dm_log_operating_point_stats(void);
+static void dm_log_telemetry_sample(void);
 
 /************************************************************************
 *
@@ -271,6 +282,9 @@ static void dm_task_entry(void *pvParameters)
         // Log op stats to trace
         dm_log_operating_point_stats();
 
+        // Log telemetry sample to trace if streaming is enabled
+        dm_log_telemetry_sample();
+
         // Wait for the sampling period
         vTaskDelay(pdMS_TO_TICKS(DM_TASK_DELAY_MS));
     }
@@ -316,3 +330,93 @@ static void dm_log_operating_point_stats(void)
         Log_Write(LOG_LEVEL_ERROR, "perf mgmt svc error : unable to get op stats\r\n");
     }
 }
+
+/************************************************************************
+*
+*   FUNCTION
+*
+*       dm_task_set_telemetry_stream
+*
+*   DESCRIPTION
+*
+*       This function configures the telemetry stream. While enabled, a
+*       telemetry sample is logged into the SP stats trace buffer every
+*       period_ms, rounded up to the DM sampling period.
+*
+*   INPUTS
+*
+*       groups      TELEMETRY_GROUP bit mask, 0 stops the stream
+*       period_ms   Sampling period in milliseconds
+*
+*   OUTPUTS
+*
+*       None
+*
+***********************************************************************/
+void dm_task_set_telemetry_stream(telemetry_group_e groups, uint32_t period_ms)
+{
+    portENTER_CRITICAL();
+    g_telemetry_stream.groups = groups;
+    g_telemetry_stream.period_ms = period_ms;
+    /* First sample is taken on the next DM task iteration */
+    g_telemetry_stream.elapsed_ms = period_ms;
+    portEXIT_CRITICAL();
+}
+
+/************************************************************************
+*
+*   FUNCTION
+*
+*       dm_log_telemetry_sample
+*
+*   DESCRIPTION
+*
+*       This function logs a telemetry sample with the configured groups into
+*       the SP stats trace buffer, once per configured period.
+*
+*   INPUTS
+*
+*       None
+*
+*   OUTPUTS
+*
+*       None
+*
+***********************************************************************/
+static void dm_log_telemetry_sample(void)
+{
+    struct telemetry_sample_t sample;
+    telemetry_group_e groups;
+    bool sample_due = false;
+
+    portENTER_CRITICAL();
+    groups = g_telemetry_stream.groups;
+    if (0 != groups)
+    {
+        if (g_telemetry_stream.elapsed_ms >= g_telemetry_stream.period_ms)
+        {
+            g_telemetry_stream.elapsed_ms = 0;
+            sample_due = true;
+        }
+        g_telemetry_stream.elapsed_ms += DM_TASK_DELAY_MS;
+    }
+    portEXIT_CRITICAL();
+
+    if (!sample_due)
+    {
+        return;
+    }
+
+    if (STATUS_SUCCESS != perf_collect_telemetry_sample(groups, &sample))
+    {
+        Log_Write(LOG_LEVEL_WARNING, "telemetry: groups 0x%x of 0x%x sampled\r\n",
+                  sample.groups_valid, groups);
+    }
+
+    /* Dump the sample to trace using SP custom event, even partial ones */
+    Trace_Custom_Event(Trace_Get_Dev_Stats_CB(), TRACE_CUSTOM_TYPE_SP_TELEMETRY,
+                       (uint8_t *)&sample, sizeof(struct telemetry_sample_t));
+
+    /* Update data size in stats buffer */
+    Trace_Update_SP_Stats_Buffer_Header();
+}
@@ -168,32 +168,47 @@ int flashfs_drv_init(void)
     return 0;
 }
 
-static int queue_request_and_wait_for_response(const FLASHFS_DRIVER_REQUEST_MESSAGE_t *req_msg,
-                                               FLASHFS_DRIVER_RESPONSE_MESSAGE_t *rsp_msg)
+static int queue_request(const FLASHFS_DRIVER_REQUEST_MESSAGE_t *req_msg)
 {
     if (pdTRUE != xQueueSend(gs_flashfs_driver_reqeust_queue, req_msg, portMAX_DELAY)) {
-        Log_Write(LOG_LEVEL_ERROR, "queue_request_and_wait_for_response:  xQueueSend() failed!\r\n");
+        Log_Write(LOG_LEVEL_ERROR, "queue_request:  xQueueSend() failed!\r\n");
         return -1;
     }
 
+    return 0;
+}
+
+static int wait_for_response(const FLASHFS_DRIVER_REQUEST_MESSAGE_t *req_msg,
+                             FLASHFS_DRIVER_RESPONSE_MESSAGE_t *rsp_msg)
+{
     if (pdTRUE != xQueueReceive(gs_flashfs_driver_response_queue, rsp_msg, portMAX_DELAY)) {
-        Log_Write(LOG_LEVEL_ERROR, "queue_request_and_wait_for_response:  xQueueSend() failed!\r\n");
+        Log_Write(LOG_LEVEL_ERROR, "wait_for_response:  xQueueReceive() failed!\r\n");
         return -1;
     }
 
     if (req_msg->id != rsp_msg->id) {
-        Log_Write(LOG_LEVEL_ERROR, "queue_request_and_wait_for_response:  id mismatch!\r\n");
+        Log_Write(LOG_LEVEL_ERROR, "wait_for_response:  id mismatch!\r\n");
         return -1;
     }
 
     if (req_msg->request != rsp_msg->request) {
-        Log_Write(LOG_LEVEL_ERROR, "queue_request_and_wait_for_response:  request mismatch!\r\n");
+        Log_Write(LOG_LEVEL_ERROR, "wait_for_response:  request mismatch!\r\n");
         return -1;
     }
 
     return 0;
 }
 
+static int queue_request_and_wait_for_response(const FLASHFS_DRIVER_REQUEST_MESSAGE_t *req_msg,
+                                               FLASHFS_DRIVER_RESPONSE_MESSAGE_t *rsp_msg)
+{
+    if (0 != queue_request(req_msg)) {
+        return -1;
+    }
+
+    return wait_for_response(req_msg, rsp_msg);
+}
+
 int flashfs_drv_get_config_data(void *buffer)
 {
     FLASHFS_DRIVER_REQUEST_MESSAGE_t req;
@@ -265,6 +280,59 @@ int flashfs_drv_read_file(ESPERANTO_FLASH_REGION_ID_t region_id, uint32_t offset
     return 0;
 }
 
+/* Read request started by flashfs_drv_read_file_start(), only one can be pending at a time and no
+   other flashfs_drv_* request can be issued until it is completed by flashfs_drv_read_file_wait() */
+static FLASHFS_DRIVER_REQUEST_MESSAGE_t gs_pending_read_req;
+static bool gs_pending_read;
+
+int flashfs_drv_read_file_start(ESPERANTO_FLASH_REGION_ID_t region_id, uint32_t offset, void *buffer,
+                                uint32_t buffer_size)
+{
+    if (gs_pending_read) {
+        Log_Write(LOG_LEVEL_ERROR, "flashfs_drv_read_file_start: a read is already pending!\r\n");
+        return -1;
+    }
+
+    gs_pending_read_req.id = get_next_request_id();
+    gs_pending_read_req.request = FLASHFS_DRIVER_REQUEST_READ_FILE;
+    gs_pending_read_req.args.read_file.region_id = region_id;
+    gs_pending_read_req.args.read_file.offset = offset;
+    gs_pending_read_req.args.read_file.buffer = buffer;
+    gs_pending_read_req.args.read_file.buffer_size = buffer_size;
+
+    if (0 != queue_request(&gs_pending_read_req)) {
+        Log_Write(LOG_LEVEL_ERROR, "flashfs_drv_read_file_start: queue_request() failed!\r\n");
+        return -1;
+    }
+
+    gs_pending_read = true;
+    return 0;
+}
+
+int flashfs_drv_read_file_wait(void)
+{
+    FLASHFS_DRIVER_RESPONSE_MESSAGE_t rsp;
+
+    if (!gs_pending_read) {
+        Log_Write(LOG_LEVEL_ERROR, "flashfs_drv_read_file_wait: no read pending!\r\n");
+        return -1;
+    }
+
+    gs_pending_read = false;
+
+    if (0 != wait_for_response(&gs_pending_read_req, &rsp)) {
+        Log_Write(LOG_LEVEL_ERROR, "flashfs_drv_read_file_wait: wait_for_response() failed!\r\n");
+        return -1;
+    }
+
+    if (0 != rsp.status_code) {
+        Log_Write(LOG_LEVEL_ERROR, "flashfs_drv_read_file_wait: flash_fs_read_file() failed!\r\n");
+        return -1;
+    }
+
+    return 0;
+}
+
 int flashfs_drv_reset_boot_counters(void)
 {
     return -1;
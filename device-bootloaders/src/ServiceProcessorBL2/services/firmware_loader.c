@@ -9,6 +9,8 @@
 
     Public interfaces:
         load_firmware
+        load_firmware_images
+        get_firmware_load_stats
 */
 /***********************************************************************/
 #include "etsoc/drivers/serial/serial.h"
@@ -405,6 +407,107 @@ typedef union load_address_u
     };
 } load_address_t;
 
+/* Size of the chunks the code and data are streamed by. Multiple of the largest hash block size
+   (SHA-512) so that, as when loading whole regions, only the last update of a region can be partial */
+#define FW_LOAD_CHUNK_SIZE (64 * 1024)
+
+typedef struct FW_LOAD_CHUNK_s
+{
+    uint32_t region_no;
+    uint32_t offset; /* offset in the region */
+    uint32_t size;
+} FW_LOAD_CHUNK_t;
+
+typedef struct FW_IMAGE_s
+{
+    ESPERANTO_IMAGE_TYPE_t image_type;
+    ESPERANTO_FLASH_REGION_ID_t region_id;
+    const char *image_name;
+    ESPERANTO_IMAGE_FILE_HEADER_t *image_file_header;
+    uint32_t image_file_size;
+    bool header_read_pending;
+} FW_IMAGE_t;
+
+static struct firmware_load_stats_t gs_load_stats;
+static uint64_t gs_load_start_time;
+
+static int get_fw_image(const ESPERANTO_IMAGE_TYPE_t image_type, FW_IMAGE_t *image)
+{
+    SERVICE_PROCESSOR_BL2_DATA_t *bl2_data = get_service_processor_bl2_data();
+
+    switch (image_type)
+    {
+        case ESPERANTO_IMAGE_TYPE_MACHINE_MINION:
+            image->region_id = ESPERANTO_FLASH_REGION_ID_MACHINE_MINION;
+            image->image_name = "MACHINE_MINION";
+            image->image_file_header = &(bl2_data->machine_minion_header);
+            break;
+        case ESPERANTO_IMAGE_TYPE_MASTER_MINION:
+            image->region_id = ESPERANTO_FLASH_REGION_ID_MASTER_MINION;
+            image->image_name = "MASTER_MINION";
+            image->image_file_header = &(bl2_data->master_minion_header);
+            break;
+        case ESPERANTO_IMAGE_TYPE_WORKER_MINION:
+            image->region_id = ESPERANTO_FLASH_REGION_ID_WORKER_MINION;
+            image->image_name = "WORKER_MINION";
+            image->image_file_header = &(bl2_data->worker_minion_header);
+            break;
+        case ESPERANTO_IMAGE_TYPE_MAXION_BL1:
+            image->region_id = ESPERANTO_FLASH_REGION_ID_MAXION_BL1;
+            image->image_file_header = &(bl2_data->maxion_bl1_header);
+            image->image_name = "MAXION_BL1";
+            break;
+        default:
+            Log_Write(LOG_LEVEL_ERROR, "load_firmware: invalid image type!\n");
+            return -1;
+    }
+
+    image->image_type = image_type;
+    image->image_file_size = 0;
+    image->header_read_pending = false;
+
+    return 0;
+}
+
+/* Get the image file size and start reading its header, the flash driver must be idle */
+static int start_header_read(FW_IMAGE_t *image)
+{
+    if (0 != flashfs_drv_get_file_size(image->region_id, &image->image_file_size))
+    {
+        Log_Write(LOG_LEVEL_ERROR, "load_firmware: flashfs_drv_get_file_size(%s) failed!\n",
+                  image->image_name);
+        return -1;
+    }
+    if (image->image_file_size < sizeof(ESPERANTO_IMAGE_FILE_HEADER_t))
+    {
+        Log_Write(LOG_LEVEL_ERROR, "load_firmware: %s image file too small!\n", image->image_name);
+        return -1;
+    }
+    if (0 != flashfs_drv_read_file_start(image->region_id, 0, image->image_file_header,
+                                         sizeof(ESPERANTO_IMAGE_FILE_HEADER_t)))
+    {
+        Log_Write(LOG_LEVEL_ERROR, "load_firmware: flashfs_drv_read_file_start(%s header) failed!\n",
+                  image->image_name);
+        return -1;
+    }
+    image->header_read_pending = true;
+
+    return 0;
+}
+
+static int wait_header_read(FW_IMAGE_t *image)
+{
+    image->header_read_pending = false;
+    if (0 != flashfs_drv_read_file_wait())
+    {
+        Log_Write(LOG_LEVEL_ERROR, "load_firmware: flashfs_drv_read_file(%s header) failed!\n",
+                  image->image_name);
+        return -1;
+    }
+
+    return 0;
+}
+
 static int load_image_code_and_data_cleanup_on_error(uint32_t region_no,
                                                      const ESPERANTO_IMAGE_INFO_t *image_info,
                                                      bool encrypted_hash_context_initialized,
@@ -433,13 +536,61 @@ static int load_image_code_and_data_cleanup_on_error(uint32_t region_no,
     return -1;
 }
 
+/* Start reading the chunk from flash into its final location in memory */
+static int start_chunk_read(ESPERANTO_FLASH_REGION_ID_t region_id,
+                            const ESPERANTO_IMAGE_INFO_t *image_info,
+                            const uint64_t *region_address, const FW_LOAD_CHUNK_t *chunk)
+{
+    uint32_t load_offset = (uint32_t)(sizeof(ESPERANTO_IMAGE_FILE_HEADER_t) +
+                                      image_info->secret_info.load_regions[chunk->region_no].region_offset +
+                                      chunk->offset);
+
+    return flashfs_drv_read_file_start(region_id, load_offset,
+                                       (void *)(region_address[chunk->region_no] + chunk->offset),
+                                       chunk->size);
+}
+
+/* Move the chunk to the next non empty chunk of the image, following the chunk given as input.
+   Returns false when the image has no more chunks */
+static bool next_load_chunk(const ESPERANTO_IMAGE_INFO_t *image_info, FW_LOAD_CHUNK_t *chunk)
+{
+    uint32_t region_no = chunk->region_no;
+    uint32_t offset = chunk->offset + chunk->size;
+    uint32_t load_size;
+
+    while (region_no < image_info->secret_info.load_regions_count)
+    {
+        load_size = image_info->secret_info.load_regions[region_no].load_size;
+        if (offset < load_size)
+        {
+            chunk->region_no = region_no;
+            chunk->offset = offset;
+            chunk->size = (load_size - offset) < FW_LOAD_CHUNK_SIZE ? (load_size - offset) :
+                                                                      FW_LOAD_CHUNK_SIZE;
+            return true;
+        }
+        region_no++;
+        offset = 0;
+    }
+
+    return false;
+}
+
 static int load_image_code_and_data(ESPERANTO_FLASH_REGION_ID_t region_id,
-                                    const ESPERANTO_IMAGE_FILE_HEADER_t *image_file_header)
+                                    const ESPERANTO_IMAGE_FILE_HEADER_t *image_file_header,
+                                    FW_IMAGE_t *next_image,
+                                    struct firmware_load_image_stats_t *stats)
 {
     uint32_t code_and_data_hash_size;
-    uint32_t load_offset;
     load_address_t load_address;
+    uint64_t region_address[MAX_EXECUTABLE_IMAGE_LOAD_REGIONS_COUNT];
     uint32_t region_no = 0;
+    FW_LOAD_CHUNK_t chunk = { 0 };
+    FW_LOAD_CHUNK_t next_chunk;
+    bool have_chunk;
+    bool read_pending = false;
+    void *chunk_data;
+    uint64_t start_time;
 #ifndef IGNORE_HASH
     CRYPTO_HASH_CONTEXT_t hash_context;
     bool hash_context_initialized = false;
@@ -484,10 +635,9 @@ static int load_image_code_and_data(ESPERANTO_FLASH_REGION_ID_t region_id,
     }
 #endif
 
+    /* check and remap all the regions first, chunks are streamed across regions */
     for (region_no = 0; region_no < image_info->secret_info.load_regions_count; region_no++)
     {
-        load_offset = (uint32_t)(sizeof(ESPERANTO_IMAGE_FILE_HEADER_t) +
-                                 image_info->secret_info.load_regions[region_no].region_offset);
         load_address.lo = image_info->secret_info.load_regions[region_no].load_address_lo;
         load_address.hi = image_info->secret_info.load_regions[region_no].load_address_hi;
         if (remap_load_address(&load_address.u64,
@@ -495,91 +645,115 @@ static int load_image_code_and_data(ESPERANTO_FLASH_REGION_ID_t region_id,
         {
             Log_Write(LOG_LEVEL_ERROR,
                       "Invalid region %u: load=0x%x, addr=0x%lx, fsize=0x%x, msize=0x%x\n",
-                      region_no, load_offset, load_address.u64,
-                      image_info->secret_info.load_regions[region_no].load_size,
+                      region_no, image_info->secret_info.load_regions[region_no].region_offset,
+                      load_address.u64, image_info->secret_info.load_regions[region_no].load_size,
                       image_info->secret_info.load_regions[region_no].memory_size);
             return load_image_code_and_data_cleanup_on_error(
                 region_no, image_info, encrypted_hash_context_initialized, &encrypted_hash_context,
                 hash_context_initialized, &hash_context);
         }
         Log_Write(LOG_LEVEL_DEBUG, "Region %u: load=0x%x, addr=0x%lx, fsize=0x%x, msize=0x%x\n",
-                  region_no, load_offset, load_address.u64,
-                  image_info->secret_info.load_regions[region_no].load_size,
+                  region_no, image_info->secret_info.load_regions[region_no].region_offset,
+                  load_address.u64, image_info->secret_info.load_regions[region_no].load_size,
                   image_info->secret_info.load_regions[region_no].memory_size);
+        region_address[region_no] = load_address.u64;
+    }
 
-        if (image_info->secret_info.load_regions[region_no].load_size > 0)
+    /* Stream code and data by chunks: the flash driver task reads the next chunk while the
+       VaultIP driver task hashes and decrypts the current one */
+    have_chunk = next_load_chunk(image_info, &chunk);
+    if (have_chunk)
+    {
+        if (0 != start_chunk_read(region_id, image_info, region_address, &chunk))
         {
-            if (0 !=
-                flashfs_drv_read_file(region_id, load_offset, (void *)load_address.u64,
-                                      image_info->secret_info.load_regions[region_no].load_size))
+            Log_Write(LOG_LEVEL_ERROR, "load_image_code_and_data: start_chunk_read() failed!\n");
+            goto CLEANUP_ON_ERROR;
+        }
+        read_pending = true;
+    }
+
+    while (have_chunk)
+    {
+        start_time = timer_get_ticks_count();
+        read_pending = false;
+        if (0 != flashfs_drv_read_file_wait())
+        {
+            Log_Write(LOG_LEVEL_ERROR,
+                      "load_image_code_and_data: flashfs_drv_read_file_wait(code) failed!\n");
+            goto CLEANUP_ON_ERROR;
+        }
+        stats->flash_wait_us += timer_convert_ticks_to_us(timer_get_ticks_count() - start_time);
+
+        next_chunk = chunk;
+        have_chunk = next_load_chunk(image_info, &next_chunk);
+        if (have_chunk)
+        {
+            if (0 != start_chunk_read(region_id, image_info, region_address, &next_chunk))
             {
                 Log_Write(LOG_LEVEL_ERROR,
-                          "load_image_code_and_data: flashfs_drv_read_file(code) failed!\n");
-                return load_image_code_and_data_cleanup_on_error(
-                    region_no, image_info, encrypted_hash_context_initialized,
-                    &encrypted_hash_context, hash_context_initialized, &hash_context);
+                          "load_image_code_and_data: start_chunk_read() failed!\n");
+                goto CLEANUP_ON_ERROR;
             }
-            /*Log_Write(LOG_LEVEL_ERROR, "loaded 0x%x bytes at 0x%08lx\n",
-                   image_info->secret_info.load_regions[region_no].load_size, load_address.u64);*/
+            read_pending = true;
+        }
+        else if (NULL != next_image)
+        {
+            /* flash is idle from now on, prefetch the header of the next image. On failure the
+               header is read again (and the error reported) when loading that image */
+            (void)start_header_read(next_image);
+        }
 
-            if (!gs_vaultip_disabled)
+        chunk_data = (void *)(region_address[chunk.region_no] + chunk.offset);
+        start_time = timer_get_ticks_count();
+        if (!gs_vaultip_disabled)
+        {
+            if (0 != (image_file_header->info.file_header_flags &
+                      ESPERANTO_IMAGE_FILE_HEADER_FLAGS_ENCRYPTED))
             {
-                if (0 != (image_file_header->info.file_header_flags &
-                          ESPERANTO_IMAGE_FILE_HEADER_FLAGS_ENCRYPTED))
+                /* hash encrypted data */
+                if (0 != crypto_hash_update(&encrypted_hash_context, chunk_data, chunk.size))
                 {
-                    /* hash encrypted data */
-                    if (0 != crypto_hash_update(
-                                 &encrypted_hash_context, (void *)load_address.u64,
-                                 image_info->secret_info.load_regions[region_no].load_size))
-                    {
-                        Log_Write(LOG_LEVEL_ERROR,
-                                  "load_image_code_and_data: crypto_hash_update() failed!\n");
-                        return load_image_code_and_data_cleanup_on_error(
-                            region_no, image_info, encrypted_hash_context_initialized,
-                            &encrypted_hash_context, hash_context_initialized, &hash_context);
-                    }
-
-                    /* decrypt data */
-                    if (0 != crypto_aes_decrypt_update(
-                                 &gs_aes_context, (void *)load_address.u64,
-                                 image_info->secret_info.load_regions[region_no].load_size))
-                    {
-                        Log_Write(
-                            LOG_LEVEL_ERROR,
-                            "load_image_code_and_data: crypto_aes_decrypt_update() failed!\n");
-                        return load_image_code_and_data_cleanup_on_error(
-                            region_no, image_info, encrypted_hash_context_initialized,
-                            &encrypted_hash_context, hash_context_initialized, &hash_context);
-                    }
+                    Log_Write(LOG_LEVEL_ERROR,
+                              "load_image_code_and_data: crypto_hash_update() failed!\n");
+                    goto CLEANUP_ON_ERROR;
                 }
 
-#ifndef IGNORE_HASH
-                if (0 !=
-                    crypto_hash_update(&hash_context, (void *)load_address.u64,
-                                       image_info->secret_info.load_regions[region_no].load_size))
+                /* decrypt data */
+                if (0 != crypto_aes_decrypt_update(&gs_aes_context, chunk_data, chunk.size))
                 {
                     Log_Write(LOG_LEVEL_ERROR,
-                              "load_image_code_and_data: crypto_hash_update() failed!\n");
-                    return load_image_code_and_data_cleanup_on_error(
-                        region_no, image_info, encrypted_hash_context_initialized,
-                        &encrypted_hash_context, hash_context_initialized, &hash_context);
+                              "load_image_code_and_data: crypto_aes_decrypt_update() failed!\n");
+                    goto CLEANUP_ON_ERROR;
                 }
-#endif
             }
-            total_length = total_length + image_info->secret_info.load_regions[region_no].load_size;
+
+#ifndef IGNORE_HASH
+            if (0 != crypto_hash_update(&hash_context, chunk_data, chunk.size))
+            {
+                Log_Write(LOG_LEVEL_ERROR,
+                          "load_image_code_and_data: crypto_hash_update() failed!\n");
+                goto CLEANUP_ON_ERROR;
+            }
+#endif
         }
+        stats->crypto_us += timer_convert_ticks_to_us(timer_get_ticks_count() - start_time);
 
-        if (image_info->secret_info.load_regions[region_no].memory_size >
-            image_info->secret_info.load_regions[region_no].load_size)
+        total_length = total_length + chunk.size;
+        stats->chunks++;
+        chunk = next_chunk;
+    }
+    stats->bytes = (uint32_t)total_length;
+
+    start_time = timer_get_ticks_count();
+    for (uint32_t n = 0; n < image_info->secret_info.load_regions_count; n++)
+    {
+        if (image_info->secret_info.load_regions[n].memory_size >
+            image_info->secret_info.load_regions[n].load_size)
         {
-            memset((void *)(load_address.u64 +
-                            image_info->secret_info.load_regions[region_no].load_size),
+            memset((void *)(region_address[n] + image_info->secret_info.load_regions[n].load_size),
                    0,
-                   image_info->secret_info.load_regions[region_no].memory_size -
-                       image_info->secret_info.load_regions[region_no].load_size);
-            /*Log_Write(LOG_LEVEL_ERROR, "erased 0x%x bytes\n",
-                   image_info->secret_info.load_regions[region_no].memory_size -
-                       image_info->secret_info.load_regions[region_no].load_size);*/
+                   image_info->secret_info.load_regions[n].memory_size -
+                       image_info->secret_info.load_regions[n].load_size);
         }
     }
 
@@ -643,18 +817,27 @@ static int load_image_code_and_data(ESPERANTO_FLASH_REGION_ID_t region_id,
         }
     }
 #endif
+    stats->final_us = timer_convert_ticks_to_us(timer_get_ticks_count() - start_time);
 
     return 0;
+
+CLEANUP_ON_ERROR:
+    if (read_pending && (0 != flashfs_drv_read_file_wait()))
+    {
+        Log_Write(LOG_LEVEL_ERROR, "load_image_code_and_data: flashfs_drv_read_file_wait() failed!\n");
+    }
+    return load_image_code_and_data_cleanup_on_error(
+        image_info->secret_info.load_regions_count - 1, image_info,
+        encrypted_hash_context_initialized, &encrypted_hash_context, hash_context_initialized,
+        &hash_context);
 }
 
-int load_firmware(const ESPERANTO_IMAGE_TYPE_t image_type)
+static int load_image(FW_IMAGE_t *image, FW_IMAGE_t *next_image,
+                      struct firmware_load_image_stats_t *stats)
 {
     int rv;
-    uint32_t image_file_size;
-    ESPERANTO_FLASH_REGION_ID_t region_id;
-    const char *image_name;
-    ESPERANTO_IMAGE_FILE_HEADER_t *image_file_header;
-    SERVICE_PROCESSOR_BL2_DATA_t *bl2_data = get_service_processor_bl2_data();
+    uint64_t start_time = timer_get_ticks_count();
+    uint64_t stage_time;
 
     gs_kdk_created = false;
     gs_mack_created = false;
@@ -669,71 +852,43 @@ int load_firmware(const ESPERANTO_IMAGE_TYPE_t image_type)
         gs_ignore_signatures = false;
     }
 
-    switch (image_type)
-    {
-        case ESPERANTO_IMAGE_TYPE_MACHINE_MINION:
-            region_id = ESPERANTO_FLASH_REGION_ID_MACHINE_MINION;
-            image_name = "MACHINE_MINION";
-            image_file_header = &(bl2_data->machine_minion_header);
-            break;
-        case ESPERANTO_IMAGE_TYPE_MASTER_MINION:
-            region_id = ESPERANTO_FLASH_REGION_ID_MASTER_MINION;
-            image_name = "MASTER_MINION";
-            image_file_header = &(bl2_data->master_minion_header);
-            break;
-        case ESPERANTO_IMAGE_TYPE_WORKER_MINION:
-            region_id = ESPERANTO_FLASH_REGION_ID_WORKER_MINION;
-            image_name = "WORKER_MINION";
-            image_file_header = &(bl2_data->worker_minion_header);
-            break;
-        case ESPERANTO_IMAGE_TYPE_MAXION_BL1:
-            region_id = ESPERANTO_FLASH_REGION_ID_MAXION_BL1;
-            image_file_header = &(bl2_data->maxion_bl1_header);
-            image_name = "MAXION_BL1";
-            break;
-        default:
-            Log_Write(LOG_LEVEL_ERROR, "load_firmware: invalid image type!\n");
-            return -1;
-    }
+    stats->image_type = image->image_type;
+    stats->start_us = timer_convert_ticks_to_us(start_time - gs_load_start_time);
 
-    /* load the image */
-    if (0 != flashfs_drv_get_file_size(region_id, &image_file_size))
-    {
-        Log_Write(LOG_LEVEL_ERROR, "load_firmware: flashfs_drv_get_file_size(%s) failed!\n",
-                  image_name);
-        return -1;
-    }
-    if (image_file_size < sizeof(ESPERANTO_IMAGE_FILE_HEADER_t))
+    /* load the image, its header may have been prefetched while loading the previous image */
+    if (!image->header_read_pending && (0 != start_header_read(image)))
     {
-        Log_Write(LOG_LEVEL_ERROR, "load_firmware: %s image file too small!\n", image_name);
-        return -1;
+        rv = -1;
+        goto STATS;
     }
-    if (0 != flashfs_drv_read_file(region_id, 0, image_file_header,
-                                   sizeof(ESPERANTO_IMAGE_FILE_HEADER_t)))
+    if (0 != wait_header_read(image))
     {
-        Log_Write(LOG_LEVEL_ERROR, "load_firmware: flashfs_drv_read_file(%s header) failed!\n",
-                  image_name);
         rv = -1;
         goto DONE;
     }
-    Log_Write(LOG_LEVEL_INFO, "Loaded %s header...\n", image_name);
+    Log_Write(LOG_LEVEL_INFO, "Loaded %s header...\n", image->image_name);
+    stage_time = timer_get_ticks_count();
+    stats->header_us = timer_convert_ticks_to_us(stage_time - start_time);
 
-    if (0 != verify_image_file_header(image_type, image_file_header, image_file_size))
+    if (0 != verify_image_file_header(image->image_type, image->image_file_header,
+                                      image->image_file_size))
     {
         Log_Write(LOG_LEVEL_ERROR, "load_firmware: verify_image_file_header() failed!\n");
         rv = -1;
         goto DONE;
     }
-    Log_Write(LOG_LEVEL_INFO, "Verified %s header...\n", image_name);
+    Log_Write(LOG_LEVEL_INFO, "Verified %s header...\n", image->image_name);
+    stats->verify_us = timer_convert_ticks_to_us(timer_get_ticks_count() - stage_time);
 
-    if (0 != load_image_code_and_data(region_id, image_file_header))
+    if (0 != load_image_code_and_data(image->region_id, image->image_file_header, next_image,
+                                      stats))
     {
         Log_Write(LOG_LEVEL_ERROR, "load_firmware: load_image_code_and_data() failed!\n");
         rv = -1;
         goto DONE;
     }
 
-    Log_Write(LOG_LEVEL_CRITICAL, "load_firmware: Loaded %s firmware.\n", image_name);
+    Log_Write(LOG_LEVEL_CRITICAL, "load_firmware: Loaded %s firmware.\n", image->image_name);
     rv = 0;
 
 DONE:
@@ -759,9 +914,98 @@ DONE:
 
     if (0 != rv)
     {
-        memset(image_file_header, 0, sizeof(ESPERANTO_IMAGE_FILE_HEADER_t));
+        memset(image->image_file_header, 0, sizeof(ESPERANTO_IMAGE_FILE_HEADER_t));
         memset(&(gs_IV), 0, sizeof(gs_IV));
     }
 
+STATS:
+    stats->status = rv;
+    stats->total_us = timer_convert_ticks_to_us(timer_get_ticks_count() - start_time);
+
     return rv;
 }
+
+int load_firmware_images(const ESPERANTO_IMAGE_TYPE_t *image_types, uint32_t count,
+                         uint32_t *loaded_count)
+{
+    int rv = 0;
+    uint32_t n;
+    uint32_t loaded = 0;
+    FW_IMAGE_t image;
+    FW_IMAGE_t next_image;
+    struct firmware_load_image_stats_t unreported_stats;
+    struct firmware_load_image_stats_t *stats;
+
+    gs_load_start_time = timer_get_ticks_count();
+    memset(&gs_load_stats, 0, sizeof(gs_load_stats));
+    gs_load_stats.chunk_size = FW_LOAD_CHUNK_SIZE;
+    for (n = 0; n < FIRMWARE_LOAD_STATS_MAX_IMAGES; n++)
+    {
+        gs_load_stats.images[n].status = 1;
+    }
+
+    if (NULL != loaded_count)
+    {
+        *loaded_count = 0;
+    }
+
+    for (n = 0; n < count; n++)
+    {
+        if (0 != get_fw_image(image_types[n], &next_image))
+        {
+            return -1;
+        }
+    }
+
+    if ((count > 0) && (0 != get_fw_image(image_types[0], &image)))
+    {
+        return -1;
+    }
+
+    for (n = 0; n < count; n++)
+    {
+        memset(&unreported_stats, 0, sizeof(unreported_stats));
+        stats = (n < FIRMWARE_LOAD_STATS_MAX_IMAGES) ? &(gs_load_stats.images[n]) :
+                                                       &unreported_stats;
+
+        if (n + 1 < count)
+        {
+            (void)get_fw_image(image_types[n + 1], &next_image);
+        }
+
+        rv = load_image(&image, (n + 1 < count) ? &next_image : NULL, stats);
+        if (0 != rv)
+        {
+            /* the next image header may be in flight, wait for it before giving up */
+            if ((n + 1 < count) && next_image.header_read_pending)
+            {
+                (void)wait_header_read(&next_image);
+            }
+            break;
+        }
+
+        loaded++;
+        image = next_image;
+    }
+
+    gs_load_stats.total_us = timer_convert_ticks_to_us(timer_get_ticks_count() - gs_load_start_time);
+    Log_Write(LOG_LEVEL_INFO, "load_firmware: %u image(s) loaded in %lu us\n", loaded,
+              gs_load_stats.total_us);
+
+    if (NULL != loaded_count)
+    {
+        *loaded_count = loaded;
+    }
+
+    return rv;
+}
+
+int load_firmware(const ESPERANTO_IMAGE_TYPE_t image_type)
+{
+    return load_firmware_images(&image_type, 1, NULL);
+}
+
+const struct firmware_load_stats_t *get_firmware_load_stats(void)
+{
+    return &gs_load_stats;
+}
@@ -131,6 +131,86 @@ static void dm_svc_get_public_keys(tag_id_t tag_id, uint64_t req_start_time)
     }
 }
 
+/************************************************************************
+*
+*   FUNCTION
+*
+*       dm_svc_get_firmware_partition_hashes
+*
+*   DESCRIPTION
+*
+*       This function sends the CRC32 of each block of the passive
+*       partition, used by the host to compute a delta firmware update
+*
+*   INPUTS
+*
+*       tag_id              Message tag ID
+*       req_start_time      Message start time
+*
+*   OUTPUTS
+*
+*       void
+*
+***********************************************************************/
+static void dm_svc_get_firmware_partition_hashes(tag_id_t tag_id, uint64_t req_start_time)
+{
+    struct device_mgmt_firmware_partition_hashes_rsp_t dm_rsp = { 0 };
+    int32_t status = DM_STATUS_SUCCESS;
+
+    dm_rsp.hashes.block_size = SPI_FLASH_BLOCK_SIZE;
+    if (0 != flash_fs_get_partition_block_crcs(dm_rsp.hashes.crc32, FIRMWARE_PARTITION_MAX_BLOCKS,
+                                               &dm_rsp.hashes.block_count))
+    {
+        Log_Write(LOG_LEVEL_ERROR, "dm_svc_get_firmware_partition_hashes: read failed!\n");
+        status = ERROR_FW_UPDATE_READ_PARTITON;
+    }
+
+    FILL_RSP_HEADER(dm_rsp, tag_id, DM_CMD_GET_FIRMWARE_PARTITION_HASHES,
+                    timer_get_ticks_count() - req_start_time, status)
+
+    if (0 != SP_Host_Iface_CQ_Push_Cmd((char *)&dm_rsp,
+                                       sizeof(struct device_mgmt_firmware_partition_hashes_rsp_t)))
+    {
+        Log_Write(LOG_LEVEL_ERROR, "dm_svc_get_firmware_partition_hashes: Cqueue push error!\n");
+    }
+}
+
+/************************************************************************
+*
+*   FUNCTION
+*
+*       dm_svc_get_firmware_load_stats
+*
+*   DESCRIPTION
+*
+*       This function sends the stage timings of the minion firmware load
+*
+*   INPUTS
+*
+*       tag_id              Message tag ID
+*       req_start_time      Message start time
+*
+*   OUTPUTS
+*
+*       void
+*
+***********************************************************************/
+static void dm_svc_get_firmware_load_stats(tag_id_t tag_id, uint64_t req_start_time)
+{
+    struct device_mgmt_firmware_load_stats_rsp_t dm_rsp = { 0 };
+
+    memcpy(&dm_rsp.stats, get_firmware_load_stats(), sizeof(dm_rsp.stats));
+
+    FILL_RSP_HEADER(dm_rsp, tag_id, DM_CMD_GET_FIRMWARE_LOAD_STATS,
+                    timer_get_ticks_count() - req_start_time, DM_STATUS_SUCCESS)
+
+    if (0 != SP_Host_Iface_CQ_Push_Cmd((char *)&dm_rsp,
+                                       sizeof(struct device_mgmt_firmware_load_stats_rsp_t)))
+    {
+        Log_Write(LOG_LEVEL_ERROR, "dm_svc_get_firmware_load_stats: Cqueue push error!\n");
+    }
+}
+
 /************************************************************************
 *
 *   FUNCTION
@@ -648,17 +728,21 @@ static int32_t verify_image_header(void *fw_addr)
 *       both partitions are set such that passive partition gets
 *       precedence after reboot and becomes the active partition and
 *       brings up silicon using updated firmware.
+*       In delta mode only the blocks selected by the host (the ones which
+*       differ from the passive partition content) are erased and written,
+*       the whole partition is still verified against the input image.
 *
 *   INPUTS
 *
-*       None
+*       delta               Write only the blocks set in block_mask
+*       block_mask          Blocks to write in delta mode
 *
 *   OUTPUTS
 *
 *       Status
 *
 ***********************************************************************/
-static int32_t dm_svc_firmware_update(void)
+static int32_t dm_svc_firmware_update(bool delta, uint64_t block_mask)
 {
     // Firmware image is available in the memory.
     Log_Write(LOG_LEVEL_INFO, "FW mgmt request: %s\n", __func__);
@@ -675,6 +759,7 @@ static int32_t dm_svc_firmware_update(void)
     uint64_t verify_end;
     int32_t ret = 0;
     uint32_t version;
+    uint32_t blocks_written;
     int status = STATUS_SUCCESS;
 
     start = timer_get_ticks_count();
@@ -709,8 +794,17 @@ static int32_t dm_svc_firmware_update(void)
     prog_start = timer_get_ticks_count();
 
     // Image has passed verifcation checks, program it to flash.
-    if (0 != flash_fs_update_partition((void *)SP_DM_SCRATCH_REGION_BEGIN, partition_size,
-                                       SPI_FLASH_PAGE_SIZE))
+    if (delta)
+    {
+        ret = flash_fs_update_partition_blocks((void *)SP_DM_SCRATCH_REGION_BEGIN, partition_size,
+                                               SPI_FLASH_PAGE_SIZE, block_mask, &blocks_written);
+    }
+    else
+    {
+        ret = flash_fs_update_partition((void *)SP_DM_SCRATCH_REGION_BEGIN, partition_size,
+                                        SPI_FLASH_PAGE_SIZE);
+    }
+    if (0 != ret)
     {
         Log_Write(LOG_LEVEL_ERROR, "flash_fs_update_partition: failed to write data!\n");
         return ERROR_FW_UPDATE_ERASE_WRITE_PARTITION;
@@ -1084,10 +1178,29 @@ void firmware_service_process_request(tag_id_t tag_id, msg_id_t msg_id, void *bu
                     ret);
             }
             /* Do firmware update regardless of MM commands not able to abort */
-            ret = dm_svc_firmware_update();
+            ret = dm_svc_firmware_update(false, 0);
             send_status_response(tag_id, msg_id, req_start_time, ret);
             break;
 
+        case DM_CMD_SET_FIRMWARE_UPDATE_DELTA: {
+            const struct device_mgmt_firmware_update_delta_cmd_t *dm_cmd_req = (void *)buffer;
+            ret = MM_Iface_Send_Abort_All_Cmd();
+            if (ret != SUCCESS)
+            {
+                Log_Write(
+                    LOG_LEVEL_ERROR,
+                    "firmware_service_process_request: Unable to abort all MM commands. Status: %d\n",
+                    ret);
+            }
+            ret = dm_svc_firmware_update(true, dm_cmd_req->block_mask);
+            send_status_response(tag_id, msg_id, req_start_time, ret);
+            break;
+        }
+
+        case DM_CMD_GET_FIRMWARE_PARTITION_HASHES:
+            dm_svc_get_firmware_partition_hashes(tag_id, req_start_time);
+            break;
+
         case DM_CMD_GET_MODULE_FIRMWARE_REVISIONS:
             dm_svc_get_firmware_version(tag_id, req_start_time);
             break;
@@ -1122,6 +1235,10 @@ void firmware_service_process_request(tag_id_t tag_id, msg_id_t msg_id, void *bu
             dm_svc_get_public_keys(tag_id, req_start_time);
             break;
 
+        case DM_CMD_GET_FIRMWARE_LOAD_STATS:
+            dm_svc_get_firmware_load_stats(tag_id, req_start_time);
+            break;
+
         case DM_CMD_RESET_ETSOC:
             firmware_update_reset_etsoc();
             break;
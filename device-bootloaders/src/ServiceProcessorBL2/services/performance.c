@@ -8,6 +8,7 @@
 
     Public interfaces:
         process_performance_request
+        perf_collect_telemetry_sample
 */
 /***********************************************************************/
 
@@ -16,6 +17,9 @@
 #include "mm_iface.h"
 #include "trace.h"
 #include "thermal_pwr_mgmt.h"
+#include "dm_task.h"
+
+#include <string.h>
 
 /************************************************************************
 *
@@ -380,6 +384,75 @@ static void dm_svc_perf_get_asic_latency(uint16_t tag, uint64_t req_start_time)
     }
 }
 
+/************************************************************************
+*
+*   FUNCTION
+*
+*      perf_fill_sp_stats
+*
+*   DESCRIPTION
+*
+*       This function converts the operating point stats into the DM sp stats
+*
+*   INPUTS
+*
+*       op_stats          Operating point stats
+*       sp_stats          SP stats to fill
+*
+*   OUTPUTS
+*
+*       None
+*
+***********************************************************************/
+static void perf_fill_sp_stats(const struct op_stats_t *op_stats, struct get_sp_stats_t *sp_stats)
+{
+    sp_stats->system_power_avg = op_stats->system.power.avg;
+    sp_stats->system_power_min = op_stats->system.power.min;
+    sp_stats->system_power_max = op_stats->system.power.max;
+    sp_stats->system_temperature_avg = op_stats->system.temperature.avg;
+    sp_stats->system_temperature_min = op_stats->system.temperature.min;
+    sp_stats->system_temperature_max = op_stats->system.temperature.max;
+
+    sp_stats->minion_power_avg = op_stats->minion.power.avg;
+    sp_stats->minion_power_min = op_stats->minion.power.min;
+    sp_stats->minion_power_max = op_stats->minion.power.max;
+    sp_stats->minion_temperature_avg = op_stats->minion.temperature.avg;
+    sp_stats->minion_temperature_min = op_stats->minion.temperature.min;
+    sp_stats->minion_temperature_max = op_stats->minion.temperature.max;
+    sp_stats->minion_voltage_avg = op_stats->minion.voltage.avg;
+    sp_stats->minion_voltage_min = op_stats->minion.voltage.min;
+    sp_stats->minion_voltage_max = op_stats->minion.voltage.max;
+    sp_stats->minion_freq_avg = op_stats->minion.freq.avg;
+    sp_stats->minion_freq_min = op_stats->minion.freq.min;
+    sp_stats->minion_freq_max = op_stats->minion.freq.max;
+
+    sp_stats->sram_power_avg = op_stats->sram.power.avg;
+    sp_stats->sram_power_min = op_stats->sram.power.min;
+    sp_stats->sram_power_max = op_stats->sram.power.max;
+    sp_stats->sram_temperature_avg = op_stats->sram.temperature.avg;
+    sp_stats->sram_temperature_min = op_stats->sram.temperature.min;
+    sp_stats->sram_temperature_max = op_stats->sram.temperature.max;
+    sp_stats->sram_voltage_avg = op_stats->sram.voltage.avg;
+    sp_stats->sram_voltage_min = op_stats->sram.voltage.min;
+    sp_stats->sram_voltage_max = op_stats->sram.voltage.max;
+    sp_stats->sram_freq_avg = op_stats->sram.freq.avg;
+    sp_stats->sram_freq_min = op_stats->sram.freq.min;
+    sp_stats->sram_freq_max = op_stats->sram.freq.max;
+
+    sp_stats->noc_power_avg = op_stats->noc.power.avg;
+    sp_stats->noc_power_min = op_stats->noc.power.min;
+    sp_stats->noc_power_max = op_stats->noc.power.max;
+    sp_stats->noc_temperature_avg = op_stats->noc.temperature.avg;
+    sp_stats->noc_temperature_min = op_stats->noc.temperature.min;
+    sp_stats->noc_temperature_max = op_stats->noc.temperature.max;
+    sp_stats->noc_voltage_avg = op_stats->noc.voltage.avg;
+    sp_stats->noc_voltage_min = op_stats->noc.voltage.min;
+    sp_stats->noc_voltage_max = op_stats->noc.voltage.max;
+    sp_stats->noc_freq_avg = op_stats->noc.freq.avg;
+    sp_stats->noc_freq_min = op_stats->noc.freq.min;
+    sp_stats->noc_freq_max = op_stats->noc.freq.max;
+}
+
 /************************************************************************
 *
 *   FUNCTION
@@ -416,51 +489,7 @@ static void dm_svc_perf_get_sp_stats(tag_id_t tag_id, uint64_t req_start_time)
     }
     else
     {
-        dm_rsp.sp_stats.system_power_avg = op_stats.system.power.avg;
-        dm_rsp.sp_stats.system_power_min = op_stats.system.power.min;
-        dm_rsp.sp_stats.system_power_max = op_stats.system.power.max;
-        dm_rsp.sp_stats.system_temperature_avg = op_stats.system.temperature.avg;
-        dm_rsp.sp_stats.system_temperature_min = op_stats.system.temperature.min;
-        dm_rsp.sp_stats.system_temperature_max = op_stats.system.temperature.max;
-
-        dm_rsp.sp_stats.minion_power_avg = op_stats.minion.power.avg;
-        dm_rsp.sp_stats.minion_power_min = op_stats.minion.power.min;
-        dm_rsp.sp_stats.minion_power_max = op_stats.minion.power.max;
-        dm_rsp.sp_stats.minion_temperature_avg = op_stats.minion.temperature.avg;
-        dm_rsp.sp_stats.minion_temperature_min = op_stats.minion.temperature.min;
-        dm_rsp.sp_stats.minion_temperature_max = op_stats.minion.temperature.max;
-        dm_rsp.sp_stats.minion_voltage_avg = op_stats.minion.voltage.avg;
-        dm_rsp.sp_stats.minion_voltage_min = op_stats.minion.voltage.min;
-        dm_rsp.sp_stats.minion_voltage_max = op_stats.minion.voltage.max;
-        dm_rsp.sp_stats.minion_freq_avg = op_stats.minion.freq.avg;
-        dm_rsp.sp_stats.minion_freq_min = op_stats.minion.freq.min;
-        dm_rsp.sp_stats.minion_freq_max = op_stats.minion.freq.max;
-
-        dm_rsp.sp_stats.sram_power_avg = op_stats.sram.power.avg;
-        dm_rsp.sp_stats.sram_power_min = op_stats.sram.power.min;
-        dm_rsp.sp_stats.sram_power_max = op_stats.sram.power.max;
-        dm_rsp.sp_stats.sram_temperature_avg = op_stats.sram.temperature.avg;
-        dm_rsp.sp_stats.sram_temperature_min = op_stats.sram.temperature.min;
-        dm_rsp.sp_stats.sram_temperature_max = op_stats.sram.temperature.max;
-        dm_rsp.sp_stats.sram_voltage_avg = op_stats.sram.voltage.avg;
-        dm_rsp.sp_stats.sram_voltage_min = op_stats.sram.voltage.min;
-        dm_rsp.sp_stats.sram_voltage_max = op_stats.sram.voltage.max;
-        dm_rsp.sp_stats.sram_freq_avg = op_stats.sram.freq.avg;
-        dm_rsp.sp_stats.sram_freq_min = op_stats.sram.freq.min;
-        dm_rsp.sp_stats.sram_freq_max = op_stats.sram.freq.max;
-
-        dm_rsp.sp_stats.noc_power_avg = op_stats.noc.power.avg;
-        dm_rsp.sp_stats.noc_power_min = op_stats.noc.power.min;
-        dm_rsp.sp_stats.noc_power_max = op_stats.noc.power.max;
-        dm_rsp.sp_stats.noc_temperature_avg = op_stats.noc.temperature.avg;
-        dm_rsp.sp_stats.noc_temperature_min = op_stats.noc.temperature.min;
-        dm_rsp.sp_stats.noc_temperature_max = op_stats.noc.temperature.max;
-        dm_rsp.sp_stats.noc_voltage_avg = op_stats.noc.voltage.avg;
-        dm_rsp.sp_stats.noc_voltage_min = op_stats.noc.voltage.min;
-        dm_rsp.sp_stats.noc_voltage_max = op_stats.noc.voltage.max;
-        dm_rsp.sp_stats.noc_freq_avg = op_stats.noc.freq.avg;
-        dm_rsp.sp_stats.noc_freq_min = op_stats.noc.freq.min;
-        dm_rsp.sp_stats.noc_freq_max = op_stats.noc.freq.max;
+        perf_fill_sp_stats(&op_stats, &dm_rsp.sp_stats);
     }
 
     FILL_RSP_HEADER(dm_rsp, tag_id, DM_CMD_GET_SP_STATS, timer_get_ticks_count() - req_start_time,
@@ -613,6 +642,248 @@ static void dm_svc_perf_stats_run_control(tag_id_t tag_id, uint64_t req_start_ti
     }
 }
 
+/************************************************************************
+*
+*   FUNCTION
+*
+*      perf_collect_telemetry_sample
+*
+*   DESCRIPTION
+*
+*       This function collects the requested telemetry groups in a single
+*       sample. Values come from the globals refreshed by the DM sampling
+*       task, so collecting several groups costs no more device accesses
+*       than the individual requests would.
+*
+*   INPUTS
+*
+*       groups            TELEMETRY_GROUP bit mask
+*       sample            Sample to fill
+*
+*   OUTPUTS
+*
+*       int32_t           STATUS_SUCCESS or error code of the last failing group
+*
+***********************************************************************/
+int32_t perf_collect_telemetry_sample(telemetry_group_e groups, struct telemetry_sample_t *sample)
+{
+    struct op_stats_t op_stats;
+    uint16_t soc_pwr_10mW;
+    int32_t status = STATUS_SUCCESS;
+    int32_t group_status;
+
+    memset(sample, 0, sizeof(*sample));
+    sample->timestamp = timer_get_ticks_count();
+    sample->groups_requested = groups;
+
+    if (groups & TELEMETRY_GROUP_SP_STATS)
+    {
+        group_status = Thermal_Pwr_Mgmt_Get_System_Power_Temp_Stats(&op_stats);
+        if (STATUS_SUCCESS == group_status)
+        {
+            perf_fill_sp_stats(&op_stats, &sample->sp_stats);
+            sample->groups_valid |= TELEMETRY_GROUP_SP_STATS;
+        }
+        else
+        {
+            status = group_status;
+        }
+    }
+
+    if (groups & TELEMETRY_GROUP_MM_STATS)
+    {
+        group_status = get_mm_stats(&sample->mm_stats);
+        if (STATUS_SUCCESS == group_status)
+        {
+            sample->groups_valid |= TELEMETRY_GROUP_MM_STATS;
+        }
+        else
+        {
+            status = group_status;
+        }
+    }
+
+    if (groups & TELEMETRY_GROUP_ASIC_FREQUENCIES)
+    {
+        group_status = get_module_asic_frequencies(&sample->asic_frequencies);
+        if (STATUS_SUCCESS == group_status)
+        {
+            sample->groups_valid |= TELEMETRY_GROUP_ASIC_FREQUENCIES;
+        }
+        else
+        {
+            status = group_status;
+        }
+    }
+
+    if (groups & TELEMETRY_GROUP_MODULE_VOLTAGE)
+    {
+        group_status = get_module_voltage(&sample->module_voltage);
+        if (STATUS_SUCCESS == group_status)
+        {
+            sample->groups_valid |= TELEMETRY_GROUP_MODULE_VOLTAGE;
+        }
+        else
+        {
+            status = group_status;
+        }
+    }
+
+    if (groups & TELEMETRY_GROUP_ASIC_VOLTAGE)
+    {
+        group_status = get_asic_voltage(&sample->asic_voltage);
+        if (STATUS_SUCCESS == group_status)
+        {
+            sample->groups_valid |= TELEMETRY_GROUP_ASIC_VOLTAGE;
+        }
+        else
+        {
+            status = group_status;
+        }
+    }
+
+    if (groups & TELEMETRY_GROUP_MODULE_POWER)
+    {
+        group_status = get_module_soc_power(&soc_pwr_10mW);
+        if (STATUS_SUCCESS == group_status)
+        {
+            sample->module_power.power = soc_pwr_10mW;
+            sample->groups_valid |= TELEMETRY_GROUP_MODULE_POWER;
+        }
+        else
+        {
+            status = group_status;
+        }
+    }
+
+    if (groups & TELEMETRY_GROUP_MODULE_TEMPERATURE)
+    {
+        group_status = get_module_current_temperature(&sample->temperature);
+        if (STATUS_SUCCESS == group_status)
+        {
+            sample->groups_valid |= TELEMETRY_GROUP_MODULE_TEMPERATURE;
+        }
+        else
+        {
+            status = group_status;
+        }
+    }
+
+    return status;
+}
+
+/************************************************************************
+*
+*   FUNCTION
+*
+*      dm_svc_perf_get_telemetry_batch
+*
+*   DESCRIPTION
+*
+*       This function returns all the requested telemetry groups with a
+*       single response
+*
+*   INPUTS
+*
+*       tag_id            Tag id
+*       req_start_time    Time stamp when the request was received by the Command
+*                         Dispatcher
+*       buffer            Command input buffer
+*
+*   OUTPUTS
+*
+*       None
+*
+***********************************************************************/
+static void dm_svc_perf_get_telemetry_batch(tag_id_t tag_id, uint64_t req_start_time,
+                                            void *buffer)
+{
+    const struct device_mgmt_telemetry_batch_cmd_t *dm_cmd =
+        (struct device_mgmt_telemetry_batch_cmd_t *)buffer;
+    struct device_mgmt_telemetry_batch_rsp_t dm_rsp;
+    int32_t status;
+
+    if (0 == (dm_cmd->groups & TELEMETRY_GROUP_ALL))
+    {
+        memset(&dm_rsp.sample, 0, sizeof(dm_rsp.sample));
+        status = ERROR_INVALID_ARGUMENT;
+    }
+    else
+    {
+        status = perf_collect_telemetry_sample(dm_cmd->groups & TELEMETRY_GROUP_ALL,
+                                               &dm_rsp.sample);
+        if (STATUS_SUCCESS != status)
+        {
+            /* Partial samples are still returned, groups_valid tells what made it */
+            Log_Write(LOG_LEVEL_ERROR, "%s: groups 0x%x of 0x%x sampled, status: %d\r\n", __func__,
+                      dm_rsp.sample.groups_valid, dm_rsp.sample.groups_requested, status);
+        }
+    }
+
+    FILL_RSP_HEADER(dm_rsp, tag_id, DM_CMD_GET_TELEMETRY_BATCH,
+                    timer_get_ticks_count() - req_start_time, status)
+
+    if (STATUS_SUCCESS != SP_Host_Iface_CQ_Push_Cmd((char *)&dm_rsp, sizeof(dm_rsp)))
+    {
+        Log_Write(LOG_LEVEL_ERROR, "%s: Cqueue push error!\n", __func__);
+    }
+}
+
+/************************************************************************
+*
+*   FUNCTION
+*
+*      dm_svc_perf_set_telemetry_stream
+*
+*   DESCRIPTION
+*
+*       This function starts or stops the periodic logging of telemetry
+*       samples into the SP stats trace buffer
+*
+*   INPUTS
+*
+*       tag_id            Tag id
+*       req_start_time    Time stamp when the request was received by the Command
+*                         Dispatcher
+*       buffer            Command input buffer
+*
+*   OUTPUTS
+*
+*       None
+*
+***********************************************************************/
+static void dm_svc_perf_set_telemetry_stream(tag_id_t tag_id, uint64_t req_start_time,
+                                             void *buffer)
+{
+    const struct device_mgmt_telemetry_stream_cmd_t *dm_cmd =
+        (struct device_mgmt_telemetry_stream_cmd_t *)buffer;
+    struct device_mgmt_default_rsp_t dm_rsp;
+    int32_t status = STATUS_SUCCESS;
+
+    if ((dm_cmd->groups & ~TELEMETRY_GROUP_ALL) ||
+        ((0 != dm_cmd->groups) && (0 == dm_cmd->period_ms)))
+    {
+        status = ERROR_INVALID_ARGUMENT;
+    }
+    else
+    {
+        if (0 != dm_cmd->groups)
+        {
+            /* Samples are logged into the stats trace buffer, make sure it is running */
+            Trace_Run_Control_SP_Dev_Stats(TRACE_ENABLE);
+        }
+        dm_task_set_telemetry_stream(dm_cmd->groups, dm_cmd->period_ms);
+    }
+
+    FILL_RSP_HEADER(dm_rsp, tag_id, DM_CMD_SET_TELEMETRY_STREAM,
+                    timer_get_ticks_count() - req_start_time, status)
+
+    if (STATUS_SUCCESS != SP_Host_Iface_CQ_Push_Cmd((char *)&dm_rsp, sizeof(dm_rsp)))
+    {
+        Log_Write(LOG_LEVEL_ERROR, "%s: Cqueue push error!\n", __func__);
+    }
+}
+
 /************************************************************************
 *
 *   FUNCTION
@@ -649,6 +920,12 @@ void process_performance_request(tag_id_t tag_id, msg_id_t msg_id, void *buffer)
         case DM_CMD_SET_STATS_RUN_CONTROL:
             dm_svc_perf_stats_run_control(tag_id, req_start_time, buffer);
             break;
+        case DM_CMD_GET_TELEMETRY_BATCH:
+            dm_svc_perf_get_telemetry_batch(tag_id, req_start_time, buffer);
+            break;
+        case DM_CMD_SET_TELEMETRY_STREAM:
+            dm_svc_perf_set_telemetry_stream(tag_id, req_start_time, buffer);
+            break;
         case DM_CMD_GET_ASIC_FREQUENCIES:
             dm_svc_perf_get_asic_frequencies(tag_id, req_start_time);
             break;
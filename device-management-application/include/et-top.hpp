@@ -129,10 +129,9 @@ private:
   void collectErrStats(void);
   void collectAerStats(void);
   void collectVqStats(void);
-  void collectSpStats(void);
-  void collectMmStats(void);
-  void collectFreqStats(void);
-  void collectVoltStats(void);
+  void collectTelemetry(void);
+  void collectSpStats(const device_mgmt_api::telemetry_sample_t& sample);
+  void collectMmStats(const device_mgmt_api::telemetry_sample_t& sample);
 
   int devNum_;
   bool batchMode_;
@@ -1417,6 +1417,32 @@ int verifyService() {
     DM_LOG(INFO) << "timeout: " << timeout << " ms" << std::endl;
   } break;
 
+  case DM_CMD::DM_CMD_SET_FIRMWARE_UPDATE_DELTA: {
+    // Reads back the passive partition blocks hashes, then only the changed blocks are written.
+    // For this reason runService() isn't used.
+    DMLib dml;
+
+    ret = dml.verifyDMLib();
+    if (ret != DM_STATUS_SUCCESS) {
+      DM_VLOG(LOW) << "Failed to verify the DM lib: " << ret << std::endl;
+      return ret;
+    }
+    DeviceManagement& dm = (*dml.dmi)(dml.devLayer_.get());
+
+    uint32_t blocksChanged = 0;
+    auto start = Clock::now();
+    ret = dm.updateFirmwareImageDelta(node, imagePath.c_str(), &blocksChanged, FW_UPDATE_CMD_TIMEOUT);
+    if (ret != DM_STATUS_SUCCESS) {
+      DM_LOG(INFO) << "Service request failed with return code: " << ret << std::endl;
+      return ret;
+    }
+
+    DM_LOG(INFO) << "Blocks written: " << blocksChanged << std::endl;
+    auto hostLatency = std::chrono::duration_cast<std::chrono::milliseconds>(Clock::now() - start);
+    DM_LOG(INFO) << "Host Latency: " << hostLatency.count() << " ms" << std::endl;
+    DM_LOG(INFO) << "Service request succeeded" << std::endl;
+  } break;
+
   case DM_CMD::DM_CMD_MM_RESET: {
     if ((ret = runService(nullptr, 0, nullptr, 0)) != DM_STATUS_SUCCESS) {
       return ret;
@@ -110,15 +110,38 @@ void EtTop::collectStats(void) {
   collectErrStats();
   collectAerStats();
   collectVqStats();
-  collectSpStats();
-  collectMmStats();
+  collectTelemetry();
+  return;
+}
+
+void EtTop::collectTelemetry(void) {
+  // SP, MM, frequency and voltage stats are all fetched with a single request
+  uint32_t groups = device_mgmt_api::TELEMETRY_GROUP_SP_STATS | device_mgmt_api::TELEMETRY_GROUP_MM_STATS;
   if (displayFreqDetails_) {
-    collectFreqStats();
+    groups |= device_mgmt_api::TELEMETRY_GROUP_ASIC_FREQUENCIES;
   }
   if (displayVoltDetails_) {
-    collectVoltStats();
+    groups |= device_mgmt_api::TELEMETRY_GROUP_MODULE_VOLTAGE | device_mgmt_api::TELEMETRY_GROUP_ASIC_VOLTAGE;
+  }
+
+  device_mgmt_api::telemetry_sample_t sample = {};
+  auto ret = dm_.getTelemetry(devNum_, groups, sample, kDmServiceRequestTimeout);
+  if (ret != device_mgmt_api::DM_STATUS_SUCCESS) {
+    DV_LOG(ERROR) << "Service request get telemetry failed with return code: " << std::dec << ret
+                  << ", groups sampled: 0x" << std::hex << sample.groups_valid << " of 0x" << groups << std::endl;
+  }
+
+  collectSpStats(sample);
+  collectMmStats(sample);
+  if (sample.groups_valid & device_mgmt_api::TELEMETRY_GROUP_ASIC_FREQUENCIES) {
+    freqStats_ = sample.asic_frequencies;
+  }
+  if (sample.groups_valid & device_mgmt_api::TELEMETRY_GROUP_MODULE_VOLTAGE) {
+    moduleVoltStats_ = sample.module_voltage;
+  }
+  if (sample.groups_valid & device_mgmt_api::TELEMETRY_GROUP_ASIC_VOLTAGE) {
+    asicVoltStats_ = sample.asic_voltage;
   }
-  return;
 }
 
 void EtTop::collectMemStats(void) {
@@ -290,17 +313,11 @@ void EtTop::collectAerStats(void) {
   return;
 }
 
-void EtTop::collectSpStats(void) {
-  uint32_t hostLatency;
-  uint64_t deviceLatency;
-  std::vector<char> outputBuff(sizeof(device_mgmt_api::get_sp_stats_t), 0);
-
-  auto ret = dm_.serviceRequest(devNum_, device_mgmt_api::DM_CMD::DM_CMD_GET_SP_STATS, nullptr, 0, outputBuff.data(),
-                                outputBuff.size(), &hostLatency, &deviceLatency, kDmServiceRequestTimeout);
-  if (ret != device_mgmt_api::DM_STATUS_SUCCESS) {
-    DV_LOG(ERROR) << "Service request get sp stats failed with return code: " << std::dec << ret << std::endl;
-  } else {
-    auto* sp_stats = static_cast<device_mgmt_api::get_sp_stats_t*>(static_cast<void*>(outputBuff.data()));
+void EtTop::collectSpStats(const device_mgmt_api::telemetry_sample_t& sample) {
+  if (sample.groups_valid & device_mgmt_api::TELEMETRY_GROUP_SP_STATS) {
+    // Copied out of the packed sample so it can be accessed through an aligned pointer
+    const device_mgmt_api::get_sp_stats_t spStats = sample.sp_stats;
+    auto* sp_stats = &spStats;
 
     spStats_.op.system.power.avg = sp_stats->system_power_avg;
     spStats_.op.system.power.min = sp_stats->system_power_min;
@@ -399,46 +416,10 @@ void EtTop::collectDeviceDetails(void) {
   }
 }
 
-void EtTop::collectFreqStats(void) {
-  uint32_t hostLatency;
-  uint64_t deviceLatency;
-  auto ret = dm_.serviceRequest(devNum_, device_mgmt_api::DM_CMD_GET_ASIC_FREQUENCIES, nullptr, 0,
-                                static_cast<char*>(static_cast<void*>(&freqStats_)), sizeof(freqStats_), &hostLatency,
-                                &deviceLatency, kDmServiceRequestTimeout);
-  if (ret != device_mgmt_api::DM_STATUS_SUCCESS) {
-    DV_LOG(ERROR) << "Service request get asic frequencies failed with return code: " << std::dec << ret << std::endl;
-  }
-}
-
-void EtTop::collectVoltStats(void) {
-  uint32_t hostLatency;
-  uint64_t deviceLatency;
-  auto ret = dm_.serviceRequest(devNum_, device_mgmt_api::DM_CMD_GET_MODULE_VOLTAGE, nullptr, 0,
-                                static_cast<char*>(static_cast<void*>(&moduleVoltStats_)), sizeof(moduleVoltStats_),
-                                &hostLatency, &deviceLatency, kDmServiceRequestTimeout);
-  if (ret != device_mgmt_api::DM_STATUS_SUCCESS) {
-    DV_LOG(ERROR) << "Service request get module voltage failed with return code: " << std::dec << ret << std::endl;
-  }
-  ret = dm_.serviceRequest(devNum_, device_mgmt_api::DM_CMD_GET_ASIC_VOLTAGE, nullptr, 0,
-                           static_cast<char*>(static_cast<void*>(&asicVoltStats_)), sizeof(asicVoltStats_),
-                           &hostLatency, &deviceLatency, kDmServiceRequestTimeout);
-  if (ret != device_mgmt_api::DM_STATUS_SUCCESS) {
-    DV_LOG(ERROR) << "Service request get asic voltage failed with return code: " << std::dec << ret << std::endl;
-  }
-}
-
-void EtTop::collectMmStats(void) {
-  uint32_t hostLatency;
-  uint64_t deviceLatency;
-  std::vector<char> outputBuff(sizeof(device_mgmt_api::get_mm_stats_t), 0);
-
-  auto ret = dm_.serviceRequest(devNum_, device_mgmt_api::DM_CMD::DM_CMD_GET_MM_STATS, nullptr, 0, outputBuff.data(),
-                                outputBuff.size(), &hostLatency, &deviceLatency, kDmServiceRequestTimeout);
-
-  if (ret != device_mgmt_api::DM_STATUS_SUCCESS) {
-    DV_LOG(ERROR) << "Service request get mm stats failed with return code: " << std::dec << ret << std::endl;
-  } else {
-    auto* mm_stats = static_cast<device_mgmt_api::get_mm_stats_t*>(static_cast<void*>(outputBuff.data()));
+void EtTop::collectMmStats(const device_mgmt_api::telemetry_sample_t& sample) {
+  if (sample.groups_valid & device_mgmt_api::TELEMETRY_GROUP_MM_STATS) {
+    const device_mgmt_api::get_mm_stats_t mmStats = sample.mm_stats;
+    auto* mm_stats = &mmStats;
 
     mmStats_.computeResources.cm_bw.avg = mm_stats->cm_bw_avg;
     mmStats_.computeResources.cm_bw.min = mm_stats->cm_bw_min;
@@ -90,6 +90,29 @@ void KW_Launch(uint32_t kw_idx);
 int32_t KW_Dispatch_Kernel_Launch_Cmd(
     struct device_ops_kernel_launch_cmd_t *cmd, uint8_t sqw_idx, uint8_t *kw_idx);
 
+/*! \fn int32_t KW_Dispatch_Kernel_Launch_Batch_Cmd
+        (const struct device_ops_kernel_launch_batch_cmd_t *cmd, uint8_t sqw_idx, uint8_t* kw_idx))
+    \brief Kernel Worker's interface to dispatch a kernel launch batch command.
+    The first launch is dispatched, the Kernel Worker chains the remaining ones.
+    \param cmd Kernel Launch Batch Command
+    \param sqw_idx Index of the submission queue worker
+    \param kw_idx Pointer to get kernel work index (slot number)
+    \return Status success or error
+*/
+int32_t KW_Dispatch_Kernel_Launch_Batch_Cmd(
+    const struct device_ops_kernel_launch_batch_cmd_t *cmd, uint8_t sqw_idx, uint8_t *kw_idx);
+
+/*! \fn int32_t KW_Dispatch_Mem_Op_Cmd(const struct cmd_header_t *cmd, uint8_t sqw_idx,
+        uint8_t *kw_idx)
+    \brief Kernel Worker's interface to dispatch a device memset or local memcpy command
+    to the built-in memory routine of the compute minions
+    \param cmd Memset or local memcpy Command
+    \param sqw_idx Index of the submission queue worker
+    \param kw_idx Pointer to get kernel work index (slot number)
+    \return Status success or error
+*/
+int32_t KW_Dispatch_Mem_Op_Cmd(const struct cmd_header_t *cmd, uint8_t sqw_idx, uint8_t *kw_idx);
+
 /*! \fn int32_t KW_Dispatch_Kernel_Abort_Cmd(const struct device_ops_kernel_abort_cmd_t *cmd,
     uint8_t sqw_idx)
     \brief Kernel Worker's interface to dispatch a kernel abort command
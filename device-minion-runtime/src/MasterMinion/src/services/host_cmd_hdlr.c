@@ -87,6 +87,90 @@
         ret_status = DEV_OPS_API_DMA_RESPONSE_UNEXPECTED_ERROR;                              \
     }
 
+/*! \def KERNEL_LAUNCH_TO_DEVICEAPI_STATUS
+    \brief Helper macro to convert Kernel Launch dispatch Error to Device API Errors
+*/
+#define KERNEL_LAUNCH_TO_DEVICEAPI_STATUS(status, ret_status, kernel_fail_msg)                   \
+    if (status == KW_ERROR_KERNEL_INVALID_SHIRE_MASK)                                            \
+    {                                                                                            \
+        ret_status = DEV_OPS_API_KERNEL_LAUNCH_RESPONSE_INVALID_ARGS_INVALID_SHIRE_MASK;         \
+    }                                                                                            \
+    else if (status == KW_ERROR_CW_SHIRES_NOT_READY)                                             \
+    {                                                                                            \
+        ret_status = DEV_OPS_API_KERNEL_LAUNCH_RESPONSE_SHIRES_NOT_READY;                        \
+    }                                                                                            \
+    else if (status == KW_ERROR_KERNEL_INVALID_ADDRESS)                                          \
+    {                                                                                            \
+        ret_status = DEV_OPS_API_KERNEL_LAUNCH_RESPONSE_INVALID_ADDRESS;                         \
+    }                                                                                            \
+    else if (status == KW_ERROR_KERNEL_INVALID_ARGS_SIZE)                                        \
+    {                                                                                            \
+        ret_status = DEV_OPS_API_KERNEL_LAUNCH_RESPONSE_INVALID_ARGS_PAYLOAD_SIZE;               \
+    }                                                                                            \
+    else if ((status == KW_ABORTED_KERNEL_SLOT_SEARCH) ||                                        \
+             (status == KW_ABORTED_KERNEL_SHIRES_SEARCH) || (status == HOST_CMD_STATUS_ABORTED)) \
+    {                                                                                            \
+        strncpy(kernel_fail_msg, "Aborted", sizeof(kernel_fail_msg));                            \
+        ret_status = DEV_OPS_API_KERNEL_LAUNCH_RESPONSE_HOST_ABORTED;                            \
+    }                                                                                            \
+    else if (status == KW_ERROR_CM_IFACE_MULTICAST_FAILED)                                       \
+    {                                                                                            \
+        ret_status = DEV_OPS_API_KERNEL_LAUNCH_RESPONSE_CM_IFACE_MULTICAST_FAILED;               \
+    }                                                                                            \
+    else if (status == KW_ERROR_KERNEL_UMODE_STACK_INVALID_CONFIG)                               \
+    {                                                                                            \
+        ret_status = DEV_OPS_API_KERNEL_LAUNCH_RESPONSE_INVALID_ARGS_INVALID_STACK_CFG;          \
+    }                                                                                            \
+    else if (status == KW_ERROR_KERNEL_INVALID_BATCH_SIZE)                                       \
+    {                                                                                            \
+        ret_status = DEV_OPS_API_KERNEL_LAUNCH_RESPONSE_INVALID_ARGS_INVALID_BATCH_SIZE;         \
+    }                                                                                            \
+    else                                                                                         \
+    {                                                                                            \
+        /* Unexpected error. It should never come here. */                                       \
+        ret_status = DEV_OPS_API_KERNEL_LAUNCH_RESPONSE_UNEXPECTED_ERROR;                        \
+    }
+
+/*! \def MEM_OP_TO_DEVICEAPI_STATUS
+    \brief Helper macro to convert memset and local memcpy dispatch Error to Device API Errors
+*/
+#define MEM_OP_TO_DEVICEAPI_STATUS(status, ret_status, mem_op_fail_msg)                          \
+    if (status == KW_ERROR_KERNEL_INVALID_SHIRE_MASK)                                            \
+    {                                                                                            \
+        ret_status = DEV_OPS_API_MEM_OP_RESPONSE_INVALID_SHIRE_MASK;                             \
+    }                                                                                            \
+    else if (status == KW_ERROR_CW_SHIRES_NOT_READY)                                             \
+    {                                                                                            \
+        ret_status = DEV_OPS_API_MEM_OP_RESPONSE_SHIRES_NOT_READY;                               \
+    }                                                                                            \
+    else if (status == KW_ERROR_KERNEL_INVALID_ADDRESS)                                          \
+    {                                                                                            \
+        ret_status = DEV_OPS_API_MEM_OP_RESPONSE_INVALID_ADDRESS;                                \
+    }                                                                                            \
+    else if (status == KW_ERROR_MEM_OP_INVALID_SIZE)                                             \
+    {                                                                                            \
+        ret_status = DEV_OPS_API_MEM_OP_RESPONSE_INVALID_SIZE;                                   \
+    }                                                                                            \
+    else if (status == KW_ERROR_MEM_OP_INVALID_PATTERN_SIZE)                                     \
+    {                                                                                            \
+        ret_status = DEV_OPS_API_MEM_OP_RESPONSE_INVALID_PATTERN_SIZE;                           \
+    }                                                                                            \
+    else if ((status == KW_ABORTED_KERNEL_SLOT_SEARCH) ||                                        \
+             (status == KW_ABORTED_KERNEL_SHIRES_SEARCH) || (status == HOST_CMD_STATUS_ABORTED)) \
+    {                                                                                            \
+        strncpy(mem_op_fail_msg, "Aborted", sizeof(mem_op_fail_msg));                            \
+        ret_status = DEV_OPS_API_MEM_OP_RESPONSE_HOST_ABORTED;                                   \
+    }                                                                                            \
+    else if (status == KW_ERROR_CM_IFACE_MULTICAST_FAILED)                                       \
+    {                                                                                            \
+        ret_status = DEV_OPS_API_MEM_OP_RESPONSE_CM_IFACE_MULTICAST_FAILED;                      \
+    }                                                                                            \
+    else                                                                                         \
+    {                                                                                            \
+        /* Unexpected error. It should never come here. */                                       \
+        ret_status = DEV_OPS_API_MEM_OP_RESPONSE_UNEXPECTED_ERROR;                               \
+    }
+
 /*! \def TRACE_RT_CONFIG_TO_DEVICEAPI_STATUS
     \brief Helper macro to convert Trace Config Error to Device API Errors
 */
@@ -856,41 +940,7 @@ static inline int32_t kernel_launch_cmd_handler(
         rsp->device_cmd_execute_dur = 0U;
 
         /* Map device internal errors onto device api errors */
-        if (status == KW_ERROR_KERNEL_INVALID_SHIRE_MASK)
-        {
-            rsp->status = DEV_OPS_API_KERNEL_LAUNCH_RESPONSE_INVALID_ARGS_INVALID_SHIRE_MASK;
-        }
-        else if (status == KW_ERROR_CW_SHIRES_NOT_READY)
-        {
-            rsp->status = DEV_OPS_API_KERNEL_LAUNCH_RESPONSE_SHIRES_NOT_READY;
-        }
-        else if (status == KW_ERROR_KERNEL_INVALID_ADDRESS)
-        {
-            rsp->status = DEV_OPS_API_KERNEL_LAUNCH_RESPONSE_INVALID_ADDRESS;
-        }
-        else if (status == KW_ERROR_KERNEL_INVALID_ARGS_SIZE)
-        {
-            rsp->status = DEV_OPS_API_KERNEL_LAUNCH_RESPONSE_INVALID_ARGS_PAYLOAD_SIZE;
-        }
-        else if ((status == KW_ABORTED_KERNEL_SLOT_SEARCH) ||
-                 (status == KW_ABORTED_KERNEL_SHIRES_SEARCH) || (status == HOST_CMD_STATUS_ABORTED))
-        {
-            strncpy(kernel_fail_msg, "Aborted", sizeof(kernel_fail_msg));
-            rsp->status = DEV_OPS_API_KERNEL_LAUNCH_RESPONSE_HOST_ABORTED;
-        }
-        else if (status == KW_ERROR_CM_IFACE_MULTICAST_FAILED)
-        {
-            rsp->status = DEV_OPS_API_KERNEL_LAUNCH_RESPONSE_CM_IFACE_MULTICAST_FAILED;
-        }
-        else if (status == KW_ERROR_KERNEL_UMODE_STACK_INVALID_CONFIG)
-        {
-            rsp->status = DEV_OPS_API_KERNEL_LAUNCH_RESPONSE_INVALID_ARGS_INVALID_STACK_CFG;
-        }
-        else
-        {
-            /* Unexpected error. It should never come here.*/
-            rsp->status = DEV_OPS_API_KERNEL_LAUNCH_RESPONSE_UNEXPECTED_ERROR;
-        }
+        KERNEL_LAUNCH_TO_DEVICEAPI_STATUS(status, rsp->status, kernel_fail_msg)
 
         Log_Write(LOG_LEVEL_ERROR,
             "TID[%u]:SQW[%d]:HostCmdHdlr:KernelLaunch:%s:shire_mask:0x%lx Status:%d\r\n",
@@ -949,6 +999,284 @@ static inline int32_t kernel_launch_cmd_handler(
     return status;
 }
 
+/************************************************************************
+*
+*   FUNCTION
+*
+*       kernel_launch_batch_cmd_handler
+*
+*   DESCRIPTION
+*
+*       Process host kernel launch batch command, and transmit response
+*       in case the batch could not be dispatched. Otherwise the KW
+*       transmits the aggregated response once the batch completes.
+*
+*   INPUTS
+*
+*       command_buffer   Buffer containing command to process
+*       sqw_idx          Submission queue index
+*       start_cycle      Cycle count to measure wait latency
+*
+*   OUTPUTS
+*
+*       int32_t           Successful status or error code.
+*
+***********************************************************************/
+static inline int32_t kernel_launch_batch_cmd_handler(
+    void *command_buffer, uint8_t sqw_idx, uint64_t start_cycles)
+{
+    const struct device_ops_kernel_launch_batch_cmd_t *cmd =
+        (struct device_ops_kernel_launch_batch_cmd_t *)command_buffer;
+    uint8_t kw_idx;
+    execution_cycles_t cycles;
+    int32_t status = STATUS_SUCCESS;
+
+    TRACE_LOG_CMD_STATUS(DEV_OPS_API_MID_DEVICE_OPS_KERNEL_LAUNCH_BATCH_CMD, sqw_idx,
+        cmd->command_info.cmd_hdr.tag_id, CMD_STATUS_RECEIVED)
+
+    Log_Write(LOG_LEVEL_DEBUG,
+        "TID[%u]:SQW[%d]:HostCommandHandler:Processing:KERNEL_LAUNCH_BATCH_CMD\r\n",
+        cmd->command_info.cmd_hdr.tag_id, sqw_idx);
+
+    /* Get the SQW state to check for command abort */
+    if (SQW_Get_State(sqw_idx) == SQW_STATE_ABORTED)
+    {
+        status = HOST_CMD_STATUS_ABORTED;
+    }
+
+    if (status == STATUS_SUCCESS)
+    {
+        /* Blocking call to launch the first kernel of the batch */
+        status = KW_Dispatch_Kernel_Launch_Batch_Cmd(cmd, sqw_idx, &kw_idx);
+    }
+
+    /* Compute Wait Cycles (cycles the command waits to
+    launch on Compute Minions) Snapshot current cycle */
+    cycles.cmd_start_cycles = start_cycles;
+    cycles.wait_cycles = PMC_GET_LATENCY(start_cycles);
+    cycles.exec_start_cycles = PMC_Get_Current_Cycles();
+
+    if (status == STATUS_SUCCESS)
+    {
+        /* Notify kernel worker to chain the remaining launches, and construct
+        and transmit the aggregated response to host completion queue */
+        KW_Notify(kw_idx, &cycles);
+
+        Log_Write(LOG_LEVEL_DEBUG, "TID[%u]:SQW[%d]:KW[%d]:HostCommandHandler:Notified\r\n",
+            cmd->command_info.cmd_hdr.tag_id, sqw_idx, kw_idx);
+    }
+    else
+    {
+        char kernel_fail_msg[8] = "Failed\0";
+        kernel_fail_msg[sizeof(kernel_fail_msg) - 1] = 0;
+
+        /* No launch was executed, so the response carries no per launch results */
+        struct device_ops_kernel_launch_batch_rsp_t rsp = { 0 };
+
+        /* Construct and transit command response */
+        rsp.response_info.rsp_hdr.tag_id = cmd->command_info.cmd_hdr.tag_id;
+        rsp.response_info.rsp_hdr.msg_id = DEV_OPS_API_MID_DEVICE_OPS_KERNEL_LAUNCH_BATCH_RSP;
+        rsp.device_cmd_start_ts = start_cycles;
+        rsp.device_cmd_wait_dur = cycles.wait_cycles;
+        rsp.device_cmd_execute_dur = 0U;
+        rsp.num_results = 0U;
+
+        /* Map device internal errors onto device api errors */
+        KERNEL_LAUNCH_TO_DEVICEAPI_STATUS(status, rsp.status, kernel_fail_msg)
+
+        Log_Write(LOG_LEVEL_ERROR, "TID[%u]:SQW[%d]:HostCmdHdlr:KernelLaunchBatch:%s Status:%d\r\n",
+            cmd->command_info.cmd_hdr.tag_id, sqw_idx, kernel_fail_msg, status);
+
+#if TEST_FRAMEWORK
+        /* For SP2MM command response, we need to provide the total size = header + payload */
+        rsp.response_info.rsp_hdr.size = sizeof(rsp);
+        status = SP_Iface_Push_Rsp_To_SP2MM_CQ(&rsp, sizeof(rsp));
+#else
+        rsp.response_info.rsp_hdr.size = (uint16_t)(sizeof(rsp) - sizeof(struct cmn_header_t));
+        status = Host_Iface_CQ_Push_Cmd(0, &rsp, sizeof(rsp));
+#endif
+        /* Check for abort status for trace logging.
+        Since we are in failure path, we will ignore CQ push status for logging to trace. */
+        if (rsp.status == DEV_OPS_API_KERNEL_LAUNCH_RESPONSE_HOST_ABORTED)
+        {
+            TRACE_LOG_CMD_STATUS(DEV_OPS_API_MID_DEVICE_OPS_KERNEL_LAUNCH_BATCH_CMD, sqw_idx,
+                cmd->command_info.cmd_hdr.tag_id, CMD_STATUS_ABORTED)
+        }
+        else
+        {
+            TRACE_LOG_CMD_STATUS(DEV_OPS_API_MID_DEVICE_OPS_KERNEL_LAUNCH_BATCH_CMD, sqw_idx,
+                cmd->command_info.cmd_hdr.tag_id, CMD_STATUS_FAILED)
+        }
+
+        if (status == STATUS_SUCCESS)
+        {
+            Log_Write(LOG_LEVEL_DEBUG,
+                "TID[%u]:SQW[%d]:HostCommandHandler:Pushed:KERNEL_LAUNCH_BATCH_CMD_RSP->Host_CQ\r\n",
+                cmd->command_info.cmd_hdr.tag_id, sqw_idx);
+        }
+        else
+        {
+            Log_Write(LOG_LEVEL_ERROR,
+                "TID[%u]:SQW[%d]:HostCommandHandler:HostIface:Push:Failed\r\n",
+                cmd->command_info.cmd_hdr.tag_id, sqw_idx);
+            SP_Iface_Report_Error(MM_RECOVERABLE_FW_MM_SQW_ERROR, MM_CQ_PUSH_ERROR);
+        }
+
+#if !TEST_FRAMEWORK
+        /* Decrement commands count being processed by given SQW */
+        SQW_Decrement_Command_Count(sqw_idx);
+
+        /* Report device API error to SP */
+        SP_Iface_Report_Error(MM_RECOVERABLE_OPS_API_KERNEL_LAUNCH, (int16_t)rsp.status);
+#endif
+    }
+
+    return status;
+}
+
+/************************************************************************
+*
+*   FUNCTION
+*
+*       mem_op_cmd_handler
+*
+*   DESCRIPTION
+*
+*       Process host memset or local memcpy command, and transmit response
+*       in case the command could not be dispatched. Otherwise the KW
+*       transmits the response once the compute minions are done.
+*
+*   INPUTS
+*
+*       command_buffer   Buffer containing command to process
+*       sqw_idx          Submission queue index
+*       start_cycle      Cycle count to measure wait latency
+*
+*   OUTPUTS
+*
+*       int32_t           Successful status or error code.
+*
+***********************************************************************/
+static inline int32_t mem_op_cmd_handler(
+    void *command_buffer, uint8_t sqw_idx, uint64_t start_cycles)
+{
+    const struct cmd_header_t *cmd = (struct cmd_header_t *)command_buffer;
+    uint8_t kw_idx;
+    execution_cycles_t cycles;
+    int32_t status = STATUS_SUCCESS;
+
+    TRACE_LOG_CMD_STATUS(
+        cmd->cmd_hdr.msg_id, sqw_idx, cmd->cmd_hdr.tag_id, CMD_STATUS_RECEIVED)
+
+    Log_Write(LOG_LEVEL_DEBUG, "TID[%u]:SQW[%d]:HostCommandHandler:Processing:MEM_OP_CMD:%d\r\n",
+        cmd->cmd_hdr.tag_id, sqw_idx, cmd->cmd_hdr.msg_id);
+
+    /* Verify the command size, memset and local memcpy commands have no optional payload */
+    if (((cmd->cmd_hdr.msg_id == DEV_OPS_API_MID_DEVICE_OPS_MEMSET_CMD) &&
+            (cmd->cmd_hdr.size < sizeof(struct device_ops_memset_cmd_t))) ||
+        ((cmd->cmd_hdr.msg_id == DEV_OPS_API_MID_DEVICE_OPS_MEMCPY_LOCAL_CMD) &&
+            (cmd->cmd_hdr.size < sizeof(struct device_ops_memcpy_local_cmd_t))))
+    {
+        status = KW_ERROR_MEM_OP_INVALID_SIZE;
+    }
+    /* Get the SQW state to check for command abort */
+    else if (SQW_Get_State(sqw_idx) == SQW_STATE_ABORTED)
+    {
+        status = HOST_CMD_STATUS_ABORTED;
+    }
+    else
+    {
+        /* Blocking call to dispatch the operation to the compute minions */
+        status = KW_Dispatch_Mem_Op_Cmd(cmd, sqw_idx, &kw_idx);
+    }
+
+    /* Compute Wait Cycles (cycles the command waits to
+    launch on Compute Minions) Snapshot current cycle */
+    cycles.cmd_start_cycles = start_cycles;
+    cycles.wait_cycles = PMC_GET_LATENCY(start_cycles);
+    cycles.exec_start_cycles = PMC_Get_Current_Cycles();
+
+    if (status == STATUS_SUCCESS)
+    {
+        /* Notify kernel worker to wait for completion, and construct
+        and transmit the response to host completion queue */
+        KW_Notify(kw_idx, &cycles);
+
+        Log_Write(LOG_LEVEL_DEBUG, "TID[%u]:SQW[%d]:KW[%d]:HostCommandHandler:Notified\r\n",
+            cmd->cmd_hdr.tag_id, sqw_idx, kw_idx);
+    }
+    else
+    {
+        char mem_op_fail_msg[8] = "Failed\0";
+        mem_op_fail_msg[sizeof(mem_op_fail_msg) - 1] = 0;
+
+        /* Memset and local memcpy responses share the same layout */
+        struct device_ops_memset_rsp_t rsp;
+
+        /* Construct and transit command response */
+        rsp.response_info.rsp_hdr.tag_id = cmd->cmd_hdr.tag_id;
+        rsp.response_info.rsp_hdr.msg_id =
+            (cmd->cmd_hdr.msg_id == DEV_OPS_API_MID_DEVICE_OPS_MEMSET_CMD) ?
+                DEV_OPS_API_MID_DEVICE_OPS_MEMSET_RSP :
+                DEV_OPS_API_MID_DEVICE_OPS_MEMCPY_LOCAL_RSP;
+        rsp.device_cmd_start_ts = start_cycles;
+        rsp.device_cmd_wait_dur = cycles.wait_cycles;
+        rsp.device_cmd_execute_dur = 0U;
+        rsp.pad = 0;
+
+        /* Map device internal errors onto device api errors */
+        MEM_OP_TO_DEVICEAPI_STATUS(status, rsp.status, mem_op_fail_msg)
+
+        Log_Write(LOG_LEVEL_ERROR, "TID[%u]:SQW[%d]:HostCmdHdlr:MemOp:%s Status:%d\r\n",
+            cmd->cmd_hdr.tag_id, sqw_idx, mem_op_fail_msg, status);
+
+#if TEST_FRAMEWORK
+        /* For SP2MM command response, we need to provide the total size = header + payload */
+        rsp.response_info.rsp_hdr.size = sizeof(rsp);
+        status = SP_Iface_Push_Rsp_To_SP2MM_CQ(&rsp, sizeof(rsp));
+#else
+        rsp.response_info.rsp_hdr.size = (uint16_t)(sizeof(rsp) - sizeof(struct cmn_header_t));
+        status = Host_Iface_CQ_Push_Cmd(0, &rsp, sizeof(rsp));
+#endif
+        /* Check for abort status for trace logging.
+        Since we are in failure path, we will ignore CQ push status for logging to trace. */
+        if (rsp.status == DEV_OPS_API_MEM_OP_RESPONSE_HOST_ABORTED)
+        {
+            TRACE_LOG_CMD_STATUS(
+                cmd->cmd_hdr.msg_id, sqw_idx, cmd->cmd_hdr.tag_id, CMD_STATUS_ABORTED)
+        }
+        else
+        {
+            TRACE_LOG_CMD_STATUS(
+                cmd->cmd_hdr.msg_id, sqw_idx, cmd->cmd_hdr.tag_id, CMD_STATUS_FAILED)
+        }
+
+        if (status == STATUS_SUCCESS)
+        {
+            Log_Write(LOG_LEVEL_DEBUG,
+                "TID[%u]:SQW[%d]:HostCommandHandler:Pushed:MEM_OP_CMD_RSP->Host_CQ\r\n",
+                cmd->cmd_hdr.tag_id, sqw_idx);
+        }
+        else
+        {
+            Log_Write(LOG_LEVEL_ERROR,
+                "TID[%u]:SQW[%d]:HostCommandHandler:HostIface:Push:Failed\r\n",
+                cmd->cmd_hdr.tag_id, sqw_idx);
+            SP_Iface_Report_Error(MM_RECOVERABLE_FW_MM_SQW_ERROR, MM_CQ_PUSH_ERROR);
+        }
+
+#if !TEST_FRAMEWORK
+        /* Decrement commands count being processed by given SQW */
+        SQW_Decrement_Command_Count(sqw_idx);
+
+        /* Report device API error to SP */
+        SP_Iface_Report_Error(MM_RECOVERABLE_OPS_API_MEM_OP, (int16_t)rsp.status);
+#endif
+    }
+
+    return status;
+}
+
 /************************************************************************
 *
 *   FUNCTION
@@ -2192,9 +2520,16 @@ int32_t Host_Command_Handler(void *command_buffer, uint8_t sqw_idx, uint64_t sta
         case DEV_OPS_API_MID_DEVICE_OPS_KERNEL_LAUNCH_CMD:
             status = kernel_launch_cmd_handler(command_buffer, sqw_idx, start_cycles);
             break;
+        case DEV_OPS_API_MID_DEVICE_OPS_KERNEL_LAUNCH_BATCH_CMD:
+            status = kernel_launch_batch_cmd_handler(command_buffer, sqw_idx, start_cycles);
+            break;
         case DEV_OPS_API_MID_DEVICE_OPS_KERNEL_ABORT_CMD:
             status = kernel_abort_cmd_handler(command_buffer, sqw_idx);
             break;
+        case DEV_OPS_API_MID_DEVICE_OPS_MEMSET_CMD:
+        case DEV_OPS_API_MID_DEVICE_OPS_MEMCPY_LOCAL_CMD:
+            status = mem_op_cmd_handler(command_buffer, sqw_idx, start_cycles);
+            break;
         case DEV_OPS_API_MID_DEVICE_OPS_DMA_READLIST_CMD:
         case DEV_OPS_API_MID_DEVICE_OPS_P2PDMA_READLIST_CMD:
             status = dma_readlist_cmd_handler(command_buffer, sqw_idx, start_cycles);
@@ -20,6 +20,7 @@
         KW_Notify
         KW_Launch
         KW_Dispatch_Kernel_Launch_Cmd
+        KW_Dispatch_Kernel_Launch_Batch_Cmd
         KW_Dispatch_Kernel_Abort_Cmd
         KW_Abort_All_Dispatched_Kernels
         KW_Get_Average_Exec_Cycles
@@ -156,10 +157,32 @@ typedef struct kernel_instance_ {
     uint64_t umode_trace_buffer_ptr;
     uint32_t kernel_state;
     tag_id_t launch_tag_id;
+    uint16_t mem_op_cmd_id; /* Memset or local memcpy command ID, zero for a kernel launch */
     uint8_t sqw_idx;
     uint8_t cm_abort_wait_timeout_flag;
 } kernel_instance_t;
 
+/*! \typedef kw_batch_node_t
+    \brief One kernel launch of a kernel launch batch, as copied from the command.
+*/
+typedef struct kw_batch_node_ {
+    uint64_t code_start_address;
+    uint64_t pointer_to_args;
+    uint64_t shire_mask;
+} kw_batch_node_t;
+
+/*! \typedef kw_batch_t
+    \brief Kernel launch batch associated with a kernel slot.
+    Filled by the SQW at dispatch and consumed by the KW which chains
+    the launches. num_nodes is zero for a single kernel launch.
+*/
+typedef struct kw_batch_ {
+    kw_batch_node_t nodes[DEVICE_OPS_KERNEL_LAUNCH_BATCH_NODES_MAX];
+    uint64_t reserved_shire_mask; /* Union of the shire masks of all the launches */
+    uint16_t num_nodes;
+    uint16_t cmd_flags;
+} kw_batch_t;
+
 /*! \typedef kw_cb_t
     \brief Kernel Worker Control Block structure.
     Used to maintain kernel instance and related resources
@@ -170,6 +193,7 @@ typedef CACHE_STRUCT({
     fcc_sync_cb_t host2kw[MM_MAX_PARALLEL_KERNELS];
     spinlock_t resource_lock;
     kernel_instance_t kernels[MM_MAX_PARALLEL_KERNELS];
+    kw_batch_t batches[MM_MAX_PARALLEL_KERNELS];
     uint32_t launch_wait_timeout_flag[SQW_NUM];
 }) kw_cb_t;
 
@@ -962,6 +986,439 @@ int32_t KW_Dispatch_Kernel_Launch_Cmd(
     return status;
 }
 
+/************************************************************************
+*
+*   FUNCTION
+*
+*       kw_batch_launch_node
+*
+*   DESCRIPTION
+*
+*       Local fn helper to launch one kernel of a kernel launch batch on
+*       the compute minions. The kernel slot and the shires of the whole
+*       batch must already be reserved.
+*
+*   INPUTS
+*
+*       slot_index  Index of the kernel slot owning the batch
+*       node_index  Index of the launch within the batch
+*
+*   OUTPUTS
+*
+*       int32_t      status success or error
+*
+***********************************************************************/
+static int32_t kw_batch_launch_node(uint8_t slot_index, uint16_t node_index)
+{
+    kernel_instance_t *const kernel = &KW_CB.kernels[slot_index];
+    kw_batch_t *const batch = &KW_CB.batches[slot_index];
+    mm_to_cm_message_kernel_launch_t launch_args = { 0 };
+    uint64_t shire_mask = atomic_load_local_64(&batch->nodes[node_index].shire_mask);
+
+    /* Populate the kernel launch CM msg params */
+    launch_args.header.id = MM_TO_CM_MESSAGE_ID_KERNEL_LAUNCH;
+    launch_args.header.tag_id = atomic_load_local_16(&kernel->launch_tag_id);
+    launch_args.header.flags = CM_IFACE_FLAG_ASYNC_CMD;
+    launch_args.kernel.kw_base_id = (uint8_t)KW_MS_BASE_HART;
+    launch_args.kernel.slot_index = slot_index;
+    launch_args.kernel.code_start_address =
+        atomic_load_local_64(&batch->nodes[node_index].code_start_address);
+    launch_args.kernel.pointer_to_args =
+        atomic_load_local_64(&batch->nodes[node_index].pointer_to_args);
+    launch_args.kernel.shire_mask = shire_mask;
+    launch_args.kernel.exception_buffer = atomic_load_local_64(&kernel->umode_exception_buffer_ptr);
+
+    /* If the flag bit flush L3 is set, it applies to every launch of the batch */
+    if (atomic_load_local_16(&batch->cmd_flags) & CMD_FLAGS_KERNEL_LAUNCH_FLUSH_L3)
+    {
+        launch_args.kernel.flags |= KERNEL_LAUNCH_FLAGS_EVICT_L3_BEFORE_LAUNCH;
+    }
+
+    /* Setup kernel environment shire mask */
+    KW_INIT_KERNEL_ENV_SHIRE_MASK(slot_index, shire_mask)
+
+    /* Abort and completion processing target the shires of the current launch */
+    atomic_store_local_64(&kernel->kernel_shire_mask, shire_mask);
+
+    /* Reset the L2 SCP kernel launched flag for the kernel slot */
+    atomic_store_global_32(&CM_KERNEL_LAUNCHED_FLAG[slot_index].flag, 0);
+
+    /* Blocking call that blocks till all shires ack command */
+    return CM_Iface_Multicast_Send(shire_mask, (cm_iface_message_t *)&launch_args);
+}
+
+/************************************************************************
+*
+*   FUNCTION
+*
+*       KW_Dispatch_Kernel_Launch_Batch_Cmd
+*
+*   DESCRIPTION
+*
+*       KW Dispatch Kernel launch batch command. All the launches are
+*       verified and their shires reserved up-front, then the first one
+*       is launched. The KW chains the remaining ones as each completes.
+*
+*   INPUTS
+*
+*       cmd         Kernel launch batch command
+*       sqw_idx     Submission queue index
+*       kw_idx      Pointer to get kernel work index (slot number)
+*
+*   OUTPUTS
+*
+*       int32_t      status success or error
+*
+***********************************************************************/
+int32_t KW_Dispatch_Kernel_Launch_Batch_Cmd(
+    const struct device_ops_kernel_launch_batch_cmd_t *cmd, uint8_t sqw_idx, uint8_t *kw_idx)
+{
+    kernel_instance_t *kernel = 0;
+    kw_batch_t *batch;
+    uint64_t reserved_shire_mask = 0;
+    int32_t status = STATUS_SUCCESS;
+    uint8_t slot_index;
+    uint16_t num_nodes = (uint16_t)((cmd->command_info.cmd_hdr.size - sizeof(*cmd)) /
+                                    sizeof(struct kernel_launch_batch_node));
+
+    /* Verify the number of launches */
+    if ((cmd->command_info.cmd_hdr.size < sizeof(*cmd)) || (num_nodes == 0) ||
+        (num_nodes > DEVICE_OPS_KERNEL_LAUNCH_BATCH_NODES_MAX))
+    {
+        Log_Write(LOG_LEVEL_ERROR, "TID[%u]:SQW[%d]:KW:ERROR:Invalid batch size:Size:%d\r\n",
+            cmd->command_info.cmd_hdr.tag_id, sqw_idx, cmd->command_info.cmd_hdr.size);
+        return KW_ERROR_KERNEL_INVALID_BATCH_SIZE;
+    }
+
+    if (!kw_check_address_bounds(cmd->exception_buffer, true))
+    {
+        status = KW_ERROR_KERNEL_INVALID_ADDRESS;
+    }
+
+    /* Verify all the launches before starting the chain */
+    for (uint16_t i = 0; (i < num_nodes) && (status == STATUS_SUCCESS); i++)
+    {
+        const struct kernel_launch_batch_node *node = &cmd->list[i];
+
+        if (node->shire_mask == 0)
+        {
+            Log_Write(LOG_LEVEL_ERROR,
+                "TID[%u]:SQW[%d]:KW:ERROR:Invalid Shire Mask:Launch:%d:0x%lx\r\n",
+                cmd->command_info.cmd_hdr.tag_id, sqw_idx, i, node->shire_mask);
+            status = KW_ERROR_KERNEL_INVALID_SHIRE_MASK;
+        }
+        else if (!kw_check_address_bounds(node->code_start_address, false) ||
+                 !kw_check_address_bounds(node->pointer_to_args, true))
+        {
+            Log_Write(LOG_LEVEL_ERROR, "TID[%u]:SQW[%d]:KW:ERROR:Invalid Address:Launch:%d\r\n",
+                cmd->command_info.cmd_hdr.tag_id, sqw_idx, i);
+            status = KW_ERROR_KERNEL_INVALID_ADDRESS;
+        }
+        else
+        {
+            reserved_shire_mask |= node->shire_mask;
+        }
+    }
+
+    if (status == STATUS_SUCCESS)
+    {
+        /* Reserve a slot for the batch */
+        status =
+            kw_reserve_kernel_slot(sqw_idx, cmd->command_info.cmd_hdr.tag_id, &slot_index, &kernel);
+    }
+
+    if (status == STATUS_SUCCESS)
+    {
+        /* Reserve the shires of all the launches for the lifetime of the batch,
+        so that the chain never waits on shires used by other kernels */
+        status = kw_reserve_kernel_shires(
+            sqw_idx, cmd->command_info.cmd_hdr.tag_id, reserved_shire_mask);
+
+        if (status != STATUS_SUCCESS)
+        {
+            /* Make reserved kernel slot available again */
+            kw_unreserve_kernel_slot(kernel);
+        }
+    }
+
+    if (status == STATUS_SUCCESS)
+    {
+        batch = &KW_CB.batches[slot_index];
+
+        /* Copy the launches to the KW CB, the command buffer is not valid after dispatch */
+        for (uint16_t i = 0; i < num_nodes; i++)
+        {
+            atomic_store_local_64(
+                &batch->nodes[i].code_start_address, cmd->list[i].code_start_address);
+            atomic_store_local_64(&batch->nodes[i].pointer_to_args, cmd->list[i].pointer_to_args);
+            atomic_store_local_64(&batch->nodes[i].shire_mask, cmd->list[i].shire_mask);
+        }
+        atomic_store_local_64(&batch->reserved_shire_mask, reserved_shire_mask);
+        atomic_store_local_16(&batch->cmd_flags, cmd->command_info.cmd_hdr.flags);
+        atomic_store_local_16(&batch->num_nodes, num_nodes);
+
+        /* Populate the tag_id, sqw_idx and buffers for KW */
+        atomic_store_local_16(&kernel->launch_tag_id, cmd->command_info.cmd_hdr.tag_id);
+        atomic_store_local_8(&kernel->sqw_idx, sqw_idx);
+        atomic_store_local_64(&kernel->umode_exception_buffer_ptr, cmd->exception_buffer);
+        atomic_store_local_64(&kernel->umode_trace_buffer_ptr, 0);
+
+        TRACE_LOG_CMD_STATUS(DEV_OPS_API_MID_DEVICE_OPS_KERNEL_LAUNCH_BATCH_CMD, sqw_idx,
+            cmd->command_info.cmd_hdr.tag_id, CMD_STATUS_EXECUTING)
+
+        /* Launch the first kernel of the chain */
+        status = kw_batch_launch_node(slot_index, 0);
+
+        if (status == STATUS_SUCCESS)
+        {
+            /* Mark the kernel slot in use since the kernel is launched */
+            atomic_store_local_32(&kernel->kernel_state, KERNEL_STATE_IN_USE);
+            *kw_idx = slot_index;
+        }
+        else
+        {
+            Log_Write(LOG_LEVEL_ERROR,
+                "TID[%u]:SQW[%d]:KW:ERROR:MM2CMLaunchBatch:CommandMulticast:Failed:Status:%d\r\n",
+                cmd->command_info.cmd_hdr.tag_id, sqw_idx, status);
+
+            /* Broadcast message failed. Reclaim resources */
+            atomic_store_local_16(&batch->num_nodes, 0);
+            kw_unreserve_kernel_shires(reserved_shire_mask);
+            kw_unreserve_kernel_slot(kernel);
+
+            SP_Iface_Report_Error(
+                MM_RECOVERABLE_FW_MM_KW_ERROR, MM_CM_MULTICAST_KERNEL_LAUNCH_ERROR);
+            status = KW_ERROR_CM_IFACE_MULTICAST_FAILED;
+        }
+    }
+
+    return status;
+}
+
+/************************************************************************
+*
+*   FUNCTION
+*
+*       kw_verify_mem_op_cmd
+*
+*   DESCRIPTION
+*
+*       Local fn helper to verify a memset or local memcpy command and to
+*       populate the corresponding CM memory operation message.
+*
+*   INPUTS
+*
+*       cmd         Memset or local memcpy command
+*       sqw_idx     Submission queue index
+*       mem_op      Pointer to the CM memory operation message to populate
+*
+*   OUTPUTS
+*
+*       int32_t      status success or error
+*
+***********************************************************************/
+static int32_t kw_verify_mem_op_cmd(
+    const struct cmd_header_t *cmd, uint8_t sqw_idx, mm_to_cm_message_mem_op_t *mem_op)
+{
+    int32_t status = STATUS_SUCCESS;
+
+    if (cmd->cmd_hdr.msg_id == DEV_OPS_API_MID_DEVICE_OPS_MEMSET_CMD)
+    {
+        const struct device_ops_memset_cmd_t *memset_cmd =
+            (const struct device_ops_memset_cmd_t *)(const void *)cmd;
+
+        mem_op->type = MEM_OP_TYPE_MEMSET;
+        mem_op->dst_address = memset_cmd->dst_device_phy_addr;
+        mem_op->size = memset_cmd->size;
+        mem_op->shire_mask = memset_cmd->shire_mask;
+
+        /* Replicate the pattern to 32 bits, so that the CMs do not depend on its size */
+        if (memset_cmd->pattern_size == 1)
+        {
+            mem_op->pattern = (memset_cmd->pattern & 0xFFU) * 0x01010101U;
+        }
+        else if (memset_cmd->pattern_size == 2)
+        {
+            mem_op->pattern = (memset_cmd->pattern & 0xFFFFU) * 0x00010001U;
+        }
+        else if (memset_cmd->pattern_size == 4)
+        {
+            mem_op->pattern = memset_cmd->pattern;
+        }
+        else
+        {
+            Log_Write(LOG_LEVEL_ERROR, "TID[%u]:SQW[%d]:KW:ERROR:Invalid Pattern Size:%d\r\n",
+                cmd->cmd_hdr.tag_id, sqw_idx, memset_cmd->pattern_size);
+            return KW_ERROR_MEM_OP_INVALID_PATTERN_SIZE;
+        }
+
+        if ((mem_op->size == 0) || ((mem_op->size % memset_cmd->pattern_size) != 0))
+        {
+            status = KW_ERROR_MEM_OP_INVALID_SIZE;
+        }
+        /* The pattern is laid out relative to its natural alignment */
+        else if ((mem_op->dst_address % memset_cmd->pattern_size) != 0)
+        {
+            status = KW_ERROR_KERNEL_INVALID_ADDRESS;
+        }
+    }
+    else
+    {
+        const struct device_ops_memcpy_local_cmd_t *memcpy_cmd =
+            (const struct device_ops_memcpy_local_cmd_t *)(const void *)cmd;
+
+        mem_op->type = MEM_OP_TYPE_MEMCPY;
+        mem_op->dst_address = memcpy_cmd->dst_device_phy_addr;
+        mem_op->src_address = memcpy_cmd->src_device_phy_addr;
+        mem_op->size = memcpy_cmd->size;
+        mem_op->shire_mask = memcpy_cmd->shire_mask;
+
+        if (mem_op->size == 0)
+        {
+            status = KW_ERROR_MEM_OP_INVALID_SIZE;
+        }
+        /* The source must be in bounds and must not overlap the destination */
+        else if ((mem_op->src_address + mem_op->size < mem_op->src_address) ||
+                 !kw_check_address_bounds(mem_op->src_address, false) ||
+                 !kw_check_address_bounds(mem_op->src_address + mem_op->size - 1U, false) ||
+                 ((mem_op->src_address < (mem_op->dst_address + mem_op->size)) &&
+                     (mem_op->dst_address < (mem_op->src_address + mem_op->size))))
+        {
+            status = KW_ERROR_KERNEL_INVALID_ADDRESS;
+        }
+    }
+
+    if ((status == STATUS_SUCCESS) &&
+        ((mem_op->dst_address + mem_op->size < mem_op->dst_address) ||
+            !kw_check_address_bounds(mem_op->dst_address, false) ||
+            !kw_check_address_bounds(mem_op->dst_address + mem_op->size - 1U, false)))
+    {
+        status = KW_ERROR_KERNEL_INVALID_ADDRESS;
+    }
+
+    if (status == STATUS_SUCCESS)
+    {
+        if (mem_op->shire_mask == 0)
+        {
+            status = KW_ERROR_KERNEL_INVALID_SHIRE_MASK;
+        }
+    }
+    else
+    {
+        Log_Write(LOG_LEVEL_ERROR,
+            "TID[%u]:SQW[%d]:KW:ERROR:Invalid MemOp:Dst:0x%lx:Src:0x%lx:Size:0x%lx\r\n",
+            cmd->cmd_hdr.tag_id, sqw_idx, mem_op->dst_address, mem_op->src_address,
+            mem_op->size);
+    }
+
+    return status;
+}
+
+/************************************************************************
+*
+*   FUNCTION
+*
+*       KW_Dispatch_Mem_Op_Cmd
+*
+*   DESCRIPTION
+*
+*       KW Dispatch memset or local memcpy command. The operation uses a
+*       kernel slot like a kernel launch, but the CMs run their built-in
+*       memory routine instead of a user kernel.
+*
+*   INPUTS
+*
+*       cmd         Memset or local memcpy command
+*       sqw_idx     Submission queue index
+*       kw_idx      Pointer to get kernel work index (slot number)
+*
+*   OUTPUTS
+*
+*       int32_t      status success or error
+*
+***********************************************************************/
+int32_t KW_Dispatch_Mem_Op_Cmd(const struct cmd_header_t *cmd, uint8_t sqw_idx, uint8_t *kw_idx)
+{
+    kernel_instance_t *kernel = 0;
+    mm_to_cm_message_mem_op_t mem_op = { 0 };
+    int32_t status;
+    uint8_t slot_index;
+
+    status = kw_verify_mem_op_cmd(cmd, sqw_idx, &mem_op);
+
+    if (status == STATUS_SUCCESS)
+    {
+        /* Reserve a slot for the memory operation */
+        status = kw_reserve_kernel_slot(sqw_idx, cmd->cmd_hdr.tag_id, &slot_index, &kernel);
+    }
+
+    if (status == STATUS_SUCCESS)
+    {
+        /* Reserve compute shires needed for the memory operation */
+        status = kw_reserve_kernel_shires(sqw_idx, cmd->cmd_hdr.tag_id, mem_op.shire_mask);
+
+        if (status != STATUS_SUCCESS)
+        {
+            /* Make reserved kernel slot available again */
+            kw_unreserve_kernel_slot(kernel);
+        }
+    }
+
+    if (status == STATUS_SUCCESS)
+    {
+        /* Populate the CM memory operation msg params */
+        mem_op.header.id = MM_TO_CM_MESSAGE_ID_MEM_OP;
+        mem_op.header.tag_id = cmd->cmd_hdr.tag_id;
+        mem_op.header.flags = CM_IFACE_FLAG_ASYNC_CMD;
+        mem_op.kw_base_id = (uint8_t)KW_MS_BASE_HART;
+        mem_op.slot_index = slot_index;
+
+        /* Setup kernel environment shire mask, used by the CMs to synchronize */
+        KW_INIT_KERNEL_ENV_SHIRE_MASK(slot_index, mem_op.shire_mask)
+
+        /* Populate the tag_id, sqw_idx and command type for KW */
+        atomic_store_local_64(&kernel->kernel_shire_mask, mem_op.shire_mask);
+        atomic_store_local_16(&kernel->launch_tag_id, cmd->cmd_hdr.tag_id);
+        atomic_store_local_16(&kernel->mem_op_cmd_id, cmd->cmd_hdr.msg_id);
+        atomic_store_local_8(&kernel->sqw_idx, sqw_idx);
+        atomic_store_local_64(&kernel->umode_exception_buffer_ptr, 0);
+        atomic_store_local_64(&kernel->umode_trace_buffer_ptr, 0);
+
+        /* Reset the L2 SCP kernel launched flag for the acquired kernel worker slot */
+        atomic_store_global_32(&CM_KERNEL_LAUNCHED_FLAG[slot_index].flag, 0);
+
+        TRACE_LOG_CMD_STATUS(cmd->cmd_hdr.msg_id, sqw_idx, cmd->cmd_hdr.tag_id,
+            CMD_STATUS_EXECUTING)
+
+        /* Blocking call that blocks till all shires ack command */
+        status = CM_Iface_Multicast_Send(mem_op.shire_mask, (cm_iface_message_t *)&mem_op);
+
+        if (status == STATUS_SUCCESS)
+        {
+            /* Mark the kernel slot in use since the operation is launched */
+            atomic_store_local_32(&kernel->kernel_state, KERNEL_STATE_IN_USE);
+            *kw_idx = slot_index;
+        }
+        else
+        {
+            Log_Write(LOG_LEVEL_ERROR,
+                "TID[%u]:SQW[%d]:KW:ERROR:MM2CMMemOp:CommandMulticast:Failed:Status:%d\r\n",
+                cmd->cmd_hdr.tag_id, sqw_idx, status);
+
+            /* Broadcast message failed. Reclaim resources */
+            atomic_store_local_16(&kernel->mem_op_cmd_id, 0);
+            kw_unreserve_kernel_shires(mem_op.shire_mask);
+            kw_unreserve_kernel_slot(kernel);
+
+            SP_Iface_Report_Error(
+                MM_RECOVERABLE_FW_MM_KW_ERROR, MM_CM_MULTICAST_KERNEL_LAUNCH_ERROR);
+            status = KW_ERROR_CM_IFACE_MULTICAST_FAILED;
+        }
+    }
+
+    return status;
+}
+
 /************************************************************************
 *
 *   FUNCTION
@@ -1487,6 +1944,329 @@ static inline uint32_t kw_get_kernel_launch_completion_status(
     return status;
 }
 
+/************************************************************************
+*
+*   FUNCTION
+*
+*       kw_batch_chain_next_launch
+*
+*   DESCRIPTION
+*
+*       Helper function to record the result of the current launch of a
+*       kernel launch batch, and to launch the next one if the current
+*       launch completed and the batch was not aborted.
+*
+*   INPUTS
+*
+*       kw_idx              Index of kernel worker
+*       launch_status       Completion status of the current launch, updated
+*                           with the status of the next launch if it fails
+*                           to start
+*       num_nodes           Number of launches in the batch
+*       node_index          Index of the current launch, updated on chaining
+*       launch_start_cycles Start cycles of the current launch, updated on chaining
+*       results             Per launch results of the batch
+*
+*   OUTPUTS
+*
+*       bool                True if the next launch was started
+*
+***********************************************************************/
+static bool kw_batch_chain_next_launch(uint32_t kw_idx, uint32_t *launch_status, uint16_t num_nodes,
+    uint16_t *node_index, uint64_t *launch_start_cycles, struct kernel_launch_batch_result *results)
+{
+    kernel_instance_t *const kernel = &KW_CB.kernels[kw_idx];
+    struct kernel_launch_batch_result *result = &results[*node_index];
+    bool launched = false;
+
+    result->device_cmd_start_ts = *launch_start_cycles;
+    result->device_cmd_execute_dur = PMC_GET_LATENCY(*launch_start_cycles);
+
+    /* Accumlate kernel execution cycles. */
+    atomic_add_local_64(&kernel->kernel_exec_cycles, result->device_cmd_execute_dur);
+
+    /* Update kernel running time for stats Trace. Reporting unit is kernels/second */
+    STATW_Add_New_Sample_Atomically(STATW_RESOURCE_CM,
+        (STATW_Get_Minion_Freq() * 1000000UL / result->device_cmd_execute_dur));
+
+    /* Chain the next launch only if the current one completed and nobody aborted the batch */
+    if ((*launch_status == DEV_OPS_API_KERNEL_LAUNCH_RESPONSE_KERNEL_COMPLETED) &&
+        ((*node_index + 1U) < num_nodes) &&
+        (atomic_load_local_32(&kernel->kernel_state) == KERNEL_STATE_IN_USE))
+    {
+        (*node_index)++;
+        *launch_start_cycles = PMC_Get_Current_Cycles();
+
+        if (kw_batch_launch_node((uint8_t)kw_idx, *node_index) == STATUS_SUCCESS)
+        {
+            launched = true;
+        }
+        else
+        {
+            Log_Write(LOG_LEVEL_ERROR,
+                "TID[%u]:KW[%d]:ERROR:MM2CMLaunchBatch:CommandMulticast:Failed:Launch:%d\r\n",
+                atomic_load_local_16(&kernel->launch_tag_id), kw_idx, *node_index);
+            SP_Iface_Report_Error(
+                MM_RECOVERABLE_FW_MM_KW_ERROR, MM_CM_MULTICAST_KERNEL_LAUNCH_ERROR);
+
+            result = &results[*node_index];
+            result->device_cmd_start_ts = *launch_start_cycles;
+            result->device_cmd_execute_dur = 0;
+            *launch_status = DEV_OPS_API_KERNEL_LAUNCH_RESPONSE_CM_IFACE_MULTICAST_FAILED;
+        }
+    }
+
+    return launched;
+}
+
+/************************************************************************
+*
+*   FUNCTION
+*
+*       kw_batch_send_response
+*
+*   DESCRIPTION
+*
+*       Helper function to reclaim the resources of a completed kernel
+*       launch batch, and to transmit its aggregated response.
+*
+*   INPUTS
+*
+*       kw_idx          Index of kernel worker
+*       batch_rsp       Response with the per launch results filled in
+*       num_results     Number of launches executed
+*       launch_status   Completion status of the last executed launch
+*       status_internal Internal status of the last executed launch
+*
+*   OUTPUTS
+*
+*       None
+*
+***********************************************************************/
+static void kw_batch_send_response(uint32_t kw_idx,
+    struct device_ops_kernel_launch_batch_rsp_t *batch_rsp, uint16_t num_results,
+    uint32_t launch_status, const struct kw_internal_status *status_internal)
+{
+    kernel_instance_t *const kernel = &KW_CB.kernels[kw_idx];
+    kw_batch_t *const batch = &KW_CB.batches[kw_idx];
+    uint16_t rsp_size = (uint16_t)(sizeof(struct device_ops_kernel_launch_batch_rsp_t) +
+                                   (num_results * sizeof(struct kernel_launch_batch_result)));
+    uint8_t local_sqw_idx = atomic_load_local_8(&kernel->sqw_idx);
+    int32_t status;
+
+    /* Construct the aggregated response, the last executed launch gives the batch status */
+    batch_rsp->response_info.rsp_hdr.tag_id = atomic_load_local_16(&kernel->launch_tag_id);
+    batch_rsp->response_info.rsp_hdr.msg_id = DEV_OPS_API_MID_DEVICE_OPS_KERNEL_LAUNCH_BATCH_RSP;
+    batch_rsp->device_cmd_start_ts = atomic_load_local_64(&kernel->kw_cycles.cmd_start_cycles);
+    batch_rsp->device_cmd_wait_dur = atomic_load_local_64(&kernel->kw_cycles.wait_cycles);
+    batch_rsp->device_cmd_execute_dur =
+        PMC_GET_LATENCY(atomic_load_local_64(&kernel->kw_cycles.exec_start_cycles));
+    batch_rsp->status = launch_status;
+    batch_rsp->num_results = num_results;
+    batch_rsp->pad = 0;
+    memset(&batch_rsp->error_ptrs, 0, sizeof(batch_rsp->error_ptrs));
+
+    if (batch_rsp->status != DEV_OPS_API_KERNEL_LAUNCH_RESPONSE_KERNEL_COMPLETED)
+    {
+        /* Populate response with exception buffer pointer of the failing launch */
+        batch_rsp->error_ptrs.umode_exception_buffer_ptr =
+            atomic_load_local_64(&kernel->umode_exception_buffer_ptr);
+        batch_rsp->error_ptrs.cm_shire_mask = status_internal->cm_error_shire_mask;
+    }
+
+    /* Give back the compute shires reserved for the whole batch. */
+    kw_unreserve_kernel_shires(atomic_load_local_64(&batch->reserved_shire_mask));
+    atomic_store_local_16(&batch->num_nodes, 0);
+
+    /* Make reserved kernel slot available again */
+    kw_unreserve_kernel_slot(kernel);
+
+#if TEST_FRAMEWORK
+    /* For SP2MM command response, we need to provide the total size = header + payload */
+    batch_rsp->response_info.rsp_hdr.size = rsp_size;
+    /* Send kernel launch batch response to SP */
+    status = SP_Iface_Push_Rsp_To_SP2MM_CQ(batch_rsp, rsp_size);
+#else
+    batch_rsp->response_info.rsp_hdr.size = (uint16_t)(rsp_size - sizeof(struct cmn_header_t));
+    /* Send kernel launch batch response to host */
+    status = Host_Iface_CQ_Push_Cmd(0, batch_rsp, rsp_size);
+#endif
+
+    if (status == STATUS_SUCCESS)
+    {
+        /* Log to command status to trace */
+        if (batch_rsp->status == DEV_OPS_API_KERNEL_LAUNCH_RESPONSE_KERNEL_COMPLETED)
+        {
+            TRACE_LOG_CMD_STATUS(DEV_OPS_API_MID_DEVICE_OPS_KERNEL_LAUNCH_BATCH_CMD, local_sqw_idx,
+                batch_rsp->response_info.rsp_hdr.tag_id, CMD_STATUS_SUCCEEDED);
+        }
+        else if (batch_rsp->status == DEV_OPS_API_KERNEL_LAUNCH_RESPONSE_HOST_ABORTED)
+        {
+            TRACE_LOG_CMD_STATUS(DEV_OPS_API_MID_DEVICE_OPS_KERNEL_LAUNCH_BATCH_CMD, local_sqw_idx,
+                batch_rsp->response_info.rsp_hdr.tag_id, CMD_STATUS_ABORTED);
+        }
+        else
+        {
+            TRACE_LOG_CMD_STATUS(DEV_OPS_API_MID_DEVICE_OPS_KERNEL_LAUNCH_BATCH_CMD, local_sqw_idx,
+                batch_rsp->response_info.rsp_hdr.tag_id, CMD_STATUS_FAILED);
+        }
+
+        Log_Write(LOG_LEVEL_DEBUG,
+            "TID[%u]:KW[%d]:CQ_Push:KERNEL_LAUNCH_BATCH_CMD_RSP:Launches:%d\r\n",
+            batch_rsp->response_info.rsp_hdr.tag_id, kw_idx, num_results);
+    }
+    else
+    {
+        TRACE_LOG_CMD_STATUS(DEV_OPS_API_MID_DEVICE_OPS_KERNEL_LAUNCH_BATCH_CMD, local_sqw_idx,
+            batch_rsp->response_info.rsp_hdr.tag_id, CMD_STATUS_FAILED);
+
+        Log_Write(LOG_LEVEL_ERROR, "KW[%d]:CQ_Push:Failed\r\n", kw_idx);
+        SP_Iface_Report_Error(MM_RECOVERABLE_FW_MM_KW_ERROR, MM_CQ_PUSH_ERROR);
+    }
+
+#if !TEST_FRAMEWORK
+    /* Decrement commands count being processed by given SQW */
+    SQW_Decrement_Command_Count(local_sqw_idx);
+
+    /* Check for device API error */
+    if (batch_rsp->status != DEV_OPS_API_KERNEL_LAUNCH_RESPONSE_KERNEL_COMPLETED)
+    {
+        /* Report device API error to SP */
+        SP_Iface_Report_Error(MM_RECOVERABLE_OPS_API_KERNEL_LAUNCH, (int16_t)batch_rsp->status);
+    }
+#else
+    (void)local_sqw_idx;
+#endif
+}
+
+/************************************************************************
+*
+*   FUNCTION
+*
+*       kw_mem_op_send_response
+*
+*   DESCRIPTION
+*
+*       Helper function to reclaim the resources of a completed memset or
+*       local memcpy operation, and to transmit its response.
+*
+*   INPUTS
+*
+*       kw_idx          Index of kernel worker
+*       launch_status   Completion status of the operation, as a kernel launch status
+*
+*   OUTPUTS
+*
+*       None
+*
+***********************************************************************/
+static void kw_mem_op_send_response(uint32_t kw_idx, uint32_t launch_status)
+{
+    kernel_instance_t *const kernel = &KW_CB.kernels[kw_idx];
+    uint16_t cmd_id = atomic_load_local_16(&kernel->mem_op_cmd_id);
+    uint8_t local_sqw_idx = atomic_load_local_8(&kernel->sqw_idx);
+    /* Memset and local memcpy responses share the same layout */
+    struct device_ops_memset_rsp_t rsp;
+    int32_t status;
+
+    rsp.response_info.rsp_hdr.tag_id = atomic_load_local_16(&kernel->launch_tag_id);
+    rsp.response_info.rsp_hdr.msg_id = (cmd_id == DEV_OPS_API_MID_DEVICE_OPS_MEMSET_CMD) ?
+                                           DEV_OPS_API_MID_DEVICE_OPS_MEMSET_RSP :
+                                           DEV_OPS_API_MID_DEVICE_OPS_MEMCPY_LOCAL_RSP;
+    rsp.device_cmd_start_ts = atomic_load_local_64(&kernel->kw_cycles.cmd_start_cycles);
+    rsp.device_cmd_wait_dur = atomic_load_local_64(&kernel->kw_cycles.wait_cycles);
+    rsp.device_cmd_execute_dur =
+        PMC_GET_LATENCY(atomic_load_local_64(&kernel->kw_cycles.exec_start_cycles));
+    rsp.pad = 0;
+
+    /* Map the kernel launch completion status onto the memory operation status */
+    if (launch_status == DEV_OPS_API_KERNEL_LAUNCH_RESPONSE_KERNEL_COMPLETED)
+    {
+        rsp.status = DEV_OPS_API_MEM_OP_RESPONSE_COMPLETE;
+    }
+    else if (launch_status == DEV_OPS_API_KERNEL_LAUNCH_RESPONSE_HOST_ABORTED)
+    {
+        rsp.status = DEV_OPS_API_MEM_OP_RESPONSE_HOST_ABORTED;
+    }
+    else if (launch_status == DEV_OPS_API_KERNEL_LAUNCH_RESPONSE_CM_IFACE_MULTICAST_FAILED)
+    {
+        rsp.status = DEV_OPS_API_MEM_OP_RESPONSE_CM_IFACE_MULTICAST_FAILED;
+    }
+    else if ((launch_status == DEV_OPS_API_KERNEL_LAUNCH_RESPONSE_EXCEPTION) ||
+             (launch_status == DEV_OPS_API_KERNEL_LAUNCH_RESPONSE_ERROR))
+    {
+        rsp.status = DEV_OPS_API_MEM_OP_RESPONSE_ERROR;
+    }
+    else
+    {
+        rsp.status = DEV_OPS_API_MEM_OP_RESPONSE_UNEXPECTED_ERROR;
+    }
+
+    /* Give back the reserved compute shires. */
+    kw_unreserve_kernel_shires(atomic_load_local_64(&kernel->kernel_shire_mask));
+    atomic_store_local_16(&kernel->mem_op_cmd_id, 0);
+
+    /* Make reserved kernel slot available again */
+    kw_unreserve_kernel_slot(kernel);
+
+#if TEST_FRAMEWORK
+    /* For SP2MM command response, we need to provide the total size = header + payload */
+    rsp.response_info.rsp_hdr.size = sizeof(rsp);
+    /* Send memory operation response to SP */
+    status = SP_Iface_Push_Rsp_To_SP2MM_CQ(&rsp, sizeof(rsp));
+#else
+    rsp.response_info.rsp_hdr.size = (uint16_t)(sizeof(rsp) - sizeof(struct cmn_header_t));
+    /* Send memory operation response to host */
+    status = Host_Iface_CQ_Push_Cmd(0, &rsp, sizeof(rsp));
+#endif
+
+    if (status == STATUS_SUCCESS)
+    {
+        /* Log to command status to trace */
+        if (rsp.status == DEV_OPS_API_MEM_OP_RESPONSE_COMPLETE)
+        {
+            TRACE_LOG_CMD_STATUS(
+                cmd_id, local_sqw_idx, rsp.response_info.rsp_hdr.tag_id, CMD_STATUS_SUCCEEDED);
+        }
+        else if (rsp.status == DEV_OPS_API_MEM_OP_RESPONSE_HOST_ABORTED)
+        {
+            TRACE_LOG_CMD_STATUS(
+                cmd_id, local_sqw_idx, rsp.response_info.rsp_hdr.tag_id, CMD_STATUS_ABORTED);
+        }
+        else
+        {
+            TRACE_LOG_CMD_STATUS(
+                cmd_id, local_sqw_idx, rsp.response_info.rsp_hdr.tag_id, CMD_STATUS_FAILED);
+        }
+
+        Log_Write(LOG_LEVEL_DEBUG, "TID[%u]:KW[%d]:CQ_Push:MEM_OP_CMD_RSP:Status:%d\r\n",
+            rsp.response_info.rsp_hdr.tag_id, kw_idx, rsp.status);
+    }
+    else
+    {
+        TRACE_LOG_CMD_STATUS(
+            cmd_id, local_sqw_idx, rsp.response_info.rsp_hdr.tag_id, CMD_STATUS_FAILED);
+
+        Log_Write(LOG_LEVEL_ERROR, "KW[%d]:CQ_Push:Failed\r\n", kw_idx);
+        SP_Iface_Report_Error(MM_RECOVERABLE_FW_MM_KW_ERROR, MM_CQ_PUSH_ERROR);
+    }
+
+#if !TEST_FRAMEWORK
+    /* Decrement commands count being processed by given SQW */
+    SQW_Decrement_Command_Count(local_sqw_idx);
+
+    /* Check for device API error */
+    if (rsp.status != DEV_OPS_API_MEM_OP_RESPONSE_COMPLETE)
+    {
+        /* Report device API error to SP */
+        SP_Iface_Report_Error(MM_RECOVERABLE_OPS_API_MEM_OP, (int16_t)rsp.status);
+    }
+#else
+    (void)local_sqw_idx;
+    (void)cmd_id;
+#endif
+}
+
 /************************************************************************
 *
 *   FUNCTION
@@ -1512,6 +2292,10 @@ __attribute__((noreturn)) void KW_Launch(uint32_t kw_idx)
     bool kw_abort_serviced;
     uint8_t local_sqw_idx;
     uint16_t tag_id;
+    uint16_t num_nodes;
+    uint16_t node_index;
+    uint32_t launch_status;
+    uint64_t launch_start_cycles;
     int32_t status;
     int32_t kw_abort_timer;
     uint32_t kernel_state;
@@ -1522,6 +2306,13 @@ __attribute__((noreturn)) void KW_Launch(uint32_t kw_idx)
                      sizeof(struct kernel_rsp_error_ptr_t)] __attribute__((aligned(8))) = { 0 };
     struct device_ops_kernel_launch_rsp_t *launch_rsp =
         (struct device_ops_kernel_launch_rsp_t *)(uintptr_t)rsp_data;
+    /* Allocate memory for kernel launch batch response, it includes the per launch results. */
+    uint8_t batch_rsp_data[sizeof(struct device_ops_kernel_launch_batch_rsp_t) +
+                           (DEVICE_OPS_KERNEL_LAUNCH_BATCH_NODES_MAX *
+                               sizeof(struct kernel_launch_batch_result))]
+        __attribute__((aligned(8))) = { 0 };
+    struct device_ops_kernel_launch_batch_rsp_t *batch_rsp =
+        (struct device_ops_kernel_launch_batch_rsp_t *)(uintptr_t)batch_rsp_data;
 
     /* Get the kernel instance */
     kernel_instance_t *const kernel = &KW_CB.kernels[kw_idx];
@@ -1536,77 +2327,113 @@ __attribute__((noreturn)) void KW_Launch(uint32_t kw_idx)
 
         Log_Write(LOG_LEVEL_DEBUG, "KW:Received:FCCEvent\r\n");
 
-        /* Reset state */
-        status_internal.kernel_done = false;
-        status_internal.cw_exception = false;
-        status_internal.cw_error = false;
-        kw_abort_serviced = false;
-        status_internal.status = STATUS_SUCCESS;
-        status_internal.cm_error_shire_mask = 0;
-        wait_for_ipi = true;
-        kw_abort_timer = -1;
-        atomic_store_local_8(&kernel->cm_abort_wait_timeout_flag, 0);
-
-        /* Read the shire mask and tag ID for the current kernel */
-        kernel_shire_mask = atomic_load_local_64(&kernel->kernel_shire_mask);
-        tag_id = atomic_load_local_16(&kernel->launch_tag_id);
-
-        /* Process kernel command responses from CM, for all shires
-        associated with the kernel launch */
-        while (!status_internal.kernel_done && (status_internal.status == STATUS_SUCCESS))
-        {
-            /* Wait and clear IPI */
-            KW_WAIT_AND_CLEAR_SW_INTERRUPT(wait_for_ipi)
-
-            /* Get the kernel state */
-            kernel_state = atomic_load_local_32(&kernel->kernel_state);
+        /* Number of launches for a kernel launch batch, zero for a single kernel launch */
+        num_nodes = atomic_load_local_16(&KW_CB.batches[kw_idx].num_nodes);
+        node_index = 0;
+        launch_start_cycles = atomic_load_local_64(&kernel->kw_cycles.exec_start_cycles);
 
-            /* Check the kernel_state is set to abort after timeout */
-            if ((!kw_abort_serviced) && (kernel_state == KERNEL_STATE_ABORTING))
+        /* Process the kernel launch, and for a batch each chained launch in turn */
+        do
+        {
+            /* Reset state */
+            status_internal.kernel_done = false;
+            status_internal.cw_exception = false;
+            status_internal.cw_error = false;
+            kw_abort_serviced = false;
+            status_internal.status = STATUS_SUCCESS;
+            status_internal.cm_error_shire_mask = 0;
+            wait_for_ipi = true;
+            kw_abort_timer = -1;
+            atomic_store_local_8(&kernel->cm_abort_wait_timeout_flag, 0);
+
+            /* Read the shire mask and tag ID for the current kernel */
+            kernel_shire_mask = atomic_load_local_64(&kernel->kernel_shire_mask);
+            tag_id = atomic_load_local_16(&kernel->launch_tag_id);
+
+            /* Process kernel command responses from CM, for all shires
+            associated with the kernel launch */
+            while (!status_internal.kernel_done && (status_internal.status == STATUS_SUCCESS))
             {
-                kw_abort_serviced = true;
-                Log_Write(LOG_LEVEL_ERROR, "TID[%u]:KW[%d]:Aborting kernel...\r\n", tag_id, kw_idx);
+                /* Wait and clear IPI */
+                KW_WAIT_AND_CLEAR_SW_INTERRUPT(wait_for_ipi)
 
-                /* Make sure that the kernel is launched on the CMs */
-                kw_wait_for_kernel_launch_flag(
-                    atomic_load_local_8(&kernel->sqw_idx), (uint8_t)kw_idx);
+                /* Get the kernel state */
+                kernel_state = atomic_load_local_32(&kernel->kernel_state);
 
-                /* Multicast abort to shires associated with current kernel slot
-                This abort should forcefully abort all the shires involved in kernel launch */
-                status_internal.status = kw_cm_to_mm_kernel_force_abort(kernel_shire_mask);
+                /* Check the kernel_state is set to abort after timeout */
+                if ((!kw_abort_serviced) && (kernel_state == KERNEL_STATE_ABORTING))
+                {
+                    kw_abort_serviced = true;
+                    Log_Write(LOG_LEVEL_ERROR, "TID[%u]:KW[%d]:Aborting kernel...\r\n", tag_id,
+                        kw_idx);
 
-                /* Check and register a timer for completion message from CMs after abort */
-                KW_REGISTER_CM_ABORT_TIMER(kw_abort_timer, kw_idx, status_internal.status)
+                    /* Make sure that the kernel is launched on the CMs */
+                    kw_wait_for_kernel_launch_flag(
+                        atomic_load_local_8(&kernel->sqw_idx), (uint8_t)kw_idx);
 
-                /* Since we did a multicast to CMs in above call, being pessimistic here
-                and disabling the wait for IPI to make sure we don't miss any pending message. */
-                wait_for_ipi = false;
-            }
-            else if ((kernel_state == KERNEL_STATE_ABORTING) &&
-                     (atomic_load_local_8(&kernel->cm_abort_wait_timeout_flag) == 1))
-            {
-                /* Set the status to indicate that timeout occured while waiting for abort completion message from CMs. */
-                status_internal.status = KW_ERROR_CM_ABORT_TIMEOUT;
+                    /* Multicast abort to shires associated with current kernel slot
+                    This abort should forcefully abort all the shires involved in kernel launch */
+                    status_internal.status = kw_cm_to_mm_kernel_force_abort(kernel_shire_mask);
 
-                Log_Write(LOG_LEVEL_ERROR,
-                    "TID[%u]:KW[%d]:Timeout occured waiting for kernel complete message after CM abort\r\n",
-                    tag_id, kw_idx);
+                    /* Check and register a timer for completion message from CMs after abort */
+                    KW_REGISTER_CM_ABORT_TIMER(kw_abort_timer, kw_idx, status_internal.status)
+
+                    /* Since we did a multicast to CMs in above call, being pessimistic here
+                    and disabling the wait for IPI to make sure we don't miss any pending
+                    message. */
+                    wait_for_ipi = false;
+                }
+                else if ((kernel_state == KERNEL_STATE_ABORTING) &&
+                         (atomic_load_local_8(&kernel->cm_abort_wait_timeout_flag) == 1))
+                {
+                    /* Set the status to indicate that timeout occured while waiting for abort
+                    completion message from CMs. */
+                    status_internal.status = KW_ERROR_CM_ABORT_TIMEOUT;
+
+                    Log_Write(LOG_LEVEL_ERROR,
+                        "TID[%u]:KW[%d]:Timeout occured waiting for kernel complete message after CM abort\r\n",
+                        tag_id, kw_idx);
+                }
+                else
+                {
+                    /* Handle messages from Compute Worker */
+                    kw_cm_to_mm_process_messages(
+                        kw_idx, tag_id, kernel_shire_mask, &status_internal);
+
+                    /* Enable wait for IPI */
+                    wait_for_ipi = true;
+                }
             }
-            else
-            {
-                /* Handle messages from Compute Worker */
-                kw_cm_to_mm_process_messages(kw_idx, tag_id, kernel_shire_mask, &status_internal);
 
-                /* Enable wait for IPI */
-                wait_for_ipi = true;
+            /* Check if CM abort timer was registered */
+            if (kw_abort_timer >= 0)
+            {
+                /* Free the registered SW Timeout slot */
+                SW_Timer_Cancel_Timeout((uint8_t)kw_abort_timer);
             }
+
+            /* Read the kernel state to detect abort by host */
+            kernel_state = atomic_load_local_32(&kernel->kernel_state);
+
+            /* Get completion status of the current launch. */
+            launch_status = kw_get_kernel_launch_completion_status(kernel_state, &status_internal);
+        } while ((num_nodes > 0) &&
+                 kw_batch_chain_next_launch(kw_idx, &launch_status, num_nodes, &node_index,
+                     &launch_start_cycles, batch_rsp->results));
+
+        /* Kernel launch batch done, send the aggregated response */
+        if (num_nodes > 0)
+        {
+            kw_batch_send_response(
+                kw_idx, batch_rsp, (uint16_t)(node_index + 1U), launch_status, &status_internal);
+            continue;
         }
 
-        /* Check if CM abort timer was registered */
-        if (kw_abort_timer >= 0)
+        /* Memset or local memcpy done, send its response */
+        if (atomic_load_local_16(&kernel->mem_op_cmd_id) != 0)
         {
-            /* Free the registered SW Timeout slot */
-            SW_Timer_Cancel_Timeout((uint8_t)kw_abort_timer);
+            kw_mem_op_send_response(kw_idx, launch_status);
+            continue;
         }
 
         /* Kernel run complete with host abort, exception or success.
@@ -1614,9 +2441,6 @@ __attribute__((noreturn)) void KW_Launch(uint32_t kw_idx)
 
         uint16_t rsp_size = (uint16_t)(sizeof(struct device_ops_kernel_launch_rsp_t));
 
-        /* Read the kernel state to detect abort by host */
-        kernel_state = atomic_load_local_32(&kernel->kernel_state);
-
         /* Construct and transmit kernel launch response to host */
         launch_rsp->response_info.rsp_hdr.tag_id = tag_id;
         launch_rsp->response_info.rsp_hdr.msg_id = DEV_OPS_API_MID_DEVICE_OPS_KERNEL_LAUNCH_RSP;
@@ -1628,7 +2452,7 @@ __attribute__((noreturn)) void KW_Launch(uint32_t kw_idx)
         local_sqw_idx = atomic_load_local_8(&kernel->sqw_idx);
 
         /* Get completion status of kernel launch. */
-        launch_rsp->status = kw_get_kernel_launch_completion_status(kernel_state, &status_internal);
+        launch_rsp->status = launch_status;
 
         if (launch_rsp->status != DEV_OPS_API_KERNEL_LAUNCH_RESPONSE_KERNEL_COMPLETED)
         {
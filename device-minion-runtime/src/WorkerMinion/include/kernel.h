@@ -110,4 +110,13 @@ uint64_t kernel_launch_set_global_exception_mask(uint32_t shire_id);
 */
 int64_t launch_kernel(mm_to_cm_message_kernel_params_t kernel) __attribute__((optimize("-fomit-frame-pointer")));
 
+/*! \fn int64_t launch_mem_op(const mm_to_cm_message_mem_op_t *mem_op)
+    \brief Function used to execute a built-in memset or memcpy operation on the shires of the
+    given mask. The work is split in cache lines among all the harts of those shires, and it follows
+    the kernel launch protocol so that the MM handles it as a kernel launch.
+    \param mem_op Parameters of the memory operation.
+    \return Success or error
+*/
+int64_t launch_mem_op(const mm_to_cm_message_mem_op_t *mem_op);
+
 #endif
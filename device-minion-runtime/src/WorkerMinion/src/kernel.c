@@ -490,6 +490,165 @@ int64_t launch_kernel(mm_to_cm_message_kernel_params_t kernel)
     return return_value;
 }
 
+/* Stores the 32 bits pattern byte by byte in [addr, end), the pattern is laid out
+relative to its natural alignment */
+static inline uint64_t mem_op_fill_bytes(uint64_t addr, uint64_t end, uint32_t pattern)
+{
+    for (; addr < end; addr++)
+    {
+        *(volatile uint8_t *)addr = (uint8_t)(pattern >> ((addr & 3U) * 8U));
+    }
+
+    return addr;
+}
+
+static void mem_op_fill(uint64_t addr, uint64_t end, uint32_t pattern)
+{
+    const uint64_t head_end = (addr + 31U) & ~31ULL;
+    uint64_t blocks;
+
+    /* Byte stores up to the first 32 bytes boundary */
+    addr = mem_op_fill_bytes(addr, (head_end < end) ? head_end : end, pattern);
+
+    /* Broadcast the pattern to the 8 lanes and store 32 bytes per instruction */
+    blocks = (end - addr) / 32U;
+    if (blocks > 0)
+    {
+        asm volatile("fbcx.ps f0, %[pattern]       \n"
+                     "1:                           \n"
+                     "fsq2    f0, 0(%[addr])       \n"
+                     "addi    %[addr], %[addr], 32 \n"
+                     "addi    %[blocks], %[blocks], -1 \n"
+                     "bnez    %[blocks], 1b        \n"
+                     : [addr] "+r"(addr), [blocks] "+r"(blocks)
+                     : [pattern] "r"(pattern)
+                     : "f0", "memory");
+    }
+
+    /* Remaining bytes */
+    mem_op_fill_bytes(addr, end, pattern);
+}
+
+static void mem_op_copy(uint64_t dst, uint64_t src, uint64_t end)
+{
+    uint64_t blocks;
+
+    /* Vector copy only if source and destination share the same 32 bytes alignment */
+    if (((dst ^ src) & 31U) == 0)
+    {
+        for (; (dst < end) && (dst & 31U); dst++, src++)
+        {
+            *(volatile uint8_t *)dst = *(volatile const uint8_t *)src;
+        }
+
+        blocks = (end - dst) / 32U;
+        if (blocks > 0)
+        {
+            asm volatile("1:                           \n"
+                         "flq2    f0, 0(%[src])        \n"
+                         "fsq2    f0, 0(%[dst])        \n"
+                         "addi    %[src], %[src], 32   \n"
+                         "addi    %[dst], %[dst], 32   \n"
+                         "addi    %[blocks], %[blocks], -1 \n"
+                         "bnez    %[blocks], 1b        \n"
+                         : [dst] "+r"(dst), [src] "+r"(src), [blocks] "+r"(blocks)
+                         :
+                         : "f0", "memory");
+        }
+    }
+    else if (((dst ^ src) & 7U) == 0)
+    {
+        for (; (dst < end) && (dst & 7U); dst++, src++)
+        {
+            *(volatile uint8_t *)dst = *(volatile const uint8_t *)src;
+        }
+        for (; (dst + 8U) <= end; dst += 8U, src += 8U)
+        {
+            *(volatile uint64_t *)dst = *(volatile const uint64_t *)src;
+        }
+    }
+
+    /* Remaining (or misaligned) bytes */
+    for (; dst < end; dst++, src++)
+    {
+        *(volatile uint8_t *)dst = *(volatile const uint8_t *)src;
+    }
+}
+
+int64_t launch_mem_op(const mm_to_cm_message_mem_op_t *mem_op)
+{
+    const uint32_t shire_id = get_shire_id();
+    const uint64_t hart_id = get_hart_id();
+    const uint64_t first_worker = (shire_id == MASTER_SHIRE) ? 32 : 0;
+    const uint64_t master_mask = 1ULL << MASTER_SHIRE;
+    const uint64_t lower_shires = mem_op->shire_mask & ((1ULL << shire_id) - 1U);
+    mm_to_cm_message_kernel_params_t kernel = { 0 };
+    uint64_t worker;
+    uint64_t num_workers;
+    uint64_t first_line;
+    uint64_t num_lines;
+    uint64_t lines_per_worker;
+    uint64_t extra_lines;
+    uint64_t begin;
+    uint64_t end;
+    bool kernel_last_thread;
+
+    /* The memory operation follows the kernel launch protocol on the kernel slot */
+    kernel.kw_base_id = mem_op->kw_base_id;
+    kernel.slot_index = mem_op->slot_index;
+    kernel.shire_mask = mem_op->shire_mask;
+
+    pre_kernel_setup(&kernel);
+
+    /* Wait until all the Shires involved in the operation reach this sync point */
+    kernel_last_thread = pre_launch_synchronize_shires(&pre_launch_global_barrier,
+        pre_launch_local_barrier, (uint32_t)__builtin_popcountll(kernel.shire_mask));
+
+    /* Last thread sets the kernel launched global flag for MM. The threads are not marked as
+    launched, there is no U-mode context to return from on abort */
+    if (kernel_last_thread)
+    {
+        atomic_store_global_32(&CM_KERNEL_LAUNCHED_FLAG[kernel.slot_index].flag, 1);
+    }
+
+    /* Global index of this hart among all the harts of the operation, the master shire
+    only contributes its 32 worker harts */
+    num_workers = (uint64_t)__builtin_popcountll(kernel.shire_mask) * 64U -
+                  ((kernel.shire_mask & master_mask) ? 32U : 0U);
+    worker = (uint64_t)__builtin_popcountll(lower_shires) * 64U -
+             ((lower_shires & master_mask) ? 32U : 0U) + ((hart_id % 64U) - first_worker);
+
+    /* Split the destination in whole cache lines, so that no two harts write the same line */
+    first_line = mem_op->dst_address & ~63ULL;
+    num_lines = (((mem_op->dst_address + mem_op->size + 63U) & ~63ULL) - first_line) / 64U;
+    lines_per_worker = num_lines / num_workers;
+    extra_lines = num_lines % num_workers;
+
+    begin = first_line +
+            64U * (worker * lines_per_worker + (worker < extra_lines ? worker : extra_lines));
+    end = begin + 64U * (lines_per_worker + (worker < extra_lines ? 1U : 0U));
+    begin = (begin < mem_op->dst_address) ? mem_op->dst_address : begin;
+    end = (end > (mem_op->dst_address + mem_op->size)) ? (mem_op->dst_address + mem_op->size) :
+                                                           end;
+
+    if (begin < end)
+    {
+        if (mem_op->type == MEM_OP_TYPE_MEMSET)
+        {
+            mem_op_fill(begin, end, mem_op->pattern);
+        }
+        else
+        {
+            mem_op_copy(begin, mem_op->src_address + (begin - mem_op->dst_address), end);
+        }
+    }
+
+    /* Post cleanup waits for the stores and evicts L1 and L2, then notifies the MM */
+    kernel_launch_post_cleanup(&kernel, 0, KERNEL_RETURN_SUCCESS);
+
+    return 0;
+}
+
 static void pre_kernel_setup(const mm_to_cm_message_kernel_params_t *kernel)
 {
     const uint32_t shire_id = get_shire_id();
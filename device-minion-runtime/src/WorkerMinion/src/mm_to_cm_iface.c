@@ -203,6 +203,31 @@ static void mm_to_cm_iface_handle_message(
             }
             break;
         }
+        case MM_TO_CM_MESSAGE_ID_MEM_OP:
+        {
+            /* Copy the msg locally before notifying MM */
+            const mm_to_cm_message_mem_op_t mem_op = *(mm_to_cm_message_mem_op_t *)message_ptr;
+
+            /* Notify MM after copying the msg locally */
+            MM_NOTIFY_ASYNC_MSG(shire, msg_header)
+
+            /* Check if this Shire is involved in the memory operation */
+            if (mem_op.shire_mask & (1ULL << shire))
+            {
+                Log_Write(LOG_LEVEL_DEBUG,
+                    "TID[%u]:MM->CM:Memory operation:%d on Shire 0x%llx\r\n", msg_header.tag_id,
+                    mem_op.type, 1ULL << shire);
+
+                launch_mem_op(&mem_op);
+            }
+            else
+            {
+                Log_Write(LOG_LEVEL_ERROR,
+                    "TID[%u]:MM->CM:Memory operation msg received on shire not involved\r\n",
+                    msg_header.tag_id);
+            }
+            break;
+        }
         case MM_TO_CM_MESSAGE_ID_KERNEL_ABORT:
         {
             /* Notify MM after parsing the msg */
@@ -231,6 +231,21 @@ RESERVED
 */
 #define KW_ERROR_KERNEL_UMODE_STACK_INVALID_CONFIG -1016
 
+/*! \def KW_ERROR_KERNEL_INVALID_BATCH_SIZE
+    \brief Kernel Worker - Kernel launch batch is empty or too large
+*/
+#define KW_ERROR_KERNEL_INVALID_BATCH_SIZE -1017
+
+/*! \def KW_ERROR_MEM_OP_INVALID_SIZE
+    \brief Kernel Worker - Memory operation size is zero or not a multiple of the pattern size
+*/
+#define KW_ERROR_MEM_OP_INVALID_SIZE -1018
+
+/*! \def KW_ERROR_MEM_OP_INVALID_PATTERN_SIZE
+    \brief Kernel Worker - Memset pattern size is not supported
+*/
+#define KW_ERROR_MEM_OP_INVALID_PATTERN_SIZE -1019
+
 /**************************************
  * Define Compute Worker error codes. *
  **************************************/
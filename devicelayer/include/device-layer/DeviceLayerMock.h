@@ -27,6 +27,9 @@ public:
   MOCK_METHOD4(waitForEpollEventsMasterMinion,
                void(int device, uint64_t& sq_bitmap, bool& cq_available, std::chrono::milliseconds timeout));
   MOCK_METHOD2(receiveResponseMasterMinion, bool(int device, std::vector<std::byte>& response));
+  MOCK_METHOD5(receiveResponsesMasterMinion, size_t(int device, std::byte* buffer, size_t bufferSize,
+                                                    ResponseInfo* responses, size_t maxResponses));
+  MOCK_METHOD2(setPollingWindowMasterMinion, void(int device, std::chrono::microseconds window));
   MOCK_METHOD4(sendCommandServiceProcessor, bool(int device, std::byte* command, size_t commandSize, CmdFlagSP flags));
   MOCK_METHOD2(setSqThresholdServiceProcessor, void(int device, uint32_t bytesNeeded));
   MOCK_METHOD3(waitForEpollEventsServiceProcessor, void(int device, bool& sq_available, bool& cq_available));
@@ -77,6 +80,14 @@ public:
     ON_CALL(*this, receiveResponseMasterMinion).WillByDefault([this](int device, std::vector<std::byte>& response) {
       return delegate_->receiveResponseMasterMinion(device, response);
     });
+    ON_CALL(*this, receiveResponsesMasterMinion)
+      .WillByDefault(
+        [this](int device, std::byte* buffer, size_t bufferSize, ResponseInfo* responses, size_t maxResponses) {
+          return delegate_->receiveResponsesMasterMinion(device, buffer, bufferSize, responses, maxResponses);
+        });
+    ON_CALL(*this, setPollingWindowMasterMinion).WillByDefault([this](int device, std::chrono::microseconds window) {
+      delegate_->setPollingWindowMasterMinion(device, window);
+    });
     ON_CALL(*this, sendCommandServiceProcessor)
       .WillByDefault([this](int device, std::byte* command, size_t commandSize, CmdFlagSP flags) {
         return delegate_->sendCommandServiceProcessor(device, command, commandSize, flags);
@@ -135,12 +135,22 @@ enum class TraceBufferType {
   TraceBufferTypeNum
 };
 
+/// \brief This struct describes where a response received by `IDeviceAsync::receiveResponsesMasterMinion()` has been
+/// stored inside the caller provided buffer
+struct DEVICE_LAYER_EXPORT ResponseInfo {
+  size_t offset_; ///< offset in bytes of the response from the beginning of the buffer
+  size_t size_;   ///< size in bytes of the response
+};
+
 class DEVICE_LAYER_EXPORT Exception : public dbg::StackException {
   using dbg::StackException::StackException;
 };
 
 class DEVICE_LAYER_EXPORT IDeviceAsync {
 public:
+  /// \brief Alignment of each response stored by `receiveResponsesMasterMinion()`
+  static constexpr size_t kResponseAlignment = 8;
+
   /// \brief Sends a command to the master minion. If the method returns false, the caller should try later when the
   /// queue has enough space indicated by availability from `waitForEpollEventsMasterMinion()`
   ///
@@ -188,6 +198,34 @@ public:
   ///
   virtual bool receiveResponseMasterMinion(int device, std::vector<std::byte>& response) = 0;
 
+  /// \brief Receives as many responses as available from the device, up to maxResponses, in a single call. This is a
+  /// non-blocking interface. Responses are stored back to back into the caller provided buffer, each one starting at
+  /// an offset aligned to kResponseAlignment. The reception stops when there are no more responses, when
+  /// maxResponses are received or when the next response does not fit in the remaining space of the buffer; a buffer
+  /// of `getSubmissionQueueSizeMasterMinion()` bytes is always big enough to hold at least one response.
+  ///
+  /// @param[in] device indicating which device to receive the responses from.
+  /// @param[out] buffer caller provided buffer where the responses are stored.
+  /// @param[in] bufferSize size in bytes of the buffer.
+  /// @param[out] responses caller provided array of at least maxResponses elements. On return, the first entries
+  /// contain the location of each received response inside the buffer, in reception order.
+  /// @param[in] maxResponses maximum number of responses to receive.
+  ///
+  /// @returns the number of received responses, 0 if there was no response to be received.
+  ///
+  virtual size_t receiveResponsesMasterMinion(int device, std::byte* buffer, size_t bufferSize,
+                                              ResponseInfo* responses, size_t maxResponses) = 0;
+
+  /// \brief Sets the completion polling window of the master minion. When the window is not zero,
+  /// `waitForEpollEventsMasterMinion()` busy-polls the device queues during this window before blocking the caller
+  /// thread waiting for the queue events. This trades CPU time for lower completion latency. By default the window is
+  /// zero and the caller thread blocks straight away.
+  ///
+  /// @param[in] device indicating which device to set the polling window for.
+  /// @param[in] window busy-polling time before falling back to block waiting for events.
+  ///
+  virtual void setPollingWindowMasterMinion(int device, std::chrono::microseconds window) = 0;
+
   /// \brief Sends a command to the service processor. If the method returns false, the caller should try later when the
   /// queue has enough space indicated by availability from `waitForEpollEventsServiceProcessor()`
   ///
@@ -4,6 +4,7 @@
  *-------------------------------------------------------------------------*/
 #include "DevicePcie.h"
 #include "Utils.h"
+#include <algorithm>
 #include <cassert>
 #include <cstring>
 #include <dirent.h>
@@ -301,6 +302,7 @@ int openWhenReady(const std::string path, std::chrono::seconds timeout) {
 }
 
 constexpr int kMaxEpollEvents = 6;
+constexpr uint32_t kUserRingEntries = 256;
 } // namespace
 namespace dev {
 
@@ -323,6 +325,92 @@ namespace dev {
     }                                                                                                                  \
   } while (0)
 
+std::unique_ptr<DevicePcie::UserRings> DevicePcie::UserRings::create(int fd) {
+  uring_setup setup{};
+  setup.sq_entries = kUserRingEntries;
+  setup.cq_entries = kUserRingEntries;
+  setup.eventfd = -1;
+  if (::ioctl(fd, ETSOC1_IOCTL_URING_SETUP, &setup) < 0) {
+    DV_DLOG(DEBUG) << "User-space rings not available, using PUSH_SQ/POP_CQ: '" << std::strerror(errno) << "'";
+    return nullptr;
+  }
+  // From now on the driver posts the responses on the CQ ring, so failing to map it is fatal
+  auto base = mmap(nullptr, setup.mmap_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, ET_URING_MMAP_OFFSET);
+  if (base == MAP_FAILED) {
+    throw Exception("Error mapping user-space rings: '"s + std::strerror(errno) + "'");
+  }
+  return std::unique_ptr<UserRings>(new UserRings(static_cast<std::byte*>(base), setup));
+}
+
+DevicePcie::UserRings::UserRings(std::byte* base, const uring_setup& setup)
+  : base_(base)
+  , setup_(setup) {
+}
+
+DevicePcie::UserRings::~UserRings() {
+  if (munmap(base_, setup_.mmap_size) != 0) {
+    DV_LOG(WARNING) << "Error munmap user-space rings: '" << std::strerror(errno) << "'";
+  }
+}
+
+uring_ring_hdr* DevicePcie::UserRings::header(uint64_t offset, int index) const {
+  return reinterpret_cast<uring_ring_hdr*>(base_ + offset + static_cast<size_t>(index) * ET_URING_HDR_STRIDE);
+}
+
+bool DevicePcie::UserRings::push(int fd, int sqIdx, const std::byte* command, size_t commandSize) {
+  if (commandSize > setup_.sq_entry_size - sizeof(uring_sqe)) {
+    throw Exception("Command does not fit in user-space SQ ring entry");
+  }
+  std::lock_guard lock(sqMutex_);
+  auto hdr = header(setup_.sq_hdr_offset, sqIdx);
+  // The ring is always empty here: entries the driver could not submit are retracted below
+  auto tail = hdr->tail;
+  auto slot = static_cast<size_t>(sqIdx) * setup_.sq_entries + (tail & (setup_.sq_entries - 1));
+  auto sqe = reinterpret_cast<uring_sqe*>(base_ + setup_.sq_entries_offset + slot * setup_.sq_entry_size);
+  sqe->size = static_cast<uint32_t>(commandSize);
+  std::memcpy(sqe->cmd, command, commandSize);
+  __atomic_store_n(&hdr->tail, tail + 1, __ATOMIC_RELEASE);
+
+  uring_enter enter{};
+  enter.sq_bitmap = 1ULL << sqIdx;
+  wrap_ioctl(fd, ETSOC1_IOCTL_URING_ENTER, &enter);
+
+  // The driver leaves the entry on the ring if the device SQ is full. Retract it so that the caller gets the same
+  // backpressure as with PUSH_SQ
+  if (__atomic_load_n(&hdr->head, __ATOMIC_ACQUIRE) != tail + 1) {
+    __atomic_store_n(&hdr->tail, tail, __ATOMIC_RELEASE);
+    return false;
+  }
+  return true;
+}
+
+size_t DevicePcie::UserRings::pop(int fd, std::byte* buffer, size_t bufferSize) {
+  std::lock_guard lock(cqMutex_);
+  auto hdr = header(setup_.cq_hdr_offset, 0);
+  auto head = hdr->head;
+  if (head == __atomic_load_n(&hdr->tail, __ATOMIC_ACQUIRE)) {
+    return 0;
+  }
+  auto slot = head & (setup_.cq_entries - 1);
+  auto cqe = reinterpret_cast<const uring_cqe*>(base_ + setup_.cq_entries_offset + slot * setup_.cq_entry_size);
+  size_t size = cqe->size;
+  if (size > bufferSize) {
+    throw Exception("Response does not fit in the buffer");
+  }
+  std::memcpy(buffer, cqe->rsp, size);
+  __atomic_store_n(&hdr->head, head + 1, __ATOMIC_RELEASE);
+
+  // The driver stops draining the device CQ while the ring is full, resume it now that there is room again
+  if (__atomic_load_n(&hdr->flags, __ATOMIC_RELAXED) & URING_RING_FLAG_CQ_OVERFLOW) {
+    // an empty sq_bitmap submits from all SQ rings, so serialize with push()
+    std::lock_guard sqLock(sqMutex_);
+    uring_enter enter{};
+    enter.flags = URING_ENTER_FLAG_CQ_RESUME;
+    wrap_ioctl(fd, ETSOC1_IOCTL_URING_ENTER, &enter);
+  }
+  return size;
+}
+
 void DevicePcie::setupDeviceInfo(int device, DevInfo& deviceInfo, bool enableMgmt, bool enableOps,
                                  std::chrono::milliseconds timeout) const {
   auto end = std::chrono::steady_clock::now() + timeout;
@@ -351,6 +439,7 @@ void DevicePcie::setupDeviceInfo(int device, DevInfo& deviceInfo, bool enableMgm
     wrap_ioctl(deviceInfo.fdOps_, ETSOC1_IOCTL_GET_SQ_COUNT, &deviceInfo.mmSqCount_);
     wrap_ioctl(deviceInfo.fdOps_, ETSOC1_IOCTL_GET_SQ_MAX_MSG_SIZE, &deviceInfo.mmSqMaxMsgSize_);
     wrap_ioctl(deviceInfo.fdOps_, ETSOC1_IOCTL_GET_P2PDMA_DEVICE_COMPAT_BITMAP, &deviceInfo.p2pCompatBitmap_);
+    deviceInfo.userRings_ = UserRings::create(deviceInfo.fdOps_);
 
     logs << std::endl;
     logInfoLine(logs, "PCIe target:", path);
@@ -360,6 +449,7 @@ void DevicePcie::setupDeviceInfo(int device, DevInfo& deviceInfo, bool enableMgm
     logInfoLine(logs, "MM SQ count:", deviceInfo.mmSqCount_, true);
     logInfoLine(logs, "MM VQ Maximum message size (B):", deviceInfo.mmSqMaxMsgSize_, true);
     logInfoLine(logs, "P2P compatibility bitmap:", deviceInfo.p2pCompatBitmap_, true);
+    logInfoLine(logs, "MM user-space rings:", std::string(deviceInfo.userRings_ ? "enabled" : "disabled"));
   }
 
   auto fd = mgmtEnabled_ ? deviceInfo.fdMgmt_ : deviceInfo.fdOps_;
@@ -459,8 +549,9 @@ void DevicePcie::setupDeviceInfo(int device, DevInfo& deviceInfo, bool enableMgm
   DV_DLOG(DEBUG) << logs.str();
 }
 
-void DevicePcie::teardownDeviceInfo(const DevInfo& deviceInfo, bool disableMgmt, bool disableOps) const {
+void DevicePcie::teardownDeviceInfo(DevInfo& deviceInfo, bool disableMgmt, bool disableOps) const {
   if (disableOps) {
+    deviceInfo.userRings_.reset();
     auto res = close(deviceInfo.fdOps_);
     if (res < 0) {
       throw Exception("Failed to close ops file, error: '"s + std::strerror(errno) + "'"s);
@@ -671,6 +762,10 @@ bool DevicePcie::sendCommandMasterMinion(int device, int sqIdx, std::byte* comma
   cmdInfo.size = static_cast<uint16_t>(commandSize);
   cmdInfo.sq_index = static_cast<uint16_t>(sqIdx);
   cmdInfo.flags = parseCmdFlagMM(flags);
+  // DMA and high priority commands need the driver to process them, only plain commands go through the rings
+  if (deviceInfo.userRings_ && cmdInfo.flags == CMD_DESC_FLAG_NONE) {
+    return deviceInfo.userRings_->push(deviceInfo.fdOps_, sqIdx, command, commandSize);
+  }
   return wrap_ioctl(deviceInfo.fdOps_, ETSOC1_IOCTL_PUSH_SQ, &cmdInfo);
 }
 
@@ -698,7 +793,21 @@ void DevicePcie::waitForEpollEventsMasterMinion(int device, uint64_t& sq_bitmap,
   sq_bitmap = 0;
   cq_available = false;
   epoll_event eventList[kMaxEpollEvents];
-  auto readyEvents = epoll_wait(deviceInfo.epFdOps_, eventList, kMaxEpollEvents, static_cast<int>(timeout.count()));
+  int readyEvents = 0;
+  if (deviceInfo.pollingWindow_.count() > 0) {
+    // busy-poll without sleeping during the polling window, then fallback to a blocking wait
+    auto start = std::chrono::steady_clock::now();
+    auto pollingEnd = start + std::min<std::chrono::microseconds>(deviceInfo.pollingWindow_, timeout);
+    do {
+      readyEvents = epoll_wait(deviceInfo.epFdOps_, eventList, kMaxEpollEvents, 0);
+    } while (readyEvents == 0 && std::chrono::steady_clock::now() < pollingEnd);
+    timeout = std::max(timeout - std::chrono::duration_cast<std::chrono::milliseconds>(
+                                   std::chrono::steady_clock::now() - start),
+                       std::chrono::milliseconds(0));
+  }
+  if (readyEvents == 0) {
+    readyEvents = epoll_wait(deviceInfo.epFdOps_, eventList, kMaxEpollEvents, static_cast<int>(timeout.count()));
+  }
 
   if (readyEvents > 0) {
     for (int i = 0; i < readyEvents; i++) {
@@ -726,11 +835,48 @@ bool DevicePcie::receiveResponseMasterMinion(int device, std::vector<std::byte>&
   auto& deviceInfo = devices_[static_cast<unsigned long>(device)];
 
   response.resize(deviceInfo.mmSqMaxMsgSize_);
+  return popResponseMasterMinion(deviceInfo, response.data(), response.size()) > 0;
+}
+
+size_t DevicePcie::popResponseMasterMinion(DevInfo& deviceInfo, std::byte* buffer, size_t bufferSize) const {
+  if (deviceInfo.userRings_) {
+    if (auto size = deviceInfo.userRings_->pop(deviceInfo.fdOps_, buffer, bufferSize); size > 0) {
+      return size;
+    }
+    // responses which need post processing by the driver (i.e. MM reset) are still popped through the driver
+  }
   rsp_desc rspInfo;
-  rspInfo.rsp = response.data();
-  rspInfo.size = deviceInfo.mmSqMaxMsgSize_;
+  rspInfo.rsp = buffer;
+  rspInfo.size = static_cast<uint16_t>(std::min<size_t>(bufferSize, deviceInfo.mmSqMaxMsgSize_));
   rspInfo.cq_index = 0;
-  return wrap_ioctl(deviceInfo.fdOps_, ETSOC1_IOCTL_POP_CQ, &rspInfo);
+  auto res = wrap_ioctl(deviceInfo.fdOps_, ETSOC1_IOCTL_POP_CQ, &rspInfo);
+  return res ? static_cast<size_t>(res.rc_) : 0;
+}
+
+size_t DevicePcie::receiveResponsesMasterMinion(int device, std::byte* buffer, size_t bufferSize,
+                                                ResponseInfo* responses, size_t maxResponses) {
+  CHECK_OPS_ENABLED();
+  CHECK_VALID_DEVICE(device);
+  auto& deviceInfo = devices_[static_cast<unsigned long>(device)];
+
+  size_t count = 0;
+  size_t offset = 0;
+  // responses are popped one by one, straight into the caller buffer
+  while (count < maxResponses && offset + deviceInfo.mmSqMaxMsgSize_ <= bufferSize) {
+    auto size = popResponseMasterMinion(deviceInfo, buffer + offset, deviceInfo.mmSqMaxMsgSize_);
+    if (size == 0) {
+      break;
+    }
+    responses[count++] = ResponseInfo{offset, size};
+    offset = (offset + size + kResponseAlignment - 1) & ~(kResponseAlignment - 1);
+  }
+  return count;
+}
+
+void DevicePcie::setPollingWindowMasterMinion(int device, std::chrono::microseconds window) {
+  CHECK_OPS_ENABLED();
+  CHECK_VALID_DEVICE(device);
+  devices_[static_cast<unsigned long>(device)].pollingWindow_ = window;
 }
 
 size_t DevicePcie::getTraceBufferSizeMasterMinion(int device, TraceBufferType traceType) {
@@ -5,6 +5,7 @@
 #pragma once
 #include "device-layer/IDeviceLayer.h"
 #include <et_ioctl.h>
+#include <memory>
 #include <mutex>
 #include <unordered_map>
 
@@ -21,6 +22,9 @@ public:
   void waitForEpollEventsMasterMinion(int device, uint64_t& sq_bitmap, bool& cq_available,
                                       std::chrono::milliseconds timeout = std::chrono::seconds(10)) override;
   bool receiveResponseMasterMinion(int device, std::vector<std::byte>& response) override;
+  size_t receiveResponsesMasterMinion(int device, std::byte* buffer, size_t bufferSize, ResponseInfo* responses,
+                                      size_t maxResponses) override;
+  void setPollingWindowMasterMinion(int device, std::chrono::microseconds window) override;
 
   bool sendCommandServiceProcessor(int device, std::byte* command, size_t commandSize, CmdFlagSP flags) override;
   void setSqThresholdServiceProcessor(int device, uint32_t bytesNeeded) override;
@@ -56,6 +60,29 @@ public:
   bool checkP2pDmaCompatibility(int deviceA, int deviceB) const override;
 
 private:
+  // User-space SQ/CQ rings shared with the driver, see ETSOC1_IOCTL_URING_SETUP. Plain MM commands are written on the
+  // SQ rings and MM responses are read from CQ ring 0 without any copy through the driver nor syscall per response.
+  class UserRings {
+  public:
+    // Returns nullptr if the driver does not support user-space rings
+    static std::unique_ptr<UserRings> create(int fd);
+    ~UserRings();
+
+    // Returns false if there was not enough space on the device SQ to submit the command
+    bool push(int fd, int sqIdx, const std::byte* command, size_t commandSize);
+    // Returns the size of the popped response, 0 if CQ ring is empty
+    size_t pop(int fd, std::byte* buffer, size_t bufferSize);
+
+  private:
+    UserRings(std::byte* base, const uring_setup& setup);
+    uring_ring_hdr* header(uint64_t offset, int index) const;
+
+    std::byte* base_;
+    uring_setup setup_;
+    std::mutex sqMutex_;
+    std::mutex cqMutex_;
+  };
+
   struct DevInfo {
     std::array<char, 32> devName_;
     dram_info userDram_;
@@ -68,11 +95,14 @@ private:
     int fdMgmt_;
     int epFdMgmt_;
     uint64_t p2pCompatBitmap_;
+    std::chrono::microseconds pollingWindow_{0};
+    std::unique_ptr<UserRings> userRings_;
   };
 
   void setupDeviceInfo(int device, DevInfo& deviceInfo, bool enableMgmt, bool enableOps,
                        std::chrono::milliseconds timeout = std::chrono::seconds(30)) const;
-  void teardownDeviceInfo(const DevInfo& deviceInfo, bool disableMgmt, bool disableOps) const;
+  void teardownDeviceInfo(DevInfo& deviceInfo, bool disableMgmt, bool disableOps) const;
+  size_t popResponseMasterMinion(DevInfo& deviceInfo, std::byte* buffer, size_t bufferSize) const;
 
   std::unordered_map<void*, size_t> dmaBuffers_;
   std::vector<DevInfo> devices_;
@@ -5,6 +5,7 @@
 #include "DeviceSysEmu.h"
 #include "SysEmuHostListener.h"
 #include "Utils.h"
+#include <algorithm>
 #include <boost/crc.hpp>
 #include <chrono>
 #include <elfio/elfio.hpp>
@@ -335,6 +336,24 @@ bool DeviceSysEmu::foundEventsMasterMinion(uint64_t& sqBitmap, bool& cqAvailable
   return false;
 }
 
+bool DeviceSysEmu::pollEventsMasterMinion(uint64_t& sqBitmap, bool& cqAvailable) {
+  if (foundEventsMasterMinion(sqBitmap, cqAvailable)) {
+    return true;
+  }
+  // don't wait for the CQ interrupt, look at the queue directly
+  if (!mmCqReady_ && checkForEventEPOLLIN(completionQueueMM_)) {
+    cqAvailable = true;
+    mmCqReady_ = true;
+    return true;
+  }
+  return false;
+}
+
+void DeviceSysEmu::setPollingWindowMasterMinion(int, std::chrono::microseconds window) {
+  std::lock_guard lock(mutex_);
+  mmPollingWindow_ = window;
+}
+
 void DeviceSysEmu::waitForEpollEventsMasterMinion(int, uint64_t& sq_bitmap, bool& cq_available,
                                                   std::chrono::milliseconds timeout) {
   DV_VLOG(HIGH) << "Waiting for interrupt from master minion";
@@ -343,6 +362,22 @@ void DeviceSysEmu::waitForEpollEventsMasterMinion(int, uint64_t& sq_bitmap, bool
   cq_available = false;
 
   auto lock = std::unique_lock<std::mutex>(mutex_);
+  if (mmPollingWindow_.count() > 0) {
+    auto start = std::chrono::steady_clock::now();
+    auto pollingEnd = start + std::min<std::chrono::microseconds>(mmPollingWindow_, timeout);
+    while (isRunning_ && !pollEventsMasterMinion(sq_bitmap, cq_available)) {
+      if (std::chrono::steady_clock::now() >= pollingEnd) {
+        break;
+      }
+      lock.unlock();
+      std::this_thread::yield();
+      lock.lock();
+    }
+    if (!isRunning_ || sq_bitmap != 0 || cq_available) {
+      return;
+    }
+    timeout -= std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+  }
   mmEpollBlock_.wait_for(lock, timeout, [this, &sq_bitmap, &cq_available]() {
     if (!isRunning_) {
       return true;
@@ -414,50 +449,49 @@ void DeviceSysEmu::setSqThresholdServiceProcessor(int, uint32_t bytesNeeded) {
   submissionQueueSP_.thresholdBytes_ = bytesNeeded;
 }
 
-bool DeviceSysEmu::receiveResponse(QueueInfo& queue, std::vector<std::byte>& response, bool& clearEvent) {
-  Checker checker{*this};
-  clearEvent = true;
+size_t DeviceSysEmu::popWrapping(QueueInfo& queue, size_t size, std::byte* dst) {
+  // check if there are some messages to read
+  if (getUsedSpace(queue.cb_) < size) {
+    return 0UL;
+  }
+  auto remaining = size;
+  if (queue.cb_.tail_offset + remaining > queue.cb_.length) {
+    auto bytesUntillEnd = queue.cb_.length - queue.cb_.tail_offset;
+    sysEmu_->mmioRead(queue.bufferAddress_ + sizeof(CircBuffCb) + queue.cb_.tail_offset, bytesUntillEnd, dst);
+    queue.cb_.tail_offset = 0;
+    remaining -= bytesUntillEnd;
+    dst += bytesUntillEnd;
+  }
+  sysEmu_->mmioRead(queue.bufferAddress_ + sizeof(CircBuffCb) + queue.cb_.tail_offset, remaining, dst);
+  queue.cb_.tail_offset = (queue.cb_.tail_offset + remaining) % queue.cb_.length;
+  return size;
+}
 
+size_t DeviceSysEmu::peekResponseSize(QueueInfo& queue) {
   // read queue info
   sysEmu_->mmioRead(queue.bufferAddress_ + offsetof(CircBuffCb, head_offset), sizeof(queue.cb_.head_offset),
                     reinterpret_cast<std::byte*>(&queue.cb_.head_offset));
 
-  // helper function to pop from the circular buffer till size (in bytes) into dst, warping the tail offset if needed
-  auto bufferPopWraping = [this, &queue](size_t size, std::byte* dst) {
-    // check if there are some messages to read
-    if (getUsedSpace(queue.cb_) < size) {
-      return 0UL;
-    }
-    if (queue.cb_.tail_offset + size > queue.cb_.length) {
-      auto bytesUntillEnd = queue.cb_.length - queue.cb_.tail_offset;
-      sysEmu_->mmioRead(queue.bufferAddress_ + sizeof(CircBuffCb) + queue.cb_.tail_offset, bytesUntillEnd, dst);
-      queue.cb_.tail_offset = 0;
-      size -= bytesUntillEnd;
-      dst += bytesUntillEnd;
-    }
-    sysEmu_->mmioRead(queue.bufferAddress_ + sizeof(CircBuffCb) + queue.cb_.tail_offset, size, dst);
-    queue.cb_.tail_offset = (queue.cb_.tail_offset + size) % queue.cb_.length;
-    return size;
-  };
-
-  // make room to pop message header
-  response.resize(kCommonHeaderSize);
-  // pop message header
-  if (bufferPopWraping(kCommonHeaderSize, response.data()) <= 0) {
-    response.clear();
-    return false;
+  // read the message header without consuming it
+  std::array<std::byte, kCommonHeaderSize> header;
+  auto tailOffset = queue.cb_.tail_offset;
+  auto popped = popWrapping(queue, kCommonHeaderSize, header.data());
+  queue.cb_.tail_offset = tailOffset;
+  if (popped == 0) {
+    return 0;
   }
 
   // get the response size
   uint16_t respSize;
-  std::memcpy(&respSize, response.data(), sizeof(respSize));
+  std::memcpy(&respSize, header.data(), sizeof(respSize));
   if (respSize == 0) {
     throw Exception("CompletionQueue: Invalid response size");
   }
-  // make room for message payload
-  response.resize(respSize + kCommonHeaderSize);
-  // pop the message payload
-  if (bufferPopWraping(respSize, &response[kCommonHeaderSize]) <= 0) {
+  return respSize + kCommonHeaderSize;
+}
+
+void DeviceSysEmu::popResponse(QueueInfo& queue, std::byte* response, size_t size, bool& clearEvent) {
+  if (popWrapping(queue, size, response) == 0) {
     throw Exception("CompletionQueue: Couldn't read the response payload. ");
   }
 
@@ -466,10 +500,20 @@ bool DeviceSysEmu::receiveResponse(QueueInfo& queue, std::vector<std::byte>& res
                      reinterpret_cast<std::byte*>(&queue.cb_.tail_offset));
 
   // The availability of queue after the response is received
-  if (getUsedSpace(queue.cb_) > 0) {
-    clearEvent = false;
-  }
+  clearEvent = getUsedSpace(queue.cb_) == 0;
+}
 
+bool DeviceSysEmu::receiveResponse(QueueInfo& queue, std::vector<std::byte>& response, bool& clearEvent) {
+  Checker checker{*this};
+  clearEvent = true;
+
+  auto size = peekResponseSize(queue);
+  if (size == 0) {
+    response.clear();
+    return false;
+  }
+  response.resize(size);
+  popResponse(queue, response.data(), size, clearEvent);
   return true;
 }
 
@@ -485,6 +529,34 @@ bool DeviceSysEmu::receiveResponseMasterMinion(int, std::vector<std::byte>& resp
   return tmp;
 }
 
+size_t DeviceSysEmu::receiveResponsesMasterMinion(int, std::byte* buffer, size_t bufferSize, ResponseInfo* responses,
+                                                  size_t maxResponses) {
+  DV_VLOG(HIGH) << "Start receiving responses from Master Minion";
+  std::lock_guard lock(mutex_);
+  Checker checker{*this};
+  bool clearEvent = true;
+  size_t count = 0;
+  size_t offset = 0;
+  while (count < maxResponses) {
+    auto size = peekResponseSize(completionQueueMM_);
+    if (size == 0) {
+      break;
+    }
+    if (offset + size > bufferSize) {
+      clearEvent = false;
+      break;
+    }
+    popResponse(completionQueueMM_, buffer + offset, size, clearEvent);
+    responses[count++] = ResponseInfo{offset, size};
+    offset = (offset + size + kResponseAlignment - 1) & ~(kResponseAlignment - 1);
+  }
+  if (clearEvent) {
+    mmCqReady_ = false;
+  }
+  DV_VLOG(HIGH) << "Responses from Master Minion received: " << count;
+  return count;
+}
+
 bool DeviceSysEmu::receiveResponseServiceProcessor(int, std::vector<std::byte>& response) {
   DV_VLOG(HIGH) << "Start receiving response from Service Processor";
   std::lock_guard lock(mutex_);
@@ -39,6 +39,9 @@ public:
   void waitForEpollEventsMasterMinion(int device, uint64_t& sqBitmap, bool& cqAvailable,
                                       std::chrono::milliseconds timeout = std::chrono::seconds(10)) override;
   bool receiveResponseMasterMinion(int device, std::vector<std::byte>& response) override;
+  size_t receiveResponsesMasterMinion(int device, std::byte* buffer, size_t bufferSize, ResponseInfo* responses,
+                                      size_t maxResponses) override;
+  void setPollingWindowMasterMinion(int device, std::chrono::microseconds window) override;
 
   bool sendCommandServiceProcessor(int device, std::byte* command, size_t commandSize, CmdFlagSP flags) override;
   void setSqThresholdServiceProcessor(int device, uint32_t bytesNeeded) override;
@@ -97,10 +100,14 @@ private:
 
   bool sendCommand(QueueInfo& queue, std::byte* command, size_t commandSize, bool& clearEvent);
   bool receiveResponse(QueueInfo& queue, std::vector<std::byte>& response, bool& clearEvent);
+  size_t popWrapping(QueueInfo& queue, size_t size, std::byte* dst);
+  size_t peekResponseSize(QueueInfo& queue);
+  void popResponse(QueueInfo& queue, std::byte* response, size_t size, bool& clearEvent);
 
   bool checkForEventEPOLLIN(const QueueInfo& queueInfo) const;
   bool checkForEventEPOLLOUT(const QueueInfo& queueInfo) const;
   bool foundEventsMasterMinion(uint64_t& sqBitmap, bool& cqAvailable);
+  bool pollEventsMasterMinion(uint64_t& sqBitmap, bool& cqAvailable);
   bool foundEventsServiceProcessor(bool& sqAvailable, bool& cqAvailable);
 
   void startHostMemoryAccessThread();
@@ -123,6 +130,7 @@ private:
   uint32_t mmIntrptBitmap_ = 0;
   std::atomic<uint64_t> mmSqBitmap_ = 0;
   std::atomic<bool> mmCqReady_ = false;
+  std::chrono::microseconds mmPollingWindow_{0};
 
   std::condition_variable spEpollBlock_;
   uint32_t spIntrptBitmap_ = 0;
@@ -48,6 +48,13 @@ void DeviceSysEmuMulti::waitForEpollEventsMasterMinion(int device, uint64_t& sqB
 bool DeviceSysEmuMulti::receiveResponseMasterMinion(int device, std::vector<std::byte>& response) {
   return getDevice(device).receiveResponseMasterMinion(device, response);
 }
+size_t DeviceSysEmuMulti::receiveResponsesMasterMinion(int device, std::byte* buffer, size_t bufferSize,
+                                                       ResponseInfo* responses, size_t maxResponses) {
+  return getDevice(device).receiveResponsesMasterMinion(device, buffer, bufferSize, responses, maxResponses);
+}
+void DeviceSysEmuMulti::setPollingWindowMasterMinion(int device, std::chrono::microseconds window) {
+  return getDevice(device).setPollingWindowMasterMinion(device, window);
+}
 
 bool DeviceSysEmuMulti::sendCommandServiceProcessor(int device, std::byte* command, size_t commandSize,
                                                     CmdFlagSP flags) {
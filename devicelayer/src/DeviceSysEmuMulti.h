@@ -17,6 +17,9 @@ public:
   void waitForEpollEventsMasterMinion(int device, uint64_t& sqBitmap, bool& cqAvailable,
                                       std::chrono::milliseconds timeout = std::chrono::seconds(10)) override;
   bool receiveResponseMasterMinion(int device, std::vector<std::byte>& response) override;
+  size_t receiveResponsesMasterMinion(int device, std::byte* buffer, size_t bufferSize, ResponseInfo* responses,
+                                      size_t maxResponses) override;
+  void setPollingWindowMasterMinion(int device, std::chrono::microseconds window) override;
 
   bool sendCommandServiceProcessor(int device, std::byte* command, size_t commandSize, CmdFlagSP flags) override;
   void setSqThresholdServiceProcessor(int device, uint32_t bytesNeeded) override;
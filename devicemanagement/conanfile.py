@@ -34,6 +34,7 @@ class DeviceManagementConan(ConanFile):
     def requirements(self):
         self.requires("deviceApi/2.5.0")
         self.requires("deviceLayer/2.2.0")
+        self.requires("esperantoTrace/2.1.0")
         self.requires("hostUtils/0.3.0")
 
     def validate(self):
@@ -79,7 +80,7 @@ class DeviceManagementConan(ConanFile):
     def package_info(self):
         # library components
         self.cpp_info.components["DM"].set_property("cmake_target_name", "deviceManagement::DM")
-        self.cpp_info.components["DM"].requires = ["deviceApi::deviceApi", "deviceLayer::deviceLayer", "hostUtils::logging"]
+        self.cpp_info.components["DM"].requires = ["deviceApi::deviceApi", "deviceLayer::deviceLayer", "esperantoTrace::et_trace", "hostUtils::logging"]
         self.cpp_info.components["DM"].libs = ["DM"]
         self.cpp_info.components["DM"].includedirs = ["include"]
         self.cpp_info.components["DM"].libdirs = ["lib"]
@@ -87,7 +88,7 @@ class DeviceManagementConan(ConanFile):
             self.cpp_info.components["DM"].defines.append("NDEBUG")
 
         self.cpp_info.components["DM_static"].set_property("cmake_target_name", "deviceManagement::DM_static")
-        self.cpp_info.components["DM_static"].requires = ["deviceApi::deviceApi", "deviceLayer::deviceLayer", "hostUtils::logging"]
+        self.cpp_info.components["DM_static"].requires = ["deviceApi::deviceApi", "deviceLayer::deviceLayer", "esperantoTrace::et_trace", "hostUtils::logging"]
         self.cpp_info.components["DM_static"].libs = ["DM_static"]
         self.cpp_info.components["DM_static"].includedirs = ["include"]
         self.cpp_info.components["DM_static"].libdirs = ["lib"]
@@ -98,6 +98,11 @@ static std::unordered_map<std::string, device_mgmt_api::DM_CMD> const commandCod
   {"DM_CMD_GET_SHIRE_CACHE_CONFIG", device_mgmt_api::DM_CMD::DM_CMD_GET_SHIRE_CACHE_CONFIG},
   {"DM_CMD_SET_VMIN_LUT", device_mgmt_api::DM_CMD::DM_CMD_SET_VMIN_LUT},
   {"DM_CMD_GET_VMIN_LUT", device_mgmt_api::DM_CMD::DM_CMD_GET_VMIN_LUT},
+  {"DM_CMD_GET_TELEMETRY_BATCH", device_mgmt_api::DM_CMD::DM_CMD_GET_TELEMETRY_BATCH},
+  {"DM_CMD_SET_TELEMETRY_STREAM", device_mgmt_api::DM_CMD::DM_CMD_SET_TELEMETRY_STREAM},
+  {"DM_CMD_GET_FIRMWARE_LOAD_STATS", device_mgmt_api::DM_CMD::DM_CMD_GET_FIRMWARE_LOAD_STATS},
+  {"DM_CMD_GET_FIRMWARE_PARTITION_HASHES", device_mgmt_api::DM_CMD::DM_CMD_GET_FIRMWARE_PARTITION_HASHES},
+  {"DM_CMD_SET_FIRMWARE_UPDATE_DELTA", device_mgmt_api::DM_CMD::DM_CMD_SET_FIRMWARE_UPDATE_DELTA},
   {"DM_CMD_MDI_SELECT_HART", device_mgmt_api::DM_CMD::DM_CMD_MDI_SELECT_HART},
   {"DM_CMD_MDI_UNSELECT_HART", device_mgmt_api::DM_CMD::DM_CMD_MDI_UNSELECT_HART},
   {"DM_CMD_MDI_RESET_HART", device_mgmt_api::DM_CMD::DM_CMD_MDI_RESET_HART},
@@ -226,6 +231,65 @@ public:
   /// @return true if event is received in given timeout else false
   bool getDMEvent(const uint32_t device_node, std::vector<std::byte>& event, uint32_t timeout);
 
+  /// @brief Get several telemetry groups with a single request
+  ///
+  /// @param[in] device_node  device index to use
+  /// @param[in] groups  device_mgmt_api::TELEMETRY_GROUP bit mask
+  /// @param[out] sample  telemetry sample, sample.groups_valid tells which
+  /// groups were sampled
+  /// @param[in] timeout  Time to wait for the request to complete
+  ///
+  /// @return Zero if all the requested groups were sampled
+  int getTelemetry(const uint32_t device_node, uint32_t groups, device_mgmt_api::telemetry_sample_t& sample,
+                   uint32_t timeout);
+
+  /// @brief Start streaming telemetry samples. The device logs a sample every
+  /// period_ms into the SP stats trace buffer, which is read in bulk with
+  /// readTelemetry. Subscribing again changes the groups and period.
+  ///
+  /// @param[in] device_node  device index to use
+  /// @param[in] groups  device_mgmt_api::TELEMETRY_GROUP bit mask
+  /// @param[in] period_ms  sampling period in milliseconds, rounded up to the
+  /// device sampling period
+  /// @param[in] timeout  Time to wait for the request to complete
+  ///
+  /// @return Zero if the stream was started
+  int subscribeTelemetry(const uint32_t device_node, uint32_t groups, uint32_t period_ms, uint32_t timeout);
+
+  /// @brief Stop streaming telemetry samples
+  ///
+  /// @param[in] device_node  device index to use
+  /// @param[in] timeout  Time to wait for the request to complete
+  ///
+  /// @return Zero if the stream was stopped
+  int unsubscribeTelemetry(const uint32_t device_node, uint32_t timeout);
+
+  /// @brief Read all the telemetry samples streamed since the previous call.
+  /// The SP stats trace buffer wraps when full, samples older than the buffer
+  /// capacity are lost if not read in time.
+  ///
+  /// @param[in] device_node  device index to use
+  /// @param[out] samples  new samples, oldest first
+  ///
+  /// @return Zero if the call was succesfull
+  int readTelemetry(const uint32_t device_node, std::vector<device_mgmt_api::telemetry_sample_t>& samples);
+
+  /// @brief Update the firmware writing only the flash blocks which changed.
+  /// The CRC32 of each block of the passive partition is read back from the
+  /// device and compared with the image, the device then erases and writes
+  /// only the blocks which differ. The whole image is still written to the
+  /// device scratch region and the whole partition verified against it before
+  /// the partitions swap, exactly as DM_CMD_SET_FIRMWARE_UPDATE.
+  ///
+  /// @param[in] device_node  device index to use
+  /// @param[in] filePath  firmware image path on filesystem
+  /// @param[out] blocksChanged  number of blocks written (can be nullptr)
+  /// @param[in] timeout  Time to wait for the whole update to complete
+  ///
+  /// @return Zero if the firmware was updated
+  int updateFirmwareImageDelta(const uint32_t device_node, const char* filePath, uint32_t* blocksChanged,
+                               uint32_t timeout);
+
 private:
   /// @brief DeviceManagement constructors
   DeviceManagement(){};
@@ -7,6 +7,10 @@
 #include "device-layer/IDeviceLayer.h"
 #include "utils.h"
 
+#include <esperanto/et-trace/layout.h>
+
+#include <algorithm>
+#include <array>
 #include <cerrno>
 #include <cstring>
 #include <chrono>
@@ -25,6 +29,28 @@
 
 using namespace dev;
 
+namespace {
+// Standard CRC-32, matches the SP crc32() used to hash the flash partition blocks
+uint32_t crc32(const unsigned char* data, size_t size) {
+  static const auto table = [] {
+    std::array<uint32_t, 256> t{};
+    for (uint32_t i = 0; i < t.size(); i++) {
+      uint32_t r = i;
+      for (int j = 0; j < 8; j++) {
+        r = (r & 1) ? (r >> 1) ^ 0xEDB88320U : r >> 1;
+      }
+      t[i] = r;
+    }
+    return t;
+  }();
+  uint32_t crc = 0xFFFFFFFFU;
+  for (size_t i = 0; i < size; i++) {
+    crc = table[(crc ^ data[i]) & 0xFF] ^ (crc >> 8);
+  }
+  return crc ^ 0xFFFFFFFFU;
+}
+} // namespace
+
 namespace device_management {
 
 template <typename T, int MaxLen, typename Container = std::deque<T>>
@@ -122,6 +148,8 @@ struct lockable_ {
   std::promise<void> exitReceiverPromise;
   std::timed_mutex sqGuard;
   std::timed_mutex cqGuard;
+  // timestamp of the newest telemetry sample returned by readTelemetry
+  std::atomic<uint64_t> lastTelemetryTimestamp = 0;
 
 private:
   std::unordered_map<device_mgmt_api::tag_id_t, std::promise<std::vector<std::byte>>> commandMap;
@@ -369,6 +397,145 @@ int DeviceManagement::getTraceBufferServiceProcessor(const uint32_t device_node,
   return 0;
 }
 
+int DeviceManagement::getTelemetry(const uint32_t device_node, uint32_t groups,
+                                   device_mgmt_api::telemetry_sample_t& sample, uint32_t timeout) {
+  const uint32_t input[2] = {groups, 0};
+  uint32_t hostLatency = 0;
+  uint64_t devLatency = 0;
+  return serviceRequest(device_node, device_mgmt_api::DM_CMD::DM_CMD_GET_TELEMETRY_BATCH,
+                        reinterpret_cast<const char*>(input), sizeof(input), reinterpret_cast<char*>(&sample),
+                        sizeof(sample), &hostLatency, &devLatency, timeout);
+}
+
+int DeviceManagement::subscribeTelemetry(const uint32_t device_node, uint32_t groups, uint32_t period_ms,
+                                         uint32_t timeout) {
+  if (!groups || !period_ms) {
+    return -EINVAL;
+  }
+  const uint32_t input[2] = {groups, period_ms};
+  uint32_t hostLatency = 0;
+  uint64_t devLatency = 0;
+  return serviceRequest(device_node, device_mgmt_api::DM_CMD::DM_CMD_SET_TELEMETRY_STREAM,
+                        reinterpret_cast<const char*>(input), sizeof(input), nullptr, 0, &hostLatency, &devLatency,
+                        timeout);
+}
+
+int DeviceManagement::unsubscribeTelemetry(const uint32_t device_node, uint32_t timeout) {
+  const uint32_t input[2] = {0, 0};
+  uint32_t hostLatency = 0;
+  uint64_t devLatency = 0;
+  return serviceRequest(device_node, device_mgmt_api::DM_CMD::DM_CMD_SET_TELEMETRY_STREAM,
+                        reinterpret_cast<const char*>(input), sizeof(input), nullptr, 0, &hostLatency, &devLatency,
+                        timeout);
+}
+
+int DeviceManagement::readTelemetry(const uint32_t device_node,
+                                    std::vector<device_mgmt_api::telemetry_sample_t>& samples) {
+  if (!isValidDeviceNode(device_node)) {
+    return -EINVAL;
+  }
+
+  // A single read of the whole SP stats trace buffer returns every sample logged since the last call
+  std::vector<std::byte> buffer;
+  devLayer_->getTraceBufferServiceProcessor(device_node, TraceBufferType::TraceBufferSPStats, buffer);
+  if (buffer.size() < sizeof(trace_buffer_std_header_t)) {
+    return -EIO;
+  }
+  trace_buffer_std_header_t header;
+  memcpy(&header, buffer.data(), sizeof(header));
+  if (header.magic_header != TRACE_MAGIC_HEADER) {
+    return -EIO;
+  }
+
+  auto lockable = getDeviceInstance(device_node);
+  auto lastTimestamp = lockable->lastTelemetryTimestamp.load();
+  auto newestTimestamp = lastTimestamp;
+  const size_t dataSize = std::min(static_cast<size_t>(header.data_size), buffer.size());
+  size_t offset = sizeof(trace_buffer_std_header_t);
+  while (offset + sizeof(trace_custom_event_t) <= dataSize) {
+    trace_custom_event_t entry;
+    memcpy(&entry, buffer.data() + offset, sizeof(entry));
+    auto entrySize = sizeof(trace_entry_header_t) + entry.header.payload_size;
+    if (entry.header.payload_size == 0 || offset + entrySize > dataSize) {
+      break;
+    }
+    if (entry.header.type == TRACE_TYPE_CUSTOM_EVENT && entry.custom_type == TRACE_CUSTOM_TYPE_SP_TELEMETRY &&
+        entry.payload_size == sizeof(device_mgmt_api::telemetry_sample_t)) {
+      device_mgmt_api::telemetry_sample_t sample;
+      memcpy(&sample, buffer.data() + offset + sizeof(trace_custom_event_t), sizeof(sample));
+      if (sample.timestamp > lastTimestamp) {
+        newestTimestamp = std::max(newestTimestamp, sample.timestamp);
+        samples.emplace_back(sample);
+      }
+    }
+    offset += entrySize;
+  }
+  lockable->lastTelemetryTimestamp = newestTimestamp;
+
+  return 0;
+}
+
+int DeviceManagement::updateFirmwareImageDelta(const uint32_t device_node, const char* filePath,
+                                               uint32_t* blocksChanged, uint32_t timeout) {
+  auto end = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeout);
+  auto remaining = [&end] {
+    auto left = std::chrono::duration_cast<std::chrono::milliseconds>(end - std::chrono::steady_clock::now());
+    return static_cast<uint32_t>(std::max<int64_t>(left.count(), 0));
+  };
+
+  if (!isValidDeviceNode(device_node) || !filePath) {
+    return -EINVAL;
+  }
+
+  std::ifstream file(filePath, std::ios::binary);
+  if (!file.good()) {
+    return -EINVAL;
+  }
+  std::vector<unsigned char> fwImage(std::istreambuf_iterator<char>(file), {});
+
+  uint32_t hostLatency = 0;
+  uint64_t devLatency = 0;
+  device_mgmt_api::firmware_partition_hashes_t hashes = {};
+  auto res = serviceRequest(device_node, device_mgmt_api::DM_CMD::DM_CMD_GET_FIRMWARE_PARTITION_HASHES, nullptr, 0,
+                            reinterpret_cast<char*>(&hashes), sizeof(hashes), &hostLatency, &devLatency, remaining());
+  if (res != device_mgmt_api::DM_STATUS_SUCCESS) {
+    return res;
+  }
+  if (hashes.block_size == 0 || hashes.block_count == 0 ||
+      hashes.block_count > FIRMWARE_PARTITION_MAX_BLOCKS) {
+    return -EIO;
+  }
+
+  // As for the full update, only the first partition image of the file is written
+  if (fwImage.size() < static_cast<size_t>(hashes.block_size) * hashes.block_count) {
+    return -EINVAL;
+  }
+
+  uint64_t blockMask = 0;
+  uint32_t changed = 0;
+  for (uint32_t block = 0; block < hashes.block_count; block++) {
+    if (crc32(fwImage.data() + static_cast<size_t>(block) * hashes.block_size, hashes.block_size) !=
+        hashes.crc32[block]) {
+      blockMask |= 1ULL << block;
+      changed++;
+    }
+  }
+  DV_LOG(INFO) << "Firmware delta update: " << changed << " of " << hashes.block_count << " blocks changed";
+
+  // The device still verifies the whole partition against the image in its scratch region
+  if (auto ret = updateFirmwareImage(getDeviceInstance(device_node), filePath); ret != 0) {
+    return ret;
+  }
+
+  res = serviceRequest(device_node, device_mgmt_api::DM_CMD::DM_CMD_SET_FIRMWARE_UPDATE_DELTA,
+                       reinterpret_cast<const char*>(&blockMask), sizeof(blockMask), nullptr, 0, &hostLatency,
+                       &devLatency, remaining());
+  if (blocksChanged) {
+    *blocksChanged = changed;
+  }
+  return res;
+}
+
 bool DeviceManagement::isValidActivePowerManagement(const char* input_buff) {
   for (auto it = activePowerManagementTable.begin(); it != activePowerManagementTable.end(); ++it) {
     if (it->second == *input_buff) {
@@ -516,6 +683,7 @@ int DeviceManagement::serviceRequest(const uint32_t device_node, uint32_t cmd_co
     } break;
     case device_mgmt_api::DM_CMD::DM_CMD_GET_MODULE_RESIDENCY_THROTTLE_STATES:
     case device_mgmt_api::DM_CMD::DM_CMD_GET_MODULE_RESIDENCY_POWER_STATES:
+    case device_mgmt_api::DM_CMD::DM_CMD_GET_TELEMETRY_BATCH:
     case device_mgmt_api::DM_CMD::DM_CMD_SET_DM_TRACE_RUN_CONTROL:
     case device_mgmt_api::DM_CMD::DM_CMD_SET_DM_TRACE_CONFIG:
     case device_mgmt_api::DM_CMD::DM_CMD_MDI_SELECT_HART:
@@ -2549,6 +2549,64 @@ void TestDevMgmtApiSyncCmds::getASICLatency(bool singleDevice) {
   }
 }
 
+void TestDevMgmtApiSyncCmds::getTelemetryBatch(bool singleDevice) {
+  getDM_t dmi = getInstance();
+  ASSERT_TRUE(dmi);
+  DeviceManagement& dm = (*dmi)(devLayer_.get());
+  auto end = Clock::now() + std::chrono::milliseconds(FLAGS_exec_timeout_ms);
+
+  auto deviceCount = singleDevice ? 1 : dm.getDevicesCount();
+  for (int deviceIdx = 0; deviceIdx < deviceCount; deviceIdx++) {
+    device_mgmt_api::telemetry_sample_t sample = {};
+    ASSERT_EQ(dm.getTelemetry(deviceIdx, device_mgmt_api::TELEMETRY_GROUP_ALL, sample, DURATION2MS(end - Clock::now())),
+              device_mgmt_api::DM_STATUS_SUCCESS);
+    DV_LOG(INFO) << "Service Request Completed for Device: " << deviceIdx;
+
+    // Skip validation if loopback driver
+    if (getTestTarget() != Target::Loopback) {
+      EXPECT_EQ(sample.groups_requested, device_mgmt_api::TELEMETRY_GROUP_ALL);
+      EXPECT_EQ(sample.groups_valid, device_mgmt_api::TELEMETRY_GROUP_ALL);
+      // A request without any group is rejected
+      EXPECT_EQ(dm.getTelemetry(deviceIdx, 0, sample, DURATION2MS(end - Clock::now())), -EIO);
+    }
+  }
+}
+
+void TestDevMgmtApiSyncCmds::streamTelemetry(bool singleDevice) {
+  getDM_t dmi = getInstance();
+  ASSERT_TRUE(dmi);
+  DeviceManagement& dm = (*dmi)(devLayer_.get());
+  auto end = Clock::now() + std::chrono::milliseconds(FLAGS_exec_timeout_ms);
+  const uint32_t periodMs = 10;
+
+  auto deviceCount = singleDevice ? 1 : dm.getDevicesCount();
+  for (int deviceIdx = 0; deviceIdx < deviceCount; deviceIdx++) {
+    const uint32_t groups = device_mgmt_api::TELEMETRY_GROUP_SP_STATS | device_mgmt_api::TELEMETRY_GROUP_MODULE_POWER;
+    ASSERT_EQ(dm.subscribeTelemetry(deviceIdx, groups, periodMs, DURATION2MS(end - Clock::now())),
+              device_mgmt_api::DM_STATUS_SUCCESS);
+    std::this_thread::sleep_for(std::chrono::milliseconds(periodMs * 10));
+    ASSERT_EQ(dm.unsubscribeTelemetry(deviceIdx, DURATION2MS(end - Clock::now())), device_mgmt_api::DM_STATUS_SUCCESS);
+
+    // Skip validation if loopback driver
+    if (getTestTarget() != Target::Loopback) {
+      std::vector<device_mgmt_api::telemetry_sample_t> samples;
+      ASSERT_EQ(dm.readTelemetry(deviceIdx, samples), device_mgmt_api::DM_STATUS_SUCCESS);
+      DV_LOG(INFO) << "Device[" << deviceIdx << "]: Received " << samples.size() << " telemetry samples";
+      ASSERT_FALSE(samples.empty());
+      uint64_t lastTimestamp = 0;
+      for (const auto& sample : samples) {
+        EXPECT_EQ(sample.groups_requested, groups);
+        EXPECT_GT(sample.timestamp, lastTimestamp);
+        lastTimestamp = sample.timestamp;
+      }
+      // Samples are returned only once
+      samples.clear();
+      ASSERT_EQ(dm.readTelemetry(deviceIdx, samples), device_mgmt_api::DM_STATUS_SUCCESS);
+      EXPECT_TRUE(samples.empty());
+    }
+  }
+}
+
 void TestDevMgmtApiSyncCmds::getMMErrorCount(bool singleDevice) {
   getDM_t dmi = getInstance();
   ASSERT_TRUE(dmi);
@@ -2597,6 +2655,75 @@ void TestDevMgmtApiSyncCmds::getFWBootstatus(bool singleDevice) {
   }
 }
 
+void TestDevMgmtApiSyncCmds::getFWLoadStats(bool singleDevice) {
+  getDM_t dmi = getInstance();
+  ASSERT_TRUE(dmi);
+  DeviceManagement& dm = (*dmi)(devLayer_.get());
+  auto end = Clock::now() + std::chrono::milliseconds(FLAGS_exec_timeout_ms);
+
+  auto deviceCount = singleDevice ? 1 : dm.getDevicesCount();
+  for (int deviceIdx = 0; deviceIdx < deviceCount; deviceIdx++) {
+    const uint32_t output_size = sizeof(device_mgmt_api::firmware_load_stats_t);
+    char output_buff[output_size] = {0};
+    auto hst_latency = std::make_unique<uint32_t>();
+    auto dev_latency = std::make_unique<uint64_t>();
+
+    ASSERT_EQ(dm.serviceRequest(deviceIdx, device_mgmt_api::DM_CMD::DM_CMD_GET_FIRMWARE_LOAD_STATS, nullptr, 0,
+                                output_buff, output_size, hst_latency.get(), dev_latency.get(),
+                                DURATION2MS(end - Clock::now())),
+              device_mgmt_api::DM_STATUS_SUCCESS);
+    DV_LOG(INFO) << "Service Request Completed for Device: " << deviceIdx;
+
+    // Skip printing and validation if loopback driver
+    if (getTestTarget() != Target::Loopback) {
+      const auto* stats = reinterpret_cast<device_mgmt_api::firmware_load_stats_t*>(output_buff);
+      EXPECT_GT(stats->chunk_size, 0);
+      uint64_t imagesTotalUs = 0;
+      for (const auto& image : stats->images) {
+        DV_LOG(INFO) << "Device[" << deviceIdx << "]: image " << image.image_type << " status " << image.status
+                     << " bytes " << image.bytes << " chunks " << image.chunks << " header " << image.header_us
+                     << "us verify " << image.verify_us << "us flash wait " << image.flash_wait_us << "us crypto "
+                     << image.crypto_us << "us final " << image.final_us << "us total " << image.total_us << "us";
+        EXPECT_EQ(image.status, 0);
+        EXPECT_GT(image.bytes, 0);
+        EXPECT_LE(image.header_us + image.verify_us + image.flash_wait_us + image.crypto_us + image.final_us,
+                  image.total_us);
+        imagesTotalUs += image.total_us;
+      }
+      EXPECT_LE(imagesTotalUs, stats->total_us);
+    }
+  }
+}
+
+void TestDevMgmtApiSyncCmds::getFWPartitionHashes(bool singleDevice) {
+  getDM_t dmi = getInstance();
+  ASSERT_TRUE(dmi);
+  DeviceManagement& dm = (*dmi)(devLayer_.get());
+  auto end = Clock::now() + std::chrono::milliseconds(FLAGS_exec_timeout_ms);
+
+  auto deviceCount = singleDevice ? 1 : dm.getDevicesCount();
+  for (int deviceIdx = 0; deviceIdx < deviceCount; deviceIdx++) {
+    const uint32_t output_size = sizeof(device_mgmt_api::firmware_partition_hashes_t);
+    char output_buff[output_size] = {0};
+    auto hst_latency = std::make_unique<uint32_t>();
+    auto dev_latency = std::make_unique<uint64_t>();
+
+    ASSERT_EQ(dm.serviceRequest(deviceIdx, device_mgmt_api::DM_CMD::DM_CMD_GET_FIRMWARE_PARTITION_HASHES, nullptr, 0,
+                                output_buff, output_size, hst_latency.get(), dev_latency.get(),
+                                DURATION2MS(end - Clock::now())),
+              device_mgmt_api::DM_STATUS_SUCCESS);
+    DV_LOG(INFO) << "Service Request Completed for Device: " << deviceIdx;
+
+    // Skip validation if loopback driver
+    if (getTestTarget() != Target::Loopback) {
+      const auto* hashes = reinterpret_cast<device_mgmt_api::firmware_partition_hashes_t*>(output_buff);
+      EXPECT_EQ(hashes->block_size, 64 * 1024);
+      EXPECT_GT(hashes->block_count, 0);
+      EXPECT_LE(hashes->block_count, FIRMWARE_PARTITION_MAX_BLOCKS);
+    }
+  }
+}
+
 void TestDevMgmtApiSyncCmds::getModuleFWRevision(bool singleDevice) {
   getDM_t dmi = getInstance();
   ASSERT_TRUE(dmi);
@@ -3185,6 +3312,35 @@ void TestDevMgmtApiSyncCmds::setFirmwareUpdateImage(bool singleDevice, bool rese
   }
 }
 
+void TestDevMgmtApiSyncCmds::setFirmwareUpdateImageDelta(bool singleDevice) {
+  getDM_t dmi = getInstance();
+  ASSERT_TRUE(dmi);
+  DeviceManagement& dm = (*dmi)(devLayer_.get());
+  auto timeoutMulFactor = singleDevice ? 1 : 2; // doubling timeout for running on multiple devices
+  auto end = Clock::now() + timeoutMulFactor * std::chrono::milliseconds(FLAGS_exec_timeout_ms);
+
+  ASSERT_TRUE(fs::exists(FLASH_IMG_PATH));
+
+  auto deviceCount = singleDevice ? 1 : dm.getDevicesCount();
+  for (int deviceIdx = 0; deviceIdx < deviceCount; deviceIdx++) {
+    uint32_t firstChanged = 0;
+    uint32_t secondChanged = 0;
+    ASSERT_EQ(dm.updateFirmwareImageDelta(deviceIdx, FLASH_IMG_PATH, &firstChanged, DURATION2MS(end - Clock::now())),
+              device_mgmt_api::DM_STATUS_SUCCESS);
+    // The passive partition now holds the image, only the blocks rewritten by the device itself (boot counters and
+    // config region) can still differ
+    ASSERT_EQ(dm.updateFirmwareImageDelta(deviceIdx, FLASH_IMG_PATH, &secondChanged, DURATION2MS(end - Clock::now())),
+              device_mgmt_api::DM_STATUS_SUCCESS);
+    DV_LOG(INFO) << "Device[" << deviceIdx << "]: delta updates wrote " << firstChanged << " then " << secondChanged
+                 << " blocks";
+
+    // Skip validation if loopback driver
+    if (getTestTarget() != Target::Loopback) {
+      EXPECT_LE(secondChanged, 2);
+    }
+  }
+}
+
 void TestDevMgmtApiSyncCmds::setPCIELinkSpeedToInvalidLinkSpeed(bool singleDevice) {
   getDM_t dmi = getInstance();
   ASSERT_TRUE(dmi);
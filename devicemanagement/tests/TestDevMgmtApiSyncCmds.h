@@ -144,11 +144,16 @@ protected:
   void getASICUtilization(bool singleDevice);
   void getASICStalls(bool singleDevice);
   void getASICLatency(bool singleDevice);
+  void getTelemetryBatch(bool singleDevice);
+  void streamTelemetry(bool singleDevice);
   void getMMErrorCount(bool singleDevice);
   void getFWBootstatus(bool singleDevice);
+  void getFWLoadStats(bool singleDevice);
+  void getFWPartitionHashes(bool singleDevice);
   void getModuleFWRevision(bool singleDevice);
   void setSpRootCertificate(bool singleDevice);
   void setFirmwareUpdateImage(bool singleDevice, bool resetDev, int iterations = 1);
+  void setFirmwareUpdateImageDelta(bool singleDevice);
   void testShireCacheConfig(bool singleDevice);
 
   // Integration tests for SP tracing and error events
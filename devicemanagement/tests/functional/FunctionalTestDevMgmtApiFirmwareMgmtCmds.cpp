@@ -51,6 +51,29 @@ TEST_F(FunctionalTestDevMgmtApiFirmwareMgmtCmds, getFWBootstatus) {
   }
 }
 
+TEST_F(FunctionalTestDevMgmtApiFirmwareMgmtCmds, getFWLoadStats) {
+  // Minion firmware is loaded by SP BL2 only on full boot
+  if (targetInList({Target::FullBoot, Target::Silicon})) {
+    initEventProcessor();
+    getFWLoadStats(false /* Multiple devices */);
+    cleanupEventProcessor();
+  } else {
+    DV_LOG(INFO) << "Skipping the test since its not supported on current target";
+    FLAGS_enable_trace_dump = false;
+  }
+}
+
+TEST_F(FunctionalTestDevMgmtApiFirmwareMgmtCmds, getFWPartitionHashes) {
+  if (targetInList({Target::FullBoot, Target::Silicon})) {
+    initEventProcessor();
+    getFWPartitionHashes(false /* Multiple devices */);
+    cleanupEventProcessor();
+  } else {
+    DV_LOG(INFO) << "Skipping the test since its not supported on current target";
+    FLAGS_enable_trace_dump = false;
+  }
+}
+
 TEST_F(FunctionalTestDevMgmtApiFirmwareMgmtCmds, getModuleFWRevision) {
   if (targetInList({Target::FullBoot, Target::Silicon})) {
     initEventProcessor();
@@ -82,6 +105,22 @@ TEST_F(FunctionalTestDevMgmtApiFirmwareMgmtCmds, DISABLED_updateFirmwareImage) {
   }
 }
 
+TEST_F(FunctionalTestDevMgmtApiFirmwareMgmtCmds, DISABLED_updateFirmwareImageDelta) {
+  if (targetInList({Target::FullBoot, Target::Silicon})) {
+    if (isParallelRun()) {
+      DV_LOG(INFO) << "Skipping the test since it cannot be run in parallel with ops device";
+      FLAGS_enable_trace_dump = false;
+      return;
+    }
+    initEventProcessor();
+    setFirmwareUpdateImageDelta(false /* Multiple Devices */);
+    cleanupEventProcessor();
+  } else {
+    DV_LOG(INFO) << "Skipping the test since its not supported on current target";
+    FLAGS_enable_trace_dump = false;
+  }
+}
+
 TEST_F(FunctionalTestDevMgmtApiFirmwareMgmtCmds, resetSOCSingleDevice) {
   if (isParallelRun()) {
     DV_LOG(INFO) << "Skipping the test since it cannot be run in parallel with ops device";
@@ -49,6 +49,14 @@ TEST_F(FunctionalTestDevMgmtApiPerfMgmtCmds, getASICLatency) {
   getASICLatency(false /* Multiple devices */);
 }
 
+TEST_F(FunctionalTestDevMgmtApiPerfMgmtCmds, getTelemetryBatch) {
+  getTelemetryBatch(false /* Multiple devices */);
+}
+
+TEST_F(FunctionalTestDevMgmtApiPerfMgmtCmds, streamTelemetry) {
+  streamTelemetry(false /* Multiple devices */);
+}
+
 int main(int argc, char** argv) {
   google::InitGoogleLogging(argv[0]);
   google::SetCommandLineOption("GLOG_minloglevel", "0");
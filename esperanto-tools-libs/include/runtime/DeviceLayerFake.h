@@ -15,6 +15,7 @@
 #include <mutex>
 #include <queue>
 #include <string>
+#include <vector>
 
 namespace dev {
 
@@ -85,6 +86,7 @@ public:
     auto cmd = reinterpret_cast<device_ops_api::cmn_header_t*>(command);
     device_ops_api::rsp_header_t rsp;
     rsp.rsp_hdr.tag_id = cmd->tag_id;
+    rsp.rsp_hdr.size = 0;
     switch (cmd->msg_id) {
     case device_ops_api::DEV_OPS_API_MID_DEVICE_OPS_DMA_WRITELIST_CMD:
       rsp.rsp_hdr.msg_id = device_ops_api::DEV_OPS_API_MID_DEVICE_OPS_DMA_WRITELIST_RSP;
@@ -113,10 +115,27 @@ public:
     case device_ops_api::DEV_OPS_API_MID_CHECK_DEVICE_OPS_API_COMPATIBILITY_CMD:
       rsp.rsp_hdr.msg_id = device_ops_api::DEV_OPS_API_MID_DEVICE_OPS_API_COMPATIBILITY_RSP;
       break;
+    case device_ops_api::DEV_OPS_API_MID_DEVICE_OPS_KERNEL_LAUNCH_BATCH_CMD: {
+      // all the launches complete, with a zeroed result each
+      auto numLaunches = (cmd->size - sizeof(device_ops_api::device_ops_kernel_launch_batch_cmd_t)) /
+                         sizeof(device_ops_api::kernel_launch_batch_node);
+      std::vector<std::byte> response(sizeof(device_ops_api::device_ops_kernel_launch_batch_rsp_t) +
+                                      numLaunches * sizeof(device_ops_api::kernel_launch_batch_result));
+      auto batchRsp = reinterpret_cast<device_ops_api::device_ops_kernel_launch_batch_rsp_t*>(response.data());
+      batchRsp->response_info.rsp_hdr.tag_id = cmd->tag_id;
+      batchRsp->response_info.rsp_hdr.msg_id = device_ops_api::DEV_OPS_API_MID_DEVICE_OPS_KERNEL_LAUNCH_BATCH_RSP;
+      batchRsp->response_info.rsp_hdr.size =
+        static_cast<device_ops_api::msg_size_t>(response.size() - sizeof(device_ops_api::rsp_header_t));
+      batchRsp->status = device_ops_api::DEV_OPS_API_KERNEL_LAUNCH_RESPONSE_KERNEL_COMPLETED;
+      batchRsp->num_results = static_cast<uint16_t>(numLaunches);
+      responsesMasterMinion_[device].push(std::move(response));
+      return true;
+    }
     default:
       throw Exception("Please, add command with msg_id: " + std::to_string(cmd->msg_id));
     }
-    responsesMasterMinion_[device].push(rsp);
+    auto begin = reinterpret_cast<const std::byte*>(&rsp);
+    responsesMasterMinion_[device].emplace(begin, begin + sizeof(rsp));
     return true;
   }
 
@@ -144,14 +163,38 @@ public:
     }
 
     if (!responsesMasterMinion_[device].empty()) {
-      response.resize(sizeof(device_ops_api::rsp_header_t));
-      std::memcpy(response.data(), &responsesMasterMinion_[device].front(), sizeof(device_ops_api::rsp_header_t));
+      response = std::move(responsesMasterMinion_[device].front());
       responsesMasterMinion_[device].pop();
       return true;
     }
     return false;
   }
 
+  size_t receiveResponsesMasterMinion(int device, std::byte* buffer, size_t bufferSize, ResponseInfo* responses,
+                                      size_t maxResponses) override {
+    checkDevice(device);
+    std::unique_lock<std::mutex> lock(mmMutex_, std::defer_lock);
+    while (!lock.try_lock()) {
+      // spin-lock
+    }
+
+    auto& pending = responsesMasterMinion_[device];
+    size_t count = 0;
+    size_t offset = 0;
+    while (count < maxResponses && !pending.empty() && offset + pending.front().size() <= bufferSize) {
+      auto responseSize = pending.front().size();
+      std::memcpy(buffer + offset, pending.front().data(), responseSize);
+      pending.pop();
+      responses[count++] = ResponseInfo{offset, responseSize};
+      offset += (responseSize + kResponseAlignment - 1) & ~(kResponseAlignment - 1);
+    }
+    return count;
+  }
+
+  void setPollingWindowMasterMinion(int, std::chrono::microseconds) override {
+    // does nothing in fake
+  }
+
   bool sendCommandServiceProcessor(int device, std::byte* command, size_t, CmdFlagSP) override {
     checkDevice(device);
     std::unique_lock<std::mutex> lock(spMutex_, std::defer_lock);
@@ -299,7 +342,7 @@ public:
   }
 
 private:
-  std::unordered_map<int, std::queue<device_ops_api::rsp_header_t>> responsesMasterMinion_;
+  std::unordered_map<int, std::queue<std::vector<std::byte>>> responsesMasterMinion_;
   std::unordered_map<int, std::queue<device_ops_api::dev_mgmt_rsp_header_t>> responsesServiceProcessor_;
   std::condition_variable cvMm_;
   std::condition_variable cvSp_;
@@ -71,10 +71,13 @@ enum class Class {
   SyncTime,
   IdentifyThread,
   MemoryStats,
+  MemsetDevice,
+  MemcpyDeviceToDeviceLocal,
+  KernelLaunchBatch,
   COUNT
 };
 
-enum class ResponseType { DMARead, DMAWrite, Kernel, DMAP2P, COUNT };
+enum class ResponseType { DMARead, DMAWrite, Kernel, DMAP2P, MemOp, COUNT };
 
 Class class_from_string(const std::string& str);
 Type type_from_string(const std::string& str);
@@ -172,6 +175,8 @@ public:
   void setClass(Class c);
   void setTimeStamp(TimePoint t = Clock::now());
   void setThreadId(std::thread::id id = std::this_thread::get_id());
+  // Sets the textual id of a thread that is not in this process (e.g. read back from a trace); there is no numeric id
+  void setThreadId(std::string id);
   void setExtras(ExtraMetadata extras);
 
   void setDuration(Duration d);
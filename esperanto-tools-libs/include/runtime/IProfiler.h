@@ -19,8 +19,12 @@ namespace rt {
 ///
 class ETRT_API IProfiler {
 public:
-  /// \brief Profiler user can choose what profiling output generate, Json format or Binary format
-  enum class OutputType { Json, Binary };
+  /// \brief Profiler user can choose what profiling output generate, Json format or Binary format.
+  ///
+  /// CompactBinary records fixed-size events into per-thread lock-free buffers and writes them in a compact binary
+  /// format with interned strings. It has the lowest recording overhead; the resulting trace can be converted offline
+  /// to Chrome trace / Perfetto JSON.
+  enum class OutputType { Json, Binary, CompactBinary };
 
   /// \brief Virtual Destructor to enable polymorphic release of IProfiler
   /// instances
@@ -149,6 +149,24 @@ public:
                        std::optional<UserTrace> userTraceConfig = std::nullopt,
                        const std::string& coreDumpFilePath = "");
 
+  /// \brief Queues a chain of kernel launches as a single command. The device executes them back-to-back in the given
+  /// order, each one once the previous one has completed successfully, without any host round trip in between. The
+  /// first failing launch terminates the chain and its error is reported for the whole batch. Per launch timings are
+  /// reported to the profiler.
+  ///
+  /// @param[in] stream handler indicating in which stream the kernels will be executed
+  /// @param[in] launches the kernel launches, see \ref KernelLaunchBatchEntry. There must be at least one and at most
+  /// DEVICE_OPS_KERNEL_LAUNCH_BATCH_NODES_MAX (8) launches; the kernels must have been loaded in the device of the stream
+  /// @param[in] barrier this parameter indicates if the first kernel execution should be postponed till all previous
+  /// works issued into this stream finish (a barrier).
+  /// @param[in] flushL3 this parameter indicates if the L3 should be flushed before each kernel execution starts.
+  ///
+  /// @returns EventId is a handler of an event which can be waited for (waitForEventId) to synchronize when the last
+  /// kernel of the batch ends the execution.
+  ///
+  EventId kernelLaunchBatch(StreamId stream, const std::vector<KernelLaunchBatchEntry>& launches, bool barrier = true,
+                            bool flushL3 = false);
+
   /// \brief Queues a memcpy operation from host memory to device memory. The device memory must be previously
   /// allocated by a mallocDevice.
   ///
@@ -270,6 +288,39 @@ public:
   EventId memcpyDeviceToDevice(DeviceId deviceSrc, StreamId streamDst, const std::byte* d_src, std::byte* d_dst,
                                size_t size, bool barrier = true);
 
+  /// \brief Queues a memset operation which fills a device memory region with a repeated pattern. The fill is
+  /// executed by the compute minions of the device, without any host DMA involved. The device memory must be a valid
+  /// region previously allocated by a mallocDevice.
+  ///
+  /// @param[in] stream handler indicating in which stream to queue the memset operation.
+  /// @param[in] d_dst device memory buffer to fill.
+  /// @param[in] pattern value to write; only the lowest patternSize bytes are used.
+  /// @param[in] size indicates the size of the memset in bytes; it must be a multiple of patternSize.
+  /// @param[in] patternSize size of the pattern in bytes, it can be 1, 2 or 4. d_dst must be aligned to it.
+  /// @param[in] barrier this parameter indicates if the memset operation should be postponed till all previous works
+  /// issued into this stream finish (a barrier). All memset operations are always asynchronous.
+  /// @returns EventId is a handler of an event which can be waited for (waitForEventId) to synchronize when the memset
+  /// ends.
+  ///
+  EventId memsetDevice(StreamId stream, std::byte* d_dst, uint32_t pattern, size_t size, uint8_t patternSize = 1,
+                       bool barrier = true);
+
+  /// \brief Queues a device to device memcpy operation within a single device. The copy is executed by the compute
+  /// minions of the device, without any host DMA involved. The device memory must be a valid region previously
+  /// allocated by a mallocDevice; source and destination regions must not overlap.
+  ///
+  /// @param[in] stream handler indicating in which stream to queue the memcpy operation.
+  /// @param[in] d_src device memory buffer to copy from.
+  /// @param[in] d_dst device memory buffer to copy to.
+  /// @param[in] size indicates the size of the memcpy.
+  /// @param[in] barrier this parameter indicates if the memcpy operation should be postponed till all previous works
+  /// issued into this stream finish (a barrier). All memcpy operations are always asynchronous.
+  /// @returns EventId is a handler of an event which can be waited for (waitForEventId) to synchronize when the memcpy
+  /// ends.
+  ///
+  EventId memcpyDeviceToDeviceLocal(StreamId stream, const std::byte* d_src, std::byte* d_dst, size_t size,
+                                    bool barrier = true);
+
   /// \brief This will block the caller thread until the given event is dispatched or the timeout is reached. This
   /// primitive allows to synchronize with the device execution.
   ///
@@ -427,6 +478,8 @@ private:
 
   virtual EventId doKernelLaunch(StreamId stream, KernelId kernel, const std::byte* kernel_args,
                                  size_t kernel_args_size, const KernelLaunchOptionsImp& options) = 0;
+  virtual EventId doKernelLaunchBatch(StreamId stream, const std::vector<KernelLaunchBatchEntry>& launches,
+                                      bool barrier, bool flushL3) = 0;
 
   virtual EventId doMemcpyHostToDevice(StreamId stream, const std::byte* src, std::byte* dst, size_t size, bool barrier,
                                        const CmaCopyFunction& cmaCopyFunction) = 0;
@@ -441,6 +494,10 @@ private:
                                          std::byte* d_dst, size_t size, bool barrier) = 0;
   virtual EventId doMemcpyDeviceToDevice(DeviceId deviceSrc, StreamId streamDst, const std::byte* d_src,
                                          std::byte* d_dst, size_t size, bool barrier) = 0;
+  virtual EventId doMemsetDevice(StreamId stream, std::byte* d_dst, uint32_t pattern, size_t size, uint8_t patternSize,
+                                 bool barrier) = 0;
+  virtual EventId doMemcpyDeviceToDeviceLocal(StreamId stream, const std::byte* d_src, std::byte* d_dst, size_t size,
+                                              bool barrier) = 0;
 
   virtual bool doWaitForEvent(EventId event, std::chrono::seconds timeout = std::chrono::hours(24)) = 0;
   virtual bool doWaitForStream(StreamId stream, std::chrono::seconds timeout = std::chrono::hours(24)) = 0;
@@ -77,6 +77,14 @@ struct ETRT_API MemcpyList {
   std::vector<Op> operations_;
 };
 
+/// \brief One kernel launch of a \ref IRuntime::kernelLaunchBatch
+struct ETRT_API KernelLaunchBatchEntry {
+  KernelId kernel_;                 ///< kernel to launch, loaded in the device of the stream
+  const std::byte* args_ = nullptr; ///< kernel arguments, already in device memory (see mallocDevice). If null, the
+                                    ///< kernel gets a pointer to an unspecified buffer
+  uint64_t shireMask_;              ///< shires that execute this launch
+};
+
 /// \brief This is the device kernel error context which is a result of a running kernel terminating on a abnormal state
 /// (exception / abort)
 struct ETRT_API __attribute__((aligned(64))) ErrorContext {
@@ -167,7 +175,20 @@ enum class DeviceErrorCode {
   ErrorTypeCmSmodeRtException,
   ErrorTypeCmSmodeRtHang,
 
-  Unknown
+  Unknown,
+
+  // Added after Unknown so that the values of the codes above do not change
+  MemOpUnexpectedError,
+  MemOpInvalidAddress,
+  MemOpInvalidSize,
+  MemOpInvalidShireMask,
+  MemOpInvalidPatternSize,
+  MemOpShiresNotReady,
+  MemOpHostAborted,
+  MemOpError,
+  MemOpCmIfaceMulticastFailed,
+
+  KernelLaunchInvalidBatchSize
 };
 
 /// \brief This struct contains the errorCode given by de device when some command fail and the associated
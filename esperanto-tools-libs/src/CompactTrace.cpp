@@ -0,0 +1,435 @@
+/*-------------------------------------------------------------------------
+ * Copyright (c) 2025 Ainekko, Co.
+ * SPDX-License-Identifier: Apache-2.0
+ *-------------------------------------------------------------------------*/
+
+#include "CompactTrace.h"
+
+#include "Utils.h"
+
+#include <cereal/archives/json.hpp>
+
+#include <cstring>
+#include <iomanip>
+#include <sstream>
+
+namespace rt::profiling::compact {
+
+namespace {
+template <typename T> void writePod(std::ostream& stream, const T& value) {
+  stream.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+template <typename T> bool readPod(std::istream& stream, T& value) {
+  stream.read(reinterpret_cast<char*>(&value), sizeof(T));
+  return static_cast<size_t>(stream.gcount()) == sizeof(T);
+}
+
+size_t roundUpToPowerOfTwo(size_t value) {
+  size_t result = 1;
+  while (result < value) {
+    result <<= 1;
+  }
+  return result;
+}
+
+template <typename T> uint64_t toRaw(T value) {
+  return static_cast<uint64_t>(static_cast<int64_t>(value));
+}
+
+uint32_t internCached(const std::string& str, ThreadBuffer& buffer, StringTable& strings) {
+  if (auto it = buffer.internCache_.find(str); it != end(buffer.internCache_)) {
+    return it->second;
+  }
+  auto id = strings.intern(str);
+  buffer.internCache_.emplace(str, id);
+  return id;
+}
+
+uint64_t encodeValue(const ProfileEvent::ExtraValues& value, ThreadBuffer& buffer, StringTable& strings) {
+  return std::visit(
+    [&buffer, &strings](auto&& v) -> uint64_t {
+      using T = std::decay_t<decltype(v)>;
+      if constexpr (std::is_same_v<T, std::string>) {
+        return internCached(v, buffer, strings);
+      } else if constexpr (std::is_same_v<T, DeviceProperties>) {
+        std::stringstream ss;
+        {
+          cereal::JSONOutputArchive archive(ss, cereal::JSONOutputArchive::Options::NoIndent());
+          archive(cereal::make_nvp(std::string{ProfileEvent::kDeviceProps}, v));
+        }
+        return strings.intern(ss.str());
+      } else if constexpr (std::is_same_v<T, ProfileEvent::Duration>) {
+        return toRaw(v.count());
+      } else if constexpr (std::is_same_v<T, ProfileEvent::SystemTimePoint>) {
+        return toRaw(v.time_since_epoch().count());
+      } else if constexpr (std::is_enum_v<T>) {
+        return toRaw(static_cast<std::underlying_type_t<T>>(v));
+      } else {
+        return static_cast<uint64_t>(v);
+      }
+    },
+    value);
+}
+
+std::string escapeJson(const std::string& str) {
+  std::stringstream ss;
+  for (auto c : str) {
+    switch (c) {
+    case '"':
+      ss << "\\\"";
+      break;
+    case '\\':
+      ss << "\\\\";
+      break;
+    case '\n':
+      ss << "\\n";
+      break;
+    case '\t':
+      ss << "\\t";
+      break;
+    default:
+      if (static_cast<unsigned char>(c) < 0x20) {
+        ss << "\\u" << std::hex << std::setw(4) << std::setfill('0') << static_cast<int>(c) << std::dec;
+      } else {
+        ss << c;
+      }
+    }
+  }
+  return ss.str();
+}
+
+void writeChromeArg(std::ostream& out, const ProfileEvent::ExtraValues& value) {
+  std::visit(
+    [&out](auto&& v) {
+      using T = std::decay_t<decltype(v)>;
+      if constexpr (std::is_same_v<T, std::string>) {
+        out << '"' << escapeJson(v) << '"';
+      } else if constexpr (std::is_same_v<T, DeviceProperties>) {
+        std::stringstream ss;
+        {
+          cereal::JSONOutputArchive archive(ss, cereal::JSONOutputArchive::Options::NoIndent());
+          archive(cereal::make_nvp("value", v));
+        }
+        out << '"' << escapeJson(ss.str()) << '"';
+      } else if constexpr (std::is_same_v<T, ResponseType>) {
+        out << '"' << getString(v) << '"';
+      } else if constexpr (std::is_same_v<T, ProfileEvent::Duration>) {
+        out << std::chrono::duration_cast<std::chrono::nanoseconds>(v).count();
+      } else if constexpr (std::is_same_v<T, ProfileEvent::SystemTimePoint>) {
+        out << std::chrono::duration_cast<std::chrono::nanoseconds>(v.time_since_epoch()).count();
+      } else if constexpr (std::is_same_v<T, bool>) {
+        out << (v ? "true" : "false");
+      } else if constexpr (std::is_enum_v<T>) {
+        out << static_cast<int64_t>(v);
+      } else {
+        out << v;
+      }
+    },
+    value);
+}
+
+double toMicroseconds(ProfileEvent::Duration d) {
+  return std::chrono::duration<double, std::micro>(d).count();
+}
+} // namespace
+
+uint32_t StringTable::intern(const std::string& str) {
+  std::lock_guard lock(mutex_);
+  auto [it, inserted] = ids_.try_emplace(str, static_cast<uint32_t>(strings_.size()));
+  if (inserted) {
+    strings_.emplace_back(str);
+  }
+  return it->second;
+}
+
+std::string StringTable::get(uint32_t id) const {
+  std::lock_guard lock(mutex_);
+  return strings_.at(id);
+}
+
+size_t StringTable::size() const {
+  std::lock_guard lock(mutex_);
+  return strings_.size();
+}
+
+RecordRing::RecordRing(size_t capacity)
+  : records_(roundUpToPowerOfTwo(capacity))
+  , mask_(records_.size() - 1) {
+}
+
+bool RecordRing::push(const CompactRecord* records, size_t count) {
+  auto head = head_.load(std::memory_order_relaxed);
+  auto tail = tail_.load(std::memory_order_acquire);
+  if (records_.size() - (head - tail) < count) {
+    drops_.fetch_add(1, std::memory_order_relaxed);
+    return false;
+  }
+  for (size_t i = 0; i < count; ++i) {
+    records_[(head + i) & mask_] = records[i];
+  }
+  head_.store(head + count, std::memory_order_release);
+  return true;
+}
+
+size_t RecordRing::pop(CompactRecord* out, size_t maxCount) {
+  auto tail = tail_.load(std::memory_order_relaxed);
+  auto head = head_.load(std::memory_order_acquire);
+  auto count = std::min(static_cast<size_t>(head - tail), maxCount);
+  for (size_t i = 0; i < count; ++i) {
+    out[i] = records_[(tail + i) & mask_];
+  }
+  tail_.store(tail + count, std::memory_order_release);
+  return count;
+}
+
+size_t encode(const ProfileEvent& event, ThreadBuffer& buffer, StringTable& strings,
+              std::array<CompactRecord, 4>& out) {
+  auto& first = out[0];
+  first.timeStamp_ = event.getTimeStamp().time_since_epoch().count();
+  // Events may carry the id of another thread (e.g. forwarded by a server), so encode the event's own id
+  if (event.getNumericThreadId() == buffer.threadId_) {
+    if (!buffer.threadIdString_) {
+      buffer.threadIdString_ = internCached(event.getThreadId(), buffer, strings);
+    }
+    first.thread_ = *buffer.threadIdString_;
+  } else {
+    first.thread_ = internCached(event.getThreadId(), buffer, strings);
+  }
+  first.type_ = static_cast<uint8_t>(event.getType());
+  first.class_ = static_cast<uint8_t>(event.getClass());
+  first.numExtras_ = 0;
+  first.flags_ = 0;
+
+  size_t current = 0;
+  for (auto& [key, value] : event.getExtras()) {
+    if (out[current].numExtras_ == kMaxInlineExtras) {
+      if (current + 1 == out.size()) {
+        RT_LOG(WARNING) << "Too many extras in profiling event " << getString(event.getClass()) << ", truncating it";
+        break;
+      }
+      out[current].flags_ |= CompactRecord::kContinued;
+      out[current + 1] = out[current];
+      ++current;
+      out[current].numExtras_ = 0;
+      out[current].flags_ = 0;
+    }
+    auto& extra = out[current].extras_[out[current].numExtras_++];
+    extra.key_ = internCached(key, buffer, strings);
+    extra.tag_ = static_cast<ExtraTag>(value.index());
+    extra.value_ = encodeValue(value, buffer, strings);
+  }
+  return current + 1;
+}
+
+Writer::Writer(std::ostream& stream, const StringTable& strings)
+  : stream_(stream)
+  , strings_(strings) {
+  CompactTraceHeader header{};
+  header.magic_ = kMagic;
+  header.formatVersion_ = kFormatVersion;
+  header.endianMark_ = kLittleEndianMark;
+  header.traceVersion_ = static_cast<uint16_t>(kCurrentVersion);
+  header.recordSize_ = sizeof(CompactRecord);
+  writePod(stream_, header);
+}
+
+void Writer::ensureString(uint32_t id) {
+  if (id < writtenStrings_.size() && writtenStrings_[id]) {
+    return;
+  }
+  if (id >= writtenStrings_.size()) {
+    writtenStrings_.resize(id + 1, false);
+  }
+  auto str = strings_.get(id);
+  writePod(stream_, ChunkKind::String);
+  writePod(stream_, id);
+  writePod(stream_, static_cast<uint32_t>(str.size()));
+  stream_.write(str.data(), static_cast<std::streamsize>(str.size()));
+  writtenStrings_[id] = true;
+}
+
+void Writer::writeRecords(const CompactRecord* records, size_t count) {
+  for (size_t i = 0; i < count; ++i) {
+    auto& record = records[i];
+    ensureString(record.thread_);
+    for (uint8_t e = 0; e < record.numExtras_; ++e) {
+      auto& extra = record.extras_[e];
+      ensureString(extra.key_);
+      if (extra.tag_ == ExtraTag::String || extra.tag_ == ExtraTag::DeviceProperties) {
+        ensureString(static_cast<uint32_t>(extra.value_));
+      }
+    }
+    writePod(stream_, ChunkKind::Record);
+    writePod(stream_, record);
+  }
+}
+
+void Writer::writeDrops(uint32_t index, uint64_t count) {
+  writePod(stream_, ChunkKind::Drops);
+  writePod(stream_, index);
+  writePod(stream_, count);
+}
+
+Reader::Reader(std::istream& stream)
+  : stream_(stream) {
+  CompactTraceHeader header{};
+  if (!readPod(stream_, header) || header.magic_ != kMagic) {
+    throw Exception("Not a compact profiling trace");
+  }
+  if (header.formatVersion_ != kFormatVersion || header.endianMark_ != kLittleEndianMark ||
+      header.recordSize_ != sizeof(CompactRecord)) {
+    throw Exception("Unsupported compact profiling trace format version " + std::to_string(header.formatVersion_));
+  }
+}
+
+ProfileEvent::ExtraValues Reader::decodeValue(const CompactExtra& extra) const {
+  auto raw = extra.value_;
+  switch (extra.tag_) {
+  case ExtraTag::U64:
+    return raw;
+  case ExtraTag::Event:
+    return static_cast<EventId>(raw);
+  case ExtraTag::Stream:
+    return static_cast<StreamId>(static_cast<int64_t>(raw));
+  case ExtraTag::Device:
+    return static_cast<DeviceId>(static_cast<int64_t>(raw));
+  case ExtraTag::Kernel:
+    return static_cast<KernelId>(static_cast<int64_t>(raw));
+  case ExtraTag::ResponseType:
+    return static_cast<ResponseType>(raw);
+  case ExtraTag::Duration:
+    return ProfileEvent::Duration(static_cast<int64_t>(raw));
+  case ExtraTag::DeviceProperties: {
+    std::stringstream ss(strings_.at(static_cast<uint32_t>(raw)));
+    DeviceProperties props;
+    cereal::JSONInputArchive archive(ss);
+    archive(cereal::make_nvp(std::string{ProfileEvent::kDeviceProps}, props));
+    return props;
+  }
+  case ExtraTag::Version:
+    return static_cast<Version>(raw);
+  case ExtraTag::SystemTimePoint:
+    return ProfileEvent::SystemTimePoint(ProfileEvent::SystemTimePoint::duration(static_cast<int64_t>(raw)));
+  case ExtraTag::String:
+    return strings_.at(static_cast<uint32_t>(raw));
+  case ExtraTag::Bool:
+    return raw != 0;
+  case ExtraTag::U32:
+    return static_cast<uint32_t>(raw);
+  default:
+    throw Exception("Unknown compact profiling extra tag " + std::to_string(static_cast<int>(extra.tag_)));
+  }
+}
+
+bool Reader::next(ProfileEvent& event) {
+  ProfileEvent::ExtraMetadata extras;
+  bool pending = false;
+  ChunkKind kind;
+  while (readPod(stream_, kind)) {
+    switch (kind) {
+    case ChunkKind::String: {
+      uint32_t id;
+      uint32_t size;
+      readPod(stream_, id);
+      readPod(stream_, size);
+      std::string str(size, '\0');
+      stream_.read(str.data(), size);
+      strings_[id] = std::move(str);
+      break;
+    }
+    case ChunkKind::Drops: {
+      uint32_t index;
+      uint64_t count;
+      readPod(stream_, index);
+      readPod(stream_, count);
+      drops_ += count;
+      break;
+    }
+    case ChunkKind::Record: {
+      CompactRecord record;
+      if (!readPod(stream_, record)) {
+        throw Exception("Truncated compact profiling trace");
+      }
+      for (uint8_t e = 0; e < record.numExtras_; ++e) {
+        auto& extra = record.extras_[e];
+        extras.emplace(strings_.at(extra.key_), decodeValue(extra));
+      }
+      if (record.flags_ & CompactRecord::kContinued) {
+        pending = true;
+        break;
+      }
+      event = ProfileEvent(static_cast<Type>(record.type_), static_cast<Class>(record.class_));
+      event.setTimeStamp(ProfileEvent::TimePoint(ProfileEvent::Duration(record.timeStamp_)));
+      event.setThreadId(strings_.at(record.thread_));
+      event.setExtras(std::move(extras));
+      return true;
+    }
+    default:
+      throw Exception("Unknown compact profiling chunk " + std::to_string(static_cast<int>(kind)));
+    }
+  }
+  if (pending) {
+    throw Exception("Truncated compact profiling trace");
+  }
+  return false;
+}
+
+void convertToChromeTrace(std::istream& input, std::ostream& output) {
+  Reader reader(input);
+  ProfileEvent evt;
+  bool first = true;
+  output << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+  while (reader.next(evt)) {
+    output << (first ? "\n" : ",\n");
+    first = false;
+    auto tid = evt.getThreadId();
+    auto ts = toMicroseconds(evt.getTimeStamp().time_since_epoch());
+
+    if (evt.getClass() == Class::IdentifyThread && evt.getThreadName()) {
+      output << R"({"ph":"M","name":"thread_name","pid":0,"tid":)" << tid << R"(,"args":{"name":")"
+             << escapeJson(evt.getThreadName().value()) << "\"}}";
+      continue;
+    }
+
+    output << R"({"name":")" << getString(evt.getClass()) << R"(","cat":"runtime","pid":0,"tid":)" << tid
+           << ",\"ts\":" << std::fixed << std::setprecision(3) << ts;
+    auto eventId = evt.getEvent();
+    switch (evt.getType()) {
+    case Type::Start:
+    case Type::End:
+      // Start and End of the same runtime event can come from different threads, so use async events when possible
+      if (eventId) {
+        output << ",\"ph\":\"" << (evt.getType() == Type::Start ? 'b' : 'e') << "\",\"id\":" << static_cast<int>(*eventId);
+      } else {
+        output << ",\"ph\":\"" << (evt.getType() == Type::Start ? 'B' : 'E') << '"';
+      }
+      break;
+    case Type::Complete:
+      output << ",\"ph\":\"X\",\"dur\":" << toMicroseconds(evt.getDuration().value_or(ProfileEvent::Duration{0}));
+      break;
+    case Type::Counter:
+      output << ",\"ph\":\"C\"";
+      break;
+    case Type::Instant:
+    default:
+      output << ",\"ph\":\"i\",\"s\":\"t\"";
+      break;
+    }
+    output << ",\"args\":{";
+    bool firstArg = true;
+    for (auto& [key, value] : evt.getExtras()) {
+      output << (firstArg ? "" : ",") << '"' << escapeJson(key) << "\":";
+      firstArg = false;
+      writeChromeArg(output, value);
+    }
+    output << "}}";
+  }
+  if (reader.getDroppedRecords() > 0) {
+    output << (first ? "\n" : ",\n") << R"({"name":"DroppedRecords","ph":"C","pid":0,"tid":0,"ts":0,"args":{"count":)"
+           << reader.getDroppedRecords() << "}}";
+  }
+  output << "\n]}\n";
+}
+
+} // namespace rt::profiling::compact
@@ -0,0 +1,183 @@
+/*-------------------------------------------------------------------------
+ * Copyright (c) 2025 Ainekko, Co.
+ * SPDX-License-Identifier: Apache-2.0
+ *-------------------------------------------------------------------------*/
+
+#pragma once
+
+#include "runtime/IProfileEvent.h"
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <istream>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <optional>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+// Compact binary trace format used by ProfilerImp when started with OutputType::CompactBinary.
+//
+// The stream starts with a CompactTraceHeader followed by a sequence of chunks, each one prefixed by a ChunkKind byte:
+//  - String: uint32_t id, uint32_t length, <length> bytes. Defines an interned string before its first use.
+//  - Record: one CompactRecord, stored as is (host endianness, as stated in the header).
+//  - Drops:  uint32_t recording thread index, uint64_t number of records dropped because that thread's ring buffer was
+//            full.
+// Events with more than kMaxInlineExtras extras are split in several records, all but the last one flagged as
+// continued.
+namespace rt::profiling::compact {
+
+constexpr std::array<char, 4> kMagic = {'E', 'T', 'P', 'B'};
+constexpr uint16_t kFormatVersion = 1;
+constexpr uint16_t kLittleEndianMark = 0x0102;
+constexpr size_t kMaxInlineExtras = 10;
+
+enum class ChunkKind : uint8_t { String = 1, Record = 3, Drops = 4 };
+
+// Mirrors the alternatives of ProfileEvent::ExtraValues, in the same order
+enum class ExtraTag : uint8_t {
+  U64,
+  Event,
+  Stream,
+  Device,
+  Kernel,
+  ResponseType,
+  Duration,
+  DeviceProperties, // value is the id of an interned string holding the properties serialized as JSON
+  Version,
+  SystemTimePoint,
+  String, // value is the id of an interned string
+  Bool,
+  U32,
+};
+
+struct CompactTraceHeader {
+  std::array<char, 4> magic_;
+  uint16_t formatVersion_;
+  uint16_t endianMark_;
+  uint16_t traceVersion_;
+  uint16_t recordSize_;
+  uint32_t reserved_;
+};
+
+struct CompactExtra {
+  uint64_t value_;
+  uint32_t key_; // interned string id
+  ExtraTag tag_;
+  uint8_t reserved_[3];
+};
+
+struct CompactRecord {
+  static constexpr uint8_t kContinued = 0x1;
+
+  int64_t timeStamp_; // ProfileEvent::Clock ticks since epoch
+  uint32_t thread_;   // interned string of the event thread id, as ProfileEvent::getThreadId() returns it
+  uint8_t type_;
+  uint8_t class_;
+  uint8_t numExtras_;
+  uint8_t flags_;
+  std::array<CompactExtra, kMaxInlineExtras> extras_;
+};
+static_assert(std::is_trivially_copyable_v<CompactRecord>, "CompactRecord must be a POD");
+
+// String interning shared by all recording threads. Ids are dense and never reused.
+class StringTable {
+public:
+  uint32_t intern(const std::string& str);
+  std::string get(uint32_t id) const;
+  size_t size() const;
+
+private:
+  mutable std::mutex mutex_;
+  std::unordered_map<std::string, uint32_t> ids_;
+  std::vector<std::string> strings_;
+};
+
+// Single producer / single consumer ring of fixed-size records. The producer is the thread which owns the buffer, the
+// consumer is the profiler IO thread.
+class RecordRing {
+public:
+  explicit RecordRing(size_t capacity);
+
+  // Pushes all the records or none of them. Returns false (and accounts a drop) when there is not enough room.
+  bool push(const CompactRecord* records, size_t count);
+  // Pops up to maxCount records into out, returns the number of popped records
+  size_t pop(CompactRecord* out, size_t maxCount);
+
+  uint64_t takeDrops() {
+    return drops_.exchange(0, std::memory_order_relaxed);
+  }
+
+private:
+  std::vector<CompactRecord> records_;
+  size_t mask_;
+  alignas(64) std::atomic<uint64_t> head_{0};
+  alignas(64) std::atomic<uint64_t> tail_{0};
+  alignas(64) std::atomic<uint64_t> drops_{0};
+};
+
+// Per recording thread state
+struct ThreadBuffer {
+  ThreadBuffer(uint32_t index, std::thread::id threadId, size_t capacity)
+    : index_(index)
+    , threadId_(threadId)
+    , ring_(capacity) {
+  }
+  uint32_t index_;
+  std::thread::id threadId_;
+  RecordRing ring_;
+  // Interned string of threadId_, set by the first event of this thread
+  std::optional<uint32_t> threadIdString_;
+  // Owning thread local cache of already interned strings, avoids taking the StringTable lock for every record
+  std::unordered_map<std::string, uint32_t> internCache_;
+  // Only accessed by the owning thread
+  bool identified_ = false;
+};
+
+// Encodes a ProfileEvent into one or more records. Returns the number of records written into out.
+size_t encode(const ProfileEvent& event, ThreadBuffer& buffer, StringTable& strings,
+              std::array<CompactRecord, 4>& out);
+
+// Writes chunks into the output stream, emitting the definitions of the strings referenced by the records on demand
+class Writer {
+public:
+  Writer(std::ostream& stream, const StringTable& strings);
+  void writeRecords(const CompactRecord* records, size_t count);
+  void writeDrops(uint32_t index, uint64_t count);
+
+private:
+  void ensureString(uint32_t id);
+
+  std::ostream& stream_;
+  const StringTable& strings_;
+  std::vector<bool> writtenStrings_;
+};
+
+// Reads back a compact trace, rebuilding the original ProfileEvents
+class Reader {
+public:
+  explicit Reader(std::istream& stream);
+
+  // Returns false when there are no more events
+  bool next(ProfileEvent& event);
+  // Total number of records dropped by the recorder so far
+  uint64_t getDroppedRecords() const {
+    return drops_;
+  }
+
+private:
+  ProfileEvent::ExtraValues decodeValue(const CompactExtra& extra) const;
+
+  std::istream& stream_;
+  std::unordered_map<uint32_t, std::string> strings_;
+  uint64_t drops_ = 0;
+};
+
+// Converts a compact trace into Chrome trace event format JSON (also understood by Perfetto UI)
+void convertToChromeTrace(std::istream& input, std::ostream& output);
+
+} // namespace rt::profiling::compact
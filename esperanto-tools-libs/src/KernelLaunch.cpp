@@ -156,3 +156,68 @@ EventId RuntimeImp::doKernelLaunch(StreamId streamId, KernelId kernelId, const s
   Sync(event);
   return event;
 }
+
+EventId RuntimeImp::doKernelLaunchBatch(StreamId streamId, const std::vector<KernelLaunchBatchEntry>& launches,
+                                        bool barrier, bool flushL3) {
+  if (launches.empty() || launches.size() > DEVICE_OPS_KERNEL_LAUNCH_BATCH_NODES_MAX) {
+    throw Exception("Kernel launch batch must have between 1 and " +
+                    std::to_string(DEVICE_OPS_KERNEL_LAUNCH_BATCH_NODES_MAX) + " launches");
+  }
+  SpinLock lock(mutex_);
+  auto streamInfo = streamManager_.getStreamInfo(streamId);
+  auto deviceId = DeviceId{streamInfo.device_};
+  auto validMask = deviceLayer_->getDeviceConfig(streamInfo.device_).computeMinionShireMask_;
+
+  std::vector<std::byte> cmdBase(sizeof(device_ops_api::device_ops_kernel_launch_batch_cmd_t) +
+                                 launches.size() * sizeof(device_ops_api::kernel_launch_batch_node));
+  auto cmdPtr = reinterpret_cast<device_ops_api::device_ops_kernel_launch_batch_cmd_t*>(cmdBase.data());
+
+  for (size_t i = 0; i < launches.size(); ++i) {
+    const auto& launch = launches[i];
+    const auto& kernel = find(kernels_, launch.kernel_)->second;
+    if (kernel->deviceId_ != deviceId) {
+      throw Exception("Can't execute stream and kernel associated to a different device");
+    }
+    if (~validMask & launch.shireMask_ || !(validMask & launch.shireMask_)) {
+      std::stringstream ss;
+      ss << "Shiremask of launch " << i << " is invalid. Valid selectable values for shire mask are: 0x" << std::hex
+         << validMask;
+      throw Exception(ss.str());
+    }
+    cmdPtr->list[i].code_start_address = kernel->getEntryAddress();
+    cmdPtr->list[i].pointer_to_args = reinterpret_cast<uint64_t>(launch.args_);
+    cmdPtr->list[i].shire_mask = launch.shireMask_;
+  }
+
+  // the launches without arguments get the parameters buffer of the batch
+  auto pBuffer = executionContextCache_->allocBuffer(deviceId);
+  for (size_t i = 0; i < launches.size(); ++i) {
+    if (launches[i].args_ == nullptr) {
+      cmdPtr->list[i].pointer_to_args = reinterpret_cast<uint64_t>(pBuffer->getParametersPtr());
+    }
+  }
+
+  auto event = eventManager_.getNextId();
+  streamManager_.addEvent(streamId, event);
+  executionContextCache_->reserveBuffer(event, pBuffer);
+
+  cmdPtr->command_info.cmd_hdr.tag_id = static_cast<uint16_t>(event);
+  cmdPtr->command_info.cmd_hdr.msg_id = device_ops_api::DEV_OPS_API_MID_DEVICE_OPS_KERNEL_LAUNCH_BATCH_CMD;
+  cmdPtr->command_info.cmd_hdr.size = static_cast<device_ops_api::msg_size_t>(cmdBase.size());
+  cmdPtr->command_info.cmd_hdr.flags = 0;
+  if (barrier) {
+    cmdPtr->command_info.cmd_hdr.flags |= device_ops_api::CMD_FLAGS_BARRIER_ENABLE;
+  }
+  if (flushL3) {
+    cmdPtr->command_info.cmd_hdr.flags |= device_ops_api::CMD_FLAGS_KERNEL_LAUNCH_FLUSH_L3;
+  }
+  cmdPtr->exception_buffer = reinterpret_cast<uint64_t>(pBuffer->getExceptionContextPtr());
+
+  RT_VLOG(LOW) << "Pushing kernel Launch Batch Command on SQ: " << streamInfo.vq_
+               << " EventId: " << cmdPtr->command_info.cmd_hdr.tag_id << ", launches: " << launches.size();
+  auto& commandSender = find(commandSenders_, getCommandSenderIdx(streamInfo.device_, streamInfo.vq_))->second;
+  commandSender.send(Command{cmdBase, commandSender, event, event, streamId, false, true});
+
+  Sync(event);
+  return event;
+}
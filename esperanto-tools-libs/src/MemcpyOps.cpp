@@ -327,4 +327,83 @@ EventId RuntimeImp::doMemcpyDeviceToDevice(DeviceId deviceSrc, StreamId streamDs
   Sync(evt);
   return evt;
 }
+
+EventId RuntimeImp::doMemsetDevice(StreamId stream, std::byte* d_dst, uint32_t pattern, size_t size,
+                                   uint8_t patternSize, bool barrier) {
+  if (patternSize != 1 && patternSize != 2 && patternSize != 4) {
+    throw Exception("memsetDevice pattern size must be 1, 2 or 4 bytes");
+  }
+  if (size % patternSize != 0 || reinterpret_cast<uint64_t>(d_dst) % patternSize != 0) {
+    throw Exception("memsetDevice address and size must be multiples of the pattern size");
+  }
+  auto streamInfo = streamManager_.getStreamInfo(stream);
+  auto& commandSender = find(commandSenders_, getCommandSenderIdx(streamInfo.device_, streamInfo.vq_))->second;
+  auto dc = deviceLayer_->getDeviceConfig(streamInfo.device_);
+  SpinLock lock(mutex_);
+  if (checkMemcpyDeviceAddress_) {
+    const auto& mm = memoryManagers_.at(DeviceId{streamInfo.device_});
+    mm.checkOperation(d_dst, size);
+  }
+  auto evt = eventManager_.getNextId();
+  RT_VLOG(LOW) << "MemsetDevice stream: " << static_cast<int>(stream) << " EventId: " << static_cast<int>(evt)
+               << std::hex << " Device address: " << d_dst << " Pattern: " << pattern << " Size: " << size;
+  streamManager_.addEvent(stream, evt);
+
+  auto data = std::vector<std::byte>(sizeof(device_ops_memset_cmd_t));
+  auto dataPtr = reinterpret_cast<device_ops_memset_cmd_t*>(data.data());
+
+  dataPtr->command_info.cmd_hdr.size = static_cast<msg_size_t>(data.size());
+  dataPtr->command_info.cmd_hdr.tag_id = static_cast<tag_id_t>(evt);
+  dataPtr->command_info.cmd_hdr.msg_id = DEV_OPS_API_MID_DEVICE_OPS_MEMSET_CMD;
+  if (barrier) {
+    dataPtr->command_info.cmd_hdr.flags |= device_ops_api::CMD_FLAGS_BARRIER_ENABLE;
+  }
+  dataPtr->dst_device_phy_addr = reinterpret_cast<uint64_t>(d_dst);
+  dataPtr->size = size;
+  dataPtr->shire_mask = dc.computeMinionShireMask_;
+  dataPtr->pattern = pattern;
+  dataPtr->pattern_size = patternSize;
+
+  commandSender.send(Command{std::move(data), commandSender, evt, evt, stream, false, true});
+
+  Sync(evt);
+  return evt;
+}
+
+EventId RuntimeImp::doMemcpyDeviceToDeviceLocal(StreamId stream, const std::byte* d_src, std::byte* d_dst, size_t size,
+                                                bool barrier) {
+  auto streamInfo = streamManager_.getStreamInfo(stream);
+  auto& commandSender = find(commandSenders_, getCommandSenderIdx(streamInfo.device_, streamInfo.vq_))->second;
+  auto dc = deviceLayer_->getDeviceConfig(streamInfo.device_);
+  SpinLock lock(mutex_);
+  if (checkMemcpyDeviceAddress_) {
+    const auto& mm = memoryManagers_.at(DeviceId{streamInfo.device_});
+    mm.checkOperation(d_src, size);
+    mm.checkOperation(d_dst, size);
+  }
+  auto evt = eventManager_.getNextId();
+  RT_VLOG(LOW) << "MemcpyDeviceToDeviceLocal stream: " << static_cast<int>(stream)
+               << " EventId: " << static_cast<int>(evt) << std::hex << " DeviceSrc address: " << d_src
+               << " DeviceDst address: " << d_dst << " Size: " << size;
+  streamManager_.addEvent(stream, evt);
+
+  auto data = std::vector<std::byte>(sizeof(device_ops_memcpy_local_cmd_t));
+  auto dataPtr = reinterpret_cast<device_ops_memcpy_local_cmd_t*>(data.data());
+
+  dataPtr->command_info.cmd_hdr.size = static_cast<msg_size_t>(data.size());
+  dataPtr->command_info.cmd_hdr.tag_id = static_cast<tag_id_t>(evt);
+  dataPtr->command_info.cmd_hdr.msg_id = DEV_OPS_API_MID_DEVICE_OPS_MEMCPY_LOCAL_CMD;
+  if (barrier) {
+    dataPtr->command_info.cmd_hdr.flags |= device_ops_api::CMD_FLAGS_BARRIER_ENABLE;
+  }
+  dataPtr->src_device_phy_addr = reinterpret_cast<uint64_t>(d_src);
+  dataPtr->dst_device_phy_addr = reinterpret_cast<uint64_t>(d_dst);
+  dataPtr->size = size;
+  dataPtr->shire_mask = dc.computeMinionShireMask_;
+
+  commandSender.send(Command{std::move(data), commandSender, evt, evt, stream, false, true});
+
+  Sync(evt);
+  return evt;
+}
 } // namespace rt
@@ -55,6 +55,9 @@ std::string getString(Class cls) {
     STR_PROFILING_CLASS(SyncTime)
     STR_PROFILING_CLASS(IdentifyThread)
     STR_PROFILING_CLASS(MemoryStats)
+    STR_PROFILING_CLASS(MemsetDevice)
+    STR_PROFILING_CLASS(MemcpyDeviceToDeviceLocal)
+    STR_PROFILING_CLASS(KernelLaunchBatch)
 
   default:
     RT_LOG(WARNING) << "No stringized unknown profiling::Class. Consider adding it to " __FILE__;
@@ -90,6 +93,8 @@ std::string getString(ResponseType rspType) {
     return "Kernel";
   case ResponseType::DMAP2P:
     return "DMA P2P";
+  case ResponseType::MemOp:
+    return "Memory Op";
   default:
     RT_LOG(WARNING) << "No stringized unknown ResponseType. Consider adding it to " __FILE__;
     return "Unknown response type: " + std::to_string(static_cast<int>(rspType));
@@ -126,6 +131,9 @@ Class class_from_string(const std::string& str) {
     s_map[getString(Class::SyncTime)] = Class::SyncTime;
     s_map[getString(Class::IdentifyThread)] = Class::IdentifyThread;
     s_map[getString(Class::MemoryStats)] = Class::MemoryStats;
+    s_map[getString(Class::MemsetDevice)] = Class::MemsetDevice;
+    s_map[getString(Class::MemcpyDeviceToDeviceLocal)] = Class::MemcpyDeviceToDeviceLocal;
+    s_map[getString(Class::KernelLaunchBatch)] = Class::KernelLaunchBatch;
 
     assert(s_map.size() == static_cast<int>(Class::COUNT));
   });
@@ -154,6 +162,7 @@ ResponseType response_type_from_string(const std::string& str) {
     s_map[getString(ResponseType::DMAWrite)] = ResponseType::DMAWrite;
     s_map[getString(ResponseType::Kernel)] = ResponseType::Kernel;
     s_map[getString(ResponseType::DMAP2P)] = ResponseType::DMAP2P;
+    s_map[getString(ResponseType::MemOp)] = ResponseType::MemOp;
 
     assert(s_map.size() == static_cast<int>(ResponseType::COUNT));
   });
@@ -286,6 +295,10 @@ void ProfileEvent::setThreadId(std::thread::id id) {
   ss << id;
   threadId_ = ss.str();
 }
+void ProfileEvent::setThreadId(std::string id) {
+  numericThreadId_ = std::thread::id();
+  threadId_ = std::move(id);
+}
 void ProfileEvent::setExtras(ExtraMetadata extras) {
   extra_ = std::move(extras);
 }
@@ -11,18 +11,48 @@
 
 namespace rt::profiling {
 
+namespace {
+std::atomic<uint64_t> s_nextInstanceId{1};
+
+// Last ThreadBuffer used by this thread, saves the profiler lookup on the recording hot path
+struct ThreadBufferCache {
+  uint64_t instanceId_ = 0;
+  compact::ThreadBuffer* buffer_ = nullptr;
+};
+thread_local ThreadBufferCache s_threadBufferCache;
+
+constexpr size_t kIoBatchRecords = 256;
+constexpr auto kIoPollPeriod = std::chrono::milliseconds(1);
+} // namespace
+
+ProfilerImp::ProfilerImp()
+  : instanceId_(s_nextInstanceId++) {
+}
+
 // IProfiler interface
 void ProfilerImp::start(std::ostream& outputStream, OutputType outputType) {
   if (recording_) {
     throw Exception("Profiler was already started");
   }
+  compact_ = outputType == OutputType::CompactBinary;
   recording_ = true;
-  ioThread_ = std::thread(std::bind(&ProfilerImp::ioThread, this, outputType, &outputStream));
+  if (compact_) {
+    ioThread_ = std::thread(std::bind(&ProfilerImp::compactIoThread, this, &outputStream));
+  } else {
+    ioThread_ = std::thread(std::bind(&ProfilerImp::ioThread, this, outputType, &outputStream));
+  }
   ProfileEvent evt(Type::Instant, Class::StartProfiling);
   evt.setExtras({{"version", kCurrentVersion}});
   record(std::move(evt));
 
   SpinLock lock{mutex_};
+  if (compact_) {
+    while (!delayedEvents_.empty()) {
+      recordCompact(delayedEvents_.front());
+      delayedEvents_.pop();
+    }
+    return;
+  }
   while (!delayedEvents_.empty()) {
     auto& event = delayedEvents_.front();
     events_.emplace(std::move(event));
@@ -44,6 +74,10 @@ void ProfilerImp::record(const ProfileEvent& event) {
   if (!recording_) {
     return;
   }
+  if (compact_) {
+    recordCompact(event);
+    return;
+  }
 
   auto identifyThreadEvent = identifyThread();
 
@@ -102,6 +136,79 @@ std::optional<ProfileEvent> ProfilerImp::identifyThread() {
   }
 }
 
+compact::ThreadBuffer& ProfilerImp::getThreadBuffer() {
+  auto& cache = s_threadBufferCache;
+  if (cache.instanceId_ == instanceId_) {
+    return *cache.buffer_;
+  }
+  auto threadId = std::this_thread::get_id();
+  SpinLock lock(threadBuffersMutex_);
+  auto& buffer = threadBufferIndex_[threadId];
+  if (buffer == nullptr) {
+    auto index = static_cast<uint32_t>(threadBuffers_.size());
+    buffer = threadBuffers_.emplace_back(std::make_unique<compact::ThreadBuffer>(index, threadId, kThreadBufferRecords))
+               .get();
+    numThreadBuffers_.store(threadBuffers_.size(), std::memory_order_release);
+  }
+  cache.instanceId_ = instanceId_;
+  cache.buffer_ = buffer;
+  return *buffer;
+}
+
+void ProfilerImp::recordCompact(const ProfileEvent& event) {
+  auto& buffer = getThreadBuffer();
+  std::array<compact::CompactRecord, 4> records;
+  if (!buffer.identified_ && !threadName_.empty()) {
+    buffer.identified_ = true;
+    ProfileEvent identifyThreadEvent{Type::Instant, Class::IdentifyThread};
+    identifyThreadEvent.setThreadName(threadName_);
+    auto count = compact::encode(identifyThreadEvent, buffer, strings_, records);
+    buffer.ring_.push(records.data(), count);
+  }
+  auto count = compact::encode(event, buffer, strings_, records);
+  buffer.ring_.push(records.data(), count);
+}
+
+void ProfilerImp::compactIoThread(std::ostream* stream) {
+  profiling::IProfilerRecorder::setCurrentThreadName("Profiler IO thread");
+
+  compact::Writer writer(*stream, strings_);
+  std::vector<compact::ThreadBuffer*> buffers;
+  std::vector<compact::CompactRecord> batch(kIoBatchRecords);
+
+  auto drain = [&]() {
+    if (numThreadBuffers_.load(std::memory_order_acquire) != buffers.size()) {
+      SpinLock lock(threadBuffersMutex_);
+      for (auto i = buffers.size(); i < threadBuffers_.size(); ++i) {
+        buffers.emplace_back(threadBuffers_[i].get());
+      }
+    }
+    size_t drained = 0;
+    for (auto buffer : buffers) {
+      size_t count;
+      while ((count = buffer->ring_.pop(batch.data(), batch.size())) > 0) {
+        writer.writeRecords(batch.data(), count);
+        drained += count;
+      }
+      if (auto drops = buffer->ring_.takeDrops(); drops > 0) {
+        writer.writeDrops(buffer->index_, drops);
+      }
+    }
+    return drained;
+  };
+
+  while (recording_) {
+    if (drain() == 0) {
+      SpinLock lock{mutex_};
+      cv_.wait_for(lock, kIoPollPeriod, [this] { return !recording_; });
+    }
+  }
+  while (drain() > 0) {
+    // keep draining until all the buffers are empty
+  }
+  stream->flush();
+}
+
 void ProfilerImp::ioThread(OutputType outputType, std::ostream* stream) {
   profiling::IProfilerRecorder::setCurrentThreadName("Profiler IO thread");
 
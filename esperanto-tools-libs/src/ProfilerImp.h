@@ -5,6 +5,7 @@
 
 #pragma once
 
+#include "CompactTrace.h"
 #include "Utils.h"
 #include "runtime/IProfileEvent.h"
 #include "runtime/IProfiler.h"
@@ -13,6 +14,7 @@
 #include <cereal/archives/json.hpp>
 #include <cereal/archives/portable_binary.hpp>
 
+#include <atomic>
 #include <mutex>
 #include <queue>
 #include <variant>
@@ -41,6 +43,11 @@ public:
 // Regular implementation
 class ETRT_API ProfilerImp : public IProfilerRecorder {
 public:
+  // Number of records each recording thread can buffer before the IO thread drains them (OutputType::CompactBinary)
+  static constexpr size_t kThreadBufferRecords = 8192;
+
+  ProfilerImp();
+
   // IProfiler interface
   void start(std::ostream& outputStream, OutputType outputType) override;
   void stop() override;
@@ -50,6 +57,9 @@ public:
 
 private:
   void ioThread(OutputType outputType, std::ostream* stream);
+  void compactIoThread(std::ostream* stream);
+  void recordCompact(const ProfileEvent& event);
+  compact::ThreadBuffer& getThreadBuffer();
   std::optional<ProfileEvent> identifyThread();
 
   std::mutex mutex_;
@@ -57,7 +67,16 @@ private:
   std::queue<ProfileEvent> delayedEvents_;
   std::condition_variable cv_;
   std::thread ioThread_;
-  bool recording_ = false;
+  std::atomic<bool> recording_ = false;
+  std::atomic<bool> compact_ = false;
+
+  // Compact recording state: one SPSC ring per recording thread, kept for the whole profiler lifetime
+  const uint64_t instanceId_;
+  compact::StringTable strings_;
+  std::mutex threadBuffersMutex_;
+  std::unordered_map<std::thread::id, compact::ThreadBuffer*> threadBufferIndex_;
+  std::vector<std::unique_ptr<compact::ThreadBuffer>> threadBuffers_;
+  std::atomic<size_t> numThreadBuffers_ = 0;
 
   std::mutex identifiedThreadsMutex_;
   std::unordered_set<std::thread::id> identifiedThreads_;
@@ -23,6 +23,9 @@ constexpr auto kResponsePollingIntervalNoEventsOnFly = 500us;
 constexpr auto kResponseNumTriesBeforePolling = 1;
 constexpr auto kCheckDevicesInterval = 5s;
 constexpr auto kCheckDevicesPolling = 1ms;
+constexpr size_t kMaxResponsesPerBatch = 64;
+// typical response size (kernel launch response with error pointer), used to size the receive buffer
+constexpr size_t kRegularResponseSize = 64;
 } // namespace
 
 void ResponseReceiver::checkResponses(int deviceId) {
@@ -32,7 +35,9 @@ void ResponseReceiver::checkResponses(int deviceId) {
 
   profiling::IProfilerRecorder::setCurrentThreadName("Device " + std::to_string(deviceId) + " response receiver");
 
-  std::vector<std::byte> buffer(kMaxMsgSize);
+  // room for the largest possible response plus a full batch of regular sized ones
+  std::vector<std::byte> buffer(kMaxMsgSize + kMaxResponsesPerBatch * kRegularResponseSize);
+  std::array<dev::ResponseInfo, kMaxResponsesPerBatch> responses;
 
   std::random_device rd;
   std::mt19937 gen(rd());
@@ -41,11 +46,14 @@ void ResponseReceiver::checkResponses(int deviceId) {
     int responsesCount = 0;
     for (int i = 0; i < kResponseNumTriesBeforePolling; ++i) {
       try {
-        while (deviceLayer_.receiveResponseMasterMinion(deviceId, buffer)) {
-          RT_VLOG(LOW) << "Got response from deviceId: " << deviceId;
-          responsesCount++;
-          receiverServices_->onResponseReceived(DeviceId{deviceId}, buffer);
-          RT_VLOG(LOW) << "Response processed";
+        while (auto received = deviceLayer_.receiveResponsesMasterMinion(deviceId, buffer.data(), buffer.size(),
+                                                                          responses.data(), responses.size())) {
+          RT_VLOG(LOW) << "Got " << received << " responses from deviceId: " << deviceId;
+          for (auto r = 0UL; r < received; ++r) {
+            responsesCount++;
+            receiverServices_->onResponseReceived(DeviceId{deviceId}, buffer.data() + responses[r].offset_);
+          }
+          RT_VLOG(LOW) << "Responses processed";
         }
       } catch (const std::exception& e) {
         RT_LOG(WARNING)
@@ -20,7 +20,8 @@ public:
     virtual ~IReceiverServices() = default;
     virtual bool areEventsOnFly(DeviceId device) const = 0;
     virtual void checkDevice(DeviceId device) = 0;
-    virtual void onResponseReceived(DeviceId device, const std::vector<std::byte>& response) = 0;
+    // response points to a full response, header included, only valid during the call
+    virtual void onResponseReceived(DeviceId device, const std::byte* response) = 0;
   };
   explicit ResponseReceiver(dev::IDeviceLayer& deviceLayer, IReceiverServices* receiverServices);
 
@@ -154,6 +154,15 @@ EventId IRuntime::kernelLaunch(StreamId stream, KernelId kernel, const std::byte
   return evt;
 }
 
+EventId IRuntime::kernelLaunchBatch(StreamId stream, const std::vector<KernelLaunchBatchEntry>& launches, bool barrier,
+                                    bool flushL3) {
+  EASY_FUNCTION()
+  ScopedProfileEvent profileEvent(Class::KernelLaunchBatch, *profiler_, stream, barrier);
+  auto evt = doKernelLaunchBatch(stream, launches, barrier, flushL3);
+  profileEvent.setEventId(evt);
+  return evt;
+}
+
 bool IRuntime::waitForEvent(EventId event, std::chrono::seconds timeout) {
   EASY_FUNCTION(profiler::colors::Red300)
   EASY_VALUE("Event", static_cast<int>(event));
@@ -249,4 +258,22 @@ EventId IRuntime::memcpyDeviceToDevice(DeviceId deviceSrc, StreamId streamDst, c
   return doMemcpyDeviceToDevice(deviceSrc, streamDst, d_src, d_dst, size, barrier);
 }
 
+EventId IRuntime::memsetDevice(StreamId stream, std::byte* d_dst, uint32_t pattern, size_t size, uint8_t patternSize,
+                               bool barrier) {
+  EASY_FUNCTION()
+  ScopedProfileEvent profileEvent(Class::MemsetDevice, *profiler_, stream, barrier, d_dst, size);
+  auto eventId = doMemsetDevice(stream, d_dst, pattern, size, patternSize, barrier);
+  profileEvent.setEventId(eventId);
+  return eventId;
+}
+
+EventId IRuntime::memcpyDeviceToDeviceLocal(StreamId stream, const std::byte* d_src, std::byte* d_dst, size_t size,
+                                            bool barrier) {
+  EASY_FUNCTION()
+  ScopedProfileEvent profileEvent(Class::MemcpyDeviceToDeviceLocal, *profiler_, stream, barrier, d_src, d_dst, size);
+  auto eventId = doMemcpyDeviceToDeviceLocal(stream, d_src, d_dst, size, barrier);
+  profileEvent.setEventId(eventId);
+  return eventId;
+}
+
 } // namespace rt
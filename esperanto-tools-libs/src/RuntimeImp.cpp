@@ -597,10 +597,10 @@ void RuntimeImp::waitUntilAllowedToProcessResponseErrors(DeviceId device) {
   sync.condVar_.wait(lock, [&sync] { return (sync.numBlockers_ == 0); });
 }
 
-void RuntimeImp::onResponseReceived(DeviceId device, const std::vector<std::byte>& response) {
+void RuntimeImp::onResponseReceived(DeviceId device, const std::byte* response) {
   EASY_FUNCTION()
   // check the response header
-  auto header = reinterpret_cast<const rsp_header_t*>(response.data());
+  auto header = reinterpret_cast<const rsp_header_t*>(response);
   auto eventId = EventId{header->rsp_hdr.tag_id};
 
   auto recordEvent = [](auto& profiler, const auto& rsp, const auto& evt, ResponseType rspT) {
@@ -621,7 +621,7 @@ void RuntimeImp::onResponseReceived(DeviceId device, const std::vector<std::byte
   bool skipDispatch = false;
   switch (header->rsp_hdr.msg_id) {
   case device_ops_api::DEV_OPS_API_MID_DEVICE_OPS_API_COMPATIBILITY_RSP:
-    if (auto r = reinterpret_cast<const device_ops_api::device_ops_api_compatibility_rsp_t*>(response.data());
+    if (auto r = reinterpret_cast<const device_ops_api::device_ops_api_compatibility_rsp_t*>(response);
         r->status != device_ops_api::DEV_OPS_API_COMPATIBILITY_RESPONSE_SUCCESS) {
       responseWasOk = false;
       RT_LOG(WARNING) << "Error on device api check version: " << r->status
@@ -636,7 +636,7 @@ void RuntimeImp::onResponseReceived(DeviceId device, const std::vector<std::byte
     break;
   case device_ops_api::DEV_OPS_API_MID_DEVICE_OPS_KERNEL_ABORT_RSP:
     unlockProcessingResponseErrors(device, eventId);
-    if (auto r = reinterpret_cast<const device_ops_api::device_ops_kernel_abort_rsp_t*>(response.data());
+    if (auto r = reinterpret_cast<const device_ops_api::device_ops_kernel_abort_rsp_t*>(response);
         r->status != device_ops_api::DEV_OPS_API_KERNEL_ABORT_RESPONSE_SUCCESS) {
       responseWasOk = false;
       RT_LOG(WARNING) << "Error on kernel abort: " << r->status << ". Tag id: " << static_cast<int>(eventId);
@@ -647,7 +647,7 @@ void RuntimeImp::onResponseReceived(DeviceId device, const std::vector<std::byte
     }
     break;
   case device_ops_api::DEV_OPS_API_MID_DEVICE_OPS_DMA_READLIST_RSP: {
-    auto r = reinterpret_cast<const device_ops_api::device_ops_dma_readlist_rsp_t*>(response.data());
+    auto r = reinterpret_cast<const device_ops_api::device_ops_dma_readlist_rsp_t*>(response);
     recordEvent(*getProfiler(), *r, eventId, ResponseType::DMARead);
     if (r->status != device_ops_api::DEV_OPS_API_DMA_RESPONSE_COMPLETE) {
       responseWasOk = false;
@@ -658,7 +658,7 @@ void RuntimeImp::onResponseReceived(DeviceId device, const std::vector<std::byte
   }
   case device_ops_api::DEV_OPS_API_MID_DEVICE_OPS_ABORT_RSP:
     unlockProcessingResponseErrors(device, eventId);
-    if (auto r = reinterpret_cast<const device_ops_api::device_ops_abort_rsp_t*>(response.data());
+    if (auto r = reinterpret_cast<const device_ops_api::device_ops_abort_rsp_t*>(response);
         r->status != device_ops_api::DEV_OPS_API_ABORT_RESPONSE_SUCCESS) {
       responseWasOk = false;
       RT_LOG(WARNING) << "Error on abort command: " << r->status << ". Tag id: " << static_cast<int>(eventId);
@@ -666,7 +666,7 @@ void RuntimeImp::onResponseReceived(DeviceId device, const std::vector<std::byte
     }
     break;
   case device_ops_api::DEV_OPS_API_MID_DEVICE_OPS_DMA_WRITELIST_RSP: {
-    auto r = reinterpret_cast<const device_ops_api::device_ops_dma_writelist_rsp_t*>(response.data());
+    auto r = reinterpret_cast<const device_ops_api::device_ops_dma_writelist_rsp_t*>(response);
     recordEvent(*getProfiler(), *r, eventId, ResponseType::DMAWrite);
     if (r->status != device_ops_api::DEV_OPS_API_DMA_RESPONSE_COMPLETE) {
       responseWasOk = false;
@@ -676,7 +676,7 @@ void RuntimeImp::onResponseReceived(DeviceId device, const std::vector<std::byte
     break;
   }
   case device_ops_api::DEV_OPS_API_MID_DEVICE_OPS_KERNEL_LAUNCH_RSP: {
-    auto r = reinterpret_cast<const device_ops_api::device_ops_kernel_launch_rsp_t*>(response.data());
+    auto r = reinterpret_cast<const device_ops_api::device_ops_kernel_launch_rsp_t*>(response);
     recordEvent(*getProfiler(), *r, eventId, ResponseType::Kernel);
     RT_LOG(INFO) << "KernelLaunch Reponse Event: " << int(eventId);
     if (r->status !=
@@ -703,8 +703,42 @@ void RuntimeImp::onResponseReceived(DeviceId device, const std::vector<std::byte
     }
     break;
   }
+  case device_ops_api::DEV_OPS_API_MID_DEVICE_OPS_KERNEL_LAUNCH_BATCH_RSP: {
+    auto r = reinterpret_cast<const device_ops_api::device_ops_kernel_launch_batch_rsp_t*>(response);
+    recordEvent(*getProfiler(), *r, eventId, ResponseType::Kernel);
+    // one more event per executed launch, with its own timings, child of the batch event
+    auto regularPayloadSize = sizeof(device_ops_api::device_ops_kernel_launch_batch_rsp_t) - sizeof(rsp_header_t);
+    auto numResults = r->response_info.rsp_hdr.size > regularPayloadSize
+                        ? std::min<size_t>(r->num_results, (r->response_info.rsp_hdr.size - regularPayloadSize) /
+                                                             sizeof(device_ops_api::kernel_launch_batch_result))
+                        : 0;
+    for (size_t i = 0; i < numResults; ++i) {
+      ProfileEvent event(Type::Instant, Class::ResponseReceived);
+      event.setParentId(eventId);
+      event.setResponseType(ResponseType::Kernel);
+      event.setDeviceCmdStartTs(r->results[i].device_cmd_start_ts);
+      event.setDeviceCmdWaitDur(0);
+      event.setDeviceCmdExecDur(r->results[i].device_cmd_execute_dur);
+      getProfiler()->record(event);
+    }
+    RT_LOG(INFO) << "KernelLaunchBatch Reponse Event: " << int(eventId) << " Launches: " << r->num_results;
+    if (r->status !=
+        device_ops_api::DEV_OPS_API_KERNEL_LAUNCH_RESPONSE::DEV_OPS_API_KERNEL_LAUNCH_RESPONSE_KERNEL_COMPLETED) {
+      responseWasOk = false;
+      RT_LOG(WARNING) << "Error on kernel launch batch: " << r->status << ", launch " << int(r->num_results) - 1
+                      << ". Tag id: " << static_cast<int>(eventId);
+      ResponseError re{convert(header->rsp_hdr.msg_id, r->status), eventId};
+      re.kernelLaunchErrorExtra_ = {reinterpret_cast<std::byte*>(r->error_ptrs.umode_exception_buffer_ptr),
+                                    reinterpret_cast<std::byte*>(r->error_ptrs.umode_trace_buffer_ptr),
+                                    r->error_ptrs.cm_shire_mask};
+      processResponseError(device, re);
+    } else if (executionContextCache_) {
+      executionContextCache_->releaseBuffer(eventId);
+    }
+    break;
+  }
   case device_ops_api::DEV_OPS_API_MID_DEVICE_OPS_TRACE_RT_CONFIG_RSP:
-    if (auto r = reinterpret_cast<const device_ops_api::device_ops_trace_rt_config_rsp_t*>(response.data());
+    if (auto r = reinterpret_cast<const device_ops_api::device_ops_trace_rt_config_rsp_t*>(response);
         r->status != device_ops_api::DEV_OPS_TRACE_RT_CONFIG_RESPONSE::DEV_OPS_TRACE_RT_CONFIG_RESPONSE_SUCCESS) {
       responseWasOk = false;
       RT_LOG(WARNING) << "Error on firmware trace configure: " << r->status
@@ -713,7 +747,7 @@ void RuntimeImp::onResponseReceived(DeviceId device, const std::vector<std::byte
     }
     break;
   case device_ops_api::DEV_OPS_API_MID_DEVICE_OPS_TRACE_RT_CONTROL_RSP:
-    if (auto r = reinterpret_cast<const device_ops_api::device_ops_trace_rt_control_rsp_t*>(response.data());
+    if (auto r = reinterpret_cast<const device_ops_api::device_ops_trace_rt_control_rsp_t*>(response);
         r->status != device_ops_api::DEV_OPS_TRACE_RT_CONTROL_RESPONSE::DEV_OPS_TRACE_RT_CONTROL_RESPONSE_SUCCESS) {
       responseWasOk = false;
       RT_LOG(WARNING) << "Error on firmware trace control (start/stop): " << r->status
@@ -722,13 +756,13 @@ void RuntimeImp::onResponseReceived(DeviceId device, const std::vector<std::byte
     }
     break;
   case device_ops_api::DEV_OPS_API_MID_DEVICE_OPS_DEVICE_FW_ERROR: {
-    auto r = reinterpret_cast<const device_ops_api::device_ops_device_fw_error_t*>(response.data());
+    auto r = reinterpret_cast<const device_ops_api::device_ops_device_fw_error_t*>(response);
     RT_LOG(WARNING) << "Reported asynchronous ERROR event from firmware: " << r->error_type;
     processResponseError(device, {convert(header->rsp_hdr.msg_id, r->error_type), eventId});
     break;
   }
   case device_ops_api::DEV_OPS_API_MID_DEVICE_OPS_TRACE_BUFFER_FULL_EVENT: {
-    auto r = reinterpret_cast<const device_ops_api::device_ops_trace_buffer_full_event_t*>(response.data());
+    auto r = reinterpret_cast<const device_ops_api::device_ops_trace_buffer_full_event_t*>(response);
     RT_LOG(WARNING) << "Reported asynchronous event from firmware: Trace buffer full. This is ignored by host runtime. "
                        "Trace buffer type: "
                     << r->buffer_type;
@@ -736,7 +770,7 @@ void RuntimeImp::onResponseReceived(DeviceId device, const std::vector<std::byte
   }
   case device_ops_api::DEV_OPS_API_MID_DEVICE_OPS_P2PDMA_READLIST_RSP:
   case device_ops_api::DEV_OPS_API_MID_DEVICE_OPS_P2PDMA_WRITELIST_RSP: {
-    auto r = reinterpret_cast<const device_ops_api::device_ops_p2pdma_writelist_rsp_t*>(response.data());
+    auto r = reinterpret_cast<const device_ops_api::device_ops_p2pdma_writelist_rsp_t*>(response);
     recordEvent(*getProfiler(), *r, eventId, ResponseType::DMAP2P);
     if (r->status != device_ops_api::DEV_OPS_API_DMA_RESPONSE_COMPLETE) {
       responseWasOk = false;
@@ -746,6 +780,18 @@ void RuntimeImp::onResponseReceived(DeviceId device, const std::vector<std::byte
     }
     break;
   }
+  case device_ops_api::DEV_OPS_API_MID_DEVICE_OPS_MEMSET_RSP:
+  case device_ops_api::DEV_OPS_API_MID_DEVICE_OPS_MEMCPY_LOCAL_RSP: {
+    auto r = reinterpret_cast<const device_ops_api::device_ops_memset_rsp_t*>(response);
+    recordEvent(*getProfiler(), *r, eventId, ResponseType::MemOp);
+    if (r->status != device_ops_api::DEV_OPS_API_MEM_OP_RESPONSE_COMPLETE) {
+      responseWasOk = false;
+      RT_LOG(WARNING) << "Error on memsetDevice/memcpyDeviceToDeviceLocal op: " << r->status
+                      << ". Tag id: " << static_cast<int>(eventId);
+      processResponseError(device, {convert(header->rsp_hdr.msg_id, r->status), eventId});
+    }
+    break;
+  }
   default:
     RT_LOG(WARNING) << "Unknown response msg id: " << header->rsp_hdr.msg_id;
     break;
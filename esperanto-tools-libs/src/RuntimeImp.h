@@ -63,6 +63,8 @@ public:
 
   EventId doKernelLaunch(StreamId stream, KernelId kernel, const std::byte* kernel_args, size_t kernel_args_size,
                          const KernelLaunchOptionsImp& options) final;
+  EventId doKernelLaunchBatch(StreamId stream, const std::vector<KernelLaunchBatchEntry>& launches, bool barrier,
+                              bool flushL3) final;
   EventId doMemcpyHostToDevice(StreamId stream, const std::byte* src, std::byte* dst, size_t size, bool barrier,
                                const CmaCopyFunction& cmaCopyFunction) final;
   EventId doMemcpyDeviceToHost(StreamId stream, const std::byte* src, std::byte* dst, size_t size, bool barrier,
@@ -75,6 +77,10 @@ public:
                                  size_t size, bool barrier) final;
   EventId doMemcpyDeviceToDevice(DeviceId deviceSrc, StreamId streamDst, const std::byte* d_src, std::byte* d_dst,
                                  size_t size, bool barrier) final;
+  EventId doMemsetDevice(StreamId stream, std::byte* d_dst, uint32_t pattern, size_t size, uint8_t patternSize,
+                         bool barrier) final;
+  EventId doMemcpyDeviceToDeviceLocal(StreamId stream, const std::byte* d_src, std::byte* d_dst, size_t size,
+                                      bool barrier) final;
 
   bool doWaitForEvent(EventId event, std::chrono::seconds timeout = std::chrono::hours(24)) final;
   bool doWaitForStream(StreamId stream, std::chrono::seconds timeout = std::chrono::hours(24)) final;
@@ -101,7 +107,7 @@ public:
 
   // IResponseServices
   bool areEventsOnFly(DeviceId device) const final;
-  void onResponseReceived(DeviceId device, const std::vector<std::byte>& response) final;
+  void onResponseReceived(DeviceId device, const std::byte* response) final;
 
   // this method is a helper to call eventManager dispatch and streamManager removeEvent
   void dispatch(EventId event);
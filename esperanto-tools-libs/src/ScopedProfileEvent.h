@@ -78,6 +78,16 @@ public:
     event_.setSize(size);
     init();
   }
+  explicit ScopedProfileEvent(Class cls, IProfiler& profiler, StreamId streamId, bool barrier, const std::byte* dst,
+                              size_t size)
+    : profiler_(profiler)
+    , event_{Type::Complete, cls} {
+    event_.setStream(streamId);
+    event_.setBarrier(barrier);
+    event_.setAddressDst(reinterpret_cast<uint64_t>(dst));
+    event_.setSize(size);
+    init();
+  }
   explicit ScopedProfileEvent(Class cls, IProfiler& profiler, EventId eventId)
     : profiler_(profiler)
     , event_{Type::Complete, cls} {
@@ -150,6 +150,18 @@ std::string std::to_string(rt::DeviceErrorCode e) {
 
     STR_DEVICE_ERROR_CODE(Unknown)
 
+    STR_DEVICE_ERROR_CODE(MemOpUnexpectedError)
+    STR_DEVICE_ERROR_CODE(MemOpInvalidAddress)
+    STR_DEVICE_ERROR_CODE(MemOpInvalidSize)
+    STR_DEVICE_ERROR_CODE(MemOpInvalidShireMask)
+    STR_DEVICE_ERROR_CODE(MemOpInvalidPatternSize)
+    STR_DEVICE_ERROR_CODE(MemOpShiresNotReady)
+    STR_DEVICE_ERROR_CODE(MemOpHostAborted)
+    STR_DEVICE_ERROR_CODE(MemOpError)
+    STR_DEVICE_ERROR_CODE(MemOpCmIfaceMulticastFailed)
+
+    STR_DEVICE_ERROR_CODE(KernelLaunchInvalidBatchSize)
+
   default:
     RT_LOG(WARNING) << "Not stringized error code. Consider adding it to " __FILE__;
     return "Not stringized error code: " + std::to_string(static_cast<int>(e));
@@ -8,6 +8,7 @@
 rt::DeviceErrorCode convert(int responseType, uint32_t responseCode) {
   switch (responseType) {
   case DEV_OPS_API_MID_DEVICE_OPS_KERNEL_LAUNCH_RSP:
+  case DEV_OPS_API_MID_DEVICE_OPS_KERNEL_LAUNCH_BATCH_RSP:
     switch (responseCode) {
     case DEV_OPS_API_KERNEL_LAUNCH_RESPONSE_UNEXPECTED_ERROR:
       return rt::DeviceErrorCode::KernelLaunchUnexpectedError;
@@ -35,6 +36,8 @@ rt::DeviceErrorCode convert(int responseType, uint32_t responseCode) {
       return rt::DeviceErrorCode::KernelLaunchInvalidArgsInvalidShireMask;
     case DEV_OPS_API_KERNEL_LAUNCH_RESPONSE_USER_ERROR:
       return rt::DeviceErrorCode::KernelLaunchResponseUserError;
+    case DEV_OPS_API_KERNEL_LAUNCH_RESPONSE_INVALID_ARGS_INVALID_BATCH_SIZE:
+      return rt::DeviceErrorCode::KernelLaunchInvalidBatchSize;
     default:
       RT_LOG(WARNING) << "Unknown DEV_OPS_API_MID_DEVICE_OPS_KERNEL_LAUNCH_RSP response code: " << responseCode;
       return rt::DeviceErrorCode::Unknown;
@@ -103,6 +106,32 @@ rt::DeviceErrorCode convert(int responseType, uint32_t responseCode) {
       RT_LOG(WARNING) << "Unknown DEV_OPS_API_DMA_RESPONSE response code: " << responseCode;
       return rt::DeviceErrorCode::Unknown;
     }
+  case DEV_OPS_API_MID_DEVICE_OPS_MEMSET_RSP:
+  case DEV_OPS_API_MID_DEVICE_OPS_MEMCPY_LOCAL_RSP:
+    switch (responseCode) {
+    case DEV_OPS_API_MEM_OP_RESPONSE_UNEXPECTED_ERROR:
+      return rt::DeviceErrorCode::MemOpUnexpectedError;
+    case DEV_OPS_API_MEM_OP_RESPONSE_INVALID_ADDRESS:
+      return rt::DeviceErrorCode::MemOpInvalidAddress;
+    case DEV_OPS_API_MEM_OP_RESPONSE_INVALID_SIZE:
+      return rt::DeviceErrorCode::MemOpInvalidSize;
+    case DEV_OPS_API_MEM_OP_RESPONSE_INVALID_SHIRE_MASK:
+      return rt::DeviceErrorCode::MemOpInvalidShireMask;
+    case DEV_OPS_API_MEM_OP_RESPONSE_INVALID_PATTERN_SIZE:
+      return rt::DeviceErrorCode::MemOpInvalidPatternSize;
+    case DEV_OPS_API_MEM_OP_RESPONSE_SHIRES_NOT_READY:
+      return rt::DeviceErrorCode::MemOpShiresNotReady;
+    case DEV_OPS_API_MEM_OP_RESPONSE_HOST_ABORTED:
+      return rt::DeviceErrorCode::MemOpHostAborted;
+    case DEV_OPS_API_MEM_OP_RESPONSE_ERROR:
+      return rt::DeviceErrorCode::MemOpError;
+    case DEV_OPS_API_MEM_OP_RESPONSE_CM_IFACE_MULTICAST_FAILED:
+      return rt::DeviceErrorCode::MemOpCmIfaceMulticastFailed;
+
+    default:
+      RT_LOG(WARNING) << "Unknown DEV_OPS_API_MEM_OP_RESPONSE response code: " << responseCode;
+      return rt::DeviceErrorCode::Unknown;
+    }
   case DEV_OPS_API_MID_DEVICE_OPS_TRACE_RT_CONFIG_RSP:
     switch (responseCode) {
     case DEV_OPS_TRACE_RT_CONFIG_RESPONSE_UNEXPECTED_ERROR:
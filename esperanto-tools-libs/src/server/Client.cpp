@@ -499,6 +499,13 @@ EventId Client::doKernelLaunch(StreamId stream, KernelId kernel, const std::byte
   return registerEvent(payload, stream);
 }
 
+EventId Client::doKernelLaunchBatch(StreamId stream, const std::vector<KernelLaunchBatchEntry>& launches, bool barrier,
+                                    bool flushL3) {
+  auto payload = sendRequestAndWait(req::Type::KERNEL_LAUNCH_BATCH,
+                                    req::KernelLaunchBatch{launches, stream, barrier, flushL3});
+  return registerEvent(payload, stream);
+}
+
 EventId Client::doAbortCommand(EventId evt, std::chrono::milliseconds timeout) {
   SpinLock lock(mutex_);
   auto st = find(eventToStream_, evt, "Trying to abort a non existing command.")->second;
@@ -605,3 +612,19 @@ EventId Client::doMemcpyDeviceToDevice(DeviceId deviceSrc, StreamId streamDst, c
                                                    reinterpret_cast<AddressT>(d_dst), size, barrier});
   return registerEvent(payload, streamDst);
 }
+
+EventId Client::doMemsetDevice(StreamId stream, std::byte* d_dst, uint32_t pattern, size_t size, uint8_t patternSize,
+                               bool barrier) {
+  auto payload = sendRequestAndWait(
+    req::Type::MEMSET_DEVICE,
+    req::MemsetDevice{stream, reinterpret_cast<AddressT>(d_dst), pattern, size, patternSize, barrier});
+  return registerEvent(payload, stream);
+}
+
+EventId Client::doMemcpyDeviceToDeviceLocal(StreamId stream, const std::byte* d_src, std::byte* d_dst, size_t size,
+                                            bool barrier) {
+  auto payload = sendRequestAndWait(req::Type::MEMCPY_D2D_LOCAL,
+                                    req::Memcpy{stream, reinterpret_cast<AddressT>(d_src),
+                                                reinterpret_cast<AddressT>(d_dst), size, barrier});
+  return registerEvent(payload, stream);
+}
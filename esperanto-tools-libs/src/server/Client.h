@@ -30,6 +30,8 @@ public:
 
   EventId doKernelLaunch(StreamId stream, KernelId kernel, const std::byte* kernel_args, size_t kernel_args_size,
                          const KernelLaunchOptionsImp& options) final;
+  EventId doKernelLaunchBatch(StreamId stream, const std::vector<KernelLaunchBatchEntry>& launches, bool barrier,
+                              bool flushL3) final;
   EventId doMemcpyHostToDevice(StreamId stream, const std::byte* h_src, std::byte* d_dst, size_t size, bool barrier,
                                const CmaCopyFunction&) final;
 
@@ -44,6 +46,10 @@ public:
                                  size_t size, bool barrier) final;
   EventId doMemcpyDeviceToDevice(DeviceId deviceSrc, StreamId streamDst, const std::byte* d_src, std::byte* d_dst,
                                  size_t size, bool barrier) final;
+  EventId doMemsetDevice(StreamId stream, std::byte* d_dst, uint32_t pattern, size_t size, uint8_t patternSize,
+                         bool barrier) final;
+  EventId doMemcpyDeviceToDeviceLocal(StreamId stream, const std::byte* d_src, std::byte* d_dst, size_t size,
+                                      bool barrier) final;
 
   bool doWaitForEvent(EventId event, std::chrono::seconds timeout = std::chrono::hours(24)) final;
 
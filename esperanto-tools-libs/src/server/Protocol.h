@@ -43,7 +43,7 @@ template <class Archive> void serialize(Archive& archive, StreamError& se) {
 
 namespace Protocol {
 static constexpr int MAJOR = 3;
-static constexpr int MINOR = 3;
+static constexpr int MINOR = 5;
 } // namespace Protocol
 
 namespace req {
@@ -77,6 +77,9 @@ enum class Type : uint32_t {
   MEMCPY_P2P_WRITE,
   ENABLE_TRACING,
   DISABLE_TRACING,
+  MEMSET_DEVICE,
+  MEMCPY_D2D_LOCAL,
+  KERNEL_LAUNCH_BATCH,
 };
 
 using Id = uint32_t;
@@ -109,6 +112,18 @@ struct MemcpyP2P {
   }
 };
 
+struct MemsetDevice {
+  StreamId stream_;
+  AddressT dst_;
+  uint32_t pattern_;
+  size_t size_;
+  uint8_t patternSize_;
+  bool barrier_;
+  template <class Archive> void serialize(Archive& archive) {
+    archive(stream_, dst_, pattern_, size_, patternSize_, barrier_);
+  }
+};
+
 struct KernelLaunch {
   StreamId stream_;
   KernelId kernel_;
@@ -119,6 +134,42 @@ struct KernelLaunch {
   }
 };
 
+struct KernelLaunchBatch {
+  struct Launch {
+    KernelId kernel_;
+    AddressT args_;
+    uint64_t shireMask_;
+    template <class Archive> void serialize(Archive& archive) {
+      archive(kernel_, args_, shireMask_);
+    }
+  };
+  explicit operator std::vector<KernelLaunchBatchEntry>() const {
+    std::vector<KernelLaunchBatchEntry> launches;
+    for (auto& l : launches_) {
+      launches.emplace_back(KernelLaunchBatchEntry{l.kernel_, reinterpret_cast<std::byte*>(l.args_), l.shireMask_});
+    }
+    return launches;
+  }
+  explicit KernelLaunchBatch() = default;
+  explicit KernelLaunchBatch(const std::vector<KernelLaunchBatchEntry>& launches, StreamId st, bool barrier,
+                             bool flushL3)
+    : stream_(st)
+    , barrier_(barrier)
+    , flushL3_(flushL3) {
+    for (auto& l : launches) {
+      launches_.emplace_back(Launch{l.kernel_, reinterpret_cast<AddressT>(l.args_), l.shireMask_});
+    }
+  }
+
+  StreamId stream_;
+  std::vector<Launch> launches_;
+  bool barrier_;
+  bool flushL3_;
+  template <class Archive> void serialize(Archive& archive) {
+    archive(stream_, launches_, barrier_, flushL3_);
+  }
+};
+
 struct Memcpy {
   StreamId stream_;
   AddressT src_;
@@ -235,7 +286,7 @@ struct Request {
   Type type_;
   Id id_ = INVALID_REQUEST_ID;
   std::variant<std::monostate, UnloadCode, KernelLaunch, Memcpy, MemcpyList, CreateStream, DestroyStream, LoadCode,
-               Malloc, Free, AbortStream, AbortCommand, DeviceId, EventId, MemcpyP2P>
+               Malloc, Free, AbortStream, AbortCommand, DeviceId, EventId, MemcpyP2P, MemsetDevice, KernelLaunchBatch>
     payload_;
   template <class Archive> void serialize(Archive& archive) {
     archive(type_, id_, payload_);
@@ -277,6 +328,9 @@ enum class Type : uint32_t {
   ENABLE_TRACING,
   DISABLE_TRACING,
   TRACING_EVENT,
+  MEMSET_DEVICE,
+  MEMCPY_D2D_LOCAL,
+  KERNEL_LAUNCH_BATCH,
 };
 
 constexpr auto getStr(Type t) {
@@ -316,6 +370,9 @@ constexpr auto getStr(Type t) {
     STR_TYPE(ENABLE_TRACING)
     STR_TYPE(DISABLE_TRACING)
     STR_TYPE(TRACING_EVENT)
+    STR_TYPE(MEMSET_DEVICE)
+    STR_TYPE(MEMCPY_D2D_LOCAL)
+    STR_TYPE(KERNEL_LAUNCH_BATCH)
 
   default:
     return "Unknown type";
@@ -323,6 +323,15 @@ void Worker::processRequest(const req::Request& request) {
     break;
   }
 
+  case req::Type::KERNEL_LAUNCH_BATCH: {
+    auto& req = std::get<req::KernelLaunchBatch>(request.payload_);
+    auto evt = runtime_.kernelLaunchBatch(req.stream_, std::vector<KernelLaunchBatchEntry>(req), req.barrier_,
+                                          req.flushL3_);
+    events_.emplace(evt);
+    sendResponse({resp::Type::KERNEL_LAUNCH_BATCH, request.id_, resp::Event{evt}});
+    break;
+  }
+
   case req::Type::GET_DEVICES: {
     auto devices = runtime_.getDevices();
     sendResponse({resp::Type::GET_DEVICES, request.id_, resp::GetDevices{devices}});
@@ -429,6 +438,25 @@ void Worker::processRequest(const req::Request& request) {
     break;
   }
 
+  case req::Type::MEMSET_DEVICE: {
+    auto& req = std::get<req::MemsetDevice>(request.payload_);
+    auto dst = reinterpret_cast<std::byte*>(req.dst_);
+    auto evt = runtime_.memsetDevice(req.stream_, dst, req.pattern_, req.size_, req.patternSize_, req.barrier_);
+    events_.emplace(evt);
+    sendResponse({resp::Type::MEMSET_DEVICE, request.id_, resp::Event{evt}});
+    break;
+  }
+
+  case req::Type::MEMCPY_D2D_LOCAL: {
+    auto& req = std::get<req::Memcpy>(request.payload_);
+    auto src = reinterpret_cast<std::byte*>(req.src_);
+    auto dst = reinterpret_cast<std::byte*>(req.dst_);
+    auto evt = runtime_.memcpyDeviceToDeviceLocal(req.stream_, src, dst, req.size_, req.barrier_);
+    events_.emplace(evt);
+    sendResponse({resp::Type::MEMCPY_D2D_LOCAL, request.id_, resp::Event{evt}});
+    break;
+  }
+
   case req::Type::ENABLE_TRACING: {
     auto profiler = getProfiler();
     if (profiler != nullptr) {
@@ -49,7 +49,7 @@ bool validateVerbosity(const char* flagName, int value) {
   return true;
 }
 bool validateTraceMode(const char* flagName, const std::string& value) {
-  if (value != "json" && value != "binary") {
+  if (value != "json" && value != "binary" && value != "compact") {
     printf("Invalid value for --%s: %s\n", flagName, value.c_str());
     return false;
   }
@@ -87,7 +87,7 @@ DEFINE_string(device_type, "pcie",
 DEFINE_validator(device_type, &validateDeviceType);
 DEFINE_validator(log_verbosity, &validateVerbosity);
 DEFINE_string(tracing_folder, "/var/log/et_runtime", "Folder where will be put the tracing files.");
-DEFINE_string(tracing_mode, "json", "Tracing mode can be json or bin");
+DEFINE_string(tracing_mode, "json", "Tracing mode can be json, binary or compact (lowest overhead)");
 DEFINE_validator(tracing_mode, &validateTraceMode);
 DEFINE_string(tracing_file, "daemon.trace",
               "File which will be stored in tracing_folder containing the traces, it will be appended with '.json' or "
@@ -225,7 +225,9 @@ int main(int argc, char* argv[]) {
       profiler->setLocalProfiler(std::move(localProfiler));
 
       auto type = rt::IProfiler::OutputType::Json;
-      if (FLAGS_tracing_mode != "json") {
+      if (FLAGS_tracing_mode == "compact") {
+        type = rt::IProfiler::OutputType::CompactBinary;
+      } else if (FLAGS_tracing_mode != "json") {
         type = rt::IProfiler::OutputType::Binary;
       }
       profiler->start(*traceFileStream, type);
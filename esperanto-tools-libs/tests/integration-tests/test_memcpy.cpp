@@ -237,6 +237,55 @@ TEST_F(TestMemcpy, simpleMemcpyD2D) {
   ASSERT_EQ(random_trash, result);
 }
 
+TEST_F(TestMemcpy, memsetDevice) {
+  auto dev = devices_[0];
+  auto stream = defaultStreams_[0];
+
+  auto numElems = 1024 * 1024U + 7;
+  auto sizeBytes = numElems * sizeof(uint32_t);
+  auto d_buffer = runtime_->mallocDevice(dev, sizeBytes);
+
+  // fill the whole buffer with a 32bit pattern, then overwrite all but the first element with a byte pattern
+  runtime_->memsetDevice(stream, d_buffer, 0xCAFEBABE, sizeBytes, sizeof(uint32_t));
+  runtime_->memsetDevice(stream, d_buffer + sizeof(uint32_t), 0x5A, sizeBytes - sizeof(uint32_t));
+
+  auto result = std::vector<uint32_t>(numElems);
+  runtime_->memcpyDeviceToHost(stream, d_buffer, reinterpret_cast<std::byte*>(result.data()), sizeBytes);
+  runtime_->waitForStream(stream);
+
+  ASSERT_EQ(result[0], 0xCAFEBABE);
+  for (auto i = 1U; i < numElems; ++i) {
+    ASSERT_EQ(result[i], 0x5A5A5A5A) << "Position: " << i;
+  }
+  ASSERT_THROW(runtime_->memsetDevice(stream, d_buffer, 0, sizeBytes, 3), rt::Exception);
+  ASSERT_THROW(runtime_->memsetDevice(stream, d_buffer + 1, 0, sizeBytes - 4, sizeof(uint32_t)), rt::Exception);
+}
+
+TEST_F(TestMemcpy, memcpyDeviceToDeviceLocal) {
+  std::mt19937 gen(std::random_device{}());
+  std::uniform_int_distribution<uint16_t> dis(0, 255);
+
+  auto dev = devices_[0];
+  auto stream = defaultStreams_[0];
+
+  auto sizeBytes = 1024 * 1024 * 4U + 3;
+  auto random_trash = std::vector<uint8_t>(sizeBytes);
+  for (auto& v : random_trash) {
+    v = static_cast<uint8_t>(dis(gen));
+  }
+  auto d_src = runtime_->mallocDevice(dev, sizeBytes);
+  auto d_dst = runtime_->mallocDevice(dev, sizeBytes + 1);
+
+  // misaligned destination exercises the firmware slow path
+  runtime_->memcpyHostToDevice(stream, reinterpret_cast<std::byte*>(random_trash.data()), d_src, sizeBytes);
+  runtime_->memcpyDeviceToDeviceLocal(stream, d_src, d_dst + 1, sizeBytes);
+
+  auto result = std::vector<uint8_t>(sizeBytes);
+  runtime_->memcpyDeviceToHost(stream, d_dst + 1, reinterpret_cast<std::byte*>(result.data()), sizeBytes);
+  runtime_->waitForStream(stream);
+  ASSERT_EQ(random_trash, result);
+}
+
 int main(int argc, char** argv) {
   RuntimeFixture::ParseArguments(argc, argv);
   testing::InitGoogleTest(&argc, argv);
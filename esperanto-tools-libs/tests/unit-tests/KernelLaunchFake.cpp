@@ -137,6 +137,30 @@ TEST_F(KernelLaunchF, simpleOptions) {
   sendH2D_K_D2H_WithOptions(1, 64, 1024, opts);
 }
 
+TEST_F(KernelLaunchF, batch) {
+  auto args = runtime_->mallocDevice(device_, 64);
+  std::vector<KernelLaunchBatchEntry> launches{{kernel_, args, 0x3}, {kernel_, nullptr, 0x1}, {kernel_, args, 0x2}};
+  for (int i = 0; i < 1000; ++i) {
+    runtime_->kernelLaunchBatch(stream_, launches);
+  }
+  ASSERT_TRUE(runtime_->waitForStream(stream_));
+  ASSERT_TRUE(runtime_->retrieveStreamErrors(stream_).empty());
+  runtime_->freeDevice(device_, args);
+}
+
+TEST_F(KernelLaunchF, batchInvalidArgs) {
+  std::vector<KernelLaunchBatchEntry> launches;
+  EXPECT_THROW(runtime_->kernelLaunchBatch(stream_, launches), Exception);
+  launches.resize(DEVICE_OPS_KERNEL_LAUNCH_BATCH_NODES_MAX + 1, KernelLaunchBatchEntry{kernel_, nullptr, 0x3});
+  EXPECT_THROW(runtime_->kernelLaunchBatch(stream_, launches), Exception);
+  launches.pop_back();
+  launches.back().shireMask_ = 0;
+  EXPECT_THROW(runtime_->kernelLaunchBatch(stream_, launches), Exception);
+  launches.back().shireMask_ = 0x3;
+  runtime_->kernelLaunchBatch(stream_, launches);
+  ASSERT_TRUE(runtime_->waitForStream(stream_));
+}
+
 int main(int argc, char** argv) {
   logging::LoggerDefault logger_;
   g3::log_levels::disable(DEBUG);
@@ -112,6 +112,43 @@ TEST(CommandSender, checkSendBefore) {
   }
 }
 
+TEST(CommandSender, receiveResponsesBatched) {
+  std::vector<std::byte> commandData(64);
+
+  auto header = reinterpret_cast<device_ops_api::cmn_header_t*>(commandData.data());
+  // dummy msg_id to make it work on deviceLayerFake
+  header->msg_id = device_ops_api::DEV_OPS_API_MID_DEVICE_OPS_DMA_WRITELIST_CMD;
+  auto numCommands = 40;
+  auto deviceLayer = std::shared_ptr<dev::IDeviceLayer>(new dev::DeviceLayerFake);
+  profiling::DummyProfiler profiler;
+  CommandSender cs(*deviceLayer, &profiler, 0, 0);
+  for (device_ops_api::tag_id_t i = 0; i < numCommands; ++i) {
+    header->tag_id = device_ops_api::tag_id_t(i + 1);
+    auto evt = EventId(i + 1);
+    cs.send(Command{commandData, cs, evt, evt});
+    cs.enable(evt);
+  }
+  std::this_thread::sleep_for(std::chrono::milliseconds(1000));
+
+  // buffer only fits 16 responses, so we need 3 batches to drain them all
+  constexpr auto kBatch = 16UL;
+  std::vector<std::byte> buffer(kBatch * sizeof(device_ops_api::rsp_header_t));
+  std::vector<dev::ResponseInfo> responses(kBatch * 2);
+  auto expectedTag = 1;
+  for (auto expected : {kBatch, kBatch, numCommands - 2 * kBatch}) {
+    auto received =
+      deviceLayer->receiveResponsesMasterMinion(0, buffer.data(), buffer.size(), responses.data(), responses.size());
+    ASSERT_EQ(received, expected);
+    for (auto i = 0UL; i < received; ++i) {
+      ASSERT_EQ(responses[i].offset_ % dev::IDeviceLayer::kResponseAlignment, 0);
+      auto rsp = reinterpret_cast<device_ops_api::rsp_header_t*>(buffer.data() + responses[i].offset_);
+      ASSERT_EQ(rsp->rsp_hdr.tag_id, expectedTag++);
+    }
+  }
+  EXPECT_EQ(deviceLayer->receiveResponsesMasterMinion(0, buffer.data(), buffer.size(), responses.data(), responses.size()),
+            0);
+}
+
 int main(int argc, char** argv) {
   logging::LoggerDefault logger_;
   testing::InitGoogleTest(&argc, argv);
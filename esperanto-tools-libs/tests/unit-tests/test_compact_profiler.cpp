@@ -0,0 +1,163 @@
+/*-------------------------------------------------------------------------
+ * Copyright (c) 2025 Ainekko, Co.
+ * SPDX-License-Identifier: Apache-2.0
+ *-------------------------------------------------------------------------*/
+
+#include "CompactTrace.h"
+#include "ProfilerImp.h"
+#include "runtime/IProfileEvent.h"
+#include "gtest/gtest.h"
+
+#include <sstream>
+#include <thread>
+#include <vector>
+
+using namespace rt::profiling;
+
+namespace {
+std::vector<ProfileEvent> readAll(const std::string& trace) {
+  std::istringstream iss(trace, std::ios_base::binary);
+  compact::Reader reader(iss);
+  std::vector<ProfileEvent> events;
+  ProfileEvent evt;
+  while (reader.next(evt)) {
+    events.emplace_back(evt);
+  }
+  return events;
+}
+} // namespace
+
+TEST(CompactProfiler, roundtrip) {
+  std::ostringstream oss(std::ios_base::binary);
+  ProfilerImp profiler;
+  profiler.start(oss, rt::IProfiler::OutputType::CompactBinary);
+
+  ProfileEvent evt(Type::Start, Class::KernelLaunch, rt::StreamId{3}, rt::EventId{42});
+  evt.setKernelId(rt::KernelId{7});
+  evt.setDeviceId(rt::DeviceId{1});
+  evt.setDuration(std::chrono::microseconds(15));
+  evt.setBarrier(true);
+  evt.setAlignment(64);
+  evt.setThreadName("worker");
+  evt.setSystemTimeStamp();
+  profiler.record(evt);
+  profiler.stop();
+
+  auto events = readAll(oss.str());
+  ASSERT_EQ(events.size(), 3);
+  EXPECT_EQ(events.front().getClass(), Class::StartProfiling);
+  EXPECT_EQ(events.back().getClass(), Class::EndProfiling);
+
+  auto& read = events[1];
+  EXPECT_EQ(read.getType(), evt.getType());
+  EXPECT_EQ(read.getClass(), evt.getClass());
+  EXPECT_EQ(read.getTimeStamp(), evt.getTimeStamp());
+  EXPECT_EQ(read.getThreadId(), evt.getThreadId());
+  EXPECT_EQ(read.getStream(), evt.getStream());
+  EXPECT_EQ(read.getEvent(), evt.getEvent());
+  EXPECT_EQ(read.getKernelId(), evt.getKernelId());
+  EXPECT_EQ(read.getDeviceId(), evt.getDeviceId());
+  EXPECT_EQ(read.getDuration(), evt.getDuration());
+  EXPECT_EQ(read.getBarrier(), evt.getBarrier());
+  EXPECT_EQ(read.getAlignment(), evt.getAlignment());
+  EXPECT_EQ(read.getThreadName(), evt.getThreadName());
+  EXPECT_EQ(read.getSystemTimeStamp(), evt.getSystemTimeStamp());
+}
+
+TEST(CompactProfiler, keeps_the_event_thread_id) {
+  std::ostringstream oss(std::ios_base::binary);
+  ProfilerImp profiler;
+  profiler.start(oss, rt::IProfiler::OutputType::CompactBinary);
+
+  // Events created on another thread (or forwarded from another process) are recorded with their own thread id
+  ProfileEvent other(Type::Instant, Class::CommandSent);
+  std::thread([&other] { other.setThreadId(); }).join();
+  ProfileEvent remote(Type::Instant, Class::CommandSent);
+  remote.setThreadId(std::string{"12345"});
+  ProfileEvent local(Type::Instant, Class::CommandSent);
+  profiler.record(other);
+  profiler.record(remote);
+  profiler.record(local);
+  profiler.stop();
+
+  auto events = readAll(oss.str());
+  ASSERT_EQ(events.size(), 5);
+  ASSERT_NE(other.getThreadId(), local.getThreadId());
+  EXPECT_EQ(events[1].getThreadId(), other.getThreadId());
+  EXPECT_EQ(events[2].getThreadId(), "12345");
+  EXPECT_EQ(events[3].getThreadId(), local.getThreadId());
+}
+
+TEST(CompactProfiler, many_extras_are_split) {
+  std::ostringstream oss(std::ios_base::binary);
+  ProfilerImp profiler;
+  profiler.start(oss, rt::IProfiler::OutputType::CompactBinary);
+
+  ProfileEvent evt(Type::Complete, Class::DeviceCommand);
+  ProfileEvent::ExtraMetadata extras;
+  for (uint64_t i = 0; i < 2 * compact::kMaxInlineExtras + 1; ++i) {
+    extras.emplace("extra_" + std::to_string(i), i);
+  }
+  evt.setExtras(extras);
+  profiler.record(evt);
+  profiler.stop();
+
+  auto events = readAll(oss.str());
+  ASSERT_EQ(events.size(), 3);
+  auto readExtras = events[1].getExtras();
+  ASSERT_EQ(readExtras.size(), extras.size());
+  for (auto& [key, value] : extras) {
+    ASSERT_EQ(readExtras.count(key), 1);
+    EXPECT_EQ(std::get<uint64_t>(readExtras[key]), std::get<uint64_t>(value));
+  }
+}
+
+TEST(CompactProfiler, multiple_threads) {
+  constexpr auto kNumThreads = 8;
+  constexpr auto kEventsPerThread = 1000;
+  std::ostringstream oss(std::ios_base::binary);
+  ProfilerImp profiler;
+  profiler.start(oss, rt::IProfiler::OutputType::CompactBinary);
+
+  std::vector<std::thread> threads;
+  for (auto t = 0; t < kNumThreads; ++t) {
+    threads.emplace_back([&profiler] {
+      for (auto i = 0; i < kEventsPerThread; ++i) {
+        ProfileEvent evt(Type::Instant, Class::CommandSent);
+        evt.setEvent(rt::EventId{static_cast<uint16_t>(i)});
+        profiler.record(evt);
+      }
+    });
+  }
+  for (auto& t : threads) {
+    t.join();
+  }
+  profiler.stop();
+
+  std::istringstream iss(oss.str(), std::ios_base::binary);
+  compact::Reader reader(iss);
+  ProfileEvent evt;
+  size_t numEvents = 0;
+  while (reader.next(evt)) {
+    numEvents += evt.getClass() == Class::CommandSent;
+  }
+  EXPECT_EQ(numEvents + reader.getDroppedRecords(), kNumThreads * kEventsPerThread);
+}
+
+TEST(CompactProfiler, chrome_trace_conversion) {
+  std::ostringstream oss(std::ios_base::binary);
+  ProfilerImp profiler;
+  profiler.start(oss, rt::IProfiler::OutputType::CompactBinary);
+  profiler.record(ProfileEvent(Type::Start, Class::MemcpyHostToDevice, rt::StreamId{0}, rt::EventId{1}));
+  profiler.record(ProfileEvent(Type::End, Class::MemcpyHostToDevice, rt::StreamId{0}, rt::EventId{1}));
+  profiler.stop();
+
+  std::istringstream iss(oss.str(), std::ios_base::binary);
+  std::ostringstream json;
+  compact::convertToChromeTrace(iss, json);
+  auto str = json.str();
+  EXPECT_NE(str.find("\"traceEvents\""), std::string::npos);
+  EXPECT_NE(str.find("\"name\":\"MemcpyHostToDevice\""), std::string::npos);
+  EXPECT_NE(str.find("\"ph\":\"b\""), std::string::npos);
+  EXPECT_NE(str.find("\"ph\":\"e\""), std::string::npos);
+}
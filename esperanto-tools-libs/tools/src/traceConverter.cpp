@@ -0,0 +1,36 @@
+/*-------------------------------------------------------------------------
+ * Copyright (c) 2025 Ainekko, Co.
+ * SPDX-License-Identifier: Apache-2.0
+ *-------------------------------------------------------------------------*/
+
+// Converts a trace recorded with IProfiler::OutputType::CompactBinary into Chrome trace event JSON, which can be
+// opened with chrome://tracing or https://ui.perfetto.dev
+
+#include "CompactTrace.h"
+
+#include <fstream>
+#include <iostream>
+
+int main(int argc, char* argv[]) {
+  if (argc != 3) {
+    std::cerr << "Usage: " << argv[0] << " <compact trace> <output json>\n";
+    return 1;
+  }
+  std::ifstream input(argv[1], std::ios_base::binary);
+  if (!input.is_open()) {
+    std::cerr << "Can't open input trace " << argv[1] << "\n";
+    return 1;
+  }
+  std::ofstream output(argv[2]);
+  if (!output.is_open()) {
+    std::cerr << "Can't open output file " << argv[2] << "\n";
+    return 1;
+  }
+  try {
+    rt::profiling::compact::convertToChromeTrace(input, output);
+  } catch (const std::exception& e) {
+    std::cerr << "Error converting trace: " << e.what() << "\n";
+    return 1;
+  }
+  return 0;
+}
@@ -83,7 +83,8 @@ typedef enum {
     MM_TO_CM_MESSAGE_ID_TRACE_CONFIGURE,
     MM_TO_CM_MESSAGE_ID_TRACE_BUFFER_EVICT,
     MM_TO_CM_MESSAGE_ID_PMC_CONFIGURE,
-    MM_TO_CM_MESSAGE_ID_DUMP_THREAD_CONTEXT
+    MM_TO_CM_MESSAGE_ID_DUMP_THREAD_CONTEXT,
+    MM_TO_CM_MESSAGE_ID_MEM_OP
 } mm_to_cm_message_id_e;
 
 #define KERNEL_LAUNCH_FLAGS_EVICT_L3_BEFORE_LAUNCH      (1u << 0)
@@ -154,6 +155,24 @@ typedef struct {
 
 ASSERT_CACHE_LINE_CONSTRAINTS(mm_to_cm_message_dump_thread_context_t);
 
+/* Built-in memory operations executed by the compute minions */
+typedef enum { MEM_OP_TYPE_MEMSET = 0, MEM_OP_TYPE_MEMCPY = 1 } mem_op_type_e;
+
+typedef struct {
+    cm_iface_message_header_t header;
+    uint64_t dst_address;
+    uint64_t src_address; /**< Only used by MEM_OP_TYPE_MEMCPY */
+    uint64_t size;
+    uint64_t shire_mask;
+    uint32_t pattern; /**< Only used by MEM_OP_TYPE_MEMSET, already replicated to 32 bits */
+    uint8_t type;     /**< One of mem_op_type_e */
+    uint8_t kw_base_id;
+    uint8_t slot_index;
+    uint8_t pad[17]; /**< Padding to make struct 64 bytes */
+} __attribute__((packed, aligned(64))) mm_to_cm_message_mem_op_t;
+
+ASSERT_CACHE_LINE_CONSTRAINTS(mm_to_cm_message_mem_op_t);
+
 /*
  * CM to MM messages
  */
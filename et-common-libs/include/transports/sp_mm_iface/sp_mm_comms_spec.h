@@ -103,7 +103,8 @@ enum mm2sp_error_type_e {
     MM_RECOVERABLE_OPS_API_ABORT = 15,
     MM_RECOVERABLE_OPS_API_CM_RESET = 16,
     MM_RECOVERABLE_OPS_API_TRACE_RT_CONFIG = 17,
-    MM_RECOVERABLE_OPS_API_TRACE_RT_CONTROL = 18
+    MM_RECOVERABLE_OPS_API_TRACE_RT_CONTROL = 18,
+    MM_RECOVERABLE_OPS_API_MEM_OP = 19
 };
 
 /*********************************
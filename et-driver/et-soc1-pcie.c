@@ -38,6 +38,7 @@
 #include "et_p2pdma.h"
 #include "et_pci_dev.h"
 #include "et_sysfs.h"
+#include "et_uring.h"
 #include "et_vma.h"
 #include "et_vqueue.h"
 
@@ -98,7 +99,7 @@ static int get_next_devnum(void)
  *
  * EPOLLHUP: If ops device is not initialized
  * EPOLLOUT: If any SQ of ops device is available
- * EPOLLIN: If any CQ of ops device is available
+ * EPOLLIN: If any CQ of ops device or user-space CQ ring is available
  *
  * Return: Positive devnum value on success, negative error on failure
  */
@@ -131,6 +132,10 @@ static __poll_t esperanto_pcie_ops_poll(struct file *fp, poll_table *wait)
 
 	mutex_unlock(&ops->vq_data.vq_common.cq_bitmap_mutex);
 
+	// Generate EPOLLIN event if any user-space CQ ring has entries
+	if (et_uring_cq_ready(container_of(ops, struct et_pci_dev, ops)))
+		mask |= EPOLLIN;
+
 	return mask;
 }
 
@@ -159,6 +164,10 @@ static __poll_t esperanto_pcie_ops_poll(struct file *fp, poll_table *wait)
  * - ETSOC1_IOCTL_SET_SQ_THRESHOLD: Sets SQ threshold for SQ availability
  * - ETSOC1_IOCTL_GET_P2PDMA_DEVICE_COMPAT_BITMAP: P2PDMA bitmap for its
  *   compatibility with other devices
+ * - ETSOC1_IOCTL_URING_SETUP: Attaches user-space SQ/CQ rings to be mapped
+ *   with mmap() at ET_URING_MMAP_OFFSET
+ * - ETSOC1_IOCTL_URING_ENTER: Submits pending SQ ring entries to the device
+ *   and resumes throttled CQs
  *
  * Return: Non-negative value on success, negative error on failure
  */
@@ -172,6 +181,8 @@ static long esperanto_pcie_ops_ioctl(struct file *fp, unsigned int cmd,
 	struct cmd_desc cmd_info;
 	struct rsp_desc rsp_info;
 	struct sq_threshold sq_threshold_info;
+	struct uring_setup uring_setup_info;
+	struct uring_enter uring_enter_info;
 	struct et_mapped_region *region;
 	void __user *usr_arg = (void __user *)arg;
 	u16 sq_idx;
@@ -482,6 +493,41 @@ static long esperanto_pcie_ops_ioctl(struct file *fp, unsigned int cmd,
 
 		break;
 
+	case ETSOC1_IOCTL_URING_SETUP:
+		if (copy_from_user(&uring_setup_info, usr_arg,
+				   _IOC_SIZE(cmd))) {
+			dev_err(&et_dev->pdev->dev,
+				"ops_ioctl[%u]: failed to copy from user!\n",
+				_IOC_NR(cmd));
+			return -EFAULT;
+		}
+
+		rv = et_uring_setup(et_dev, &uring_setup_info);
+		if (rv)
+			return rv;
+
+		if (copy_to_user(usr_arg, &uring_setup_info, _IOC_SIZE(cmd))) {
+			dev_err(&et_dev->pdev->dev,
+				"ops_ioctl[%u]: failed to copy to user!\n",
+				_IOC_NR(cmd));
+			et_uring_destroy(et_dev);
+			return -EFAULT;
+		}
+
+		break;
+
+	case ETSOC1_IOCTL_URING_ENTER:
+		if (copy_from_user(&uring_enter_info, usr_arg,
+				   _IOC_SIZE(cmd))) {
+			dev_err(&et_dev->pdev->dev,
+				"ops_ioctl[%u]: failed to copy from user!\n",
+				_IOC_NR(cmd));
+			return -EFAULT;
+		}
+
+		rv = et_uring_enter(et_dev, &uring_enter_info);
+		break;
+
 	default:
 		dev_err(&et_dev->pdev->dev, "ops_ioctl: unknown cmd: 0x%x\n",
 			cmd);
@@ -626,7 +672,7 @@ struct vm_area_struct *et_find_vma(struct et_pci_dev *et_dev,
  * esperanto_pcie_ops_mmap() - Esperanto PCIe mmap operation
  *
  * Allocates CMA buffer for the et_dev and mmap it into user virtual address
- * space
+ * space. Offset ET_URING_MMAP_OFFSET maps the user-space SQ/CQ rings instead
  *
  * Return: 0 on success, negative error on failure
  */
@@ -643,6 +689,9 @@ static int esperanto_pcie_ops_mmap(struct file *fp, struct vm_area_struct *vma)
 	ops = container_of(fp->private_data, struct et_ops_dev, misc_dev);
 	et_dev = container_of(ops, struct et_pci_dev, ops);
 
+	if (vma->vm_pgoff == ET_URING_MMAP_OFFSET >> PAGE_SHIFT)
+		return et_uring_mmap(et_dev, vma);
+
 	if (vma->vm_pgoff != 0) {
 		dev_err(&et_dev->pdev->dev, "mmap() offset must be 0.\n");
 		return -EINVAL;
@@ -1181,6 +1230,8 @@ static int esperanto_pcie_ops_release(struct inode *inode, struct file *fp)
 	struct et_ops_dev *ops;
 
 	ops = container_of(fp->private_data, struct et_ops_dev, misc_dev);
+	et_uring_destroy(container_of(ops, struct et_pci_dev, ops));
+
 	spin_lock(&ops->open_lock);
 	ops->is_open = false;
 	spin_unlock(&ops->open_lock);
@@ -1381,6 +1432,8 @@ static int create_et_pci_dev(struct et_pci_dev **new_dev, struct pci_dev *pdev)
 	et_dev->ops.is_resetting = false;
 	mutex_init(&et_dev->ops.reset_mutex);
 	et_dev->ops.miscdev_created = false;
+	et_dev->ops.uring = NULL;
+	mutex_init(&et_dev->ops.uring_mutex);
 
 	return 0;
 }
@@ -2556,6 +2609,7 @@ static void destroy_et_pci_dev(struct et_pci_dev *et_dev)
 	mutex_destroy(&et_dev->mgmt.reset_mutex);
 	mutex_destroy(&et_dev->ops.init_mutex);
 	mutex_destroy(&et_dev->ops.reset_mutex);
+	mutex_destroy(&et_dev->ops.uring_mutex);
 }
 
 /**
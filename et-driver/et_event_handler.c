@@ -382,6 +382,11 @@ static void parse_cm_err_syndrome(struct device_mgmt_event_msg_t *event_msg,
 			"OPS API Trace RT Control Error (error code: %d)\n",
 			(s32)event_msg->event_syndrome[1]);
 		break;
+	case MM_RECOVERABLE_OPS_API_MEM_OP:
+		sprintf(dbg_msg->syndrome,
+			"OPS API Memset/Local Memcpy Error (error code: %d)\n",
+			(s32)event_msg->event_syndrome[1]);
+		break;
 	default:
 		sprintf(dbg_msg->syndrome, "Undefined Error (error code: %d)\n",
 			(s32)event_msg->event_syndrome[1]);
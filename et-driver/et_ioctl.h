@@ -191,6 +191,120 @@ struct trace_desc {
 	void *buf;
 };
 
+/**
+ * DOC: User-space rings
+ *
+ * ETSOC1_IOCTL_URING_SETUP attaches a pair of shared SQ/CQ rings per ops VQ to
+ * the ops device. The rings live in a single kernel allocation which user-space
+ * maps with mmap() at offset ET_URING_MMAP_OFFSET. Each ring is described by a
+ * struct uring_ring_hdr (ET_URING_HDR_STRIDE bytes apart) followed, in the
+ * entries area, by a power-of-two number of fixed size entries.
+ *
+ * SQ rings are produced by user-space (tail) and consumed by the driver (head)
+ * when user-space rings the doorbell with ETSOC1_IOCTL_URING_ENTER. CQ rings are
+ * produced by the driver directly from its CQ interrupt handler and consumed by
+ * user-space without any syscall. head and tail are free running counters.
+ */
+#define ET_URING_MMAP_OFFSET 0x40000000ULL
+#define ET_URING_HDR_STRIDE 64
+#define ET_URING_MAX_ENTRIES 4096
+
+/**
+ * enum uring_ring_flag - Flag values for struct uring_ring_hdr
+ */
+enum uring_ring_flag {
+	URING_RING_FLAG_NONE = 0x0,
+	URING_RING_FLAG_CQ_OVERFLOW = 0x1 << 0
+};
+
+/**
+ * enum uring_enter_flag - Flag values for struct uring_enter
+ */
+enum uring_enter_flag {
+	URING_ENTER_FLAG_NONE = 0x0,
+	URING_ENTER_FLAG_CQ_RESUME = 0x1 << 0
+};
+
+/**
+ * struct uring_ring_hdr - Shared header of a user-space ring
+ * @head: Consumer index
+ * @tail: Producer index
+ * @flags: value of enum uring_ring_flag
+ * @reserved: Reserved for future use
+ */
+struct uring_ring_hdr {
+	__u32 head;
+	__u32 tail;
+	__u32 flags;
+	__u32 reserved;
+};
+
+/**
+ * struct uring_sqe - SQ ring entry
+ * @size: Size of the command in bytes
+ * @reserved: Reserved for future use
+ * @cmd: Command memory
+ */
+struct uring_sqe {
+	__u32 size;
+	__u32 reserved;
+	__u8 cmd[];
+};
+
+/**
+ * struct uring_cqe - CQ ring entry
+ * @size: Size of the response in bytes
+ * @reserved: Reserved for future use
+ * @rsp: Response memory
+ */
+struct uring_cqe {
+	__u32 size;
+	__u32 reserved;
+	__u8 rsp[];
+};
+
+/**
+ * struct uring_setup - Descriptor for ETSOC1_IOCTL_URING_SETUP
+ * @sq_entries: Number of entries per SQ ring, power of two (in)
+ * @cq_entries: Number of entries per CQ ring, power of two (in)
+ * @eventfd: eventfd signaled on CQ ring updates, -1 if none (in)
+ * @sq_count: Number of SQ rings (out)
+ * @cq_count: Number of CQ rings (out)
+ * @sq_entry_size: Size of an SQ ring entry in bytes (out)
+ * @cq_entry_size: Size of a CQ ring entry in bytes (out)
+ * @sq_hdr_offset: Offset of the first SQ ring header in the mapping (out)
+ * @cq_hdr_offset: Offset of the first CQ ring header in the mapping (out)
+ * @sq_entries_offset: Offset of the first SQ ring entries (out)
+ * @cq_entries_offset: Offset of the first CQ ring entries (out)
+ * @mmap_size: Size of the mapping in bytes (out)
+ */
+struct uring_setup {
+	__u32 sq_entries;
+	__u32 cq_entries;
+	__s32 eventfd;
+	__u16 sq_count;
+	__u16 cq_count;
+	__u32 sq_entry_size;
+	__u32 cq_entry_size;
+	__u64 sq_hdr_offset;
+	__u64 cq_hdr_offset;
+	__u64 sq_entries_offset;
+	__u64 cq_entries_offset;
+	__u64 mmap_size;
+};
+
+/**
+ * struct uring_enter - Descriptor for ETSOC1_IOCTL_URING_ENTER
+ * @sq_bitmap: Bitmap of SQ rings to submit from, 0 for all
+ * @flags: value of enum uring_enter_flag
+ * @reserved: Reserved for future use
+ */
+struct uring_enter {
+	__u64 sq_bitmap;
+	__u32 flags;
+	__u32 reserved;
+};
+
 #define ETSOC1_IOCTL_GET_USER_DRAM_INFO                                        \
 	_IOR(ESPERANTO_PCIE_IOCTL_MAGIC, 1, struct dram_info)
 
@@ -235,4 +349,10 @@ struct trace_desc {
 #define ETSOC1_IOCTL_GET_P2PDMA_DEVICE_COMPAT_BITMAP                           \
 	_IOR(ESPERANTO_PCIE_IOCTL_MAGIC, 15, __u64)
 
+#define ETSOC1_IOCTL_URING_SETUP                                               \
+	_IOWR(ESPERANTO_PCIE_IOCTL_MAGIC, 16, struct uring_setup)
+
+#define ETSOC1_IOCTL_URING_ENTER                                               \
+	_IOW(ESPERANTO_PCIE_IOCTL_MAGIC, 17, struct uring_enter)
+
 #endif
@@ -22,6 +22,8 @@
 #include "et_sysfs.h"
 #include "et_vqueue.h"
 
+struct et_uring;
+
 /**
  * enum et_iomem_r - IO memory DIR regions
  */
@@ -80,6 +82,7 @@ struct et_bar_region {
  * @dir_vq: VQ information discovered from ops DIRs
  * @vq_data: VQ data other than the ops DIRs VQ information
  * @mem_stats: Memory statistics for ops device
+ * @uring: User-space SQ/CQ rings, NULL if not set up
  */
 struct et_ops_dev {
 	bool is_initialized;
@@ -104,6 +107,11 @@ struct et_ops_dev {
 	struct et_ops_dir_vqueue dir_vq;
 	struct et_vq_data vq_data;
 	struct et_mem_stats mem_stats;
+	struct et_uring *uring;
+	/**
+	 * @uring_mutex: serializes access to uring
+	 */
+	struct mutex uring_mutex;
 };
 
 /**
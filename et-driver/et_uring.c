@@ -0,0 +1,480 @@
+// SPDX-License-Identifier: GPL-2.0
+
+/******************************************************************************
+ *
+ * Copyright (c) 2025 Ainekko, Co.
+ *
+ ******************************************************************************/
+
+#include <linux/errno.h>
+#include <linux/log2.h>
+#include <linux/slab.h>
+#include <linux/vmalloc.h>
+#include <linux/version.h>
+
+#include "et_uring.h"
+
+/**
+ * sqe_addr() - Get the address of an SQ ring entry
+ * @uring: Pointer to struct et_uring
+ * @ring: SQ ring index
+ * @pos: Free running position in the ring
+ *
+ * Return: Pointer to struct uring_sqe
+ */
+static struct uring_sqe *sqe_addr(struct et_uring *uring, u16 ring, u32 pos)
+{
+	size_t slot = (size_t)ring * uring->sq_entries +
+		      (pos & (uring->sq_entries - 1));
+
+	return (struct uring_sqe *)(uring->sq_ents +
+				    slot * uring->sq_entry_size);
+}
+
+/**
+ * cqe_addr() - Get the address of a CQ ring entry
+ * @uring: Pointer to struct et_uring
+ * @ring: CQ ring index
+ * @pos: Free running position in the ring
+ *
+ * Return: Pointer to struct uring_cqe
+ */
+static struct uring_cqe *cqe_addr(struct et_uring *uring, u16 ring, u32 pos)
+{
+	size_t slot = (size_t)ring * uring->cq_entries +
+		      (pos & (uring->cq_entries - 1));
+
+	return (struct uring_cqe *)(uring->cq_ents +
+				    slot * uring->cq_entry_size);
+}
+
+/**
+ * cq_to_ops_dev() - Get the device of an ops CQ
+ * @cq: Pointer to struct et_cqueue
+ *
+ * Return: Pointer to struct et_pci_dev if CQ belongs to ops device, NULL
+ * otherwise
+ */
+static struct et_pci_dev *cq_to_ops_dev(struct et_cqueue *cq)
+{
+	struct et_pci_dev *et_dev = pci_get_drvdata(cq->vq_common->pdev);
+
+	if (cq->vq_common != &et_dev->ops.vq_data.vq_common)
+		return NULL;
+
+	return et_dev;
+}
+
+/**
+ * et_uring_free() - Free user-space rings
+ * @uring: Pointer to struct et_uring
+ */
+static void et_uring_free(struct et_uring *uring)
+{
+	if (uring->eventfd)
+		eventfd_ctx_put(uring->eventfd);
+	kfree(uring->bounce);
+	vfree(uring->mem);
+	kfree(uring);
+}
+
+/**
+ * et_uring_setup() - Attach user-space SQ/CQ rings to the ops device
+ * @et_dev: Pointer to struct et_pci_dev
+ * @setup: Pointer to struct uring_setup, output fields are filled on success
+ *
+ * One SQ ring and one CQ ring are created per ops SQ and CQ. Entries are big
+ * enough to hold the largest message of the corresponding device VQ.
+ *
+ * Return: 0 on success, negative error on failure
+ */
+int et_uring_setup(struct et_pci_dev *et_dev, struct uring_setup *setup)
+{
+	struct et_vq_common *vq_common = &et_dev->ops.vq_data.vq_common;
+	struct et_uring *uring;
+	size_t hdrs_size, sq_ents_size, cq_ents_size;
+	u16 i;
+	int rv;
+
+	if (!is_power_of_2(setup->sq_entries) ||
+	    setup->sq_entries > ET_URING_MAX_ENTRIES ||
+	    !is_power_of_2(setup->cq_entries) ||
+	    setup->cq_entries > ET_URING_MAX_ENTRIES)
+		return -EINVAL;
+
+	if (!vq_common->sq_count || vq_common->sq_count > ET_MAX_QUEUES ||
+	    !vq_common->cq_count || vq_common->cq_count > ET_MAX_QUEUES)
+		return -ENODEV;
+
+	uring = kzalloc(sizeof(*uring), GFP_KERNEL);
+	if (!uring)
+		return -ENOMEM;
+
+	uring->sq_count = vq_common->sq_count;
+	uring->cq_count = vq_common->cq_count;
+	uring->sq_entries = setup->sq_entries;
+	uring->cq_entries = setup->cq_entries;
+	uring->sq_entry_size =
+		ALIGN(sizeof(struct uring_sqe) + vq_common->sq_size -
+			      sizeof(struct et_circbuffer),
+		      ET_URING_HDR_STRIDE);
+	uring->cq_entry_size =
+		ALIGN(sizeof(struct uring_cqe) + vq_common->cq_size -
+			      sizeof(struct et_circbuffer),
+		      ET_URING_HDR_STRIDE);
+
+	hdrs_size = PAGE_ALIGN((size_t)(uring->sq_count + uring->cq_count) *
+			       ET_URING_HDR_STRIDE);
+	sq_ents_size = (size_t)uring->sq_count * uring->sq_entries *
+		       uring->sq_entry_size;
+	cq_ents_size = (size_t)uring->cq_count * uring->cq_entries *
+		       uring->cq_entry_size;
+	uring->mem_size = PAGE_ALIGN(hdrs_size + sq_ents_size + cq_ents_size);
+
+	// Zeroed memory, all rings start empty with no flags set
+	uring->mem = vmalloc_user(uring->mem_size);
+	if (!uring->mem) {
+		rv = -ENOMEM;
+		goto error_free_uring;
+	}
+
+	uring->bounce = kmalloc(uring->sq_entry_size, GFP_KERNEL);
+	if (!uring->bounce) {
+		rv = -ENOMEM;
+		goto error_free_uring;
+	}
+
+	if (setup->eventfd >= 0) {
+		uring->eventfd = eventfd_ctx_fdget(setup->eventfd);
+		if (IS_ERR(uring->eventfd)) {
+			rv = PTR_ERR(uring->eventfd);
+			uring->eventfd = NULL;
+			goto error_free_uring;
+		}
+	}
+
+	for (i = 0; i < uring->sq_count; i++)
+		uring->sq_hdrs[i] = uring->mem + i * ET_URING_HDR_STRIDE;
+	for (i = 0; i < uring->cq_count; i++)
+		uring->cq_hdrs[i] = uring->mem +
+				    (uring->sq_count + i) * ET_URING_HDR_STRIDE;
+	uring->sq_ents = (u8 *)uring->mem + hdrs_size;
+	uring->cq_ents = uring->sq_ents + sq_ents_size;
+
+	mutex_lock(&et_dev->ops.uring_mutex);
+	if (et_dev->ops.uring) {
+		mutex_unlock(&et_dev->ops.uring_mutex);
+		rv = -EBUSY;
+		goto error_free_uring;
+	}
+	et_dev->ops.uring = uring;
+	mutex_unlock(&et_dev->ops.uring_mutex);
+
+	setup->sq_count = uring->sq_count;
+	setup->cq_count = uring->cq_count;
+	setup->sq_entry_size = uring->sq_entry_size;
+	setup->cq_entry_size = uring->cq_entry_size;
+	setup->sq_hdr_offset = 0;
+	setup->cq_hdr_offset = (u64)uring->sq_count * ET_URING_HDR_STRIDE;
+	setup->sq_entries_offset = hdrs_size;
+	setup->cq_entries_offset = hdrs_size + sq_ents_size;
+	setup->mmap_size = uring->mem_size;
+
+	return 0;
+
+error_free_uring:
+	et_uring_free(uring);
+
+	return rv;
+}
+
+/**
+ * et_uring_destroy() - Detach and free user-space rings of the ops device
+ * @et_dev: Pointer to struct et_pci_dev
+ *
+ * Existing user mappings keep the pages alive until they are unmapped
+ */
+void et_uring_destroy(struct et_pci_dev *et_dev)
+{
+	struct et_uring *uring;
+
+	mutex_lock(&et_dev->ops.uring_mutex);
+	uring = et_dev->ops.uring;
+	et_dev->ops.uring = NULL;
+	mutex_unlock(&et_dev->ops.uring_mutex);
+
+	if (uring)
+		et_uring_free(uring);
+}
+
+/**
+ * et_uring_enter() - Submit pending SQ ring entries to the device
+ * @et_dev: Pointer to struct et_pci_dev
+ * @enter: Pointer to struct uring_enter
+ *
+ * Pushes the entries of the selected SQ rings to the corresponding device SQs,
+ * in order, until a ring is empty or its device SQ is full. Entries left in a
+ * ring are submitted by a later call. With URING_ENTER_FLAG_CQ_RESUME, the
+ * draining of the device CQs throttled by a full CQ ring is resumed.
+ *
+ * Return: Number of submitted entries on success, negative error on failure
+ */
+ssize_t et_uring_enter(struct et_pci_dev *et_dev, struct uring_enter *enter)
+{
+	struct et_vq_data *vq_data = &et_dev->ops.vq_data;
+	struct et_uring *uring;
+	struct uring_ring_hdr *hdr;
+	struct uring_sqe *sqe;
+	u64 sq_bitmap = enter->sq_bitmap;
+	u32 head, tail, size;
+	ssize_t rv = 0, submitted = 0;
+	u16 i;
+
+	mutex_lock(&et_dev->ops.uring_mutex);
+
+	uring = et_dev->ops.uring;
+	if (!uring) {
+		rv = -ENXIO;
+		goto unlock_uring_mutex;
+	}
+
+	if (!sq_bitmap)
+		sq_bitmap = GENMASK_ULL(uring->sq_count - 1, 0);
+
+	for (i = 0; i < uring->sq_count && i < vq_data->vq_common.sq_count;
+	     i++) {
+		if (!(sq_bitmap & BIT_ULL(i)))
+			continue;
+
+		hdr = uring->sq_hdrs[i];
+		head = uring->sq_heads[i];
+		// Pairs with the release of the entries by user-space
+		tail = smp_load_acquire(&hdr->tail);
+		if (tail - head > uring->sq_entries) {
+			rv = -EINVAL;
+			goto unlock_uring_mutex;
+		}
+
+		while (head != tail) {
+			sqe = sqe_addr(uring, i, head);
+			size = READ_ONCE(sqe->size);
+			if (!size || size > uring->sq_entry_size - sizeof(*sqe)) {
+				// Drop the invalid entry so it is reported once
+				head++;
+				rv = -EINVAL;
+				break;
+			}
+
+			memcpy(uring->bounce, sqe->cmd, size);
+			rv = et_squeue_push(&vq_data->sqs[i], uring->bounce,
+					    size);
+			if (rv == -EAGAIN) {
+				rv = 0;
+				break;
+			}
+
+			head++;
+			if (rv < 0)
+				break;
+			submitted++;
+		}
+
+		uring->sq_heads[i] = head;
+		smp_store_release(&hdr->head, head);
+
+		if (rv < 0)
+			goto unlock_uring_mutex;
+	}
+
+	if (enter->flags & URING_ENTER_FLAG_CQ_RESUME) {
+		for (i = 0;
+		     i < uring->cq_count && i < vq_data->vq_common.cq_count;
+		     i++) {
+			hdr = uring->cq_hdrs[i];
+			if (!(READ_ONCE(hdr->flags) &
+			      URING_RING_FLAG_CQ_OVERFLOW))
+				continue;
+
+			WRITE_ONCE(hdr->flags,
+				   hdr->flags & ~URING_RING_FLAG_CQ_OVERFLOW);
+			queue_work(vq_data->vq_common.cq_workqueue,
+				   &vq_data->cqs[i].isr_work);
+		}
+	}
+
+	rv = submitted;
+
+unlock_uring_mutex:
+	mutex_unlock(&et_dev->ops.uring_mutex);
+
+	return rv;
+}
+
+/**
+ * et_uring_mmap() - Map user-space rings into user virtual address space
+ * @et_dev: Pointer to struct et_pci_dev
+ * @vma: VMA covering the whole ring memory
+ *
+ * Return: 0 on success, negative error on failure
+ */
+int et_uring_mmap(struct et_pci_dev *et_dev, struct vm_area_struct *vma)
+{
+	struct et_uring *uring;
+	int rv;
+
+	mutex_lock(&et_dev->ops.uring_mutex);
+
+	uring = et_dev->ops.uring;
+	if (!uring) {
+		rv = -ENXIO;
+		goto unlock_uring_mutex;
+	}
+
+	if (vma->vm_end - vma->vm_start != uring->mem_size) {
+		dev_err(&et_dev->pdev->dev,
+			"uring mmap() size must be %zu bytes\n",
+			uring->mem_size);
+		rv = -EINVAL;
+		goto unlock_uring_mutex;
+	}
+
+#if (LINUX_VERSION_CODE < KERNEL_VERSION(6, 3, 0)) && (!defined(RHEL_MAJOR) || (RHEL_MAJOR < 9))
+	vma->vm_flags |= VM_DONTCOPY;
+#else
+	vm_flags_set(vma, VM_DONTCOPY);
+#endif
+
+	rv = remap_vmalloc_range(vma, uring->mem, 0);
+
+unlock_uring_mutex:
+	mutex_unlock(&et_dev->ops.uring_mutex);
+
+	return rv;
+}
+
+/**
+ * et_uring_cq_ready() - Check if any CQ ring has entries for user-space
+ * @et_dev: Pointer to struct et_pci_dev
+ *
+ * Return: true if any CQ ring is not empty, false otherwise
+ */
+bool et_uring_cq_ready(struct et_pci_dev *et_dev)
+{
+	struct et_uring *uring;
+	bool ready = false;
+	u16 i;
+
+	mutex_lock(&et_dev->ops.uring_mutex);
+
+	uring = et_dev->ops.uring;
+	for (i = 0; uring && i < uring->cq_count && !ready; i++)
+		ready = uring->cq_tails[i] != READ_ONCE(uring->cq_hdrs[i]->head);
+
+	mutex_unlock(&et_dev->ops.uring_mutex);
+
+	return ready;
+}
+
+/**
+ * et_uring_cq_throttled() - Check if a CQ must stop being drained
+ * @cq: Pointer to struct et_cqueue
+ *
+ * A CQ is throttled while its user-space CQ ring is full. The overflow flag is
+ * raised so that user-space resumes the draining once it has made room.
+ * Expects cq->pop_mutex to be held.
+ *
+ * Return: true if CQ is throttled, false otherwise
+ */
+bool et_uring_cq_throttled(struct et_cqueue *cq)
+{
+	struct et_pci_dev *et_dev = cq_to_ops_dev(cq);
+	struct uring_ring_hdr *hdr;
+	struct et_uring *uring;
+	bool throttled = false;
+
+	if (!et_dev)
+		return false;
+
+	mutex_lock(&et_dev->ops.uring_mutex);
+
+	uring = et_dev->ops.uring;
+	if (uring && cq->index < uring->cq_count) {
+		hdr = uring->cq_hdrs[cq->index];
+		if (uring->cq_tails[cq->index] - READ_ONCE(hdr->head) >=
+		    uring->cq_entries) {
+			WRITE_ONCE(hdr->flags,
+				   hdr->flags | URING_RING_FLAG_CQ_OVERFLOW);
+			throttled = true;
+		}
+	}
+
+	mutex_unlock(&et_dev->ops.uring_mutex);
+
+	return throttled;
+}
+
+/**
+ * et_uring_cq_begin() - Reserve the next entry of a CQ ring
+ * @cq: Pointer to struct et_cqueue
+ * @size: Size of the response in bytes
+ *
+ * Expects cq->pop_mutex to be held and et_uring_cq_throttled() to have been
+ * checked under it, so the ring has room. On success, returns with
+ * uring_mutex held until et_uring_cq_end() is called.
+ *
+ * Return: Pointer to struct uring_cqe, NULL if the response must take the
+ * msg_list path
+ */
+struct uring_cqe *et_uring_cq_begin(struct et_cqueue *cq, size_t size)
+{
+	struct et_pci_dev *et_dev = cq_to_ops_dev(cq);
+	struct et_uring *uring;
+
+	if (!et_dev)
+		return NULL;
+
+	mutex_lock(&et_dev->ops.uring_mutex);
+
+	uring = et_dev->ops.uring;
+	if (!uring || cq->index >= uring->cq_count ||
+	    WARN_ON_ONCE(size > uring->cq_entry_size -
+					sizeof(struct uring_cqe))) {
+		mutex_unlock(&et_dev->ops.uring_mutex);
+		return NULL;
+	}
+
+	return cqe_addr(uring, cq->index, uring->cq_tails[cq->index]);
+}
+
+/**
+ * et_uring_cq_end() - Publish or cancel the entry reserved on a CQ ring
+ * @cq: Pointer to struct et_cqueue
+ * @cqe: Entry returned by et_uring_cq_begin()
+ * @size: Size of the response in bytes, 0 to cancel
+ */
+void et_uring_cq_end(struct et_cqueue *cq, struct uring_cqe *cqe, size_t size)
+{
+	struct et_pci_dev *et_dev = pci_get_drvdata(cq->vq_common->pdev);
+	struct et_uring *uring = et_dev->ops.uring;
+
+	if (size) {
+		cqe->size = size;
+		cqe->reserved = 0;
+		uring->cq_tails[cq->index]++;
+		// Pairs with the acquire of the tail by user-space
+		smp_store_release(&uring->cq_hdrs[cq->index]->tail,
+				  uring->cq_tails[cq->index]);
+
+		if (uring->eventfd)
+#if LINUX_VERSION_CODE < KERNEL_VERSION(6, 8, 0)
+			eventfd_signal(uring->eventfd, 1);
+#else
+			eventfd_signal(uring->eventfd);
+#endif
+	}
+
+	mutex_unlock(&et_dev->ops.uring_mutex);
+
+	if (size)
+		wake_up_interruptible(&cq->vq_common->waitqueue);
+}
@@ -0,0 +1,72 @@
+/* SPDX-License-Identifier: GPL-2.0 */
+
+/***********************************************************************
+ *
+ * Copyright (c) 2025 Ainekko, Co.
+ *
+ **********************************************************************/
+
+#ifndef __ET_URING_H
+#define __ET_URING_H
+
+#include <linux/eventfd.h>
+#include <linux/kernel.h>
+#include <linux/mm.h>
+
+#include "et_ioctl.h"
+#include "et_pci_dev.h"
+#include "et_vqueue.h"
+
+/**
+ * struct et_uring - User-space SQ/CQ rings attached to the ops device
+ * @mem: vmalloc'ed memory shared with user-space
+ * @mem_size: Size of the shared memory in bytes
+ * @sq_count: Number of SQ rings
+ * @cq_count: Number of CQ rings
+ * @sq_entries: Number of entries per SQ ring
+ * @cq_entries: Number of entries per CQ ring
+ * @sq_entry_size: Size of an SQ ring entry in bytes
+ * @cq_entry_size: Size of a CQ ring entry in bytes
+ * @sq_hdrs: SQ ring headers in shared memory
+ * @cq_hdrs: CQ ring headers in shared memory
+ * @sq_ents: First SQ ring entry in shared memory
+ * @cq_ents: First CQ ring entry in shared memory
+ * @sq_heads: Driver owned copy of SQ ring heads
+ * @cq_tails: Driver owned copy of CQ ring tails
+ * @bounce: Bounce buffer for SQ entries, guards against user-space
+ *          modifying an entry while it is being validated and pushed
+ * @eventfd: eventfd signaled on CQ ring updates, NULL if none
+ *
+ * head/tail values owned by the driver are never read back from shared memory,
+ * so a misbehaving user-space can only corrupt its own rings.
+ */
+struct et_uring {
+	void *mem;
+	size_t mem_size;
+	u16 sq_count;
+	u16 cq_count;
+	u32 sq_entries;
+	u32 cq_entries;
+	u32 sq_entry_size;
+	u32 cq_entry_size;
+	struct uring_ring_hdr *sq_hdrs[ET_MAX_QUEUES];
+	struct uring_ring_hdr *cq_hdrs[ET_MAX_QUEUES];
+	u8 *sq_ents;
+	u8 *cq_ents;
+	u32 sq_heads[ET_MAX_QUEUES];
+	u32 cq_tails[ET_MAX_QUEUES];
+	u8 *bounce;
+	struct eventfd_ctx *eventfd;
+};
+
+int et_uring_setup(struct et_pci_dev *et_dev, struct uring_setup *setup);
+void et_uring_destroy(struct et_pci_dev *et_dev);
+ssize_t et_uring_enter(struct et_pci_dev *et_dev, struct uring_enter *enter);
+int et_uring_mmap(struct et_pci_dev *et_dev, struct vm_area_struct *vma);
+bool et_uring_cq_ready(struct et_pci_dev *et_dev);
+
+bool et_uring_cq_throttled(struct et_cqueue *cq);
+struct uring_cqe *et_uring_cq_begin(struct et_cqueue *cq, size_t size);
+void et_uring_cq_end(struct et_cqueue *cq, struct uring_cqe *cqe, size_t size);
+
+#endif
@@ -14,6 +14,7 @@
 #include "et_event_handler.h"
 #include "et_io.h"
 #include "et_pci_dev.h"
+#include "et_uring.h"
 #include "et_vqueue.h"
 
 enum device_ops_api_msg_e {
@@ -2196,10 +2197,18 @@ ssize_t et_cqueue_pop(struct et_cqueue *cq, bool sync_for_host)
 	struct cmn_header_t header;
 	struct et_msg_node *msg_node;
 	struct device_mgmt_event_msg_t mgmt_event;
+	struct uring_cqe *cqe;
 	ssize_t rv;
 
 	mutex_lock(&cq->pop_mutex);
 
+	// Leave messages on the device CQ while the user-space CQ ring is full,
+	// user-space resumes the draining with ETSOC1_IOCTL_URING_ENTER
+	if (et_uring_cq_throttled(cq)) {
+		rv = -EAGAIN;
+		goto error_unlock_mutex;
+	}
+
 	// Read the message header
 	if (!et_circbuffer_pop(&cq->cb, cq->cb_mem, (u8 *)&header,
 			       sizeof(header),
@@ -2248,6 +2257,43 @@ ssize_t et_cqueue_pop(struct et_cqueue *cq, bool sync_for_host)
 		return rv;
 	}
 
+	// Message is for user mode. Post it directly on the user-space CQ ring
+	// if one is attached. MM reset responses always take the msg_list path
+	// since they need post reset steps
+	if (header.msg_id != DEV_MGMT_API_MID_MM_RESET)
+		cqe = et_uring_cq_begin(cq, header.size + sizeof(header));
+	else
+		cqe = NULL;
+
+	if (cqe) {
+		memcpy(cqe->rsp, (u8 *)&header, sizeof(header));
+
+		// MMIO msg payload into the ring entry
+		if (!et_circbuffer_pop(&cq->cb, cq->cb_mem,
+				       cqe->rsp + sizeof(header), header.size,
+				       ET_CB_SYNC_FOR_DEVICE)) {
+			et_uring_cq_end(cq, cqe, 0);
+			rv = -EAGAIN;
+			goto error_unlock_mutex;
+		}
+
+		et_uring_cq_end(cq, cqe, header.size + sizeof(header));
+		mutex_unlock(&cq->pop_mutex);
+
+		atomic64_inc(
+			&cq->stats.counters[ET_VQ_COUNTER_STATS_MSG_COUNT]);
+		et_rate_entry_update(
+			1, &cq->stats.rates[ET_VQ_RATE_STATS_MSG_RATE]);
+		atomic64_add(
+			header.size + sizeof(header),
+			&cq->stats.counters[ET_VQ_COUNTER_STATS_BYTE_COUNT]);
+		et_rate_entry_update(
+			header.size + sizeof(header),
+			&cq->stats.rates[ET_VQ_RATE_STATS_BYTE_RATE]);
+
+		return header.size;
+	}
+
 	// Message is for user mode. Save it off.
 	msg_node = create_msg_node(header.size + sizeof(header));
 	if (!msg_node) {
@@ -162,6 +162,7 @@ enum trace_custom_type_sp {
     TRACE_CUSTOM_TYPE_SP_POWER_GLOBALS,
     TRACE_CUSTOM_TYPE_SP_POWER_STATES_GLOBALS,
     TRACE_CUSTOM_TYPE_SP_OP_STATS,
+    TRACE_CUSTOM_TYPE_SP_TELEMETRY, /**< device_mgmt_api telemetry_sample_t */
     TRACE_CUSTOM_TYPE_SP_COUNT,
     TRACE_CUSTOM_TYPE_SP_END = 999
 };
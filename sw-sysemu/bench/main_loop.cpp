@@ -75,6 +75,20 @@ BENCHMARK_DEFINE_F(FWBenchmark, BM_main_internal_fw_boot)(benchmark::State& stat
      ->ArgNames({"mem_check+l1_scp_check+l2_scp_check+flb_check", "tstore_check"});
 
 
+// Startup only: cold reset, preloaded ELFs and loading the firmware ELFs
+void BM_sys_emu_startup(benchmark::State& state) {
+    sys_emu_cmd_options cmd_options;
+    for (const auto& elf_file : fw_elfs) {
+        cmd_options.elf_files.push_back(elf_file);
+    }
+    for (auto _ : state) {
+        auto emu = std::make_unique<sys_emu>(cmd_options);
+        benchmark::DoNotOptimize(emu.get());
+        benchmark::ClobberMemory();
+    }
+}
+BENCHMARK(BM_sys_emu_startup)->Unit(benchmark::kMillisecond);
+
 /* RISCV Instructions: rv64f*/
 class Inst_RV64F_Benchmark : public SysEmuBenchmark {
 public:
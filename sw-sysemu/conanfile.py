@@ -1,5 +1,5 @@
 from conan import ConanFile
-from conan.tools.build import cross_building
+from conan.tools.build import can_run, cross_building
 from conan.tools.cmake import CMake, CMakeToolchain, CMakeDeps, cmake_layout
 from conan.tools.env import VirtualBuildEnv, VirtualRunEnv
 from conan.tools.files import get, rmdir, rm
@@ -36,6 +36,7 @@ class SwSysemuConan(ConanFile):
         "sdk_release": [True, False],
         "with_sys_emu_exe": [True, False],
         "with_benchmarks": [True, False],
+        "with_tests": [True, False],
     }
     default_options = {
         "shared": False,
@@ -55,6 +56,7 @@ class SwSysemuConan(ConanFile):
         "sdk_release": False,
         "with_sys_emu_exe": True,
         "with_benchmarks": False,
+        "with_tests": False,
     }
 
     python_requires = "conan-common/[>=1.1.0 <2.0.0]"
@@ -158,6 +160,7 @@ class SwSysemuConan(ConanFile):
         tc.variables["PROFILING"] = self.options.profiling
         tc.variables["BACKTRACE"] = self.options.backtrace
         tc.variables["BENCHMARKS"] = self.options.with_benchmarks
+        tc.variables["BUILD_TESTS"] = self.options.with_tests
         tc.variables["ENABLE_IPO"] = self.options.lto
         tc.variables["PRELOAD_LZ4"] = "lz4" is self.options.preload_compression
         if self.options.preload_elfs:
@@ -228,6 +231,8 @@ etsoc_hal/{etsoc_hal_version}
         cmake = CMake(self)
         cmake.configure()
         cmake.build()
+        if self.options.with_tests and can_run(self):
+            cmake.test()
 
     def package(self):
         cmake = CMake(self)
@@ -10,6 +10,9 @@
 #include "emu_gio.h"
 #include "system.h"
 #include "testLog.h"
+#ifdef SYS_EMU
+#include "binaryLog.h"
+#endif
 
 namespace bemu {
 
@@ -17,13 +20,30 @@ void lprintf(logLevel level, const Agent& agent, const char* fmt, ...)
 {
     assert(agent.chip);
 
+    auto& logger = agent.chip->log;
+
+#ifdef SYS_EMU
+    // Warnings and errors are also printed, they may stop the simulation
+    if (binaryLog* binary = logger.getBinaryOutput()) {
+        va_list ap;
+        va_start(ap, fmt);
+        binary->record(level, agent, logger.simTime(), fmt, ap);
+        va_end(ap);
+        if (level < LOG_WARN) {
+            return;
+        }
+        if (level >= LOG_ERR) {
+            binary->flush();
+        }
+    }
+#endif
+
     static thread_local char lbuf[4096] = { '\0' };
     va_list ap;
     va_start(ap, fmt);
     (void)vsnprintf(lbuf, 4096, fmt, ap);
     va_end(ap);
 
-    auto& logger = agent.chip->log;
     logger << level << "[" << agent.name() << "] " << lbuf << endm;
 
 #ifdef SYS_EMU
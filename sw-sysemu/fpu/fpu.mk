@@ -5,6 +5,7 @@ fpu_hdrs := \
 	fpu/debug.h \
 	fpu/fpu.h \
 	fpu/fpu_casts.h \
+	fpu/fpu_ps.h \
 	fpu/fpu_types.h \
 	fpu/texp.h \
 	fpu/tlog.h \
@@ -23,6 +24,7 @@ fpu_cpp_srcs := \
 	fpu/f32_to_f10.cpp \
 	fpu/f32_to_f11.cpp \
 	fpu/f32_to_fxp1714.cpp \
+	fpu/fpu_ps.cpp \
 	fpu/fxp1516_to_f32.cpp \
 	fpu/fxp1714_rcpStep.cpp \
 	fpu/tensors.cpp \
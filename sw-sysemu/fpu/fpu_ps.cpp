@@ -0,0 +1,353 @@
+/*-------------------------------------------------------------------------
+* Copyright (c) 2025 Ainekko, Co.
+* SPDX-License-Identifier: Apache-2.0
+*-------------------------------------------------------------------------*/
+
+#include "softfloat/platform.h"
+#include "softfloat/softfloat.h"
+#include "fpu_ps.h"
+
+#if defined(__SSE2__) && defined(__GNUC__)
+#include <immintrin.h>
+#define FPU_PS_SSE2 1
+#else
+#define FPU_PS_SSE2 0
+#endif
+
+namespace fpu {
+
+#if FPU_PS_SSE2
+
+namespace {
+
+// What ps_apply() has to verify
+enum : unsigned {
+    IN_FLOAT   = 1 << 0,    // reject NaN and subnormal operands
+    IN_FINITE  = 1 << 1,    // reject infinite operands too
+    OUT_NORMAL = 1 << 2,    // reject infinite, NaN and (nearly) tiny results
+    FP_ENV     = 1 << 3,    // round like softfloat and check the host flags
+};
+
+const unsigned PS_ARITH = IN_FLOAT | IN_FINITE | OUT_NORMAL | FP_ENV;
+const unsigned PS_CMP   = IN_FLOAT;
+
+// MXCSR with all exceptions masked, flags clear, and DAZ and FTZ off
+const unsigned MXCSR_DEFAULT = 0x1F80;
+const unsigned MXCSR_RC_SHIFT = 13;
+const unsigned MXCSR_PE = 0x20;
+const unsigned MXCSR_FLAGS = 0x3F;
+
+
+inline __m128 ps(__m128i x) { return _mm_castsi128_ps(x); }
+inline __m128i pi(__m128 x) { return _mm_castps_si128(x); }
+
+
+inline __m128i lane_mask(unsigned mask)
+{
+    const __m128i bits = _mm_set_epi32(8, 4, 2, 1);
+    return _mm_cmpeq_epi32(_mm_and_si128(_mm_set1_epi32(int(mask)), bits), bits);
+}
+
+
+// m ? x : y
+inline __m128i blend(__m128i m, __m128i x, __m128i y)
+{
+    return _mm_or_si128(_mm_and_si128(m, x), _mm_andnot_si128(m, y));
+}
+
+
+inline __m128i nonzero_below(__m128i ax, int limit)
+{
+    return _mm_andnot_si128(_mm_cmpeq_epi32(ax, _mm_setzero_si128()),
+                            _mm_cmpgt_epi32(_mm_set1_epi32(limit), ax));
+}
+
+
+// Lanes that are NaN, infinite (when finite is set) or subnormal
+inline __m128i bad_operand(__m128i x, bool finite)
+{
+    __m128i ax = _mm_and_si128(x, _mm_set1_epi32(0x7FFFFFFF));
+    __m128i special = _mm_cmpgt_epi32(ax, _mm_set1_epi32(finite ? 0x7F7FFFFF : 0x7F800000));
+    return _mm_or_si128(special, nonzero_below(ax, 0x00800000));
+}
+
+
+// Lanes that are NaN, infinite, or non-zero and below 2^-125. Results just
+// above the smallest normal are rejected too so that differences in when
+// the host and softfloat detect tininess do not matter.
+inline __m128i bad_result(__m128i x)
+{
+    __m128i ax = _mm_and_si128(x, _mm_set1_epi32(0x7FFFFFFF));
+    __m128i special = _mm_cmpgt_epi32(ax, _mm_set1_epi32(0x7F7FFFFF));
+    return _mm_or_si128(special, nonzero_below(ax, 0x01000000));
+}
+
+
+// MXCSR rounding control for the current softfloat rounding mode
+inline int host_rounding()
+{
+    switch (softfloat_roundingMode) {
+    case softfloat_round_near_even: return 0;
+    case softfloat_round_min:       return 1;
+    case softfloat_round_max:       return 2;
+    case softfloat_round_minMag:    return 3;
+    default:                        return -1;
+    }
+}
+
+
+// Keeps the compiler from moving SIMD arithmetic across MXCSR accesses
+inline void fence(__m128i& x)
+{
+    asm volatile("" : "+x"(x));
+}
+
+
+// Applies op to the operands in two 128-bit halves. Inactive lanes are
+// replaced by neutral so that they cannot raise host exceptions.
+template <typename Op>
+bool ps_apply(uint32_t* d, const uint32_t* a, const uint32_t* b, const uint32_t* c,
+              unsigned mask, unsigned checks, int neutral, Op op)
+{
+    const uint32_t* src[3] = { a, b, c };
+    __m128i m[2], x[2][3], r[2];
+    __m128i bad = _mm_setzero_si128();
+
+    for (unsigned h = 0; h < 2; ++h) {
+        m[h] = lane_mask(mask >> (4 * h));
+        for (unsigned i = 0; i < 3; ++i) {
+            if (!src[i]) {
+                x[h][i] = _mm_set1_epi32(neutral);
+                continue;
+            }
+            __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src[i] + 4 * h));
+            if (checks & IN_FLOAT) {
+                bad = _mm_or_si128(bad, _mm_and_si128(m[h], bad_operand(v, checks & IN_FINITE)));
+            }
+            x[h][i] = blend(m[h], v, _mm_set1_epi32(neutral));
+        }
+    }
+    if (_mm_movemask_epi8(bad)) {
+        return false;
+    }
+
+    if (checks & FP_ENV) {
+        int rc = host_rounding();
+        if (rc < 0) {
+            return false;
+        }
+        unsigned saved = _mm_getcsr();
+        _mm_setcsr(MXCSR_DEFAULT | (unsigned(rc) << MXCSR_RC_SHIFT));
+        for (unsigned h = 0; h < 2; ++h) {
+            for (unsigned i = 0; i < 3; ++i) {
+                fence(x[h][i]);
+            }
+            r[h] = op(x[h][0], x[h][1], x[h][2]);
+            fence(r[h]);
+        }
+        unsigned flags = _mm_getcsr() & MXCSR_FLAGS;
+        _mm_setcsr(saved);
+        // Anything but inexact needs softfloat to decide the result
+        if (flags & ~MXCSR_PE) {
+            return false;
+        }
+        if (checks & OUT_NORMAL) {
+            bad = _mm_or_si128(_mm_and_si128(m[0], bad_result(r[0])),
+                               _mm_and_si128(m[1], bad_result(r[1])));
+            if (_mm_movemask_epi8(bad)) {
+                return false;
+            }
+        }
+        if (flags & MXCSR_PE) {
+            softfloat_exceptionFlags |= softfloat_flag_inexact;
+        }
+    } else {
+        for (unsigned h = 0; h < 2; ++h) {
+            r[h] = op(x[h][0], x[h][1], x[h][2]);
+        }
+    }
+
+    for (unsigned h = 0; h < 2; ++h) {
+        __m128i* dst = reinterpret_cast<__m128i*>(d + 4 * h);
+        _mm_storeu_si128(dst, blend(m[h], r[h], _mm_loadu_si128(dst)));
+    }
+    return true;
+}
+
+
+const int ONE = 0x3F800000;
+
+
+#ifdef __FMA__
+inline bool host_has_fma() { return true; }
+#else
+bool host_has_fma()
+{
+    static const bool fma = __builtin_cpu_supports("fma");
+    return fma;
+}
+#endif
+
+
+// The softfloat names follow RISC-V: subMulAdd is -(a*b)-c, and subMulSub
+// is -(a*b)+c, which x86 calls fnmsub and fnmadd
+__attribute__((target("fma")))
+__m128i fma_mulAdd(__m128i a, __m128i b, __m128i c)
+{
+    return pi(_mm_fmadd_ps(ps(a), ps(b), ps(c)));
+}
+
+
+__attribute__((target("fma")))
+__m128i fma_mulSub(__m128i a, __m128i b, __m128i c)
+{
+    return pi(_mm_fmsub_ps(ps(a), ps(b), ps(c)));
+}
+
+
+__attribute__((target("fma")))
+__m128i fma_subMulAdd(__m128i a, __m128i b, __m128i c)
+{
+    return pi(_mm_fnmsub_ps(ps(a), ps(b), ps(c)));
+}
+
+
+__attribute__((target("fma")))
+__m128i fma_subMulSub(__m128i a, __m128i b, __m128i c)
+{
+    return pi(_mm_fnmadd_ps(ps(a), ps(b), ps(c)));
+}
+
+} // namespace
+
+
+bool ps_add(uint32_t* d, const uint32_t* a, const uint32_t* b, unsigned mask)
+{
+    return ps_apply(d, a, b, nullptr, mask, PS_ARITH, ONE, [](__m128i x, __m128i y, __m128i) {
+        return pi(_mm_add_ps(ps(x), ps(y)));
+    });
+}
+
+
+bool ps_sub(uint32_t* d, const uint32_t* a, const uint32_t* b, unsigned mask)
+{
+    return ps_apply(d, a, b, nullptr, mask, PS_ARITH, ONE, [](__m128i x, __m128i y, __m128i) {
+        return pi(_mm_sub_ps(ps(x), ps(y)));
+    });
+}
+
+
+bool ps_mul(uint32_t* d, const uint32_t* a, const uint32_t* b, unsigned mask)
+{
+    return ps_apply(d, a, b, nullptr, mask, PS_ARITH, ONE, [](__m128i x, __m128i y, __m128i) {
+        return pi(_mm_mul_ps(ps(x), ps(y)));
+    });
+}
+
+
+bool ps_mulAdd(uint32_t* d, const uint32_t* a, const uint32_t* b, const uint32_t* c, unsigned mask)
+{
+    return host_has_fma() && ps_apply(d, a, b, c, mask, PS_ARITH, ONE, fma_mulAdd);
+}
+
+
+bool ps_mulSub(uint32_t* d, const uint32_t* a, const uint32_t* b, const uint32_t* c, unsigned mask)
+{
+    return host_has_fma() && ps_apply(d, a, b, c, mask, PS_ARITH, ONE, fma_mulSub);
+}
+
+
+bool ps_subMulAdd(uint32_t* d, const uint32_t* a, const uint32_t* b, const uint32_t* c, unsigned mask)
+{
+    return host_has_fma() && ps_apply(d, a, b, c, mask, PS_ARITH, ONE, fma_subMulAdd);
+}
+
+
+bool ps_subMulSub(uint32_t* d, const uint32_t* a, const uint32_t* b, const uint32_t* c, unsigned mask)
+{
+    return host_has_fma() && ps_apply(d, a, b, c, mask, PS_ARITH, ONE, fma_subMulSub);
+}
+
+
+// Equal operands can only differ in the sign of zero, where the minimum is
+// -0.0 and the maximum is +0.0
+bool ps_min(uint32_t* d, const uint32_t* a, const uint32_t* b, unsigned mask)
+{
+    return ps_apply(d, a, b, nullptr, mask, PS_CMP, ONE, [](__m128i x, __m128i y, __m128i) {
+        __m128i lt = pi(_mm_cmplt_ps(ps(x), ps(y)));
+        __m128i gt = pi(_mm_cmpgt_ps(ps(x), ps(y)));
+        return blend(lt, x, blend(gt, y, _mm_or_si128(x, y)));
+    });
+}
+
+
+bool ps_max(uint32_t* d, const uint32_t* a, const uint32_t* b, unsigned mask)
+{
+    return ps_apply(d, a, b, nullptr, mask, PS_CMP, ONE, [](__m128i x, __m128i y, __m128i) {
+        __m128i lt = pi(_mm_cmplt_ps(ps(x), ps(y)));
+        __m128i gt = pi(_mm_cmpgt_ps(ps(x), ps(y)));
+        return blend(gt, x, blend(lt, y, _mm_and_si128(x, y)));
+    });
+}
+
+
+bool ps_eq(uint32_t* d, const uint32_t* a, const uint32_t* b, unsigned mask)
+{
+    return ps_apply(d, a, b, nullptr, mask, PS_CMP, ONE, [](__m128i x, __m128i y, __m128i) {
+        return pi(_mm_cmpeq_ps(ps(x), ps(y)));
+    });
+}
+
+
+bool ps_lt(uint32_t* d, const uint32_t* a, const uint32_t* b, unsigned mask)
+{
+    return ps_apply(d, a, b, nullptr, mask, PS_CMP, ONE, [](__m128i x, __m128i y, __m128i) {
+        return pi(_mm_cmplt_ps(ps(x), ps(y)));
+    });
+}
+
+
+bool ps_le(uint32_t* d, const uint32_t* a, const uint32_t* b, unsigned mask)
+{
+    return ps_apply(d, a, b, nullptr, mask, PS_CMP, ONE, [](__m128i x, __m128i y, __m128i) {
+        return pi(_mm_cmple_ps(ps(x), ps(y)));
+    });
+}
+
+
+bool ps_from_i32(uint32_t* d, const uint32_t* a, unsigned mask)
+{
+    return ps_apply(d, a, nullptr, nullptr, mask, FP_ENV, 0, [](__m128i x, __m128i, __m128i) {
+        return pi(_mm_cvtepi32_ps(x));
+    });
+}
+
+
+// Out of range operands raise the host invalid flag, and go to softfloat
+bool ps_to_i32(uint32_t* d, const uint32_t* a, unsigned mask)
+{
+    return ps_apply(d, a, nullptr, nullptr, mask, IN_FLOAT | IN_FINITE | FP_ENV, 0, [](__m128i x, __m128i, __m128i) {
+        return _mm_cvtps_epi32(ps(x));
+    });
+}
+
+#else // !FPU_PS_SSE2
+
+bool ps_add(uint32_t*, const uint32_t*, const uint32_t*, unsigned) { return false; }
+bool ps_sub(uint32_t*, const uint32_t*, const uint32_t*, unsigned) { return false; }
+bool ps_mul(uint32_t*, const uint32_t*, const uint32_t*, unsigned) { return false; }
+bool ps_mulAdd(uint32_t*, const uint32_t*, const uint32_t*, const uint32_t*, unsigned) { return false; }
+bool ps_mulSub(uint32_t*, const uint32_t*, const uint32_t*, const uint32_t*, unsigned) { return false; }
+bool ps_subMulAdd(uint32_t*, const uint32_t*, const uint32_t*, const uint32_t*, unsigned) { return false; }
+bool ps_subMulSub(uint32_t*, const uint32_t*, const uint32_t*, const uint32_t*, unsigned) { return false; }
+bool ps_min(uint32_t*, const uint32_t*, const uint32_t*, unsigned) { return false; }
+bool ps_max(uint32_t*, const uint32_t*, const uint32_t*, unsigned) { return false; }
+bool ps_eq(uint32_t*, const uint32_t*, const uint32_t*, unsigned) { return false; }
+bool ps_lt(uint32_t*, const uint32_t*, const uint32_t*, unsigned) { return false; }
+bool ps_le(uint32_t*, const uint32_t*, const uint32_t*, unsigned) { return false; }
+bool ps_from_i32(uint32_t*, const uint32_t*, unsigned) { return false; }
+bool ps_to_i32(uint32_t*, const uint32_t*, unsigned) { return false; }
+
+#endif // FPU_PS_SSE2
+
+} // namespace fpu
@@ -0,0 +1,51 @@
+/*-------------------------------------------------------------------------
+* Copyright (c) 2025 Ainekko, Co.
+* SPDX-License-Identifier: Apache-2.0
+*-------------------------------------------------------------------------*/
+
+#ifndef BEMU_FPU_PS_H
+#define BEMU_FPU_PS_H
+
+#include <cstdint>
+
+// ---------------------------------------------------------------------------
+// Packed single-precision operations on the host SIMD unit.
+//
+// Each function operates on the PS_LANES elements of its operands and writes
+// the elements of d whose bit is set in mask, leaving the others unchanged.
+// The results and exception flags are bit-exact with the element-wise
+// softfloat operation using softfloat_roundingMode. When that cannot be
+// guaranteed (NaN, infinite or subnormal operands, results that overflow or
+// underflow, rounding modes the host does not have, or no host SIMD support)
+// the function returns false without modifying d or the exception flags, and
+// the caller must use softfloat instead. Operands may alias d.
+// ---------------------------------------------------------------------------
+
+namespace fpu {
+
+enum : unsigned { PS_LANES = 8 };
+
+bool ps_add(uint32_t* d, const uint32_t* a, const uint32_t* b, unsigned mask);
+bool ps_sub(uint32_t* d, const uint32_t* a, const uint32_t* b, unsigned mask);
+bool ps_mul(uint32_t* d, const uint32_t* a, const uint32_t* b, unsigned mask);
+
+bool ps_mulAdd(uint32_t* d, const uint32_t* a, const uint32_t* b, const uint32_t* c, unsigned mask);
+bool ps_mulSub(uint32_t* d, const uint32_t* a, const uint32_t* b, const uint32_t* c, unsigned mask);
+bool ps_subMulAdd(uint32_t* d, const uint32_t* a, const uint32_t* b, const uint32_t* c, unsigned mask);
+bool ps_subMulSub(uint32_t* d, const uint32_t* a, const uint32_t* b, const uint32_t* c, unsigned mask);
+
+// f32_minimumNumber() and f32_maximumNumber()
+bool ps_min(uint32_t* d, const uint32_t* a, const uint32_t* b, unsigned mask);
+bool ps_max(uint32_t* d, const uint32_t* a, const uint32_t* b, unsigned mask);
+
+// Comparisons write UINT32_MAX when true and 0 when false
+bool ps_eq(uint32_t* d, const uint32_t* a, const uint32_t* b, unsigned mask);
+bool ps_lt(uint32_t* d, const uint32_t* a, const uint32_t* b, unsigned mask);
+bool ps_le(uint32_t* d, const uint32_t* a, const uint32_t* b, unsigned mask);
+
+bool ps_from_i32(uint32_t* d, const uint32_t* a, unsigned mask);
+bool ps_to_i32(uint32_t* d, const uint32_t* a, unsigned mask);
+
+} // namespace fpu
+
+#endif // BEMU_FPU_PS_H
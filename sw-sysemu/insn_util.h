@@ -432,6 +432,46 @@ inline mreg_t mkmask(unsigned len) {
 #define INTMV_VD(expr) WRITE_VD_REG(expr, intmv)
 #define WRITE_VD(expr) WRITE_VD_REG(expr, write)
 
+// Like WRITE_VD(expr) but tries the packed operation fast first, and only
+// evaluates expr for each element when fast returns false
+#define WRITE_VD_FAST(fast, expr) do { \
+    LOG_MREG(":", 0); \
+    if (M0.any()) { \
+        if (!(fast)) { \
+            for (std::size_t e = 0; e < MLEN; ++e) { \
+                if (M0[e]) { \
+                    FD.u32[e] = fpu::UI32(expr); \
+                } \
+            } \
+        } \
+        LOG_FREG("=", cpu.inst.fd()); \
+        dirty_fp_state(); \
+    } \
+    notify_freg_write(cpu, cpu.inst.fd(), M0, FD); \
+} while (0)
+
+// Like INTMV_VD(expr) for expressions without side effects. All elements
+// are computed and then merged under the mask, which the compiler can
+// turn into host SIMD instructions.
+#define INTMV_VD_BLEND(expr) do { \
+    LOG_MREG(":", 0); \
+    if (M0.any()) { \
+        const uint32_t msk = uint32_t(M0.to_ulong()); \
+        std::array<uint32_t, MLEN> val; \
+        for (std::size_t e = 0; e < MLEN; ++e) { \
+            val[e] = fpu::UI32(expr); \
+        } \
+        freg_t& dst = FD; \
+        for (std::size_t e = 0; e < MLEN; ++e) { \
+            uint32_t sel = (msk & (1u << e)) ? UINT32_MAX : 0; \
+            dst.u32[e] = (val[e] & sel) | (dst.u32[e] & ~sel); \
+        } \
+        LOG_FREG("=", cpu.inst.fd()); \
+        dirty_fp_state(); \
+    } \
+    notify_freg_intmv(cpu, cpu.inst.fd(), M0, FD); \
+} while (0)
+
 #define SCATTER(expr) do { \
     LOG_GSC_PROGRESS(":"); \
     for (std::size_t e = 0; e < cpu.gsc_progress; ++e) \
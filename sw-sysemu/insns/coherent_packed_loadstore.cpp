@@ -21,7 +21,8 @@ void insn_fgbg_ps(Hart& cpu)
 {
     require_fp_active();
     DISASM_GATHER_FD_FS1_RS2("fgbg.ps");
-    GATHER(sext<8>(mmu_load8(cpu, RS2 + FS1.i32[e], Mem_Access_LoadG)));
+    GatherScatterMemory mem(cpu, Mem_Access_LoadG);
+    GATHER(sext<8>(mem.load8(RS2 + FS1.i32[e])));
 }
 
 
@@ -29,7 +30,8 @@ void insn_fgbl_ps(Hart& cpu)
 {
     require_fp_active();
     DISASM_GATHER_FD_FS1_RS2("fgbl.ps");
-    GATHER(sext<8>(mmu_load8(cpu, RS2 + FS1.i32[e], Mem_Access_LoadL)));
+    GatherScatterMemory mem(cpu, Mem_Access_LoadL);
+    GATHER(sext<8>(mem.load8(RS2 + FS1.i32[e])));
 }
 
 
@@ -37,7 +39,8 @@ void insn_fghg_ps(Hart& cpu)
 {
     require_fp_active();
     DISASM_GATHER_FD_FS1_RS2("fghg.ps");
-    GATHER(sext<16>(mmu_aligned_load16(cpu, RS2 + FS1.i32[e], Mem_Access_LoadG)));
+    GatherScatterMemory mem(cpu, Mem_Access_LoadG);
+    GATHER(sext<16>(mem.aligned_load16(RS2 + FS1.i32[e])));
 }
 
 
@@ -45,7 +48,8 @@ void insn_fghl_ps(Hart& cpu)
 {
     require_fp_active();
     DISASM_GATHER_FD_FS1_RS2("fghl.ps");
-    GATHER(sext<16>(mmu_aligned_load16(cpu, RS2 + FS1.i32[e], Mem_Access_LoadL)));
+    GatherScatterMemory mem(cpu, Mem_Access_LoadL);
+    GATHER(sext<16>(mem.aligned_load16(RS2 + FS1.i32[e])));
 }
 
 
@@ -53,7 +57,8 @@ void insn_fgwg_ps(Hart& cpu)
 {
     require_fp_active();
     DISASM_GATHER_FD_FS1_RS2("fgwg.ps");
-    GATHER(mmu_aligned_load32(cpu, RS2 + FS1.i32[e], Mem_Access_LoadG));
+    GatherScatterMemory mem(cpu, Mem_Access_LoadG);
+    GATHER(mem.aligned_load32(RS2 + FS1.i32[e]));
 }
 
 
@@ -61,7 +66,8 @@ void insn_fgwl_ps(Hart& cpu)
 {
     require_fp_active();
     DISASM_GATHER_FD_FS1_RS2("fgwl.ps");
-    GATHER(mmu_aligned_load32(cpu, RS2 + FS1.i32[e], Mem_Access_LoadL));
+    GatherScatterMemory mem(cpu, Mem_Access_LoadL);
+    GATHER(mem.aligned_load32(RS2 + FS1.i32[e]));
 }
 
 
@@ -91,7 +97,8 @@ void insn_fscbg_ps(Hart& cpu)
 {
     require_fp_active();
     DISASM_SCATTER_FD_FS1_RS2("fscbg.ps");
-    SCATTER(mmu_store8(cpu, RS2 + FS1.i32[e], uint8_t(FD.u32[e]), Mem_Access_StoreG));
+    GatherScatterMemory mem(cpu, Mem_Access_StoreG);
+    SCATTER(mem.store8(RS2 + FS1.i32[e], uint8_t(FD.u32[e])));
 }
 
 
@@ -99,7 +106,8 @@ void insn_fscbl_ps(Hart& cpu)
 {
     require_fp_active();
     DISASM_SCATTER_FD_FS1_RS2("fscbl.ps");
-    SCATTER(mmu_store8(cpu, RS2 + FS1.i32[e], uint8_t(FD.u32[e]), Mem_Access_StoreL));
+    GatherScatterMemory mem(cpu, Mem_Access_StoreL);
+    SCATTER(mem.store8(RS2 + FS1.i32[e], uint8_t(FD.u32[e])));
 }
 
 
@@ -107,7 +115,8 @@ void insn_fschg_ps(Hart& cpu)
 {
     require_fp_active();
     DISASM_SCATTER_FD_FS1_RS2("fschg.ps");
-    SCATTER(mmu_aligned_store16(cpu, RS2 + FS1.i32[e], uint16_t(FD.u32[e]), Mem_Access_StoreG));
+    GatherScatterMemory mem(cpu, Mem_Access_StoreG);
+    SCATTER(mem.aligned_store16(RS2 + FS1.i32[e], uint16_t(FD.u32[e])));
 }
 
 
@@ -115,7 +124,8 @@ void insn_fschl_ps(Hart& cpu)
 {
     require_fp_active();
     DISASM_SCATTER_FD_FS1_RS2("fschl.ps");
-    SCATTER(mmu_aligned_store16(cpu, RS2 + FS1.i32[e], uint16_t(FD.u32[e]), Mem_Access_StoreL));
+    GatherScatterMemory mem(cpu, Mem_Access_StoreL);
+    SCATTER(mem.aligned_store16(RS2 + FS1.i32[e], uint16_t(FD.u32[e])));
 }
 
 
@@ -123,7 +133,8 @@ void insn_fscwg_ps(Hart& cpu)
 {
     require_fp_active();
     DISASM_SCATTER_FD_FS1_RS2("fscwg.ps");
-    SCATTER(mmu_aligned_store32(cpu, RS2 + FS1.i32[e], FD.u32[e], Mem_Access_StoreG));
+    GatherScatterMemory mem(cpu, Mem_Access_StoreG);
+    SCATTER(mem.aligned_store32(RS2 + FS1.i32[e], FD.u32[e]));
 }
 
 
@@ -131,7 +142,8 @@ void insn_fscwl_ps(Hart& cpu)
 {
     require_fp_active();
     DISASM_SCATTER_FD_FS1_RS2("fscwl.ps");
-    SCATTER(mmu_aligned_store32(cpu, RS2 + FS1.i32[e], FD.u32[e], Mem_Access_StoreL));
+    GatherScatterMemory mem(cpu, Mem_Access_StoreL);
+    SCATTER(mem.aligned_store32(RS2 + FS1.i32[e], FD.u32[e]));
 }
 
 
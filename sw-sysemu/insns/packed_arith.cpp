@@ -31,7 +31,7 @@ void insn_fadd_pi(Hart& cpu)
 {
     require_fp_active();
     DISASM_FD_FS1_FS2("fadd.pi");
-    INTMV_VD( FS1.u32[e] + FS2.u32[e] );
+    INTMV_VD_BLEND( FS1.u32[e] + FS2.u32[e] );
 }
 
 
@@ -39,7 +39,7 @@ void insn_faddi_pi(Hart& cpu)
 {
     require_fp_active();
     DISASM_FD_FS1_VIMM("faddi.pi");
-    INTMV_VD( FS1.u32[e] + VIMM );
+    INTMV_VD_BLEND( FS1.u32[e] + VIMM );
 }
 
 
@@ -47,7 +47,7 @@ void insn_fand_pi(Hart& cpu)
 {
     require_fp_active();
     DISASM_FD_FS1_FS2("fand.pi");
-    INTMV_VD( FS1.u32[e] & FS2.u32[e] );
+    INTMV_VD_BLEND( FS1.u32[e] & FS2.u32[e] );
 }
 
 
@@ -55,7 +55,7 @@ void insn_fandi_pi(Hart& cpu)
 {
     require_fp_active();
     DISASM_FD_FS1_UVIMM("fandi.pi");
-    INTMV_VD( FS1.u32[e] & uint32_t(VIMM) );
+    INTMV_VD_BLEND( FS1.u32[e] & uint32_t(VIMM) );
 }
 
 
@@ -85,7 +85,7 @@ void insn_feq_pi(Hart& cpu)
 {
     require_fp_active();
     DISASM_FD_FS1_FS2("feq.pi");
-    INTMV_VD( (FS1.u32[e] == FS2.u32[e]) ? UINT32_MAX : 0 );
+    INTMV_VD_BLEND( (FS1.u32[e] == FS2.u32[e]) ? UINT32_MAX : 0 );
 }
 
 
@@ -93,7 +93,7 @@ void insn_fle_pi(Hart& cpu)
 {
     require_fp_active();
     DISASM_FD_FS1_FS2("fle.pi");
-    INTMV_VD( (FS1.i32[e] <= FS2.i32[e]) ? UINT32_MAX : 0 );
+    INTMV_VD_BLEND( (FS1.i32[e] <= FS2.i32[e]) ? UINT32_MAX : 0 );
 }
 
 
@@ -101,7 +101,7 @@ void insn_flt_pi(Hart& cpu)
 {
     require_fp_active();
     DISASM_FD_FS1_FS2("flt.pi");
-    INTMV_VD( (FS1.i32[e] < FS2.i32[e]) ? UINT32_MAX : 0 );
+    INTMV_VD_BLEND( (FS1.i32[e] < FS2.i32[e]) ? UINT32_MAX : 0 );
 }
 
 
@@ -117,7 +117,7 @@ void insn_fltu_pi(Hart& cpu)
 {
     require_fp_active();
     DISASM_FD_FS1_FS2("fltu.pi");
-    INTMV_VD( (FS1.u32[e] < FS2.u32[e]) ? UINT32_MAX : 0 );
+    INTMV_VD_BLEND( (FS1.u32[e] < FS2.u32[e]) ? UINT32_MAX : 0 );
 }
 
 
@@ -125,7 +125,7 @@ void insn_fmax_pi(Hart& cpu)
 {
     require_fp_active();
     DISASM_FD_FS1_FS2("fmax.pi");
-    INTMV_VD( std::max(FS1.i32[e], FS2.i32[e]) );
+    INTMV_VD_BLEND( std::max(FS1.i32[e], FS2.i32[e]) );
 }
 
 
@@ -133,7 +133,7 @@ void insn_fmaxu_pi(Hart& cpu)
 {
     require_fp_active();
     DISASM_FD_FS1_FS2("fmaxu.pi");
-    INTMV_VD( std::max(FS1.u32[e], FS2.u32[e]) );
+    INTMV_VD_BLEND( std::max(FS1.u32[e], FS2.u32[e]) );
 }
 
 
@@ -141,7 +141,7 @@ void insn_fmin_pi(Hart& cpu)
 {
     require_fp_active();
     DISASM_FD_FS1_FS2("fmin.pi");
-    INTMV_VD( std::min(FS1.i32[e], FS2.i32[e]) );
+    INTMV_VD_BLEND( std::min(FS1.i32[e], FS2.i32[e]) );
 }
 
 
@@ -149,7 +149,7 @@ void insn_fminu_pi(Hart& cpu)
 {
     require_fp_active();
     DISASM_FD_FS1_FS2("fminu.pi");
-    INTMV_VD( std::min(FS1.u32[e], FS2.u32[e]) );
+    INTMV_VD_BLEND( std::min(FS1.u32[e], FS2.u32[e]) );
 }
 
 
@@ -157,7 +157,7 @@ void insn_fmul_pi(Hart& cpu)
 {
     require_fp_active();
     DISASM_FD_FS1_FS2("fmul.pi");
-    INTMV_VD( FS1.u32[e] * FS2.u32[e] );
+    INTMV_VD_BLEND( FS1.u32[e] * FS2.u32[e] );
 }
 
 
@@ -165,7 +165,7 @@ void insn_fmulh_pi(Hart& cpu)
 {
     require_fp_active();
     DISASM_FD_FS1_FS2("fmulh.pi");
-    INTMV_VD( (int64_t(FS1.i32[e]) * int64_t(FS2.i32[e]) >> 32) );
+    INTMV_VD_BLEND( (int64_t(FS1.i32[e]) * int64_t(FS2.i32[e]) >> 32) );
 }
 
 
@@ -173,7 +173,7 @@ void insn_fmulhu_pi(Hart& cpu)
 {
     require_fp_active();
     DISASM_FD_FS1_FS2("fmulhu.pi");
-    INTMV_VD( (uint64_t(FS1.u32[e]) * uint64_t(FS2.u32[e]) >> 32) );
+    INTMV_VD_BLEND( (uint64_t(FS1.u32[e]) * uint64_t(FS2.u32[e]) >> 32) );
 }
 
 
@@ -181,7 +181,7 @@ void insn_fnot_pi(Hart& cpu)
 {
     require_fp_active();
     DISASM_FD_FS1("fnot.pi");
-    INTMV_VD( ~FS1.u32[e] );
+    INTMV_VD_BLEND( ~FS1.u32[e] );
 }
 
 
@@ -189,7 +189,7 @@ void insn_for_pi(Hart& cpu)
 {
     require_fp_active();
     DISASM_FD_FS1_FS2("for.pi");
-    INTMV_VD( FS1.u32[e] | FS2.u32[e] );
+    INTMV_VD_BLEND( FS1.u32[e] | FS2.u32[e] );
 }
 
 
@@ -257,7 +257,7 @@ void insn_fsll_pi(Hart& cpu)
 {
     require_fp_active();
     DISASM_FD_FS1_FS2("fsll.pi");
-    INTMV_VD( (FS2.u32[e] >= 32) ? 0 : (FS1.u32[e] << FS2.u32[e]) );
+    INTMV_VD_BLEND( (FS2.u32[e] >= 32) ? 0 : (FS1.u32[e] << FS2.u32[e]) );
 }
 
 
@@ -265,7 +265,7 @@ void insn_fslli_pi(Hart& cpu)
 {
     require_fp_active();
     DISASM_FD_FS1_SHAMT5("fslli.pi");
-    INTMV_VD( FS1.u32[e] << SHAMT5 );
+    INTMV_VD_BLEND( FS1.u32[e] << SHAMT5 );
 }
 
 
@@ -273,7 +273,7 @@ void insn_fsra_pi(Hart& cpu)
 {
     require_fp_active();
     DISASM_FD_FS1_FS2("fsra.pi");
-    INTMV_VD( FS1.i32[e] >> std::min(FS2.u32[e], 31u) );
+    INTMV_VD_BLEND( FS1.i32[e] >> std::min(FS2.u32[e], 31u) );
 }
 
 
@@ -281,7 +281,7 @@ void insn_fsrai_pi(Hart& cpu)
 {
     require_fp_active();
     DISASM_FD_FS1_SHAMT5("fsrai.pi");
-    INTMV_VD( FS1.i32[e] >> SHAMT5 );
+    INTMV_VD_BLEND( FS1.i32[e] >> SHAMT5 );
 }
 
 
@@ -289,7 +289,7 @@ void insn_fsrl_pi(Hart& cpu)
 {
     require_fp_active();
     DISASM_FD_FS1_FS2("fsrl.pi");
-    INTMV_VD( (FS2.u32[e] >= 32) ? 0 : (FS1.u32[e] >> FS2.u32[e]) );
+    INTMV_VD_BLEND( (FS2.u32[e] >= 32) ? 0 : (FS1.u32[e] >> FS2.u32[e]) );
 }
 
 
@@ -297,7 +297,7 @@ void insn_fsrli_pi(Hart& cpu)
 {
     require_fp_active();
     DISASM_FD_FS1_SHAMT5("fsrli.pi");
-    INTMV_VD( FS1.u32[e] >> SHAMT5 );
+    INTMV_VD_BLEND( FS1.u32[e] >> SHAMT5 );
 }
 
 
@@ -305,7 +305,7 @@ void insn_fsub_pi(Hart& cpu)
 {
     require_fp_active();
     DISASM_FD_FS1_FS2("fsub.pi");
-    INTMV_VD( FS1.u32[e] - FS2.u32[e] );
+    INTMV_VD_BLEND( FS1.u32[e] - FS2.u32[e] );
 }
 
 
@@ -313,7 +313,7 @@ void insn_fxor_pi(Hart& cpu)
 {
     require_fp_active();
     DISASM_FD_FS1_FS2("fxor.pi");
-    INTMV_VD( FS1.u32[e] ^ FS2.u32[e] );
+    INTMV_VD_BLEND( FS1.u32[e] ^ FS2.u32[e] );
 }
 
 
@@ -7,6 +7,7 @@
 #include "emu_gio.h"
 #include "fpu/fpu.h"
 #include "fpu/fpu_casts.h"
+#include "fpu/fpu_ps.h"
 #include "insn.h"
 #include "insn_func.h"
 #include "insn_util.h"
@@ -18,12 +19,18 @@
 namespace bemu {
 
 
+// Host SIMD versions of the operations, see WRITE_VD_FAST()
+#define PS_VD1(op) fpu::op(FD.u32.data(), FS1.u32.data(), M0.to_ulong())
+#define PS_VD2(op) fpu::op(FD.u32.data(), FS1.u32.data(), FS2.u32.data(), M0.to_ulong())
+#define PS_VD3(op) fpu::op(FD.u32.data(), FS1.u32.data(), FS2.u32.data(), FS3.u32.data(), M0.to_ulong())
+
+
 void insn_fadd_ps(Hart& cpu)
 {
     require_fp_active();
     DISASM_FD_FS1_FS2_RM("fadd.ps");
     set_rounding_mode(cpu, RM);
-    WRITE_VD( fpu::f32_add(FS1.f32[e], FS2.f32[e]) );
+    WRITE_VD_FAST( PS_VD2(ps_add), fpu::f32_add(FS1.f32[e], FS2.f32[e]) );
     set_fp_exceptions(cpu);
 }
 
@@ -93,7 +100,7 @@ void insn_fcvt_ps_pw(Hart& cpu)
     require_fp_active();
     DISASM_FD_FS1_RM("fcvt.ps.pw");
     set_rounding_mode(cpu, RM);
-    WRITE_VD( fpu::i32_to_f32(FS1.i32[e]) );
+    WRITE_VD_FAST( PS_VD1(ps_from_i32), fpu::i32_to_f32(FS1.i32[e]) );
     set_fp_exceptions(cpu);
 }
 
@@ -113,7 +120,7 @@ void insn_fcvt_pw_ps(Hart& cpu)
     require_fp_active();
     DISASM_FD_FS1_RM("fcvt.pw.ps");
     set_rounding_mode(cpu, RM);
-    WRITE_VD( fpu::f32_to_i32(FS1.f32[e]) );
+    WRITE_VD_FAST( PS_VD1(ps_to_i32), fpu::f32_to_i32(FS1.f32[e]) );
     set_fp_exceptions(cpu);
 }
 
@@ -139,7 +146,7 @@ void insn_feq_ps(Hart& cpu)
 {
     require_fp_active();
     DISASM_FD_FS1_FS2("feq.ps");
-    WRITE_VD( fpu::f32_eq(FS1.f32[e], FS2.f32[e]) ? UINT32_MAX : 0 );
+    WRITE_VD_FAST( PS_VD2(ps_eq), fpu::f32_eq(FS1.f32[e], FS2.f32[e]) ? UINT32_MAX : 0 );
     set_fp_exceptions(cpu);
 }
 
@@ -166,7 +173,7 @@ void insn_fle_ps(Hart& cpu)
 {
     require_fp_active();
     DISASM_FD_FS1_FS2("fle.ps");
-    WRITE_VD( fpu::f32_le(FS1.f32[e], FS2.f32[e]) ? UINT32_MAX : 0 );
+    WRITE_VD_FAST( PS_VD2(ps_le), fpu::f32_le(FS1.f32[e], FS2.f32[e]) ? UINT32_MAX : 0 );
     set_fp_exceptions(cpu);
 }
 
@@ -184,7 +191,7 @@ void insn_flt_ps(Hart& cpu)
 {
     require_fp_active();
     DISASM_FD_FS1_FS2("flt.ps");
-    WRITE_VD( fpu::f32_lt(FS1.f32[e], FS2.f32[e]) ? UINT32_MAX : 0 );
+    WRITE_VD_FAST( PS_VD2(ps_lt), fpu::f32_lt(FS1.f32[e], FS2.f32[e]) ? UINT32_MAX : 0 );
     set_fp_exceptions(cpu);
 }
 
@@ -203,7 +210,7 @@ void insn_fmadd_ps(Hart& cpu)
     require_fp_active();
     DISASM_FD_FS1_FS2_FS3_RM("fmadd.ps");
     set_rounding_mode(cpu, RM);
-    WRITE_VD( fpu::f32_mulAdd(FS1.f32[e], FS2.f32[e], FS3.f32[e]) );
+    WRITE_VD_FAST( PS_VD3(ps_mulAdd), fpu::f32_mulAdd(FS1.f32[e], FS2.f32[e], FS3.f32[e]) );
     set_fp_exceptions(cpu);
 }
 
@@ -212,7 +219,7 @@ void insn_fmax_ps(Hart& cpu)
 {
     require_fp_active();
     DISASM_FD_FS1_FS2("fmax.ps");
-    WRITE_VD( fpu::f32_maximumNumber(FS1.f32[e], FS2.f32[e]) );
+    WRITE_VD_FAST( PS_VD2(ps_max), fpu::f32_maximumNumber(FS1.f32[e], FS2.f32[e]) );
     set_fp_exceptions(cpu);
 }
 
@@ -221,7 +228,7 @@ void insn_fmin_ps(Hart& cpu)
 {
     require_fp_active();
     DISASM_FD_FS1_FS2("fmin.ps");
-    WRITE_VD( fpu::f32_minimumNumber(FS1.f32[e], FS2.f32[e]) );
+    WRITE_VD_FAST( PS_VD2(ps_min), fpu::f32_minimumNumber(FS1.f32[e], FS2.f32[e]) );
     set_fp_exceptions(cpu);
 }
 
@@ -231,7 +238,7 @@ void insn_fmsub_ps(Hart& cpu)
     require_fp_active();
     DISASM_FD_FS1_FS2_FS3_RM("fmsub.ps");
     set_rounding_mode(cpu, RM);
-    WRITE_VD( fpu::f32_mulSub(FS1.f32[e], FS2.f32[e], FS3.f32[e]) );
+    WRITE_VD_FAST( PS_VD3(ps_mulSub), fpu::f32_mulSub(FS1.f32[e], FS2.f32[e], FS3.f32[e]) );
     set_fp_exceptions(cpu);
 }
 
@@ -241,7 +248,7 @@ void insn_fmul_ps(Hart& cpu)
     require_fp_active();
     DISASM_FD_FS1_FS2_RM("fmul.ps");
     set_rounding_mode(cpu, RM);
-    WRITE_VD( fpu::f32_mul(FS1.f32[e], FS2.f32[e]) );
+    WRITE_VD_FAST( PS_VD2(ps_mul), fpu::f32_mul(FS1.f32[e], FS2.f32[e]) );
     set_fp_exceptions(cpu);
 }
 
@@ -267,7 +274,7 @@ void insn_fnmadd_ps(Hart& cpu)
     require_fp_active();
     DISASM_FD_FS1_FS2_FS3_RM("fnmadd.ps");
     set_rounding_mode(cpu, RM);
-    WRITE_VD( fpu::f32_subMulAdd(FS1.f32[e], FS2.f32[e], FS3.f32[e]) );
+    WRITE_VD_FAST( PS_VD3(ps_subMulAdd), fpu::f32_subMulAdd(FS1.f32[e], FS2.f32[e], FS3.f32[e]) );
     set_fp_exceptions(cpu);
 }
 
@@ -277,7 +284,7 @@ void insn_fnmsub_ps(Hart& cpu)
     require_fp_active();
     DISASM_FD_FS1_FS2_FS3_RM("fnmsub.ps");
     set_rounding_mode(cpu, RM);
-    WRITE_VD( fpu::f32_subMulSub(FS1.f32[e], FS2.f32[e], FS3.f32[e]) );
+    WRITE_VD_FAST( PS_VD3(ps_subMulSub), fpu::f32_subMulSub(FS1.f32[e], FS2.f32[e], FS3.f32[e]) );
     set_fp_exceptions(cpu);
 }
 
@@ -328,7 +335,7 @@ void insn_fsub_ps(Hart& cpu)
     require_fp_active();
     DISASM_FD_FS1_FS2_RM("fsub.ps");
     set_rounding_mode(cpu, RM);
-    WRITE_VD( fpu::f32_sub(FS1.f32[e], FS2.f32[e]) );
+    WRITE_VD_FAST( PS_VD2(ps_sub), fpu::f32_sub(FS1.f32[e], FS2.f32[e]) );
     set_fp_exceptions(cpu);
 }
 
@@ -31,7 +31,8 @@ void insn_fg32b_ps(Hart& cpu)
 {
     require_fp_active();
     DISASM_GATHER_FD_RS1_RS2("fg32b.ps");
-    GATHER32(sext<8>(mmu_load8(cpu, (RS2 & ~31ull) + ((RS2 + (RS1>>(5*e))) & 31), Mem_Access_Load)));
+    GatherScatterMemory mem(cpu, Mem_Access_Load);
+    GATHER32(sext<8>(mem.load8((RS2 & ~31ull) + ((RS2 + (RS1>>(5*e))) & 31))));
 }
 
 
@@ -39,7 +40,8 @@ void insn_fg32h_ps(Hart& cpu)
 {
     require_fp_active();
     DISASM_GATHER_FD_RS1_RS2("fg32h.ps");
-    GATHER32(sext<16>(mmu_load16(cpu, (RS2 & ~31ull) + ((RS2 + ((RS1>>(4*e))<<1)) & 30), Mem_Access_Load)));
+    GatherScatterMemory mem(cpu, Mem_Access_Load);
+    GATHER32(sext<16>(mem.load16((RS2 & ~31ull) + ((RS2 + ((RS1>>(4*e))<<1)) & 30))));
 }
 
 
@@ -47,7 +49,8 @@ void insn_fg32w_ps(Hart& cpu)
 {
     require_fp_active();
     DISASM_GATHER_FD_RS1_RS2("fg32w.ps");
-    GATHER32(mmu_load32(cpu, (RS2 & ~31ull) + ((RS2 + ((RS1>>(3*e))<<2)) & 28), Mem_Access_Load));
+    GatherScatterMemory mem(cpu, Mem_Access_Load);
+    GATHER32(mem.load32((RS2 & ~31ull) + ((RS2 + ((RS1>>(3*e))<<2)) & 28)));
 }
 
 
@@ -55,7 +58,8 @@ void insn_fgb_ps(Hart& cpu)
 {
     require_fp_active();
     DISASM_GATHER_FD_FS1_RS2("fgb.ps");
-    GATHER(sext<8>(mmu_load8(cpu, RS2 + FS1.i32[e], Mem_Access_Load)));
+    GatherScatterMemory mem(cpu, Mem_Access_Load);
+    GATHER(sext<8>(mem.load8(RS2 + FS1.i32[e])));
 }
 
 
@@ -63,7 +67,8 @@ void insn_fgh_ps(Hart& cpu)
 {
     require_fp_active();
     DISASM_GATHER_FD_FS1_RS2("fgh.ps");
-    GATHER(sext<16>(mmu_load16(cpu, RS2 + FS1.i32[e], Mem_Access_Load)));
+    GatherScatterMemory mem(cpu, Mem_Access_Load);
+    GATHER(sext<16>(mem.load16(RS2 + FS1.i32[e])));
 }
 
 
@@ -71,7 +76,8 @@ void insn_fgw_ps(Hart& cpu)
 {
     require_fp_active();
     DISASM_GATHER_FD_FS1_RS2("fgw.ps");
-    GATHER(mmu_load32(cpu, RS2 + FS1.i32[e], Mem_Access_Load));
+    GatherScatterMemory mem(cpu, Mem_Access_Load);
+    GATHER(mem.load32(RS2 + FS1.i32[e]));
 }
 
 
@@ -97,7 +103,8 @@ void insn_fsc32b_ps(Hart& cpu)
 {
     require_fp_active();
     DISASM_SCATTER_FD_RS1_RS2("fsc32b.ps");
-    SCATTER32(mmu_store8(cpu, (RS2 & ~31ull) + ((RS2 + (RS1>>(5*e))) & 31), uint8_t(FD.u32[e]), Mem_Access_Store));
+    GatherScatterMemory mem(cpu, Mem_Access_Store);
+    SCATTER32(mem.store8((RS2 & ~31ull) + ((RS2 + (RS1>>(5*e))) & 31), uint8_t(FD.u32[e])));
 }
 
 
@@ -105,7 +112,8 @@ void insn_fsc32h_ps(Hart& cpu)
 {
     require_fp_active();
     DISASM_SCATTER_FD_RS1_RS2("fsc32h.ps");
-    SCATTER32(mmu_store16(cpu, (RS2 & ~31ull) + ((RS2 + ((RS1>>(4*e))<<1)) & 30), uint16_t(FD.u32[e]), Mem_Access_Store));
+    GatherScatterMemory mem(cpu, Mem_Access_Store);
+    SCATTER32(mem.store16((RS2 & ~31ull) + ((RS2 + ((RS1>>(4*e))<<1)) & 30), uint16_t(FD.u32[e])));
 }
 
 
@@ -113,7 +121,8 @@ void insn_fsc32w_ps(Hart& cpu)
 {
     require_fp_active();
     DISASM_SCATTER_FD_RS1_RS2("fsc32w.ps");
-    SCATTER32(mmu_store32(cpu, (RS2 & ~31ull) + ((RS2 + ((RS1>>(3*e))<<2)) & 28), FD.u32[e], Mem_Access_Store));
+    GatherScatterMemory mem(cpu, Mem_Access_Store);
+    SCATTER32(mem.store32((RS2 & ~31ull) + ((RS2 + ((RS1>>(3*e))<<2)) & 28), FD.u32[e]));
 }
 
 
@@ -121,7 +130,8 @@ void insn_fscb_ps(Hart& cpu)
 {
     require_fp_active();
     DISASM_SCATTER_FD_FS1_RS2("fscb.ps");
-    SCATTER(mmu_store8(cpu, RS2 + FS1.i32[e], uint8_t(FD.u32[e]), Mem_Access_Store));
+    GatherScatterMemory mem(cpu, Mem_Access_Store);
+    SCATTER(mem.store8(RS2 + FS1.i32[e], uint8_t(FD.u32[e])));
 }
 
 
@@ -129,7 +139,8 @@ void insn_fsch_ps(Hart& cpu)
 {
     require_fp_active();
     DISASM_SCATTER_FD_FS1_RS2("fsch.ps");
-    SCATTER(mmu_store16(cpu, RS2 + FS1.i32[e], uint16_t(FD.u32[e]), Mem_Access_Store));
+    GatherScatterMemory mem(cpu, Mem_Access_Store);
+    SCATTER(mem.store16(RS2 + FS1.i32[e], uint16_t(FD.u32[e])));
 }
 
 
@@ -137,7 +148,8 @@ void insn_fscw_ps(Hart& cpu)
 {
     require_fp_active();
     DISASM_SCATTER_FD_FS1_RS2("fscw.ps");
-    SCATTER(mmu_store32(cpu, RS2 + FS1.i32[e], FD.u32[e], Mem_Access_Store));
+    GatherScatterMemory mem(cpu, Mem_Access_Store);
+    SCATTER(mem.store32(RS2 + FS1.i32[e], FD.u32[e]));
 }
 
 
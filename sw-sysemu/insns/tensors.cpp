@@ -7,6 +7,9 @@
 #include <cassert>
 #include <cinttypes>
 #include <stdexcept>
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
 
 #include "cache.h"
 #include "emu_defines.h"
@@ -283,6 +286,22 @@ static TLoad& coop_tload_find_partner(Hart& hart, const TLoad& tload)
 #endif
 
 
+#if defined(ZSIM) || defined(SYS_EMU)
+// The reduce at the head of the issue queue can send or receive. A sender
+// may make its receiver ready, so wake it up.
+static void tensor_reduce_ready(Hart& cpu)
+{
+    TReduce& reduce = cpu.core->reduce;
+    if (reduce.state == TReduce::State::waiting_to_receive) {
+        reduce.state = TReduce::State::ready_to_receive;
+    } else {
+        reduce.state = TReduce::State::ready_to_send;
+        reduce.hart->coprocessor_ready();
+    }
+}
+#endif
+
+
 void tensor_load_start(Hart& cpu, uint64_t control)
 {
     uint64_t stride  = X31 & 0xFFFFFFFFFFC0ULL;
@@ -438,6 +457,7 @@ void tensor_load_start(Hart& cpu, uint64_t control)
                 Hart& hart = cpu.chip->cpu[hart0 + m * EMU_THREADS_PER_MINION];
                 auto& other_tload = coop_tload_find_partner(hart, tload);
                 other_tload.state = TLoad::State::ready;
+                hart.coprocessor_ready();
             }
         }
     } else {
@@ -451,6 +471,70 @@ void tensor_load_start(Hart& cpu, uint64_t control)
 }
 
 
+// TensorLoadInterleave8: byte c of row r goes to byte 4*c+r of the line.
+// Rows that were not loaded (bit clear in @valid) leave their bytes as they
+// were.
+static void tload_interleave8(cache_line_t& line, const std::array<Packed<128>, 4>& rows, unsigned valid)
+{
+#ifdef __SSE2__
+    if (valid == 0xF) {
+        __m128i r0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(rows[0].u8.data()));
+        __m128i r1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(rows[1].u8.data()));
+        __m128i r2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(rows[2].u8.data()));
+        __m128i r3 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(rows[3].u8.data()));
+        __m128i r01lo = _mm_unpacklo_epi8(r0, r1);
+        __m128i r01hi = _mm_unpackhi_epi8(r0, r1);
+        __m128i r23lo = _mm_unpacklo_epi8(r2, r3);
+        __m128i r23hi = _mm_unpackhi_epi8(r2, r3);
+        __m128i* dst = reinterpret_cast<__m128i*>(line.u8.data());
+        _mm_storeu_si128(dst + 0, _mm_unpacklo_epi16(r01lo, r23lo));
+        _mm_storeu_si128(dst + 1, _mm_unpackhi_epi16(r01lo, r23lo));
+        _mm_storeu_si128(dst + 2, _mm_unpacklo_epi16(r01hi, r23hi));
+        _mm_storeu_si128(dst + 3, _mm_unpackhi_epi16(r01hi, r23hi));
+        return;
+    }
+#endif
+    for (int r = 0; r < 4; ++r) {
+        if (valid & (1u << r)) {
+            for (int c = 0; c < 16; ++c) {
+                line.u8[c*4 + r] = rows[r].u8[c];
+            }
+        }
+    }
+}
+
+
+// TensorLoadInterleave16: halfword c of row r goes to halfword 2*c+r of the
+// line. Rows that were not loaded (bit clear in @valid) leave their
+// halfwords as they were.
+static void tload_interleave16(cache_line_t& line, const std::array<Packed<256>, 2>& rows, unsigned valid)
+{
+#ifdef __SSE2__
+    if (valid == 0x3) {
+        const __m128i* r0 = reinterpret_cast<const __m128i*>(rows[0].u16.data());
+        const __m128i* r1 = reinterpret_cast<const __m128i*>(rows[1].u16.data());
+        __m128i r0lo = _mm_loadu_si128(r0);
+        __m128i r0hi = _mm_loadu_si128(r0 + 1);
+        __m128i r1lo = _mm_loadu_si128(r1);
+        __m128i r1hi = _mm_loadu_si128(r1 + 1);
+        __m128i* dst = reinterpret_cast<__m128i*>(line.u16.data());
+        _mm_storeu_si128(dst + 0, _mm_unpacklo_epi16(r0lo, r1lo));
+        _mm_storeu_si128(dst + 1, _mm_unpackhi_epi16(r0lo, r1lo));
+        _mm_storeu_si128(dst + 2, _mm_unpacklo_epi16(r0hi, r1hi));
+        _mm_storeu_si128(dst + 3, _mm_unpackhi_epi16(r0hi, r1hi));
+        return;
+    }
+#endif
+    for (int r = 0; r < 2; ++r) {
+        if (valid & (1u << r)) {
+            for (int c = 0; c < 16; ++c) {
+                line.u16[c*2 + r] = rows[r].u16[c];
+            }
+        }
+    }
+}
+
+
 void tensor_load_execute(Hart& cpu, int tlid, bool tenb)
 {
     assert(tlid == 0 || tlid == 1);
@@ -501,6 +585,7 @@ void tensor_load_execute(Hart& cpu, int tlid, bool tenb)
 
     std::array<cache_line_t, L1D_LINE_SIZE> tmp;
     std::bitset<L1D_LINE_SIZE>              okay;
+    TensorMemory                            mem(cpu, Mem_Access_TxLoad);
 
     switch (cmd) {
     case tload_cmd_load:
@@ -513,7 +598,7 @@ void tensor_load_execute(Hart& cpu, int tlid, bool tenb)
             if (!msk || tload.tmask[i]) {
                 int idx = adj + ((start + i) % L1_SCP_ENTRIES);
                 try {
-                    mmu_tensor_load512(cpu, addr + i*stride, SCP[idx].u32.data(), Mem_Access_TxLoad);
+                    mem.load512(addr + i*stride, SCP[idx].u32.data());
                     LOG_SCP_32x16("=", idx);
                     L1_SCP_CHECK_FILL(cpu, idx, id);
                 }
@@ -538,27 +623,30 @@ void tensor_load_execute(Hart& cpu, int tlid, bool tenb)
                  rows, stride, id, tload.tmask.to_ulong());
         for (int i = 0; i < rows; ++i) {
             if (!msk || tload.tmask[i]) {
-                bool dirty = false;
+                std::array<Packed<128>, 4> parts;
+                unsigned valid = 0;
+                bool fault = false;
                 int idx = adj + ((start + i) % L1_SCP_ENTRIES);
                 for (int r = 0; r < 4; ++r) {
                     try {
-                        Packed<128> tmp;
-                        mmu_tensor_load128(cpu, addr + boffset + (4*i+r)*stride, tmp.u32.data(), Mem_Access_TxLoad);
-                        for (int c = 0; c < 16; ++c) {
-                            SCP[idx].u8[c*4 + r] = tmp.u8[c];
-                        }
+                        mem.load128(addr + boffset + (4*i+r)*stride, parts[r].u32.data());
                     }
                     catch (const Exception&) {
                         update_tensor_error(cpu, 1 << 7);
-                        goto tload_exit;
+                        fault = true;
+                        break;
                     }
                     catch (const memory_error&) {
                         cpu.raise_interrupt(BUS_ERROR_INTERRUPT, 0);
                         continue;
                     }
-                    dirty = true;
+                    valid |= 1u << r;
                 }
-                if (dirty) {
+                tload_interleave8(SCP[idx], parts, valid);
+                if (fault) {
+                    goto tload_exit;
+                }
+                if (valid) {
                     notify_tensor_load_scp_write(cpu, i, &SCP[idx].u64[0]);
                     LOG_SCP_32x16("=", idx);
                 }
@@ -575,27 +663,30 @@ void tensor_load_execute(Hart& cpu, int tlid, bool tenb)
                  rows, stride, id, tload.tmask.to_ulong());
         for (int i = 0; i < rows; ++i) {
             if (!msk || tload.tmask[i]) {
-                bool dirty = false;
+                std::array<Packed<256>, 2> parts;
+                unsigned valid = 0;
+                bool fault = false;
                 int idx = adj + ((start + i) % L1_SCP_ENTRIES);
                 for (int r = 0; r < 2; ++r) {
                     try {
-                        Packed<256> tmp;
-                        mmu_tensor_load256(cpu, addr + boffset + (2*i+r)*stride, tmp.u32.data(), Mem_Access_TxLoad);
-                        for (int c = 0; c < 16; ++c) {
-                            SCP[idx].u16[c*2 + r] = tmp.u16[c];
-                        }
+                        mem.load256(addr + boffset + (2*i+r)*stride, parts[r].u32.data());
                     }
                     catch (const Exception&) {
                         update_tensor_error(cpu, 1 << 7);
-                        goto tload_exit;
+                        fault = true;
+                        break;
                     }
                     catch (const memory_error&) {
                         cpu.raise_interrupt(BUS_ERROR_INTERRUPT, 0);
                         continue;
                     }
-                    dirty = true;
+                    valid |= 1u << r;
+                }
+                tload_interleave16(SCP[idx], parts, valid);
+                if (fault) {
+                    goto tload_exit;
                 }
-                if (dirty) {
+                if (valid) {
                     notify_tensor_load_scp_write(cpu, i, &SCP[idx].u64[0]);
                     LOG_SCP_32x16("=", idx);
                 }
@@ -613,7 +704,7 @@ void tensor_load_execute(Hart& cpu, int tlid, bool tenb)
         okay.reset();
         for (int j = 0; j < L1D_LINE_SIZE; ++j) {
             try {
-                mmu_tensor_load512(cpu, addr + j*stride, tmp[j].u32.data(), Mem_Access_TxLoad);
+                mem.load512(addr + j*stride, tmp[j].u32.data());
             }
             catch (const Exception&) {
                 update_tensor_error(cpu, 1 << 7);
@@ -647,7 +738,7 @@ void tensor_load_execute(Hart& cpu, int tlid, bool tenb)
         okay.reset();
         for (int j = 0; j < (L1D_LINE_SIZE / 2); ++j) {
             try {
-                mmu_tensor_load512(cpu, addr + j*stride, tmp[j].u32.data(), Mem_Access_TxLoad);
+                mem.load512(addr + j*stride, tmp[j].u32.data());
             }
             catch (const Exception&) {
                 update_tensor_error(cpu, 1 << 7);
@@ -680,7 +771,7 @@ void tensor_load_execute(Hart& cpu, int tlid, bool tenb)
         okay.reset();
         for (int j = 0; j < (L1D_LINE_SIZE / 4); ++j) {
             try {
-                mmu_tensor_load512(cpu, addr + j*stride, tmp[j].u32.data(), Mem_Access_TxLoad);
+                mem.load512(addr + j*stride, tmp[j].u32.data());
             }
             catch (const Exception&) {
                 update_tensor_error(cpu, 1 << 7);
@@ -736,13 +827,14 @@ void tensor_load_l2_start(Hart& cpu, uint64_t control)
              msk, dst, addr, rows, stride, id);
 
     uint64_t shire = cpu.shireid();
+    TensorMemory mem(cpu, Mem_Access_TxLoadL2Scp);
     for (int i = 0; i < rows; ++i) {
         if (!msk || cpu.tensor_mask[i]) {
             uint64_t l2scp_addr = L2_SCP_BASE + shire * L2_SCP_OFFSET + ((dst + i) * L1D_LINE_SIZE);
             try {
                 cache_line_t tmp;
                 const uint64_t vaddr = sextVA(addr + i*stride);
-                mmu_tensor_load512(cpu, vaddr, tmp.u32.data(), Mem_Access_TxLoadL2Scp);
+                mem.load512(vaddr, tmp.u32.data());
                 cpu.chip->memory.write(cpu, l2scp_addr, L1D_LINE_SIZE, tmp.u32.data());
                 LOG_MEMWRITE512(l2scp_addr, tmp.u32);
                 L2_SCP_CHECK_FILL(cpu, dst + i, id, vaddr);
@@ -1011,10 +1103,7 @@ void tensor_quant_execute(Hart& cpu)
     assert(cpu.core->tqueue.front() == TQueue::Instruction::tquant);
     cpu.core->tqueue.pop();
     if (cpu.core->tqueue.front() == TQueue::Instruction::reduce) {
-        cpu.core->reduce.state =
-            (cpu.core->reduce.state == TReduce::State::waiting_to_receive)
-            ? TReduce::State::ready_to_receive
-            : TReduce::State::ready_to_send;
+        tensor_reduce_ready(cpu);
     }
 #endif
     cpu.core->tquant.state = TQuant::State::idle;
@@ -1047,10 +1136,11 @@ static void tensor_store_from_scp(Hart& cpu, uint64_t tstorereg)
     }
 
     // For all the rows
+    TensorMemory mem(cpu, Mem_Access_TxStore);
     for (int row = 0; row < rows; row++) {
         LOG_SCP_32x16(":", src);
         try {
-            mmu_tensor_store512(cpu, addr + row*stride, SCP[src].u32.data(), Mem_Access_TxStore);
+            mem.store512(addr + row*stride, SCP[src].u32.data());
             L1_SCP_CHECK_READ(cpu, src, tensor_op_type::TensorStore);
         }
         catch (const Exception&) {
@@ -1152,10 +1242,7 @@ void tensor_store_execute(Hart& cpu)
     assert(cpu.core->tqueue.front() == TQueue::Instruction::tstore);
     cpu.core->tqueue.pop();
     if (cpu.core->tqueue.front() == TQueue::Instruction::reduce) {
-        cpu.core->reduce.state =
-            (cpu.core->reduce.state == TReduce::State::waiting_to_receive)
-            ? TReduce::State::ready_to_receive
-            : TReduce::State::ready_to_send;
+        tensor_reduce_ready(cpu);
     }
 #endif
     cpu.core->tstore.state = TStore::State::idle;
@@ -1178,6 +1265,7 @@ void tensor_store_execute(Hart& cpu)
     // For all the rows
     int src = regstart;
     uint64_t mask = ~(16ull*cols - 1ull);
+    TensorMemory mem(cpu, Mem_Access_TxStore);
     for (int row = 0; row < rows; row++) {
         // For all the blocks of 128b
         for (int col = 0; col < cols; col++) {
@@ -1185,7 +1273,7 @@ void tensor_store_execute(Hart& cpu)
                 if (!(col & 1)) LOG_FREG(":", src);
                 const uint32_t* ptr = &FREGS[src].u32[(col & 1) * 4];
                 const uint64_t eaddr = (addr + row * stride) & mask;
-                mmu_tensor_store128(cpu, eaddr + col*16, ptr, Mem_Access_TxStore);
+                mem.store128(eaddr + col*16, ptr);
             }
             catch (const Exception&) {
                 update_tensor_error(cpu, 1 << 7);
@@ -1580,10 +1668,7 @@ void tensor_fma_execute(Hart& cpu)
     assert(cpu.core->tqueue.front() == TQueue::Instruction::tfma);
     cpu.core->tqueue.pop();
     if (cpu.core->tqueue.front() == TQueue::Instruction::reduce) {
-        cpu.core->reduce.state =
-            (cpu.core->reduce.state == TReduce::State::waiting_to_receive)
-            ? TReduce::State::ready_to_receive
-            : TReduce::State::ready_to_send;
+        tensor_reduce_ready(cpu);
     }
 #endif
     cpu.core->tmul.state = TMul::State::idle;
@@ -1908,9 +1993,7 @@ void tensor_reduce_start(Hart& cpu, uint64_t value)
     if (cpu.core->tqueue.front() == TQueue::Instruction::reduce) {
         // If we are the head of the queue then we are actually ready to send
         // and receive, not just waiting.
-        reduce.state = (reduce.state == TReduce::State::waiting_to_receive)
-            ? TReduce::State::ready_to_receive
-            : TReduce::State::ready_to_send;
+        tensor_reduce_ready(cpu);
     }
 #else
     if (reduce.state == TReduce::State::waiting_to_receive) {
@@ -1945,6 +2028,7 @@ void tensor_reduce_step(Hart& rcv_cpu, Hart& snd_cpu)
 #endif
         snd_cpu.core->reduce.state = TReduce::State::idle;
         snd_cpu.stop_waiting(Hart::Waiting::reduce);
+        snd_cpu.coprocessor_ready();
     }
     if (--recv.count == 0) {
 #if defined(ZSIM) || defined(SYS_EMU)
@@ -1223,11 +1223,10 @@ static uint64_t csrset(Hart& cpu, uint16_t csr, uint64_t val)
                 break;
             }
             if (char(val) != '\n') {
-                cpu.uart_stream << char(val);
+                cpu.uart_line += char(val);
             } else {
-                std::cout << cpu.uart_stream.str() << std::endl;
-                cpu.uart_stream.str("");
-                cpu.uart_stream.clear();
+                std::cout << cpu.uart_line << std::endl;
+                cpu.uart_line.clear();
             }
             break;
 #ifdef SYS_EMU
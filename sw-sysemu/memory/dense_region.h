@@ -52,6 +52,20 @@ struct DenseRegion : public MemoryRegion {
         std::copy_n(source, n, storage.begin() + pos);
     }
 
+    pointer direct_access(const Agent& agent, size_type pos, size_type n, bool write) override {
+        if (pos + n > N)
+            return nullptr;
+        if (write) {
+            if (!Writeable)
+                return nullptr;
+            if (storage.empty()) {
+                storage.allocate();
+                storage.fill_pattern(agent.chip->memory_reset_value, MEM_RESET_PATTERN_SIZE);
+            }
+        }
+        return storage.empty() ? nullptr : storage.data() + pos;
+    }
+
     addr_type first() const override { return Base; }
     addr_type last() const override { return Base + N - 1; }
 
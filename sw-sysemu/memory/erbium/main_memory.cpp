@@ -25,6 +25,15 @@ void MainMemory::reset()
     regions[plic_idx].reset(new ER_PLIC<region_bases[plic_idx], region_sizes[plic_idx]>());
 }
 
+std::vector<MainMemory::memory_range> MainMemory::memory_ranges() const
+{
+    std::vector<memory_range> ranges;
+    for (unsigned idx : {bootrom_idx, sram_idx, dram_idx}) {
+        ranges.push_back({region_bases[idx], region_bases[idx] + region_sizes[idx] - 1, idx != bootrom_idx});
+    }
+    return ranges;
+}
+
 void MainMemory::wdt_clock_tick(const Agent& agent, uint64_t cycle)
 {
     auto ptr = dynamic_cast<SysregsEr<region_bases[erbreg_idx]>*>(regions[erbreg_idx].get());
@@ -34,6 +34,41 @@ void MainMemory::reset()
 }
 
 
+std::shared_ptr<const MainMemory::dram_image> MainMemory::dram_snapshot() const
+{
+    auto ptr = dynamic_cast<SparseRegion<dram_base, EMU_DRAM_SIZE, 16_MiB>*>(regions.back().get());
+    return ptr->snapshot();
+}
+
+
+void MainMemory::dram_share(std::shared_ptr<const dram_image> image)
+{
+    auto ptr = dynamic_cast<SparseRegion<dram_base, EMU_DRAM_SIZE, 16_MiB>*>(regions.back().get());
+    ptr->share(std::move(image));
+}
+
+
+std::vector<MainMemory::memory_range> MainMemory::memory_ranges() const
+{
+    auto mbox = dynamic_cast<MailboxRegion<pu_mbox_base, 512_MiB>*>(regions[2].get());
+    auto spio = dynamic_cast<SvcProcRegion<spio_base>*>(regions[3].get());
+    auto scp = dynamic_cast<ScratchRegion<scp_base, 4_MiB, EMU_NUM_SHIRES>*>(regions[4].get());
+
+    std::vector<memory_range> ranges {
+        { pu_mbox_base + mbox->pu_sram.first(), pu_mbox_base + mbox->pu_sram.last(), true },
+        { spio_base + spio->sp_rom.first(), spio_base + spio->sp_rom.last(), false },
+        { spio_base + spio->sp_sram.first(), spio_base + spio->sp_sram.last(), true },
+    };
+    // The L2 scratchpad of each shire, in shire index order which is also
+    // address order (the I/O shire has the highest shire id)
+    for (size_t shire = 0; shire < scp->storage.size(); ++shire) {
+        ranges.push_back({ scp->bucket_first(shire), scp->bucket_last(shire), true });
+    }
+    ranges.push_back({ dram_base, dram_base + EMU_DRAM_SIZE - 1, true });
+    return ranges;
+}
+
+
 void MainMemory::pu_plic_interrupt_pending_set(const Agent& agent, uint32_t source)
 {
     auto ptr = dynamic_cast<PeripheralRegion<pu_io_base, 256_MiB>*>(regions[1].get());
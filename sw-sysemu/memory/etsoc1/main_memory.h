@@ -11,6 +11,7 @@
 #include <cstdint>
 #include <memory>
 #include <stdexcept>
+#include <vector>
 #include "agent.h"
 #include "literals.h"
 #include "memory/memory_error.h"
@@ -102,10 +103,18 @@ struct MainMemory {
         dram_base           = 0x8000000000ULL,
     };
 
+    // Read-only copy of the DRAM contents, one array per allocated 16MiB
+    // bucket, that the DRAM of several systems can share copy-on-write
+    using dram_image = std::vector<std::shared_ptr<const std::array<value_type, 16_MiB>>>;
+
     // ----- Public methods -----
 
     void reset();
 
+    // Share DRAM contents between systems, see SparseRegion::share()
+    std::shared_ptr<const dram_image> dram_snapshot() const;
+    void dram_share(std::shared_ptr<const dram_image> image);
+
     void read(const Agent& agent, addr_type addr, size_type n, void* result) {
         const auto elem = search(addr, n);
         elem->read(agent, addr - elem->first(), n, reinterpret_cast<pointer>(result));
@@ -121,9 +130,29 @@ struct MainMemory {
         elem->init(agent, addr - elem->first(), n, reinterpret_cast<const_pointer>(source));
     }
 
+    // Returns a pointer to the storage of [addr, addr+n) when it can be
+    // accessed in place, see MemoryRegion::direct_access()
+    pointer direct_access(const Agent& agent, addr_type addr, size_type n, bool write) {
+        auto lo = std::lower_bound(regions.cbegin(), regions.cend(), addr, above);
+        if ((lo == regions.cend()) || ((*lo)->first() > addr) || (addr+n-1 > (*lo)->last()))
+            return nullptr;
+        return (*lo)->direct_access(agent, addr - (*lo)->first(), n, write);
+    }
+
     addr_type first() const { return regions.front()->first(); }
     addr_type last() const { return regions.back()->last(); }
 
+    // A range of the address map backed by plain memory
+    struct memory_range {
+        addr_type first;
+        addr_type last;
+        bool      writable;   // RAM, otherwise ROM
+    };
+
+    // The RAM and ROM ranges of the address map, in address order. Device
+    // registers and holes are not included.
+    std::vector<memory_range> memory_ranges() const;
+
     void dump_data(const Agent& agent, std::ostream& os, addr_type addr, size_type n) const {
         auto lo = std::lower_bound(regions.cbegin(), regions.cend(), addr, above);
         if ((lo == regions.cend()) || ((*lo)->first() > addr))
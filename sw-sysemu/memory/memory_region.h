@@ -34,6 +34,14 @@ struct MemoryRegion
     // Initialized @n bytes starting at offset @pos from values in @source
     virtual void init(const Agent& agent, size_type pos, size_type n, const_pointer source) = 0;
 
+    // Returns a pointer to the storage of @n bytes starting at offset @pos
+    // when they can be accessed in place, or nullptr otherwise. When @write
+    // is set the storage is allocated if needed, otherwise unallocated
+    // storage is not accessible in place.
+    virtual pointer direct_access(const Agent&, size_type, size_type, bool) {
+        return nullptr;
+    }
+
     // Returns the first valid address of this region
     virtual addr_type first() const = 0;
 
@@ -56,6 +56,11 @@ struct ScratchRegion : public MemoryRegion
     addr_type first() const override { return Base; }
     addr_type last() const override { return Base + 2_GiB; }
 
+    // The address range of the scratchpad of shire index @bucket, as large
+    // as it can be configured
+    addr_type bucket_first(size_type bucket) const { return Base + shireid(bucket) * 8_MiB; }
+    addr_type bucket_last(size_type bucket) const { return bucket_first(bucket) + N - 1; }
+
     void dump_data(const Agent& agent, std::ostream& os, size_type pos, size_type n) const override {
         value_type elem;
         while (n-- > 0) {
@@ -8,6 +8,9 @@
 
 #include <algorithm>
 #include <array>
+#include <memory>
+#include <stdexcept>
+#include <vector>
 #include "support/lazy_array.h"
 #include "memory/dump_data.h"
 #include "memory/memory_error.h"
@@ -27,6 +30,7 @@ struct SparseRegion : public MemoryRegion
     using const_pointer = typename MemoryRegion::const_pointer;
     using bucket_type   = lazy_array<value_type,M>;
     using storage_type  = std::array<bucket_type,N/M>;
+    using image_type    = std::vector<std::shared_ptr<const typename bucket_type::array_type>>;
 
     static_assert(!(Base % 64),
                   "bemu::SparseRegion must be aligned to 64");
@@ -67,6 +71,47 @@ struct SparseRegion : public MemoryRegion
         }
     }
 
+    pointer direct_access(const Agent& agent, size_type pos, size_type n, bool write) override {
+        size_type bucket = pos / M;
+        size_type offset = pos % M;
+        if ((pos + n > N) || (offset + n > M))
+            return nullptr;
+        if (write) {
+            if (!Writeable)
+                return nullptr;
+            if (storage[bucket].empty()) {
+                allocate_bucket(agent.chip, bucket);
+            }
+        }
+        // Reads of unallocated buckets, shared or not, go through read() so
+        // that they do not copy the shared image
+        return storage[bucket].empty() ? nullptr : storage[bucket].data() + offset;
+    }
+
+    // Returns a read-only copy of the contents of the region, made of the
+    // allocated buckets, that other regions can share with share()
+    std::shared_ptr<const image_type> snapshot() const {
+        auto image = std::make_shared<image_type>(N/M);
+        for (size_type i = 0; i < N/M; ++i) {
+            if (!storage[i].empty()) {
+                (*image)[i] = std::make_shared<const typename bucket_type::array_type>(*storage[i].p);
+            } else if (shared(i)) {
+                (*image)[i] = (*base)[i];
+            }
+        }
+        return image;
+    }
+
+    // Uses @image as the contents of the buckets this region has not
+    // written. The buckets of @image are copied on the first write, so it is
+    // never modified and it can be shared between threads. The image must
+    // have been made with the same memory reset pattern.
+    void share(std::shared_ptr<const image_type> image) {
+        if (image && (image->size() != N/M))
+            throw std::invalid_argument("bemu::SparseRegion::share()");
+        base = std::move(image);
+    }
+
     addr_type first() const override { return Base; }
     addr_type last() const override { return Base + N - 1; }
 
@@ -74,24 +119,44 @@ struct SparseRegion : public MemoryRegion
         size_type lo = pos / M;
         size_type hi = (pos + n - 1) / M;
         size_type offset = pos % M;
+        auto dump_bucket = [&](size_type bucket, size_type from, size_type count) {
+            if (storage[bucket].empty() && shared(bucket)) {
+                bemu::dump_data(os, *(*base)[bucket], from, count, agent.chip->memory_reset_value[0]);
+            } else {
+                bemu::dump_data(os, storage[bucket], from, count, agent.chip->memory_reset_value[0]);
+            }
+        };
         while (lo != hi) {
-            bemu::dump_data(os, storage[lo], offset,
-                            M - offset, agent.chip->memory_reset_value[0]);
+            dump_bucket(lo, offset, M - offset);
             ++lo;
             offset = 0;
         }
-        bemu::dump_data(os, storage[lo], offset,
-                        1 + ((pos + n - 1) % M) - offset, agent.chip->memory_reset_value[0]);
+        dump_bucket(lo, offset, 1 + ((pos + n - 1) % M) - offset);
     }
 
     // For exposition only
     storage_type  storage;
 
 protected:
+    bool shared(size_type bucket) const {
+        return base && (*base)[bucket];
+    }
+
+    void allocate_bucket(System* system, size_type bucket) {
+        storage[bucket].allocate();
+        if (shared(bucket)) {
+            *storage[bucket].p = *(*base)[bucket];
+        } else {
+            storage[bucket].fill_pattern(system->memory_reset_value, MEM_RESET_PATTERN_SIZE);
+        }
+    }
+
     size_type read_bucket(System* system, size_type bucket, size_type pos,
                           size_type count, pointer result) const
     {
-        if (storage[bucket].empty()) {
+        if (storage[bucket].empty() && shared(bucket)) {
+            std::copy_n((*base)[bucket]->cbegin() + pos, count, result);
+        } else if (storage[bucket].empty()) {
           default_value(result, count, system->memory_reset_value, pos);
         } else {
             std::copy_n(storage[bucket].cbegin() + pos, count, result);
@@ -103,12 +168,16 @@ protected:
                            size_type count, const_pointer source)
     {
         if (storage[bucket].empty()) {
-            storage[bucket].allocate();
-            storage[bucket].fill_pattern(system->memory_reset_value, MEM_RESET_PATTERN_SIZE);
+            // Reloading what the shared image has does not need a copy
+            if (shared(bucket) && std::equal(source, source + count, (*base)[bucket]->cbegin() + pos))
+                return count;
+            allocate_bucket(system, bucket);
         }
         std::copy_n(source, count, storage[bucket].begin() + pos);
         return count;
     }
+
+    std::shared_ptr<const image_type> base;
 };
 
 
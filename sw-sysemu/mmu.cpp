@@ -8,6 +8,7 @@
 #include <stdexcept>
 #include <type_traits>
 #include <climits>
+#include <cstring>
 
 #include "cache.h"
 #include "emu_gio.h"
@@ -459,18 +460,6 @@ static T mmu_aligned_load_impl(const Hart& cpu, uint64_t eaddr, mem_access_type
 }
 
 
-template <size_t Nbytes>
-static uint64_t mmu_tensor_load_impl(const Hart& cpu, uint64_t eaddr, uint32_t* data, mem_access_type macc)
-{
-    uint64_t vaddr = sextVA(eaddr);
-    assert(addr_is_size_aligned(vaddr, Nbytes));
-    uint64_t paddr = vmemtranslate(cpu, vaddr, Nbytes, macc);
-    uint64_t addr = pma_check_data_access(cpu, vaddr, paddr, Nbytes, macc);
-    cpu.chip->memory.read(cpu, addr, Nbytes, data);
-    return paddr;
-}
-
-
 uint8_t mmu_load8(const Hart& cpu, uint64_t eaddr, mem_access_type macc)
 {
     // NB: alignment is irrelevant for byte accesses, but the aligned method
@@ -509,27 +498,6 @@ uint32_t mmu_aligned_load32(const Hart& cpu, uint64_t eaddr, mem_access_type mac
 }
 
 
-void mmu_tensor_load128(const Hart& cpu, uint64_t eaddr, uint32_t* data, mem_access_type macc)
-{
-    uint64_t addr = mmu_tensor_load_impl<16>(cpu, eaddr, data, macc);
-    LOG_MEMREAD128(addr, data);
-}
-
-
-void mmu_tensor_load256(const Hart& cpu, uint64_t eaddr, uint32_t* data, mem_access_type macc)
-{
-    uint64_t addr = mmu_tensor_load_impl<32>(cpu, eaddr, data, macc);
-    LOG_MEMREAD256(addr, data);
-}
-
-
-void mmu_tensor_load512(const Hart& cpu, uint64_t eaddr, uint32_t* data, mem_access_type macc)
-{
-    uint64_t addr = mmu_tensor_load_impl<64>(cpu, eaddr, data, macc);
-    LOG_MEMREAD512(addr, data);
-}
-
-
 void mmu_loadVLEN(const Hart& cpu, uint64_t eaddr, freg_t& data, mreg_t mask, mem_access_type macc)
 {
     if (!mask.any())
@@ -640,24 +608,6 @@ static void mmu_aligned_store_impl(const Hart& cpu, uint64_t eaddr, T data, mem_
 }
 
 
-template <size_t Nbytes>
-static uint64_t mmu_tensor_store_impl(const Hart& cpu, uint64_t eaddr, const uint32_t* data, mem_access_type macc)
-{
-    uint64_t vaddr = sextVA(eaddr);
-    assert(addr_is_size_aligned(vaddr, Nbytes));
-    uint64_t paddr = vmemtranslate(cpu, vaddr, Nbytes, macc);
-    uint64_t addr = pma_check_data_access(cpu, vaddr, paddr, Nbytes, macc);
-    cpu.chip->memory.write(cpu, addr, Nbytes, data);
-    if (macc == Mem_Access_TxStore) {
-        static constexpr unsigned n_words = Nbytes / 4;
-        for (unsigned i = 0; i < n_words; ++i) {
-            notify_tensor_store_write(cpu, paddr + i * 4, data[i]);
-        }
-    }
-    return paddr;
-}
-
-
 void mmu_store8(const Hart& cpu, uint64_t eaddr, uint8_t  data, mem_access_type macc)
 {
     // NB: alignment is irrelevant for byte accesses, but the aligned method
@@ -696,24 +646,186 @@ void mmu_aligned_store32(const Hart& cpu, uint64_t eaddr, uint32_t data, mem_acc
 }
 
 
-void mmu_tensor_store128(const Hart& cpu, uint64_t eaddr, const uint32_t* data, mem_access_type macc)
+PagedMemory::Access PagedMemory::translate(uint64_t vaddr, size_t nbytes, bool write)
+{
+    const uint64_t offset = vaddr & PG_OFFSET_M;
+    const uint64_t vpage = vaddr - offset;
+    if (pages[last].vpage != vpage) {
+        unsigned i = 0;
+        while ((i < pages.size()) && (pages[i].vpage != vpage))
+            ++i;
+        if (i < pages.size())
+            last = i;
+    }
+    if (pages[last].vpage == vpage) {
+        const Page& pg = pages[last];
+        return Access{pg.ppage + offset, pg.apage + offset, pg.data ? pg.data + offset : nullptr};
+    }
+
+    Access acc;
+    acc.paddr = vmemtranslate(cpu, vaddr, nbytes, macc);
+    acc.addr = pma_check_data_access(cpu, vaddr, acc.paddr, nbytes, macc);
+    acc.data = nullptr;
+    if (pma_data_access_is_uniform(cpu, acc.paddr, macc)) {
+        Page& pg = pages[victim];
+        pg.vpage = vpage;
+        pg.ppage = acc.paddr - offset;
+        pg.apage = acc.addr - offset;
+        pg.data = cpu.chip->memory.direct_access(cpu, pg.apage, PG_OFFSET_M + 1, write);
+        if (pg.data) {
+            acc.data = pg.data + offset;
+        }
+        last = victim;
+        victim = (victim + 1) % pages.size();
+    }
+    return acc;
+}
+
+
+void TensorMemory::load(uint64_t eaddr, uint32_t* data, size_t nbytes)
+{
+    uint64_t vaddr = sextVA(eaddr);
+    assert(addr_is_size_aligned(vaddr, nbytes));
+    Access acc = translate(vaddr, nbytes, false);
+    if (acc.data) {
+        std::memcpy(data, acc.data, nbytes);
+    } else {
+        cpu.chip->memory.read(cpu, acc.addr, nbytes, data);
+    }
+    switch (nbytes) {
+    case 16: LOG_MEMREAD128(acc.paddr, data); break;
+    case 32: LOG_MEMREAD256(acc.paddr, data); break;
+    case 64: LOG_MEMREAD512(acc.paddr, data); break;
+    }
+}
+
+
+void TensorMemory::store(uint64_t eaddr, const uint32_t* data, size_t nbytes)
+{
+    uint64_t vaddr = sextVA(eaddr);
+    assert(addr_is_size_aligned(vaddr, nbytes));
+    Access acc = translate(vaddr, nbytes, true);
+    if (acc.data) {
+        std::memcpy(acc.data, data, nbytes);
+    } else {
+        cpu.chip->memory.write(cpu, acc.addr, nbytes, data);
+    }
+    if (macc == Mem_Access_TxStore) {
+        for (unsigned i = 0; i < nbytes / 4; ++i) {
+            notify_tensor_store_write(cpu, acc.paddr + i * 4, data[i]);
+        }
+    }
+    switch (nbytes) {
+    case 16: LOG_MEMWRITE128(acc.paddr, data); break;
+    case 32: LOG_MEMWRITE256(acc.paddr, data); break;
+    case 64: LOG_MEMWRITE512(acc.paddr, data); break;
+    }
+}
+
+
+template<typename T>
+T GatherScatterMemory::load(uint64_t eaddr, bool aligned)
+{
+    uint64_t vaddr = sextVA(eaddr);
+    if (!addr_is_size_aligned(vaddr, sizeof(T))) {
+        return aligned ? mmu_aligned_load_impl<T>(cpu, eaddr, macc)
+                       : mmu_load_impl<T>(cpu, eaddr, macc);
+    }
+    check_load_breakpoint(cpu, vaddr);
+    Access acc = translate(vaddr, sizeof(T), false);
+    T value {};
+    if (acc.data) {
+        std::memcpy(&value, acc.data, sizeof(T));
+    } else {
+        cpu.chip->memory.read(cpu, acc.addr, sizeof(T), &value);
+    }
+    LOG_MEMREAD(CHAR_BIT*sizeof(T), acc.paddr, value);
+    notify_mem_read(cpu, true, sizeof(T), vaddr, acc.paddr);
+    return value;
+}
+
+
+template<typename T>
+void GatherScatterMemory::store(uint64_t eaddr, T data, bool aligned)
+{
+    uint64_t vaddr = sextVA(eaddr);
+    if (!addr_is_size_aligned(vaddr, sizeof(T))) {
+        if (aligned) {
+            mmu_aligned_store_impl<T>(cpu, eaddr, data, macc);
+        } else {
+            mmu_store_impl<T>(cpu, eaddr, data, macc);
+        }
+        return;
+    }
+    check_store_breakpoint(cpu, vaddr);
+    Access acc = translate(vaddr, sizeof(T), true);
+    if (acc.data) {
+        std::memcpy(acc.data, &data, sizeof(T));
+    } else {
+        cpu.chip->memory.write(cpu, acc.addr, sizeof(T), &data);
+    }
+    LOG_MEMWRITE(CHAR_BIT*sizeof(T), acc.paddr, data);
+    notify_mem_write(cpu, true, sizeof(T), vaddr, acc.paddr, data);
+}
+
+
+uint8_t GatherScatterMemory::load8(uint64_t eaddr)
+{
+    return load<uint8_t>(eaddr, true);
+}
+
+
+uint16_t GatherScatterMemory::load16(uint64_t eaddr)
+{
+    return load<uint16_t>(eaddr, false);
+}
+
+
+uint32_t GatherScatterMemory::load32(uint64_t eaddr)
+{
+    return load<uint32_t>(eaddr, false);
+}
+
+
+uint16_t GatherScatterMemory::aligned_load16(uint64_t eaddr)
+{
+    return load<uint16_t>(eaddr, true);
+}
+
+
+uint32_t GatherScatterMemory::aligned_load32(uint64_t eaddr)
+{
+    return load<uint32_t>(eaddr, true);
+}
+
+
+void GatherScatterMemory::store8(uint64_t eaddr, uint8_t data)
+{
+    store<uint8_t>(eaddr, data, true);
+}
+
+
+void GatherScatterMemory::store16(uint64_t eaddr, uint16_t data)
+{
+    store<uint16_t>(eaddr, data, false);
+}
+
+
+void GatherScatterMemory::store32(uint64_t eaddr, uint32_t data)
 {
-    uint64_t addr = mmu_tensor_store_impl<16>(cpu, eaddr, data, macc);
-    LOG_MEMWRITE128(addr, data);
+    store<uint32_t>(eaddr, data, false);
 }
 
 
-void mmu_tensor_store256(const Hart& cpu, uint64_t eaddr, const uint32_t* data, mem_access_type macc)
+void GatherScatterMemory::aligned_store16(uint64_t eaddr, uint16_t data)
 {
-    uint64_t addr = mmu_tensor_store_impl<32>(cpu, eaddr, data, macc);
-    LOG_MEMWRITE256(addr, data);
+    store<uint16_t>(eaddr, data, true);
 }
 
 
-void mmu_tensor_store512(const Hart& cpu, uint64_t eaddr, const uint32_t* data, mem_access_type macc)
+void GatherScatterMemory::aligned_store32(uint64_t eaddr, uint32_t data)
 {
-    uint64_t addr = mmu_tensor_store_impl<64>(cpu, eaddr, data, macc);
-    LOG_MEMWRITE512(addr, data);
+    store<uint32_t>(eaddr, data, true);
 }
 
 
@@ -6,6 +6,7 @@
 #ifndef BEMU_MMU_H
 #define BEMU_MMU_H
 
+#include <array>
 #include <cstdint>
 #include <functional>
 
@@ -58,16 +59,92 @@ void mmu_aligned_store32   (const Hart& cpu, uint64_t eaddr, uint32_t data, mem_
 void mmu_aligned_storeVLEN (const Hart& cpu, uint64_t eaddr, const freg_t& data, mreg_t mask, mem_access_type macc);
 
 
-// MMU virtual memory read accesses for data from tensor operations
-void mmu_tensor_load128(const Hart& cpu, uint64_t eaddr, uint32_t* data, mem_access_type macc);
-void mmu_tensor_load256(const Hart& cpu, uint64_t eaddr, uint32_t* data, mem_access_type macc);
-void mmu_tensor_load512(const Hart& cpu, uint64_t eaddr, uint32_t* data, mem_access_type macc);
-
-
-// MMU virtual memory write accesses for data from tensor operations
-void mmu_tensor_store128(const Hart& cpu, uint64_t eaddr, const uint32_t* data, mem_access_type macc);
-void mmu_tensor_store256(const Hart& cpu, uint64_t eaddr, const uint32_t* data, mem_access_type macc);
-void mmu_tensor_store512(const Hart& cpu, uint64_t eaddr, const uint32_t* data, mem_access_type macc);
+// Base of the MMU virtual memory accesses that are repeated many times by a
+// single instruction. The address translation, the PMA check and the lookup
+// of the backing storage of a page are only done by the first access to it,
+// and the following accesses to the same page use the data in place. Pages
+// are only remembered when their PMA check has no side effects and gives
+// the same result for the whole page. An instance is used either for loads
+// or for stores, and must not outlive the instruction that creates it.
+class PagedMemory
+{
+protected:
+    PagedMemory(const Hart& cpu, mem_access_type macc) : cpu(cpu), macc(macc) {}
+
+    struct Access {
+        uint64_t        paddr;  // translated address
+        uint64_t        addr;   // address after the PMA check
+        unsigned char*  data;   // backing storage, or nullptr
+    };
+
+    // The access must not cross a page boundary
+    Access translate(uint64_t vaddr, size_t nbytes, bool write);
+
+    const Hart&     cpu;
+    mem_access_type macc;
+
+private:
+    struct Page {
+        uint64_t        vpage = ~0ull;  // valid when page aligned
+        uint64_t        ppage = 0;
+        uint64_t        apage = 0;
+        unsigned char*  data = nullptr;
+    };
+
+    std::array<Page, 4> pages;
+    unsigned            last = 0;   // most recently used entry
+    unsigned            victim = 0; // next entry to replace
+};
+
+
+// MMU virtual memory accesses for data from tensor operations
+class TensorMemory : private PagedMemory
+{
+public:
+    TensorMemory(const Hart& cpu, mem_access_type macc) : PagedMemory(cpu, macc) {}
+
+    void load128(uint64_t eaddr, uint32_t* data) { load(eaddr, data, 16); }
+    void load256(uint64_t eaddr, uint32_t* data) { load(eaddr, data, 32); }
+    void load512(uint64_t eaddr, uint32_t* data) { load(eaddr, data, 64); }
+
+    void store128(uint64_t eaddr, const uint32_t* data) { store(eaddr, data, 16); }
+    void store256(uint64_t eaddr, const uint32_t* data) { store(eaddr, data, 32); }
+    void store512(uint64_t eaddr, const uint32_t* data) { store(eaddr, data, 64); }
+
+private:
+    void load(uint64_t eaddr, uint32_t* data, size_t nbytes);
+    void store(uint64_t eaddr, const uint32_t* data, size_t nbytes);
+};
+
+
+// MMU virtual memory accesses for the elements of gather and scatter
+// operations. Breakpoints are checked and the accesses are logged and
+// notified one by one like the mmu_load*() and mmu_store*() functions they
+// replace. Only naturally aligned elements use the remembered pages, the
+// others are forwarded to those functions.
+class GatherScatterMemory : private PagedMemory
+{
+public:
+    GatherScatterMemory(const Hart& cpu, mem_access_type macc) : PagedMemory(cpu, macc) {}
+
+    uint8_t  load8  (uint64_t eaddr);
+    uint16_t load16 (uint64_t eaddr);
+    uint32_t load32 (uint64_t eaddr);
+
+    uint16_t aligned_load16 (uint64_t eaddr);
+    uint32_t aligned_load32 (uint64_t eaddr);
+
+    void store8  (uint64_t eaddr, uint8_t data);
+    void store16 (uint64_t eaddr, uint16_t data);
+    void store32 (uint64_t eaddr, uint32_t data);
+
+    void aligned_store16 (uint64_t eaddr, uint16_t data);
+    void aligned_store32 (uint64_t eaddr, uint32_t data);
+
+private:
+    template<typename T> T load(uint64_t eaddr, bool aligned);
+    template<typename T> void store(uint64_t eaddr, T data, bool aligned);
+};
 
 
 // MMU global atomic memory accesses
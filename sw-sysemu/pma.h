@@ -17,6 +17,13 @@ uint64_t pma_check_data_access(const Hart& cpu, uint64_t vaddr,
                                       mreg_t mask = mreg_t(-1),
                                       cacheop_type cop = CacheOp_None);
 
+// Returns true when pma_check_data_access() for an access of type @macc to
+// the page of physical address @addr has no side effects and gives the same
+// result for every naturally aligned access to that page. Bulk accesses use
+// it to check each page only once.
+bool pma_data_access_is_uniform(const Hart& cpu, uint64_t addr,
+                                mem_access_type macc);
+
 uint64_t pma_check_fetch_access(const Hart& cpu, uint64_t vaddr,
                                        uint64_t addr, size_t size);
 
@@ -300,6 +300,15 @@ uint64_t pma_check_data_access(const Hart& cpu, uint64_t vaddr,
 }
 
 
+bool pma_data_access_is_uniform(const Hart& cpu, uint64_t addr,
+                                mem_access_type macc)
+{
+    (void)cpu; (void)macc;
+    // The MRAM protection regions are multiples of 4KiB
+    return paddr_is_mram(addr);
+}
+
+
 uint64_t pma_check_fetch_access(const Hart& cpu, uint64_t vaddr,
                                 uint64_t addr, size_t size)
 {
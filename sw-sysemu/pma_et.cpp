@@ -65,6 +65,15 @@ static bool data_access_is_write(mem_access_type macc)
     throw std::invalid_argument("data_access_is_write()");
 }
 
+#ifdef SYS_EMU
+static inline bool data_access_is_global(mem_access_type macc)
+{
+    return (macc == Mem_Access_LoadG)
+        || (macc == Mem_Access_StoreG)
+        || (macc == Mem_Access_AtomicG);
+}
+#endif
+
 static inline bool paddr_is_sp_cacheable(uint64_t addr)
 { return paddr_is_sp_rom(addr) || paddr_is_sp_sram(addr); }
 
@@ -225,6 +234,12 @@ uint64_t pma_check_data_access(const Hart& cpu, uint64_t vaddr,
         if (SYS_EMU_PTR->get_mem_check()) {
             SYS_EMU_PTR->get_mem_checker().access(cpu.pc, addr, macc, cop, hart_index(cpu), size, mask);
         }
+        if (SYS_EMU_PTR->get_mem_contention() && data_access_is_global(macc)) {
+            SYS_EMU_PTR->get_mem_contention()->access(cpu, addr, macc, SYS_EMU_PTR->get_emu_cycle());
+        }
+        if (SYS_EMU_PTR->get_cache_sim()) {
+            SYS_EMU_PTR->get_cache_sim()->access(cpu, addr, size, macc, cop);
+        }
 #endif
 #ifdef SMB_SIZE
         if (((addr + size) > uint64_t(SMB_ADDR)) && (addr < (uint64_t(SMB_ADDR) + uint64_t(SMB_SIZE)))) {
@@ -255,6 +270,9 @@ uint64_t pma_check_data_access(const Hart& cpu, uint64_t vaddr,
         if (SYS_EMU_PTR->get_l2_scp_check()) {
             SYS_EMU_PTR->get_l2_scp_checker().l2_scp_read(hart_index(cpu), addr);
         }
+        if (SYS_EMU_PTR->get_cache_sim()) {
+            SYS_EMU_PTR->get_cache_sim()->scratchpad(cpu);
+        }
 #endif
         return addr;
     }
@@ -308,6 +326,38 @@ uint64_t pma_check_data_access(const Hart& cpu, uint64_t vaddr,
 }
 
 
+bool pma_data_access_is_uniform(const Hart& cpu, uint64_t addr,
+                                mem_access_type macc)
+{
+#ifndef SYS_EMU
+    (void) macc;
+#endif
+
+    // The DRAM protection regions are aligned to 2MiB at least. Uncacheable
+    // DRAM is not allowed for tensor operations and cache operations, let
+    // the regular check raise the fault.
+    if (!paddr_is_dram(addr) || paddr_is_dram_uncacheable(addr))
+        return false;
+#ifdef SYS_EMU
+    if (SYS_EMU_PTR->get_mem_check())
+        return false;
+    // The contention model sees every global access
+    if (SYS_EMU_PTR->get_mem_contention() && data_access_is_global(macc))
+        return false;
+    // The cache simulator sees every access
+    if (SYS_EMU_PTR->get_cache_sim())
+        return false;
+#endif
+    const uint64_t page = addr & ~PG_OFFSET_M;
+#ifdef SMB_SIZE
+    if (((page + PG_OFFSET_M) >= uint64_t(SMB_ADDR)) && (page < (uint64_t(SMB_ADDR) + uint64_t(SMB_SIZE))))
+        return false;
+#endif
+    // Truncated addresses warn on every access
+    return (page - 0x8000000000ULL) + PG_OFFSET_M < cpu.chip->dram_size;
+}
+
+
 uint64_t pma_check_fetch_access(const Hart& cpu, uint64_t vaddr,
                                        uint64_t addr, size_t size)
 {
@@ -1211,42 +1211,56 @@ static const insn_decode_func_t functab16b[32] = {
 };
 
 
+// Walk the opcode maps
+static inline insn_exec_funct_t decode_uncached(uint32_t bits, uint16_t& flags)
+{
+    if ((bits & 0x3) == 0x3) {
+        int idx = ((bits >> 2) & 0x1f);
+        return functab32b[idx](bits, flags);
+    }
+    int idx = ((bits >> 11) & 0x1c) | (bits & 0x03);
+    return functab16b[idx](bits, flags);
+}
+
+
+// Decoding only depends on the instruction bits, so the decode cache is
+// indexed and tagged by them and its entries never need to be invalidated,
+// not even when code is modified. A hit costs a single load and compare
+// instead of walking the two levels of opcode maps.
+static inline const Decoded_insn& decode_cached(Core& core, uint32_t bits)
+{
+    const uint64_t tag = uint64_t(bits) | (1ull << 32);
+    const unsigned idx = ((bits >> 2) ^ (bits >> 12) ^ (bits >> 22)) % DECODE_CACHE_ENTRIES;
+    Decoded_insn& entry = core.decode_cache[idx];
+    if (entry.tag != tag) {
+        entry.flags = 0;
+        entry.exec_fn = decode_uncached(bits, entry.flags);
+        entry.tag = tag;
+    }
+    return entry;
+}
+
+
 // FIXME: we need a better place to put this code, but it uses all these
 // decode tables only visible to this file...
 uintptr_t decode(uint32_t bits)
 {
-    Instruction inst = { bits, 0 };
-    insn_exec_funct_t exec_fn = nullptr;
-
-    if ((inst.bits & 0x3) == 0x3) {
-        int idx = ((inst.bits >> 2) & 0x1f);
-        exec_fn = functab32b[idx](inst.bits, inst.flags);
-    } else {
-        int idx = ((inst.bits >> 11) & 0x1c) | (inst.bits & 0x03);
-        exec_fn = functab16b[idx](inst.bits, inst.flags);
-    }
-    return reinterpret_cast<uintptr_t>(exec_fn);
+    uint16_t flags = 0;
+    return reinterpret_cast<uintptr_t>(decode_uncached(bits, flags));
 }
 
 
 void Hart::execute()
 {
     // Decode the fetched bits
-    insn_exec_funct_t exec_fn = nullptr;
-    if ((inst.bits & 0x3) == 0x3) {
-        int idx = ((inst.bits >> 2) & 0x1f);
-        exec_fn = functab32b[idx](inst.bits, inst.flags);
-        npc = sextVA(pc + 4);
-    } else {
-        int idx = ((inst.bits >> 11) & 0x1c) | (inst.bits & 0x03);
-        exec_fn = functab16b[idx](inst.bits, inst.flags);
-        npc = sextVA(pc + 2);
-    }
+    const Decoded_insn& decoded = decode_cached(*core, inst.bits);
+    inst.flags = decoded.flags;
+    npc = sextVA(pc + inst.size());
     if ((minstmask >> 32) != 0) {
         if (((inst.bits ^ minstmatch) & uint32_t(minstmask)) == 0)
             throw trap_mcode_instruction(inst.bits);
     }
-    (exec_fn)(*this);
+    (decoded.exec_fn)(*this);
 }
 
 
@@ -1450,6 +1464,13 @@ void Hart::raise_interrupt(int cause, uint64_t data)
     }
 
     stop_waiting(Waiting::interrupt);
+
+    // A hart sleeping on blocked coprocessors takes interrupts while it waits
+    if (is_sleeping() && has_active_coprocessor()) {
+        chip->awaking.push_back(*this);
+        state = State::active;
+        LOG_HART(DEBUG, *this, "%s", "Waking up");
+    }
 }
 
 
@@ -1530,7 +1551,7 @@ void Hart::notify_pmu_minion_event(uint8_t event)
 
 void Hart::become_nonexistent()
 {
-    if (index_in_core(*this) == 0) {
+    if ((index_in_core(*this) == 0) && chip->has_core(*this)) {
         core->tload_a[0].clear();
         core->tload_a[1].clear();
         core->tload_b.clear();
@@ -1552,7 +1573,7 @@ void Hart::become_unavailable()
         LOG_HART(DEBUG, *this, "%s", "Become unavailable");
         pending_unlink = true;
     }
-    if (index_in_core(*this) == 0) {
+    if ((index_in_core(*this) == 0) && chip->has_core(*this)) {
         if (has_active_coprocessor()) {
             WARN_HART(tensors, *this, "%s",
                      "Stopping a hart with an active coprocessor!");
@@ -1592,7 +1613,7 @@ void Hart::start_running()
         return;
     }
     pending_unlink = false;
-    if (!is_waiting() || has_active_coprocessor()) {
+    if (!is_waiting() || has_ready_coprocessor()) {
         chip->awaking.push_back(*this);
         state = State::active;
     } else {
@@ -1622,7 +1643,7 @@ void Hart::enter_debug_mode(Debug_entry::Cause cause)
     if (is_active() || is_sleeping()) {
         return;
     }
-    if (!is_waiting() || has_active_coprocessor()) {
+    if (!is_waiting() || has_ready_coprocessor()) {
         chip->awaking.push_back(*this);
         state = State::active;
     } else {
@@ -1690,6 +1711,9 @@ void Hart::start_waiting(Waiting what)
     case Waiting::tload_tenb:
         LOG_HART(DEBUG, *this, "%s", "\tStart waiting for TensorLoad to TenB");
         break;
+    case Waiting::memory:
+        LOG_HART(DEBUG, *this, "%s", "\tStart waiting for global memory");
+        break;
     }
     waits |= what;
     maybe_sleep();
@@ -1753,6 +1777,9 @@ void Hart::stop_waiting(Waiting what)
     case Waiting::tload_tenb:
         LOG_HART(DEBUG, *this, "%s", "\tStop waiting for TensorLoad to TenB");
         break;
+    case Waiting::memory:
+        LOG_HART(DEBUG, *this, "%s", "\tStop waiting for global memory");
+        break;
     }
 
     // Finish executing any outstanding TensorWait
@@ -1767,7 +1794,7 @@ void Hart::stop_waiting(Waiting what)
 
 void Hart::maybe_sleep()
 {
-    if (!is_sleeping() && is_waiting() && !has_active_coprocessor()) {
+    if (!is_sleeping() && is_waiting() && !has_ready_coprocessor()) {
         assert(is_active());
         chip->sleeping.push_back(*this);
         state = State::sleeping;
@@ -1778,7 +1805,7 @@ void Hart::maybe_sleep()
 
 void Hart::maybe_wakeup()
 {
-    if (!is_active() && (!is_waiting() || has_active_coprocessor())) {
+    if (!is_active() && (!is_waiting() || has_ready_coprocessor())) {
         chip->awaking.push_back(*this);
         state = State::active;
         LOG_HART(DEBUG, *this, "%s", "Waking up");
@@ -1786,6 +1813,15 @@ void Hart::maybe_wakeup()
 }
 
 
+// Another hart made a coprocessor of this hart ready to execute
+void Hart::coprocessor_ready()
+{
+    if (is_sleeping()) {
+        maybe_wakeup();
+    }
+}
+
+
 void Hart::debug_reset()
 {
     // Exit and clear the program buffer
@@ -1866,24 +1902,10 @@ void Hart::warm_reset()
     break_on_store = false;
     break_on_fetch = false;
 
-    // Reset core-shared state
-    if (index_in_core(*this) == 0) {
-        core->matp = 0;
-        core->menable_shadows = 0;
-        core->excl_mode = 0;
-        core->mcache_control = 0;
-        core->ucache_control = 0x200;
-        for (auto& set : core->scp_lock) {
-            set.fill(false);
-        }
-        core->tload_a[0].clear();
-        core->tload_a[1].clear();
-        core->tload_b.clear();
-        core->tmul.state = TMul::State::idle;
-        core->tquant.state = TQuant::State::idle;
-        core->reduce.state = TReduce::State::idle;
-        core->reduce.hart = this;
-        core->tqueue.clear();
+    // Reset core-shared state, a core allocated later is reset by
+    // System::allocate_shire_cores()
+    if ((index_in_core(*this) == 0) && chip->has_core(*this)) {
+        warm_reset_core();
     }
 
     clear_hastatus0(*this, hastatus0_halted);
@@ -1892,6 +1914,27 @@ void Hart::warm_reset()
 }
 
 
+void Hart::warm_reset_core()
+{
+    core->matp = 0;
+    core->menable_shadows = 0;
+    core->excl_mode = 0;
+    core->mcache_control = 0;
+    core->ucache_control = 0x200;
+    for (auto& set : core->scp_lock) {
+        set.fill(false);
+    }
+    core->tload_a[0].clear();
+    core->tload_a[1].clear();
+    core->tload_b.clear();
+    core->tmul.state = TMul::State::idle;
+    core->tquant.state = TQuant::State::idle;
+    core->reduce.state = TReduce::State::idle;
+    core->reduce.hart = this;
+    core->tqueue.clear();
+}
+
+
 void Hart::reset_progbuf()
 {
     static constexpr uint32_t ebreak = 0x100073;
@@ -12,7 +12,7 @@
 #include <cassert>
 #include <cstddef>
 #include <cstdint>
-#include <sstream>
+#include <string>
 
 #include "support/intrusive/list.h"
 #include "agent.h"
@@ -212,20 +212,29 @@ private:
 
 //==------------------------------------------------------------------------==//
 //
-// A processing core
+// Decoded instruction cache
 //
 //==------------------------------------------------------------------------==//
 
-struct Core {
-    // Only one TenC in the core
-    std::array<freg_t,NFREGS>   tenc;
+#define DECODE_CACHE_ENTRIES  256
 
-    // L1 scratchpad
-    std::array<cache_line_t,L1_SCP_ENTRIES+TFMA_MAX_AROWS>  scp;
+struct Decoded_insn {
+    // Instruction bits with bit 32 set; zero marks an empty entry
+    uint64_t    tag;
+    uint16_t    flags;
+    void        (*exec_fn)(Hart&);
+};
 
-    // L1 D-cache lock bits and addresses of locked lines
-    std::array<std::array<bool,L1D_NUM_WAYS>,L1D_NUM_SETS>      scp_lock;
-    std::array<std::array<uint64_t,L1D_NUM_WAYS>,L1D_NUM_SETS>  scp_addr;
+
+//==------------------------------------------------------------------------==//
+//
+// A processing core
+//
+//==------------------------------------------------------------------------==//
+
+struct Core {
+    // The state read every cycle comes first, the decode cache and the
+    // scratchpad last.
 
     // CSRs shared between threads of a core
     uint64_t    satp;
@@ -235,8 +244,10 @@ struct Core {
     uint8_t     mcache_control;   // 2b
     uint16_t    ucache_control;
 
-    // Unique ID to identify tensor ops in the log
-    uint64_t    tensor_uuid = 0;
+    // Tensor execution ports
+    TQueue                tqueue;
+    std::array<TLoad, 2>  tload_a;
+    TLoad                 tload_b;
 
     // Tensor arithmetic state machines
     TMul        tmul;
@@ -244,10 +255,21 @@ struct Core {
     TReduce     reduce;
     TStore      tstore;
 
-    // Tensor execution ports
-    std::array<TLoad, 2>  tload_a;
-    TLoad                 tload_b;
-    TQueue                tqueue;
+    // Unique ID to identify tensor ops in the log
+    uint64_t    tensor_uuid = 0;
+
+    // Decoded instructions, shared between threads of a core
+    std::array<Decoded_insn,DECODE_CACHE_ENTRIES>  decode_cache {};
+
+    // Only one TenC in the core
+    std::array<freg_t,NFREGS>   tenc;
+
+    // L1 scratchpad
+    std::array<cache_line_t,L1_SCP_ENTRIES+TFMA_MAX_AROWS>  scp;
+
+    // L1 D-cache lock bits and addresses of locked lines
+    std::array<std::array<bool,L1D_NUM_WAYS>,L1D_NUM_SETS>      scp_lock;
+    std::array<std::array<uint64_t,L1D_NUM_WAYS>,L1D_NUM_SETS>  scp_addr;
 };
 
 
@@ -257,7 +279,7 @@ struct Core {
 //
 //==------------------------------------------------------------------------==//
 
-struct Hart : public Agent {
+struct alignas(64) Hart : public Agent {
     // ----- Types -----
 
     // Message port configuration
@@ -306,6 +328,7 @@ struct Hart : public Agent {
         credit1     = 1 << 19,
         // resource conflicts
         tload_tenb  = 1 << 20,
+        memory      = 1 << 21,
     };
 
     // Program buffer status
@@ -355,6 +378,7 @@ struct Hart : public Agent {
     bool is_waiting() const;
     bool is_waiting(Waiting what) const;
     bool has_active_coprocessor() const;
+    bool has_ready_coprocessor() const;
 
     void become_nonexistent();
     void become_unavailable();
@@ -364,22 +388,41 @@ struct Hart : public Agent {
     void stop_waiting(Waiting what);
     void maybe_sleep();
     void maybe_wakeup();
+    void coprocessor_ready();
 
     void debug_reset();
     void warm_reset();
+    void warm_reset_core();   // only called for the first hart of a core
     void cold_reset() {}
 
     // ----- Public state -----
+    //
+    // The fields are ordered by how often the main loop touches them. The
+    // scheduler state and the state read to take interrupts and to fetch
+    // every instruction come first, in the first cache lines of the hart,
+    // and the debug, trigger and validation state is kept at the end.
 
     // Hart state (disabled, running, etc.)
     State       state = State::unavailable;
     Waiting     waits = Waiting::none;
     Waiting     twait = Waiting::none;
+    Privilege   prv;
 
     // Next and previous hart in list of waiting/running harts
     intrusive::List_hook  links;
 
     bool        pending_unlink = false;
+    bool        debug_mode;
+
+    // Pre-computed state to improve simulation speed
+    bool        break_on_load;
+    bool        break_on_store;
+    bool        break_on_fetch;
+
+    // Whether sys_emu records the retired instructions of this hart
+    bool        retire_traced = false;
+
+    uint16_t    mhartid;
 
     // Core that this hart belongs to
     Core*       core = nullptr;
@@ -391,6 +434,17 @@ struct Hart : public Agent {
     // Instruction being executed
     Instruction inst;
 
+    // Control and status registers read to take interrupts
+    uint64_t    mstatus;
+    uint32_t    mip;
+    uint32_t    mie;
+    uint32_t    mideleg;
+    uint32_t    medeleg;
+
+    // Supervisor external interrupt pin (as 32-bit for performance)
+    uint32_t    ext_seip;
+    uint32_t    fcsr;
+
     // Fetch buffer
     uint64_t              fetch_pc;
     std::array<char, 32>  fetch_cache;
@@ -401,32 +455,20 @@ struct Hart : public Agent {
     std::array<mreg_t,NMREGS>     mregs;
 
     // RISCV control and status registers
-    uint32_t    fcsr;
     uint64_t    stvec;
     uint16_t    scounteren;             // 9b
     uint64_t    sscratch;
     uint64_t    sepc;
     uint64_t    scause;
     uint64_t    stval;
-    uint64_t    mstatus;
-    uint32_t    medeleg;
-    uint32_t    mideleg;
-    uint32_t    mie;
     uint64_t    mtvec;
     uint16_t    mcounteren;             // 9b
     uint64_t    mscratch;
     uint64_t    mepc;
     uint64_t    mcause;
     uint64_t    mtval;
-    uint32_t    mip;
-    uint64_t    tdata1;
-    uint64_t    tdata2;
-    uint32_t    dcsr;
-    uint64_t    dpc;
-    uint16_t    mhartid;
 
     // Esperanto control and status registers
-    uint64_t    ddata0;
     uint64_t    minstmask;        // 33b
     uint32_t    minstmatch;
     uint64_t    mbusaddr;         // 40b
@@ -436,29 +478,26 @@ struct Hart : public Agent {
     std::bitset<16> tensor_mask;
     uint16_t    tensor_error;
     uint8_t     gsc_progress;     // log2(MLEN) bits
-    uint64_t    validation0;
-    uint8_t     validation1;
-    uint64_t    validation2;
-    uint64_t    validation3;
     std::array<Port,4>     portctrl;
     std::array<uint16_t,2> fcc;
 
-    // Supervisor external interrupt pin (as 32-bit for performance)
-    uint32_t    ext_seip;
-
-    // Other hart internal (microarchitectural or hidden) state
-    Privilege   prv;
-    bool        debug_mode;
+    // Debug and trigger state
+    uint64_t    tdata1;
+    uint64_t    tdata2;
+    uint32_t    dcsr;
+    uint64_t    dpc;
+    uint64_t    ddata0;
 
     std::array<uint32_t, 4> progbuf;
 
-    // Pre-computed state to improve simulation speed
-    bool break_on_load;
-    bool break_on_store;
-    bool break_on_fetch;
+    // Validation control and status registers
+    uint64_t    validation0;
+    uint8_t     validation1;
+    uint64_t    validation2;
+    uint64_t    validation3;
 
     // validation1 CSR emulation needs this
-    std::ostringstream uart_stream;
+    std::string uart_line;
 };
 
 
@@ -753,6 +792,36 @@ inline bool Hart::has_active_coprocessor() const
 }
 
 
+// Whether async_execute() has work to do. A waiting hart whose coprocessors
+// are all blocked on other harts sleeps until one of them becomes ready.
+inline bool Hart::has_ready_coprocessor() const
+{
+    if (mhartid % EMU_THREADS_PER_MINION != 0) {
+        return false;
+    }
+    if ((core->tload_a[0].state == TLoad::State::ready)
+        || (core->tload_a[1].state == TLoad::State::ready)
+        || (core->tload_b.state == TLoad::State::ready)) {
+        return true;
+    }
+    switch (core->tqueue.front()) {
+    case TQueue::Instruction::none:
+        break;
+    case TQueue::Instruction::tfma:
+        return core->tmul.state == TMul::State::ready;
+    case TQueue::Instruction::tquant:
+        return core->tquant.state == TQuant::State::ready;
+    case TQueue::Instruction::reduce:
+        return (core->reduce.state == TReduce::State::ready_to_receive)
+            && (core->reduce.hart->core->reduce.state == TReduce::State::ready_to_send)
+            && (core->reduce.hart->core->reduce.hart == this);
+    case TQueue::Instruction::tstore:
+        return core->tstore.state == TStore::State::ready;
+    }
+    return false;
+}
+
+
 inline unsigned hart_index(const Hart& cpu)
 {
     return hartindex(cpu.mhartid);
@@ -0,0 +1,103 @@
+#!/usr/bin/env python3
+
+"""Reader for the retire traces written with sys_emu -rt.
+
+Can be imported as a module:
+
+    from retire_trace import RetireTrace
+    for record in RetireTrace("trace.rt"):
+        ...
+
+or run as a script to print the records of a trace as text.
+
+The layout mirrors rtrace::retireRecord in sys_emu/retireTrace.h.
+"""
+
+from argparse import ArgumentParser
+from collections import namedtuple
+from pathlib import Path
+import struct
+import sys
+
+import lz4.frame
+
+MAGIC = b"BEMURTR\0"
+FORMAT_VERSION = 1
+
+RD_WRITE = 1 << 0
+MEM_LOAD = 1 << 1
+MEM_STORE = 1 << 2
+TRAP = 1 << 3
+
+_HEADER = struct.Struct("=8sII")
+_RECORD = struct.Struct("=QQIIBBBBIQQQQQ")
+
+Record = namedtuple(
+    "Record",
+    "cycle pc hart bits flags rd mem_size mem_count reserved "
+    "rd_value mem_addr mem_data cause tval",
+)
+
+
+class RetireTrace:
+    """Streams the records of a retire trace file."""
+
+    def __init__(self, path: Path):
+        self._file = lz4.frame.open(path, "rb")
+        magic, version, record_size = _HEADER.unpack(self._read(_HEADER.size))
+        if magic != MAGIC:
+            raise ValueError(f"{path}: not a sys_emu retire trace")
+        if version != FORMAT_VERSION or record_size < _RECORD.size:
+            raise ValueError(f"{path}: unsupported retire trace version {version}")
+        self._record_size = record_size
+
+    def _read(self, size: int) -> bytes:
+        data = self._file.read(size)
+        if len(data) != size:
+            raise EOFError
+        return data
+
+    def __iter__(self):
+        try:
+            while True:
+                data = self._read(self._record_size)
+                yield Record._make(_RECORD.unpack_from(data))
+        except EOFError:
+            return
+
+    def close(self):
+        self._file.close()
+
+    def __enter__(self):
+        return self
+
+    def __exit__(self, *args):
+        self.close()
+
+
+def format_record(r: Record) -> str:
+    text = f"{r.cycle}: H{r.hart} 0x{r.pc:016x} (0x{r.bits:08x})"
+    if r.flags & RD_WRITE:
+        text += f" x{r.rd}=0x{r.rd_value:016x}"
+    if r.flags & (MEM_LOAD | MEM_STORE):
+        kind = ("R" if r.flags & MEM_LOAD else "") + ("W" if r.flags & MEM_STORE else "")
+        text += f" {kind}{r.mem_size}[0x{r.mem_addr:016x}]"
+        if r.flags & MEM_STORE:
+            text += f"=0x{r.mem_data:x}"
+        if r.mem_count > 1:
+            text += f" (+{r.mem_count - 1})"
+    if r.flags & TRAP:
+        text += f" trap cause=0x{r.cause:x} tval=0x{r.tval:x}"
+    return text
+
+
+if __name__ == "__main__":
+    parser = ArgumentParser(description="Print the records of a sys_emu retire trace")
+    parser.add_argument("trace", type=Path)
+    parser.add_argument("--hart", type=int, action="append", help="only print the given hart")
+    args = parser.parse_args()
+    with RetireTrace(args.trace) as trace:
+        for record in trace:
+            if args.hart and record.hart not in args.hart:
+                continue
+            sys.stdout.write(format_record(record) + "\n")
@@ -0,0 +1,53 @@
+/*-------------------------------------------------------------------------
+* Copyright (c) 2025 Ainekko, Co.
+* SPDX-License-Identifier: Apache-2.0
+*-------------------------------------------------------------------------*/
+
+#include <cstring>
+#include <stdexcept>
+
+#include "support/lz4_record_file.h"
+#include "support/lz4_stream.h"
+
+// The LZ4 streams are only created here, so that the users of the record
+// files do not need the LZ4 headers
+
+namespace bemu {
+
+
+lz4_record_writer::lz4_record_writer(const std::string& path, const std::string& what,
+                                     const char (&magic)[8], uint32_t version, uint32_t info)
+{
+    file.open(path, std::ios::out | std::ios::binary | std::ios::trunc);
+    if (!file.is_open()) {
+        throw std::runtime_error("Unable to open " + what + " file: " + path);
+    }
+    stream.reset(new lz4_stream::basic_ostream<1 << 16>(file));
+
+    lz4_record_header header{};
+    std::memcpy(header.magic, magic, sizeof(header.magic));
+    header.version = version;
+    header.info = info;
+    write(header);
+}
+
+
+lz4_record_reader::lz4_record_reader(const std::string& path, const std::string& what,
+                                     const char (&magic)[8], uint32_t version)
+{
+    file.open(path, std::ios::in | std::ios::binary);
+    if (!file.is_open()) {
+        throw std::runtime_error("Unable to open " + what + " file: " + path);
+    }
+    stream.reset(new lz4_stream::basic_istream<1 << 16, 1 << 16>(file));
+
+    if (!read(header) || std::memcmp(header.magic, magic, sizeof(header.magic)) != 0) {
+        throw std::runtime_error("Not a sys_emu " + what + ": " + path);
+    }
+    if (header.version != version) {
+        throw std::runtime_error("Unsupported " + what + " version " + std::to_string(header.version));
+    }
+}
+
+
+} // namespace bemu
@@ -0,0 +1,94 @@
+/*-------------------------------------------------------------------------
+* Copyright (c) 2025 Ainekko, Co.
+* SPDX-License-Identifier: Apache-2.0
+*-------------------------------------------------------------------------*/
+
+#ifndef BEMU_LZ4_RECORD_FILE_H
+#define BEMU_LZ4_RECORD_FILE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <string>
+
+namespace bemu {
+
+
+// The binary logs and traces of sys_emu are LZ4 compressed streams that
+// start with this header, followed by the records of the format. The meaning
+// of `info` depends on the format. All values are stored in host endianness.
+struct lz4_record_header {
+    char     magic[8];
+    uint32_t version;
+    uint32_t info;
+};
+
+
+// Creates a record file and writes its header. Throws std::runtime_error if
+// the file cannot be created. The LZ4 footer is written when the writer is
+// destroyed.
+class lz4_record_writer {
+public:
+    lz4_record_writer(const std::string& path, const std::string& what,
+                      const char (&magic)[8], uint32_t version, uint32_t info);
+
+    lz4_record_writer(const lz4_record_writer&) = delete;
+    lz4_record_writer& operator=(const lz4_record_writer&) = delete;
+
+    void write(const void* data, size_t size) {
+        stream->write(static_cast<const char*>(data), size);
+    }
+
+    template<typename T>
+    void write(const T& value) {
+        write(&value, sizeof(T));
+    }
+
+    // Compresses and writes out what is buffered, without closing the stream
+    void flush() {
+        stream->flush();
+    }
+
+private:
+    // The LZ4 stream is destroyed (and closed) before the file
+    std::ofstream                 file;
+    std::unique_ptr<std::ostream> stream;
+};
+
+
+// Opens a record file and checks its header. Throws std::runtime_error if the
+// file cannot be opened, is not of the expected format or has another version.
+class lz4_record_reader {
+public:
+    lz4_record_reader(const std::string& path, const std::string& what,
+                      const char (&magic)[8], uint32_t version);
+
+    lz4_record_reader(const lz4_record_reader&) = delete;
+    lz4_record_reader& operator=(const lz4_record_reader&) = delete;
+
+    uint32_t info() const { return header.info; }
+
+    // Returns false at the end of the file
+    bool read(void* data, size_t size) {
+        return bool(stream->read(static_cast<char*>(data), size));
+    }
+
+    template<typename T>
+    bool read(T& value) {
+        return read(&value, sizeof(T));
+    }
+
+    std::istream& istream() { return *stream; }
+
+private:
+    std::ifstream                 file;
+    std::unique_ptr<std::istream> stream;
+    lz4_record_header             header;
+};
+
+
+} // namespace bemu
+
+#endif // BEMU_LZ4_RECORD_FILE_H
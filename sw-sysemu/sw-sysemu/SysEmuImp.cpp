@@ -10,6 +10,7 @@
 #include "utils.h"
 #include "preload.h"
 #include <unistd.h>
+#include <cstdio>
 #include <fstream>
 #include <future>
 #include <mutex>
@@ -191,6 +192,36 @@ void checkExtraOptions(const std::vector<std::string>& opts)
   }
 }
 
+/**
+ * sys_emu arguments that reproduce the system of an API trace.
+ * The SW stack options come first so the ones set by SysEmuImp override them,
+ * like they do in the constructor. The checkers, the UARTs and the log are
+ * left out, they do not change what the device does.
+ */
+std::vector<std::string> traceArguments(const SysEmuOptions& options, const sys_emu_cmd_options& opts,
+                                        const std::vector<std::string>& elfs, bool bars) {
+  char buf[64];
+  std::vector<std::string> args = options.additionalOptions;
+  args.emplace_back("-mins_dis");
+  std::snprintf(buf, sizeof(buf), "%" PRIx64, opts.minions_en);
+  args.insert(args.end(), {"-minions", buf});
+  std::snprintf(buf, sizeof(buf), "%" PRIx64, opts.shires_en);
+  args.insert(args.end(), {"-shires", buf});
+  std::snprintf(buf, sizeof(buf), "0x%" PRIx32, opts.mem_reset);
+  args.insert(args.end(), {"-mem_reset32", buf});
+  args.insert(args.end(), {"-max_cycles", std::to_string(opts.max_cycles)});
+  for (const auto& elf : elfs) {
+    args.insert(args.end(), {"-elf_load", elf});
+  }
+  if (bars) {
+    for (const auto& w : opts.mem_write32s) {
+      std::snprintf(buf, sizeof(buf), "0x%" PRIx64 ",0x%" PRIx32, w.addr, w.value);
+      args.insert(args.end(), {"-mem_write32", buf});
+    }
+  }
+  return args;
+}
+
 } // namespace
 
 void SysEmuImp::set_system(bemu::System* system) {
@@ -249,6 +280,9 @@ void SysEmuImp::mmioRead(uint64_t address, size_t size, std::byte* dst) {
         std::to_string(address) + " size: " + std::to_string(readSize))));
       return;
     }
+    if (trace_) {
+      trace_->record(chip_->emu_cycle(), atrace::API_MMIO_READ, 0, address, size, dst);
+    }
     p.set_value();
   };
   std::unique_lock<std::mutex> lock(mutex_);
@@ -262,6 +296,9 @@ void SysEmuImp::mmioWrite(uint64_t address, size_t size, const std::byte* src) {
   std::promise<void> p;
   auto request = [=, &p]() {
     SE_LOG(INFO) << "Device memory write at: " << std::hex << address << " size: " << size << " host src: " << src;
+    if (trace_) {
+      trace_->record(chip_->emu_cycle(), atrace::API_MMIO_WRITE, 0, address, size, src);
+    }
     auto pci_addr = address;
     uint64_t host_access_offset = 0;
     int64_t readSize = size;
@@ -303,6 +340,9 @@ void SysEmuImp::raiseDevicePuPlicPcieMessageInterrupt() {
   auto request = [=]() {
     SE_LOG(INFO) << "raiseDevicePuPlicPcieMessageInterrupt";
     LOG_AGENT(INFO, agent_, "raise_device_interrupt(type = %s)", "PU");
+    if (trace_) {
+      trace_->record(chip_->emu_cycle(), atrace::API_PU_INTERRUPT, 0, 0, 0);
+    }
     chip_->memory.pu_trg_pcie_mmm_int_inc(agent_);
   };
   std::lock_guard<std::mutex> lock(mutex_);
@@ -325,6 +365,9 @@ uint32_t SysEmuImp::waitForInterrupt(uint32_t bitmap) {
 bool SysEmuImp::raise_host_interrupt(uint32_t bitmap) {
   LOG_AGENT(INFO, agent_, "Raise Host (Count: %" PRId64 ") Interrupt Bitmap: (0x%" PRIx32 ")",
             ++raised_interrupt_count_, bitmap);
+  if (trace_) {
+    trace_->record(chip_->emu_cycle(), atrace::API_HOST_INTERRUPT, bitmap, 0, 0);
+  }
   std::lock_guard<std::mutex> lock(mutex_);
   pendingInterruptsBitmask_ |= bitmap;
   condVar_.notify_all();
@@ -336,6 +379,9 @@ void SysEmuImp::raiseDeviceSpioPlicPcieMessageInterrupt() {
   auto request = [=]() {
     SE_LOG(INFO) << "raiseDeviceSpioPlicPcieMessageInterrupt";
     LOG_AGENT(INFO, agent_, "raise_device_interrupt(type = %s)", "SP");
+    if (trace_) {
+      trace_->record(chip_->emu_cycle(), atrace::API_SP_INTERRUPT, 0, 0, 0);
+    }
     chip_->memory.pu_trg_pcie_ipi_trigger(agent_);
   };
   std::lock_guard<std::mutex> lock(mutex_);
@@ -348,6 +394,9 @@ bool SysEmuImp::host_memory_read(uint64_t host_addr, uint64_t size, void* data)
     return false;
   }
   hostListener_->memoryReadFromHost(host_addr, size, reinterpret_cast<std::byte*>(data));
+  if (trace_) {
+    trace_->record(chip_->emu_cycle(), atrace::API_HOST_MEMORY_READ, 0, host_addr, size, data);
+  }
   return true;
 }
 
@@ -357,6 +406,9 @@ bool SysEmuImp::host_memory_write(uint64_t host_addr, uint64_t size, const void*
     return false;
   }
   hostListener_->memoryWriteFromHost(host_addr, size, reinterpret_cast<const std::byte*>(data));
+  if (trace_) {
+    trace_->record(chip_->emu_cycle(), atrace::API_HOST_MEMORY_WRITE, 0, host_addr, size, data);
+  }
   return true;
 }
 
@@ -374,6 +426,9 @@ SysEmuImp::~SysEmuImp() {
   std::promise<void> p;
   auto request = [=, &p]() {
     try {
+      if (trace_) {
+        trace_->record(chip_->emu_cycle(), atrace::API_END, 0, 0, 0);
+      }
       chip_->set_emu_done(true);
       p.set_value();
     } catch (...) {
@@ -425,7 +480,8 @@ SysEmuImp::SysEmuImp(const SysEmuOptions& options, const std::array<uint64_t, 8>
     }
     opts = std::get<1>(parsed);
   }
-  if (opts.mem_write32s.empty()) {
+  const bool bars = opts.mem_write32s.empty();
+  if (bars) {
     opts.mem_write32s.emplace_back(
       sys_emu_cmd_options::mem_write32{BAR0_ADDR, static_cast<uint32_t>(barAddresses[0] & 0xFFFFFFFFu)});
     opts.mem_write32s.emplace_back(
@@ -501,6 +557,14 @@ SysEmuImp::SysEmuImp(const SysEmuOptions& options, const std::array<uint64_t, 8>
   opts.tstore_check |= options.tstoreCheck;
   opts.log_path = options.logFile;
 
+  if (!options.apiTracePath.empty()) {
+    std::vector<std::string> elfs;
+    std::copy_if(preloadElfs.begin(), preloadElfs.end(),
+                 std::back_inserter(elfs), [](const std::string& path) { return !path.empty(); });
+    trace_ = std::make_unique<apiTrace>(options.apiTracePath, traceArguments(options, opts, elfs, bars));
+    SE_LOG(INFO) << "Recording the API traffic to " << options.apiTracePath;
+  }
+
   sysEmuThread_ = std::thread(runMain, opts, this, &sysEmuError_); // FIXME Passing `this` like this is dangerous..
 
   // Wait until all the iATUs configured by BL2 have been enabled
@@ -5,6 +5,7 @@
 
 #pragma once
 #include "api_communicate.h"
+#include "apiTrace.h"
 #include "sw-sysemu/ISysEmu.h"
 #include "sys_emu.h"
 #include "system.h"
@@ -12,6 +13,7 @@
 #include <condition_variable>
 #include <functional>
 #include <future>
+#include <memory>
 #include <mutex>
 #include <queue>
 #include <thread>
@@ -64,5 +66,6 @@ private:
   IHostListener* hostListener_ = nullptr;
   std::queue<std::function<void()>> requests_;
   std::promise<void> iatusReady_;
+  std::unique_ptr<apiTrace> trace_;
 };
 } // namespace emu
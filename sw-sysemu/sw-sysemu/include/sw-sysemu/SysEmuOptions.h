@@ -67,6 +67,8 @@ struct SysEmuOptions {
   bool tstoreCheck = true;
   /// \brief Defaults memory to this value
   uint32_t mem_reset32 = 0xDEADBEEF;
+  /// \brief Record the host<->device API traffic to this file, to be replayed with sysemu_api_replay
+  std::string apiTracePath;
   /// \brief Hyperparameters to pass to SysEmu, might override default values
   std::vector<std::string> additionalOptions;
 };
@@ -0,0 +1,378 @@
+/*-------------------------------------------------------------------------
+* Copyright (c) 2025 Ainekko, Co.
+* SPDX-License-Identifier: Apache-2.0
+*-------------------------------------------------------------------------*/
+
+#include <algorithm>
+#include <cinttypes>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <exception>
+#include <getopt.h>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "agent.h"
+#include "apiTrace.h"
+#include "api_communicate.h"
+#include "sys_emu.h"
+#include "system.h"
+
+// Replays an API trace recorded by SysEmuImp (SysEmuOptions::apiTracePath)
+// into sys_emu, without the runtime and the device layer.
+//
+// The trace header gives the sys_emu arguments of the recorded system, the
+// options after "--" are appended to them. The host requests are injected
+// at the cycle they were handled in the recording, so the replay is cycle
+// exact as long as the device behaves the same. The device reads of host
+// memory are served from the trace, and every device to host event, with
+// the data the device writes to host memory, is checked against the
+// recorded one. A host read through the BARs that returns different data
+// is a divergence too.
+//
+// With -asap the host requests do not wait for their recorded cycle. Each
+// one is injected as soon as the device reached the point the host had seen
+// before sending it, that is, once the replay matched all the device to
+// host events recorded before the request. A host read through the BARs is
+// retried every cycle until it returns the recorded data, which is how a
+// polling host would have waited, but never for longer than the recording
+// took between the previous request and the read. A polling read may see
+// the device further along than in the recording, so reads that still
+// return different data are only reported, not counted as divergences.
+
+namespace {
+
+struct event {
+    atrace::apiRecord record;
+    std::vector<char> payload;
+    size_t            after = 0;    // device events recorded before it
+};
+
+
+const char* type_name(uint32_t type)
+{
+    switch (type) {
+    case atrace::API_MMIO_WRITE:        return "mmio write";
+    case atrace::API_MMIO_READ:         return "mmio read";
+    case atrace::API_PU_INTERRUPT:      return "PU interrupt";
+    case atrace::API_SP_INTERRUPT:      return "SP interrupt";
+    case atrace::API_END:               return "end";
+    case atrace::API_HOST_INTERRUPT:    return "host interrupt";
+    case atrace::API_HOST_MEMORY_READ:  return "host memory read";
+    case atrace::API_HOST_MEMORY_WRITE: return "host memory write";
+    default:                            return "unknown";
+    }
+}
+
+
+class apiReplay final : public api_communicate
+{
+public:
+    apiReplay(atrace::reader& trace, bool asap);
+
+    // From api_communicate
+    void set_system(bemu::System* system) override;
+    void process() override;
+    bool raise_host_interrupt(uint32_t bitmap) override;
+    bool host_memory_read(uint64_t host_addr, uint64_t size, void* data) override;
+    bool host_memory_write(uint64_t host_addr, uint64_t size, const void* data) override;
+    void notify_iatu_ctrl_2_reg_write(int, uint32_t, uint32_t) override {}
+    void notify_fatal_error(const std::string& error) override;
+
+    bool has_end() const { return !host_.empty() && (host_.back().record.type == atrace::API_END); }
+    bool diverged() const {
+        return mismatches_ || (!asap_ && readMismatches_) || !error_.empty() || (nextHost_ < host_.size());
+    }
+    void report(FILE* out) const;
+
+private:
+    // Returns false if the request has to be retried the next cycle
+    bool apply(const event& ev);
+    bool mmio(uint64_t pci_addr, uint64_t size, char* data, bool write);
+    const event* device_event(const atrace::apiRecord& record);
+    void mismatch(const char* what, const atrace::apiRecord& record);
+
+    bemu::System*      chip_ = nullptr;
+    bemu::Noagent      agent_{nullptr, "apiReplay"};
+    bool               asap_;
+    std::vector<event> host_;
+    std::vector<event> device_;
+    size_t             nextHost_ = 0;
+    size_t             nextDevice_ = 0;
+    uint64_t           lastCycle_ = 0;       // cycle of the previous request, replayed
+    uint64_t           lastRecorded_ = 0;    // ... and recorded
+    uint64_t           endCycle_ = 0;        // recorded cycle of the end
+    uint64_t           mismatches_ = 0;
+    uint64_t           readMismatches_ = 0;
+    std::string        error_;
+};
+
+
+apiReplay::apiReplay(atrace::reader& trace, bool asap)
+    : asap_(asap)
+{
+    event ev;
+    while (trace.next(ev.record, ev.payload)) {
+        if (atrace::fromHost(ev.record.type)) {
+            ev.after = device_.size();
+            host_.push_back(ev);
+        } else {
+            device_.push_back(ev);
+        }
+        endCycle_ = ev.record.cycle;
+    }
+}
+
+
+void apiReplay::set_system(bemu::System* system)
+{
+    chip_ = system;
+    agent_.chip = system;
+}
+
+
+void apiReplay::process()
+{
+    const uint64_t cycle = chip_->emu_cycle();
+    while (nextHost_ < host_.size()) {
+        const event& ev = host_[nextHost_];
+        if (asap_ ? (nextDevice_ < ev.after) : (cycle < ev.record.cycle)) {
+            return;
+        }
+        if (!apply(ev)) {
+            return;
+        }
+        lastCycle_ = cycle;
+        lastRecorded_ = ev.record.cycle;
+        ++nextHost_;
+    }
+}
+
+
+bool apiReplay::apply(const event& ev)
+{
+    const atrace::apiRecord& r = ev.record;
+    switch (r.type) {
+    case atrace::API_MMIO_WRITE:
+        if (!mmio(r.addr, r.size, const_cast<char*>(ev.payload.data()), true)) {
+            mismatch("mmio write failed", r);
+        }
+        break;
+    case atrace::API_MMIO_READ: {
+        std::vector<char> data(r.size);
+        if (!mmio(r.addr, r.size, data.data(), false)) {
+            mismatch("mmio read failed", r);
+        } else if (data != ev.payload) {
+            if (asap_ && (chip_->emu_cycle() - lastCycle_ < r.cycle - lastRecorded_)) {
+                return false;
+            }
+            ++readMismatches_;
+        }
+        break;
+    }
+    case atrace::API_PU_INTERRUPT:
+        chip_->memory.pu_trg_pcie_mmm_int_inc(agent_);
+        break;
+    case atrace::API_SP_INTERRUPT:
+        chip_->memory.pu_trg_pcie_ipi_trigger(agent_);
+        break;
+    case atrace::API_END:
+        chip_->set_emu_done(true);
+        break;
+    default:
+        mismatch("unknown record", r);
+        break;
+    }
+    return true;
+}
+
+
+bool apiReplay::mmio(uint64_t pci_addr, uint64_t size, char* data, bool write)
+{
+    const auto& iatus = chip_->memory.pcie0_get_iatus();
+
+    while (size > 0) {
+        auto iatu = std::find_if(iatus.cbegin(), iatus.cend(), [=](const auto& i) {
+            uint64_t base = (uint64_t)i.upper_base_addr << 32 | i.lwr_base_addr;
+            uint64_t limit = (uint64_t)i.uppr_limit_addr << 32 | i.limit_addr;
+            // REGION_EN set and Address Match Mode
+            return ((i.ctrl_2 >> 30) == 2) && (pci_addr >= base) && (pci_addr <= limit);
+        });
+        if (iatu == iatus.cend()) {
+            return false;
+        }
+        uint64_t base = (uint64_t)iatu->upper_base_addr << 32 | iatu->lwr_base_addr;
+        uint64_t limit = (uint64_t)iatu->uppr_limit_addr << 32 | iatu->limit_addr;
+        uint64_t target = (uint64_t)iatu->upper_target_addr << 32 | iatu->lwr_target_addr;
+        uint64_t access_size = std::min(pci_addr + size - 1, limit) + 1 - pci_addr;
+        try {
+            if (write) {
+                chip_->memory.write(agent_, target + pci_addr - base, access_size, data);
+            } else {
+                chip_->memory.read(agent_, target + pci_addr - base, access_size, data);
+            }
+        }
+        catch (const std::exception&) {
+            return false;
+        }
+        pci_addr += access_size;
+        data += access_size;
+        size -= access_size;
+    }
+    return true;
+}
+
+
+// Matches a device to host event with the next recorded one, skipping the
+// recorded events that the replay did not make
+const event* apiReplay::device_event(const atrace::apiRecord& record)
+{
+    auto match = std::find_if(device_.cbegin() + nextDevice_, device_.cend(), [&](const event& ev) {
+        return (ev.record.type == record.type) && (ev.record.arg == record.arg)
+            && (ev.record.addr == record.addr) && (ev.record.size == record.size);
+    });
+    if (match == device_.cend()) {
+        mismatch("unexpected", record);
+        return nullptr;
+    }
+    if (match != device_.cbegin() + nextDevice_) {
+        mismatch("skipped recorded events before", record);
+    }
+    nextDevice_ = match - device_.cbegin() + 1;
+    return &*match;
+}
+
+
+void apiReplay::mismatch(const char* what, const atrace::apiRecord& record)
+{
+    if (!mismatches_++) {
+        std::fprintf(stderr, "First divergence at cycle %" PRIu64 ": %s %s (arg=0x%" PRIx32
+                     ", addr=0x%" PRIx64 ", size=0x%" PRIx64 ")\n",
+                     chip_->emu_cycle(), what, type_name(record.type), record.arg, record.addr, record.size);
+    }
+}
+
+
+bool apiReplay::raise_host_interrupt(uint32_t bitmap)
+{
+    device_event(atrace::apiRecord{0, atrace::API_HOST_INTERRUPT, bitmap, 0, 0});
+    return true;
+}
+
+
+bool apiReplay::host_memory_read(uint64_t host_addr, uint64_t size, void* data)
+{
+    const event* ev = device_event(atrace::apiRecord{0, atrace::API_HOST_MEMORY_READ, 0, host_addr, size});
+    if (!ev) {
+        std::memset(data, 0, size);
+        return true;
+    }
+    std::memcpy(data, ev->payload.data(), size);
+    return true;
+}
+
+
+bool apiReplay::host_memory_write(uint64_t host_addr, uint64_t size, const void* data)
+{
+    const atrace::apiRecord record{0, atrace::API_HOST_MEMORY_WRITE, 0, host_addr, size};
+    const event* ev = device_event(record);
+    if (ev && std::memcmp(data, ev->payload.data(), size)) {
+        mismatch("different data in", record);
+    }
+    return true;
+}
+
+
+void apiReplay::notify_fatal_error(const std::string& error)
+{
+    error_ = error;
+    std::fprintf(stderr, "Fatal error: %s\n", error.c_str());
+}
+
+
+void apiReplay::report(FILE* out) const
+{
+    const uint64_t cycle = chip_ ? chip_->emu_cycle() : 0;
+    std::fprintf(out, "Replayed %zu of %zu host requests in %" PRIu64 " cycles (recorded: %" PRIu64 " cycles)\n",
+                 nextHost_, host_.size(), cycle, endCycle_);
+    std::fprintf(out, "Matched %zu of %zu device events, %" PRIu64 " divergences, %" PRIu64
+                 " mmio reads returned different data\n",
+                 nextDevice_, device_.size(), mismatches_, readMismatches_);
+}
+
+
+bool parse_options(const char* argv0, const std::vector<std::string>& args, sys_emu_cmd_options& options)
+{
+    std::vector<std::string> strings{argv0};
+    strings.insert(strings.end(), args.begin(), args.end());
+    std::vector<char*> argv;
+    for (auto& str : strings) {
+        argv.push_back(&str[0]);
+    }
+    argv.push_back(nullptr);
+
+    optind = 0; // rescan from the start, sys_emu permutes its arguments
+    auto result = sys_emu::parse_command_line_arguments(argv.size() - 1, argv.data());
+    options = std::get<1>(result);
+    return std::get<0>(result);
+}
+
+} // namespace
+
+
+int main(int argc, char* argv[])
+{
+    static const struct option replay_options[] = {
+        {"asap",  no_argument, nullptr, 'a'},
+        {"help",  no_argument, nullptr, 'h'},
+        {nullptr, 0,           nullptr,  0 }
+    };
+
+    bool asap = false;
+    int opt;
+    while ((opt = getopt_long_only(argc, argv, "+", replay_options, nullptr)) != -1) {
+        switch (opt) {
+        case 'a':
+            asap = true;
+            break;
+        default:
+            std::fprintf(stderr,
+                         "Usage: %s [-asap] <API trace> [-- <sys_emu options>]\n"
+                         "     -asap                    Inject each host request as soon as the device events it waited for happened\n",
+                         argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+    if ((optind >= argc) || ((optind + 1 < argc) && strcmp(argv[optind + 1], "--"))) {
+        std::fprintf(stderr, "Usage: %s [-asap] <API trace> [-- <sys_emu options>]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+    const char* path = argv[optind];
+
+    try {
+        atrace::reader trace(path);
+        apiReplay replay(trace, asap);
+        if (!replay.has_end()) {
+            std::fprintf(stderr, "%s: the trace does not end the simulation, running until -max_cycles\n", path);
+        }
+
+        std::vector<std::string> args = trace.args();
+        args.insert(args.end(), argv + std::min(optind + 2, argc), argv + argc);
+        sys_emu_cmd_options options;
+        if (!parse_options(argv[0], args, options)) {
+            std::fprintf(stderr, "%s: invalid sys_emu options\n", path);
+            return EXIT_FAILURE;
+        }
+
+        auto emu = std::make_unique<sys_emu>(options, &replay);
+        int status = emu->main_internal();
+        replay.report(stdout);
+        return ((status == EXIT_SUCCESS) && !replay.diverged()) ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+    catch (const std::exception& e) {
+        std::fprintf(stderr, "%s: %s\n", path, e.what());
+        return EXIT_FAILURE;
+    }
+}
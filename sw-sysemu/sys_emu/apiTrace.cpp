@@ -0,0 +1,67 @@
+/*-------------------------------------------------------------------------
+* Copyright (c) 2025 Ainekko, Co.
+* SPDX-License-Identifier: Apache-2.0
+*-------------------------------------------------------------------------*/
+
+#include <stdexcept>
+
+#include "apiTrace.h"
+
+// Size of the arguments stored after the header, each one NUL terminated
+static size_t argsSize(const std::vector<std::string>& args)
+{
+    size_t size = 0;
+    for (const auto& arg : args) {
+        size += arg.size() + 1;
+    }
+    return size;
+}
+
+apiTrace::apiTrace(const std::string& path, const std::vector<std::string>& args)
+    : out_(path, "API trace", atrace::kMagic, atrace::kFormatVersion, argsSize(args))
+{
+    for (const auto& arg : args) {
+        out_.write(arg.c_str(), arg.size() + 1);
+    }
+}
+
+void apiTrace::record(uint64_t cycle, atrace::apiRecordType type, uint32_t arg,
+                      uint64_t addr, uint64_t size, const void* payload)
+{
+    atrace::apiRecord record{cycle, type, arg, addr, size};
+    out_.write(record);
+    if (atrace::hasPayload(type)) {
+        out_.write(payload, size);
+    }
+}
+
+
+namespace atrace {
+
+reader::reader(const std::string& path)
+    : in_(path, "API trace", kMagic, kFormatVersion)
+{
+    std::vector<char> strings(in_.info());
+    if (!in_.read(strings.data(), strings.size())
+            || (!strings.empty() && (strings.back() != '\0'))) {
+        throw std::runtime_error("Truncated API trace: " + path);
+    }
+    for (size_t pos = 0; pos < strings.size(); ) {
+        args_.emplace_back(&strings[pos]);
+        pos += args_.back().size() + 1;
+    }
+}
+
+bool reader::next(apiRecord& record, std::vector<char>& payload)
+{
+    if (!in_.read(record)) {
+        return false;
+    }
+    payload.resize(hasPayload(record.type) ? record.size : 0);
+    if (!payload.empty() && !in_.read(payload.data(), payload.size())) {
+        throw std::runtime_error("Truncated API trace record");
+    }
+    return true;
+}
+
+} // namespace atrace
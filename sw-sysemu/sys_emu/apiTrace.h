@@ -0,0 +1,105 @@
+/*-------------------------------------------------------------------------
+* Copyright (c) 2025 Ainekko, Co.
+* SPDX-License-Identifier: Apache-2.0
+*-------------------------------------------------------------------------*/
+
+#ifndef _APITRACE_H_
+#define _APITRACE_H_
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "support/lz4_record_file.h"
+
+// API trace format
+//
+// The API trace is an LZ4 record file (support/lz4_record_file.h) whose
+// header info is the size of the NUL terminated sys_emu arguments that follow
+// it and reproduce the recorded system, followed by one apiRecord per host<->device interaction, in the
+// order the emulator saw them. Records of the types that carry data are
+// followed by `size` bytes of payload. All values are stored in host
+// endianness.
+
+namespace atrace {
+
+constexpr char     kMagic[8]      = {'B', 'E', 'M', 'U', 'A', 'P', 'I', '\0'};
+constexpr uint32_t kFormatVersion = 2;
+
+enum apiRecordType : uint32_t {
+    // Host to device
+    API_MMIO_WRITE = 1,     // the host writes device memory through the BARs, with payload
+    API_MMIO_READ,          // the host reads device memory through the BARs, the payload is the data read
+    API_PU_INTERRUPT,       // the host raises the PU PLIC PCIe message interrupt
+    API_SP_INTERRUPT,       // the host raises the SPIO PLIC PCIe message interrupt
+    API_END,                // the host stops the simulation
+    // Device to host
+    API_HOST_INTERRUPT,     // the device raises host interrupts, arg is the bitmap
+    API_HOST_MEMORY_READ,   // the device reads host memory (DMA), the payload is the data read
+    API_HOST_MEMORY_WRITE,  // the device writes host memory (DMA), the payload is the data written
+};
+
+struct apiRecord {
+    uint64_t cycle;       // emulated cycle at which the emulator handled it
+    uint32_t type;        // apiRecordType
+    uint32_t arg;
+    uint64_t addr;
+    uint64_t size;
+};
+
+static_assert(sizeof(apiRecord) == 32, "apiRecord layout changed");
+
+inline bool hasPayload(uint32_t type)
+{
+    return (type == API_MMIO_WRITE) || (type == API_MMIO_READ)
+        || (type == API_HOST_MEMORY_READ) || (type == API_HOST_MEMORY_WRITE);
+}
+
+inline bool fromHost(uint32_t type)
+{
+    return (type >= API_MMIO_WRITE) && (type <= API_END);
+}
+
+// Streaming reader of an API trace file
+class reader
+{
+public:
+    explicit reader(const std::string& path);
+
+    reader(const reader&) = delete;
+    reader& operator=(const reader&) = delete;
+
+    // The sys_emu arguments of the recorded system
+    const std::vector<std::string>& args() const { return args_; }
+
+    // Reads the next record and its payload, returns false at the end of the
+    // trace
+    bool next(apiRecord& record, std::vector<char>& payload);
+
+private:
+    bemu::lz4_record_reader in_;
+    std::vector<std::string> args_;
+};
+
+} // namespace atrace
+
+
+// Records the API traffic between the host and the emulated device. It is
+// only called from the emulator thread, which handles the host requests and
+// makes the device accesses to the host.
+class apiTrace
+{
+public:
+    apiTrace(const std::string& path, const std::vector<std::string>& args);
+
+    apiTrace(const apiTrace&) = delete;
+    apiTrace& operator=(const apiTrace&) = delete;
+
+    void record(uint64_t cycle, atrace::apiRecordType type, uint32_t arg,
+                uint64_t addr, uint64_t size, const void* payload = nullptr);
+
+private:
+    bemu::lz4_record_writer out_;
+};
+
+#endif
@@ -0,0 +1,350 @@
+/*-------------------------------------------------------------------------
+* Copyright (c) 2025 Ainekko, Co.
+* SPDX-License-Identifier: Apache-2.0
+*-------------------------------------------------------------------------*/
+
+#include <cstdio>
+#include <cstring>
+#include <stdexcept>
+
+#include "binaryLog.h"
+#include "system.h"
+
+binaryLog::binaryLog(const std::string& path, const std::string& name)
+    : out_(path, "binary log", binlog::kMagic, binlog::kFormatVersion, name.size()),
+      hartAgents_(EMU_NUM_THREADS, 0)
+{
+    out_.write(name.data(), name.size());
+
+    buffer_.reserve(kBufferSize);
+    writer_ = std::thread(&binaryLog::writerLoop, this);
+}
+
+binaryLog::~binaryLog()
+{
+    submit();
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+    cv_.notify_all();
+    writer_.join();
+}
+
+void binaryLog::record(logLevel level, const bemu::Agent& agent, uint64_t cycle, const char* fmt, va_list ap)
+{
+    const format* f = &getFormat(fmt);
+    char text[4096];
+    bool preformatted = !f->valid;
+    if (preformatted) {
+        // Conversions that cannot be recorded are formatted right away
+        (void)vsnprintf(text, sizeof(text), fmt, ap);
+        f = &getFormat("%s");
+    }
+    uint32_t agentId = getAgent(agent);
+
+    put(uint8_t(binlog::CHUNK_EVENT));
+    put(uint8_t(level));
+    put(f->id);
+    put(agentId);
+    put(cycle);
+
+    if (preformatted) {
+        uint32_t length = std::strlen(text);
+        put(length);
+        buffer_.insert(buffer_.end(), text, text + length);
+    } else {
+        for (const auto& spec : f->specs) {
+            for (unsigned i = 0; i < spec.nstars; ++i) {
+                put(uint64_t(int64_t(va_arg(ap, int))));
+            }
+            switch (spec.type) {
+            case binlog::ARG_INT:       put(uint64_t(int64_t(va_arg(ap, int)))); break;
+            case binlog::ARG_LONG:      put(uint64_t(va_arg(ap, long))); break;
+            case binlog::ARG_LONG_LONG: put(uint64_t(va_arg(ap, long long))); break;
+            case binlog::ARG_SIZE:      put(uint64_t(va_arg(ap, size_t))); break;
+            case binlog::ARG_INTMAX:    put(uint64_t(va_arg(ap, intmax_t))); break;
+            case binlog::ARG_PTRDIFF:   put(uint64_t(va_arg(ap, ptrdiff_t))); break;
+            case binlog::ARG_DOUBLE:    put(va_arg(ap, double)); break;
+            case binlog::ARG_POINTER:   put(uint64_t(reinterpret_cast<uintptr_t>(va_arg(ap, void*)))); break;
+            case binlog::ARG_STRING: {
+                const char* str = va_arg(ap, const char*);
+                if (!str)
+                    str = "(null)";
+                uint32_t length = std::strlen(str);
+                put(length);
+                buffer_.insert(buffer_.end(), str, str + length);
+                break;
+            }
+            }
+        }
+    }
+
+    if (buffer_.size() >= kBufferSize) {
+        submit();
+    }
+}
+
+void binaryLog::flush()
+{
+    submit();
+    std::unique_lock<std::mutex> lock(mutex_);
+    cv_.wait(lock, [this] { return pending_.empty() && !writing_; });
+    out_.flush();
+}
+
+const binaryLog::format& binaryLog::getFormat(const char* fmt)
+{
+    auto it = formats_.find(fmt);
+    if (it != formats_.end()) {
+        return it->second;
+    }
+    format f;
+    f.id = formats_.size();
+    f.valid = binlog::parseFormat(fmt, f.specs);
+    if (f.valid) {
+        defineString(binlog::CHUNK_FORMAT, f.id, fmt);
+    }
+    return formats_.emplace(fmt, std::move(f)).first->second;
+}
+
+uint32_t binaryLog::getAgent(const bemu::Agent& agent)
+{
+    // Building the name of a hart is expensive, so harts are looked up by
+    // their index and every other agent by its name.
+    const bemu::Hart* harts = agent.chip->cpu.data();
+    const auto* hart = dynamic_cast<const bemu::Hart*>(&agent);
+    size_t index = hart ? size_t(hart - harts) : EMU_NUM_THREADS;
+    if (index < EMU_NUM_THREADS && hartAgents_[index]) {
+        return hartAgents_[index] - 1;
+    }
+
+    std::string name = agent.name();
+    auto it = agents_.find(name);
+    uint32_t id;
+    if (it != agents_.end()) {
+        id = it->second;
+    } else {
+        id = agents_.size();
+        agents_.emplace(name, id);
+        defineString(binlog::CHUNK_AGENT, id, name);
+    }
+    if (index < EMU_NUM_THREADS) {
+        hartAgents_[index] = id + 1;
+    }
+    return id;
+}
+
+void binaryLog::defineString(binlog::binaryLogChunk kind, uint32_t id, const std::string& str)
+{
+    put(uint8_t(kind));
+    put(id);
+    put(uint32_t(str.size()));
+    buffer_.insert(buffer_.end(), str.begin(), str.end());
+}
+
+void binaryLog::submit()
+{
+    if (buffer_.empty()) {
+        return;
+    }
+    std::vector<char> next;
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        // Throttle the emulation thread if the writer falls behind
+        cv_.wait(lock, [this] { return pending_.size() < kMaxPendingBuffers; });
+        pending_.push_back(std::move(buffer_));
+        if (!free_.empty()) {
+            next = std::move(free_.back());
+            free_.pop_back();
+        }
+    }
+    cv_.notify_all();
+    next.clear();
+    next.reserve(kBufferSize);
+    buffer_ = std::move(next);
+}
+
+void binaryLog::writerLoop()
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+        cv_.wait(lock, [this] { return stop_ || !pending_.empty(); });
+        if (pending_.empty()) {
+            break;
+        }
+        std::vector<char> buffer = std::move(pending_.front());
+        pending_.pop_front();
+        writing_ = true;
+        lock.unlock();
+        cv_.notify_all();
+
+        out_.write(buffer.data(), buffer.size());
+
+        lock.lock();
+        writing_ = false;
+        free_.push_back(std::move(buffer));
+        cv_.notify_all();
+    }
+}
+
+
+namespace binlog {
+
+namespace {
+
+template <class T> bool get(std::istream& input, T& value)
+{
+    return bool(input.read(reinterpret_cast<char*>(&value), sizeof(T)));
+}
+
+bool getString(std::istream& input, std::string& str)
+{
+    uint32_t length;
+    if (!get(input, length))
+        return false;
+    str.resize(length);
+    return bool(input.read(&str[0], length));
+}
+
+const char* levelName(uint8_t level)
+{
+    switch (level) {
+    case LOG_DEBUG: return "DEBUG ";
+    case LOG_INFO: return "INFO ";
+    case LOG_WARN: return "WARN ";
+    case LOG_ERR: return "ERROR ";
+    default: return "FATAL ";
+    }
+}
+
+// Formats one conversion specification with its recorded argument
+bool formatSpecArg(std::istream& input, const std::string& fmt, const formatSpec& spec, std::string& out)
+{
+    std::string conv = fmt.substr(spec.begin, spec.end - spec.begin);
+    int stars[2] = {0, 0};
+    for (unsigned i = 0; i < spec.nstars; ++i) {
+        uint64_t value;
+        if (!get(input, value))
+            return false;
+        stars[i] = int(int64_t(value));
+    }
+
+    char buf[4096];
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+#pragma GCC diagnostic ignored "-Wformat-security"
+    auto print = [&](auto value) {
+        switch (spec.nstars) {
+        case 0: return std::snprintf(buf, sizeof(buf), conv.c_str(), value);
+        case 1: return std::snprintf(buf, sizeof(buf), conv.c_str(), stars[0], value);
+        default: return std::snprintf(buf, sizeof(buf), conv.c_str(), stars[0], stars[1], value);
+        }
+    };
+    int count;
+    if (spec.type == ARG_STRING) {
+        std::string str;
+        if (!getString(input, str))
+            return false;
+        count = print(str.c_str());
+    } else if (spec.type == ARG_DOUBLE) {
+        double value;
+        if (!get(input, value))
+            return false;
+        count = print(value);
+    } else {
+        uint64_t value;
+        if (!get(input, value))
+            return false;
+        switch (spec.type) {
+        case ARG_LONG:      count = print(long(value)); break;
+        case ARG_LONG_LONG: count = print((long long)value); break;
+        case ARG_SIZE:      count = print(size_t(value)); break;
+        case ARG_INTMAX:    count = print(intmax_t(value)); break;
+        case ARG_PTRDIFF:   count = print(ptrdiff_t(value)); break;
+        case ARG_POINTER:   count = print(reinterpret_cast<void*>(uintptr_t(value))); break;
+        default:            count = print(int(value)); break;
+        }
+    }
+#pragma GCC diagnostic pop
+    if (count > 0)
+        out.append(buf, std::min(size_t(count), sizeof(buf) - 1));
+    return true;
+}
+
+} // namespace
+
+void decode(const std::string& path, std::ostream& output)
+{
+    bemu::lz4_record_reader in(path, "binary log", kMagic, kFormatVersion);
+    std::string name(in.info(), '\0');
+    if (!in.read(&name[0], name.size())) {
+        throw std::runtime_error("Truncated binary log header");
+    }
+    std::istream& input = in.istream();
+
+    struct decodedFormat {
+        std::string fmt;
+        std::vector<formatSpec> specs;
+    };
+    std::unordered_map<uint32_t, decodedFormat> formats;
+    std::unordered_map<uint32_t, std::string> agents;
+    std::string text;
+
+    uint8_t kind;
+    while (get(input, kind)) {
+        if (kind == CHUNK_FORMAT || kind == CHUNK_AGENT) {
+            uint32_t id;
+            std::string str;
+            if (!get(input, id) || !getString(input, str))
+                break;
+            if (kind == CHUNK_AGENT) {
+                agents[id] = std::move(str);
+            } else {
+                decodedFormat& f = formats[id];
+                f.fmt = std::move(str);
+                parseFormat(f.fmt.c_str(), f.specs);
+            }
+            continue;
+        }
+        if (kind != CHUNK_EVENT) {
+            throw std::runtime_error("Corrupted binary log");
+        }
+
+        uint8_t level;
+        uint32_t formatId, agentId;
+        uint64_t cycle;
+        if (!get(input, level) || !get(input, formatId) || !get(input, agentId) || !get(input, cycle))
+            break;
+        auto f = formats.find(formatId);
+        if (f == formats.end()) {
+            throw std::runtime_error("Corrupted binary log: undefined format " + std::to_string(formatId));
+        }
+
+        // Same layout as testLog: "<cycle>: <LEVEL> <name>: [<agent>] <message>"
+        text.clear();
+        size_t pos = 0;
+        bool ok = true;
+        for (const auto& spec : f->second.specs) {
+            for (size_t i = pos; i < spec.begin; ++i) {
+                text.push_back(f->second.fmt[i]);
+                if (f->second.fmt[i] == '%')
+                    ++i;
+            }
+            if (!(ok = formatSpecArg(input, f->second.fmt, spec, text)))
+                break;
+            pos = spec.end;
+        }
+        if (!ok)
+            break;
+        for (size_t i = pos; i < f->second.fmt.size(); ++i) {
+            text.push_back(f->second.fmt[i]);
+            if (f->second.fmt[i] == '%')
+                ++i;
+        }
+        output << cycle << ": " << levelName(level) << name << ": [" << agents[agentId] << "] " << text << '\n';
+    }
+    output.flush();
+}
+
+} // namespace binlog
@@ -0,0 +1,194 @@
+/*-------------------------------------------------------------------------
+* Copyright (c) 2025 Ainekko, Co.
+* SPDX-License-Identifier: Apache-2.0
+*-------------------------------------------------------------------------*/
+
+#ifndef _BINARYLOG_H_
+#define _BINARYLOG_H_
+
+#include <condition_variable>
+#include <cstdarg>
+#include <cstdint>
+#include <deque>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "agent.h"
+#include "support/lz4_record_file.h"
+#include "testLog.h"
+
+// Binary log format
+//
+// Instead of formatting every message on the emulation thread, the binary log
+// records the printf format string of the message and its raw arguments. The
+// binary log is an LZ4 record file (support/lz4_record_file.h) whose header
+// info is the length of the testLog name. The name follows the header, then
+// a sequence of chunks, each one prefixed by a binaryLogChunk byte:
+//  - Format: uint32_t id, uint32_t length, <length> bytes. Defines a format
+//            string before its first use.
+//  - Agent:  uint32_t id, uint32_t length, <length> bytes. Defines the name of
+//            an agent before its first use.
+//  - Event:  uint8_t level, uint32_t format id, uint32_t agent id, uint64_t
+//            cycle, and the arguments as described by the format string:
+//            integers and pointers as uint64_t, floating point values as
+//            double, strings as uint32_t length plus <length> bytes.
+// All values are stored in host endianness. sysemu_log_decode turns a binary
+// log back into the text that testLog would have printed.
+
+namespace binlog {
+
+constexpr char     kMagic[8]      = {'B', 'E', 'M', 'U', 'L', 'O', 'G', '\0'};
+constexpr uint32_t kFormatVersion = 1;
+
+enum binaryLogChunk : uint8_t { CHUNK_FORMAT = 1, CHUNK_AGENT = 2, CHUNK_EVENT = 3 };
+
+// Argument types, matching the va_arg() type used to fetch them
+enum argType : uint8_t {
+    ARG_INT,
+    ARG_LONG,
+    ARG_LONG_LONG,
+    ARG_SIZE,
+    ARG_INTMAX,
+    ARG_PTRDIFF,
+    ARG_DOUBLE,
+    ARG_STRING,
+    ARG_POINTER,
+};
+
+// A conversion specification of a format string
+struct formatSpec {
+    size_t  begin;    // offset of '%'
+    size_t  end;      // offset past the conversion character
+    argType type;
+    uint8_t nstars;   // number of '*' width/precision arguments (of type int)
+};
+
+// Parses the conversion specifications of a printf format string. Returns
+// false if the format uses a conversion that cannot be recorded.
+inline bool parseFormat(const char* fmt, std::vector<formatSpec>& specs)
+{
+    specs.clear();
+    for (size_t i = 0; fmt[i]; ++i) {
+        if (fmt[i] != '%')
+            continue;
+        formatSpec spec{i, 0, ARG_INT, 0};
+        ++i;
+        if (fmt[i] == '%')
+            continue;
+        while (fmt[i] == '-' || fmt[i] == '+' || fmt[i] == ' ' || fmt[i] == '#' || fmt[i] == '0')
+            ++i;
+        if (fmt[i] == '*') {
+            ++spec.nstars;
+            ++i;
+        }
+        while (fmt[i] >= '0' && fmt[i] <= '9')
+            ++i;
+        if (fmt[i] == '.') {
+            ++i;
+            if (fmt[i] == '*') {
+                ++spec.nstars;
+                ++i;
+            }
+            while (fmt[i] >= '0' && fmt[i] <= '9')
+                ++i;
+        }
+        switch (fmt[i]) {
+        case 'h': ++i; if (fmt[i] == 'h') ++i; break;
+        case 'l': ++i; spec.type = ARG_LONG; if (fmt[i] == 'l') { ++i; spec.type = ARG_LONG_LONG; } break;
+        case 'z': ++i; spec.type = ARG_SIZE; break;
+        case 'j': ++i; spec.type = ARG_INTMAX; break;
+        case 't': ++i; spec.type = ARG_PTRDIFF; break;
+        case 'L': return false;
+        default: break;
+        }
+        switch (fmt[i]) {
+        case 'd': case 'i': case 'u': case 'o': case 'x': case 'X':
+            break;
+        case 'c':
+            spec.type = ARG_INT;
+            break;
+        case 'f': case 'F': case 'e': case 'E': case 'g': case 'G': case 'a': case 'A':
+            spec.type = ARG_DOUBLE;
+            break;
+        case 's':
+            spec.type = ARG_STRING;
+            break;
+        case 'p':
+            spec.type = ARG_POINTER;
+            break;
+        default:
+            return false;
+        }
+        spec.end = i + 1;
+        specs.push_back(spec);
+    }
+    return true;
+}
+
+// Decodes a binary log into the text format of testLog
+void decode(const std::string& path, std::ostream& output);
+
+} // namespace binlog
+
+
+// Records log messages in binary form. Messages are appended to a buffer
+// owned by the emulation thread; full buffers are handed over to a background
+// thread that compresses them into the output file.
+class binaryLog
+{
+public:
+    binaryLog(const std::string& path, const std::string& name);
+    ~binaryLog();
+
+    binaryLog(const binaryLog&) = delete;
+    binaryLog& operator=(const binaryLog&) = delete;
+
+    void record(logLevel level, const bemu::Agent& agent, uint64_t cycle, const char* fmt, va_list ap);
+
+    // Hands over the current buffer and waits until everything is written
+    void flush();
+
+private:
+    struct format {
+        uint32_t id;
+        bool valid;
+        std::vector<binlog::formatSpec> specs;
+    };
+
+    const format& getFormat(const char* fmt);
+    uint32_t getAgent(const bemu::Agent& agent);
+    void defineString(binlog::binaryLogChunk kind, uint32_t id, const std::string& str);
+    void submit();
+    void writerLoop();
+
+    template <class T> void put(const T& value) {
+        const char* p = reinterpret_cast<const char*>(&value);
+        buffer_.insert(buffer_.end(), p, p + sizeof(T));
+    }
+
+    static constexpr size_t kBufferSize = 1 << 20;
+    static constexpr size_t kMaxPendingBuffers = 8;
+
+    bemu::lz4_record_writer out_;
+
+    // Only accessed by the emulation thread
+    std::vector<char> buffer_;
+    std::unordered_map<const char*, format> formats_;
+    std::unordered_map<std::string, uint32_t> agents_;
+    std::vector<uint32_t> hartAgents_;
+
+    // Shared with the writer thread
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    std::deque<std::vector<char>> pending_;
+    std::vector<std::vector<char>> free_;
+    bool writing_ = false;
+    bool stop_ = false;
+    std::thread writer_;
+};
+
+#endif
@@ -0,0 +1,37 @@
+/*-------------------------------------------------------------------------
+* Copyright (c) 2025 Ainekko, Co.
+* SPDX-License-Identifier: Apache-2.0
+*-------------------------------------------------------------------------*/
+
+#include <exception>
+#include <fstream>
+#include <iostream>
+
+#include "binaryLog.h"
+
+// Turns a binary log written with sys_emu -lb back into text
+int main(int argc, char* argv[])
+{
+    if (argc < 2 || argc > 3) {
+        std::cerr << "Usage: " << argv[0] << " <binary log> [<text log>]" << std::endl;
+        return 1;
+    }
+
+    std::ofstream out;
+    if (argc == 3) {
+        out.open(argv[2]);
+        if (!out.is_open()) {
+            std::cerr << "Unable to open " << argv[2] << std::endl;
+            return 1;
+        }
+    }
+
+    try {
+        binlog::decode(argv[1], (argc == 3) ? out : std::cout);
+    }
+    catch (const std::exception& e) {
+        std::cerr << argv[1] << ": " << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,446 @@
+/*-------------------------------------------------------------------------
+* Copyright (c) 2025 Ainekko, Co.
+* SPDX-License-Identifier: Apache-2.0
+*-------------------------------------------------------------------------*/
+
+#include <algorithm>
+#include <cinttypes>
+#include <cstdio>
+#include <stdexcept>
+
+#include "cache.h"
+#include "cacheSim.h"
+#include "elfio/elfio.hpp"
+#include "processor.h"
+
+static constexpr uint64_t kNoLine = ~0ull;
+
+cacheSim::entry* cacheSim::tags::find(size_t set, uint64_t line)
+{
+    entry* e = &entries[set * ways];
+    for (size_t w = 0; w < ways; ++w) {
+        if (e[w].line == line) {
+            return &e[w];
+        }
+    }
+    return nullptr;
+}
+
+cacheSim::entry& cacheSim::tags::victim(size_t set)
+{
+    entry* e = &entries[set * ways];
+    size_t lru = 0;
+    for (size_t w = 0; w < ways; ++w) {
+        if (e[w].line == kNoLine) {
+            return e[w];
+        }
+        if (e[w].used < e[lru].used) {
+            lru = w;
+        }
+    }
+    return e[lru];
+}
+
+cacheSim::counters& cacheSim::counters::operator+=(const counters& other)
+{
+    for (size_t i = 0; i < levels.size(); ++i) {
+        levels[i].accesses   += other.levels[i].accesses;
+        levels[i].hits       += other.levels[i].hits;
+        levels[i].evictions  += other.levels[i].evictions;
+        levels[i].writebacks += other.levels[i].writebacks;
+        levels[i].prefetches += other.levels[i].prefetches;
+        levels[i].redundant  += other.levels[i].redundant;
+        levels[i].useful     += other.levels[i].useful;
+        levels[i].unused     += other.levels[i].unused;
+    }
+    scratchpad += other.scratchpad;
+    cycles += other.cycles;
+    return *this;
+}
+
+cacheSim::cacheSim(const config& cfg)
+    : cfg_(cfg),
+      l1_(EMU_NUM_MINIONS),
+      l2_(EMU_NUM_SHIRES),
+      harts_(EMU_NUM_THREADS),
+      kernelCounters_(1),
+      kernelNames_(1, "[unknown]")
+{
+    if (!cfg_.valid()) {
+        throw std::invalid_argument("cacheSim: invalid SCP/L2/L3 split");
+    }
+    cfg_.l2Ways = std::max(cfg_.l2Ways, 1u);
+    cfg_.l3Ways = std::max(cfg_.l3Ways, 1u);
+    // The L2 is private to each shire, the L3 is shared by all of them
+    uint64_t l2Lines = (uint64_t(cfg_.l2Size) << 20) / EMU_NUM_COMPUTE_SHIRES / L1D_LINE_SIZE;
+    uint64_t l3Lines = (uint64_t(cfg_.l3Size) << 20) / L1D_LINE_SIZE;
+    l2Sets_ = std::max<uint64_t>(l2Lines / cfg_.l2Ways, 1);
+    l3Sets_ = l3Lines / cfg_.l3Ways;
+}
+
+bool cacheSim::addKernel(std::istream& image, const std::string& name)
+{
+    ELFIO::elfio elf;
+    if (!elf.load(image)) {
+        return false;
+    }
+
+    size_t index = kernelNames_.size();
+    for (const ELFIO::segment* seg : elf.segments) {
+        if ((seg->get_type() != PT_LOAD) || !(seg->get_flags() & PF_X) || !seg->get_memory_size()) {
+            continue;
+        }
+        kernels_.push_back(kernel{seg->get_virtual_address(),
+                                                            seg->get_virtual_address() + seg->get_memory_size(), index});
+    }
+    if (!kernels_.empty() && (kernels_.back().index == index)) {
+        kernelNames_.push_back(name);
+        kernelCounters_.resize(kernelNames_.size());
+    }
+    return true;
+}
+
+size_t cacheSim::kernelOf(uint64_t pc)
+{
+    if (kernels_.empty()) {
+        return 0;
+    }
+    const kernel& last = kernels_[lastKernel_];
+    if ((pc >= last.start) && (pc < last.end)) {
+        return last.index;
+    }
+    for (size_t i = 0; i < kernels_.size(); ++i) {
+        if ((pc >= kernels_[i].start) && (pc < kernels_[i].end)) {
+            lastKernel_ = i;
+            return kernels_[i].index;
+        }
+    }
+    return 0;
+}
+
+cacheSim::tags& cacheSim::cache(level lvl, const context& ctx)
+{
+    std::unique_ptr<tags>* c;
+    switch (lvl) {
+    case L1:
+        c = &l1_[ctx.minion];
+        if (!*c) {
+            c->reset(new tags(L1D_NUM_SETS, L1D_NUM_WAYS));
+        }
+        break;
+    case L2:
+        c = &l2_[ctx.shire];
+        if (!*c) {
+            c->reset(new tags(l2Sets_, cfg_.l2Ways));
+        }
+        break;
+    default:
+        c = &l3_;
+        if (!*c) {
+            c->reset(new tags(l3Sets_, cfg_.l3Ways));
+        }
+        break;
+    }
+    return **c;
+}
+
+size_t cacheSim::set(level lvl, const context& ctx, uint64_t line) const
+{
+    switch (lvl) {
+    case L1:  return bemu::dcache_index(line * L1D_LINE_SIZE, ctx.mode, ctx.thread);
+    case L2:  return line % l2Sets_;
+    default:  return line % l3Sets_;
+    }
+}
+
+void cacheSim::count(const context& ctx, level lvl, uint64_t stats::*field)
+{
+    ++(ctx.hart->levels[lvl].*field);
+    ++(ctx.kernel->levels[lvl].*field);
+}
+
+void cacheSim::access(const bemu::Hart& cpu, uint64_t paddr, size_t size,
+                      bemu::mem_access_type macc, bemu::cacheop_type cop)
+{
+    unsigned hart = bemu::hart_index(cpu);
+    context ctx;
+    ctx.minion = hart / EMU_THREADS_PER_MINION;
+    ctx.shire  = hart / EMU_THREADS_PER_SHIRE;
+    ctx.thread = hart % EMU_THREADS_PER_MINION;
+    ctx.mode   = cpu.core->mcache_control;
+    ctx.hart   = &harts_[hart];
+    ctx.kernel = &kernelCounters_[kernelOf(cpu.pc)];
+
+    uint64_t first = paddr / L1D_LINE_SIZE;
+    uint64_t last = (paddr + std::max<size_t>(size, 1) - 1) / L1D_LINE_SIZE;
+    for (uint64_t line = first; line <= last; ++line) {
+        switch (macc) {
+        case bemu::Mem_Access_Load:
+            demand(ctx, L1, line, false);
+            break;
+        case bemu::Mem_Access_Store:
+            demand(ctx, L1, line, true);
+            break;
+        case bemu::Mem_Access_LoadL:
+        case bemu::Mem_Access_TxLoad:
+            demand(ctx, L2, line, false);
+            break;
+        case bemu::Mem_Access_StoreL:
+        case bemu::Mem_Access_AtomicL:
+        case bemu::Mem_Access_TxStore:
+            demand(ctx, L2, line, true);
+            break;
+        case bemu::Mem_Access_LoadG:
+        case bemu::Mem_Access_TxLoadL2Scp:
+            demand(ctx, has(L3) ? L3 : MEM, line, false);
+            break;
+        case bemu::Mem_Access_StoreG:
+        case bemu::Mem_Access_AtomicG:
+            demand(ctx, has(L3) ? L3 : MEM, line, true);
+            break;
+        case bemu::Mem_Access_Prefetch:
+            switch (cop) {
+            case bemu::CacheOp_PrefetchL1: prefetch(ctx, L1, line); break;
+            case bemu::CacheOp_PrefetchL2: prefetch(ctx, L2, line); break;
+            case bemu::CacheOp_PrefetchL3: prefetch(ctx, L3, line); break;
+            default: break;
+            }
+            break;
+        case bemu::Mem_Access_CacheOp:
+            switch (cop) {
+            case bemu::CacheOp_EvictL2:  evict(ctx, L2, line, true); break;
+            case bemu::CacheOp_EvictL3:  evict(ctx, L3, line, true); break;
+            case bemu::CacheOp_EvictDDR: evict(ctx, MEM, line, true); break;
+            case bemu::CacheOp_FlushL2:  evict(ctx, L2, line, false); break;
+            case bemu::CacheOp_FlushL3:  evict(ctx, L3, line, false); break;
+            case bemu::CacheOp_FlushDDR: evict(ctx, MEM, line, false); break;
+            default: break;
+            }
+            break;
+        case bemu::Mem_Access_Fetch:
+        case bemu::Mem_Access_PTW:
+            return;
+        }
+    }
+}
+
+void cacheSim::scratchpad(const bemu::Hart& cpu)
+{
+    // The L2 scratchpad is served by the shire cache like the L2
+    for (counters* c : { &harts_[bemu::hart_index(cpu)], &kernelCounters_[kernelOf(cpu.pc)] }) {
+        ++c->scratchpad;
+        c->cycles += cfg_.latency[L2];
+    }
+}
+
+cacheSim::level cacheSim::lookup(const context& ctx, level first, uint64_t line, bool prefetch)
+{
+    for (unsigned l = first; l < MEM; ++l) {
+        level lvl = level(l);
+        if (!has(lvl)) {
+            continue;
+        }
+        tags& c = cache(lvl, ctx);
+        entry* e = c.find(set(lvl, ctx, line), line);
+        if (!prefetch) {
+            count(ctx, lvl, &stats::accesses);
+        }
+        if (e) {
+            if (!prefetch) {
+                count(ctx, lvl, &stats::hits);
+                if (e->prefetch) {
+                    count(ctx, lvl, &stats::useful);
+                    e->prefetch = false;
+                }
+            }
+            c.touch(*e);
+            return lvl;
+        }
+    }
+    count(ctx, MEM, &stats::accesses);
+    return MEM;
+}
+
+cacheSim::entry& cacheSim::fill(const context& ctx, level lvl, uint64_t line)
+{
+    tags& c = cache(lvl, ctx);
+    entry& v = c.victim(set(lvl, ctx, line));
+    if (v.line != kNoLine) {
+        count(ctx, lvl, &stats::evictions);
+        if (v.prefetch) {
+            count(ctx, lvl, &stats::unused);
+        }
+        if (v.dirty) {
+            count(ctx, lvl, &stats::writebacks);
+            writeback(ctx, level(lvl + 1), v.line);
+        }
+    }
+    v.line = line;
+    v.dirty = false;
+    v.prefetch = false;
+    c.touch(v);
+    return v;
+}
+
+void cacheSim::writeback(const context& ctx, level lvl, uint64_t line)
+{
+    if (!has(lvl)) {
+        lvl = level(lvl + 1);
+    }
+    if (lvl == MEM) {
+        count(ctx, MEM, &stats::writebacks);
+        return;
+    }
+    entry* e = cache(lvl, ctx).find(set(lvl, ctx, line), line);
+    if (!e) {
+        e = &fill(ctx, lvl, line);
+    }
+    e->dirty = true;
+}
+
+void cacheSim::demand(const context& ctx, level first, uint64_t line, bool write)
+{
+    level served = lookup(ctx, first, line, false);
+    entry* e = nullptr;
+    if (served == first) {
+        if (first != MEM) {
+            e = cache(first, ctx).find(set(first, ctx, line), line);
+        }
+    } else {
+        for (unsigned l = served; l-- > first; ) {
+            if (has(level(l))) {
+                e = &fill(ctx, level(l), line);
+            }
+        }
+    }
+    if (write) {
+        if (e) {
+            e->dirty = true;
+        } else {
+            count(ctx, MEM, &stats::writebacks);
+        }
+    }
+    ctx.hart->cycles += cfg_.latency[served];
+    ctx.kernel->cycles += cfg_.latency[served];
+}
+
+void cacheSim::prefetch(const context& ctx, level target, uint64_t line)
+{
+    if (!has(target)) {
+        return;
+    }
+    count(ctx, target, &stats::prefetches);
+    tags& c = cache(target, ctx);
+    entry* e = c.find(set(target, ctx, line), line);
+    if (e) {
+        count(ctx, target, &stats::redundant);
+        c.touch(*e);
+        return;
+    }
+    level served = lookup(ctx, level(target + 1), line, true);
+    for (unsigned l = served; l-- > target; ) {
+        if (has(level(l))) {
+            e = &fill(ctx, level(l), line);
+        }
+    }
+    e->prefetch = true;
+}
+
+void cacheSim::evict(const context& ctx, level dest, uint64_t line, bool invalidate)
+{
+    for (unsigned l = L1; l < dest; ++l) {
+        level lvl = level(l);
+        if (!has(lvl)) {
+            continue;
+        }
+        entry* e = cache(lvl, ctx).find(set(lvl, ctx, line), line);
+        if (!e) {
+            continue;
+        }
+        if (e->dirty) {
+            count(ctx, lvl, &stats::writebacks);
+            e->dirty = false;
+            writeback(ctx, level(lvl + 1), line);
+        }
+        if (invalidate) {
+            count(ctx, lvl, &stats::evictions);
+            if (e->prefetch) {
+                count(ctx, lvl, &stats::unused);
+            }
+            *e = entry{};
+        }
+    }
+}
+
+static double percent(uint64_t part, uint64_t total)
+{
+    return total ? 100.0 * double(part) / double(total) : 0.0;
+}
+
+void cacheSim::writeCounters(std::ostream& os, const char* name, const counters& c) const
+{
+    char buf[512];
+    std::snprintf(buf, sizeof(buf), "%12" PRIu64 " %6.2f %12" PRIu64 " %6.2f %12" PRIu64 " %6.2f %12" PRIu64
+                  " %12" PRIu64 " %12" PRIu64 " %12" PRIu64 " %12" PRIu64 " %12" PRIu64 " %14" PRIu64 "  %s\n",
+                  c.levels[L1].accesses, percent(c.levels[L1].hits, c.levels[L1].accesses),
+                  c.levels[L2].accesses, percent(c.levels[L2].hits, c.levels[L2].accesses),
+                  c.levels[L3].accesses, percent(c.levels[L3].hits, c.levels[L3].accesses),
+                  c.levels[MEM].accesses, c.levels[MEM].writebacks,
+                  c.levels[L1].evictions + c.levels[L2].evictions + c.levels[L3].evictions,
+                  c.levels[L1].prefetches + c.levels[L2].prefetches + c.levels[L3].prefetches,
+                  c.levels[L1].useful + c.levels[L2].useful + c.levels[L3].useful,
+                  c.scratchpad, c.cycles, name);
+    os << buf;
+}
+
+void cacheSim::report(std::ostream& os) const
+{
+    static const char* const names[] = { "L1", "L2", "L3", "MEM" };
+    char buf[512];
+
+    counters total;
+    for (const auto& c : harts_) {
+        total += c;
+    }
+
+    std::snprintf(buf, sizeof(buf), "# SCP/L2/L3 split: %u/%u/%u MiB, L1 %ux%u, L2 %zux%u per shire, L3 %zux%u, %u byte lines\n",
+                  cfg_.scpSize, cfg_.l2Size, cfg_.l3Size, L1D_NUM_SETS, L1D_NUM_WAYS,
+                  l2Sets_, cfg_.l2Ways, l3Sets_, cfg_.l3Ways, L1D_LINE_SIZE);
+    os << buf;
+    std::snprintf(buf, sizeof(buf), "# Latencies: L1 %" PRIu64 ", L2 %" PRIu64 ", L3 %" PRIu64 ", MEM %" PRIu64 " cycles\n",
+                  cfg_.latency[L1], cfg_.latency[L2], cfg_.latency[L3], cfg_.latency[MEM]);
+    os << buf;
+
+    os << "# level     accesses       hits    hit%    evictions   writebacks   prefetches    redundant       useful       unused\n";
+    for (unsigned l = L1; l < MEM; ++l) {
+        const stats& s = total.levels[l];
+        std::snprintf(buf, sizeof(buf), "%-6s %12" PRIu64 " %12" PRIu64 " %6.2f %12" PRIu64 " %12" PRIu64
+                      " %12" PRIu64 " %12" PRIu64 " %12" PRIu64 " %12" PRIu64 "\n",
+                      names[l], s.accesses, s.hits, percent(s.hits, s.accesses), s.evictions, s.writebacks,
+                      s.prefetches, s.redundant, s.useful, s.unused);
+        os << buf;
+    }
+    std::snprintf(buf, sizeof(buf), "%-6s %12" PRIu64 " reads %12" PRIu64 " writes\n",
+                  names[MEM], total.levels[MEM].accesses, total.levels[MEM].writebacks);
+    os << buf;
+    std::snprintf(buf, sizeof(buf), "%-6s %12" PRIu64 " accesses\n", "SCP", total.scratchpad);
+    os << buf;
+
+    static const char* const header =
+        "#  L1 access   hit%    L2 access   hit%    L3 access   hit%    mem reads   mem writes"
+            "    evictions   prefetches       useful          scp         cycles  ";
+
+    os << "\n" << header << "kernel\n";
+    for (size_t i = 0; i < kernelCounters_.size(); ++i) {
+        if (!kernelCounters_[i].empty()) {
+            writeCounters(os, kernelNames_[i].c_str(), kernelCounters_[i]);
+        }
+    }
+
+    os << "\n" << header << "hart\n";
+    for (size_t i = 0; i < harts_.size(); ++i) {
+        if (!harts_[i].empty()) {
+            writeCounters(os, ("H" + std::to_string(i)).c_str(), harts_[i]);
+        }
+    }
+}
@@ -0,0 +1,174 @@
+/*-------------------------------------------------------------------------
+* Copyright (c) 2025 Ainekko, Co.
+* SPDX-License-Identifier: Apache-2.0
+*-------------------------------------------------------------------------*/
+
+#ifndef _CACHESIM_H_
+#define _CACHESIM_H_
+
+#include <array>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "emu_defines.h"
+#include "system.h"
+
+// Cache hierarchy simulator
+//
+// Replays the DRAM accesses seen by the PMA checks on a model of the minion
+// L1 data caches, the shire L2 caches, the L3 made up of the L3 partitions
+// of all the shire caches, and memory. The model only keeps tags, so it does
+// not change the behavior of the simulation; it counts hits, misses,
+// evictions and writebacks per level, and the usefulness of the prefetches,
+// and charges each access the latency of the level that serves it.
+//
+// - Load and Store start at the L1 of the minion; LoadL, StoreL, AtomicL,
+//   TensorLoad and TensorStore at the L2 of the shire; LoadG, StoreG,
+//   AtomicG and TensorLoadL2Scp at the L3.
+// - The L1 uses the set mapping of the current mcache_control mode. The L2
+//   and L3 sizes come from a SCP/L2/L3 split in MiB for all the compute
+//   shires, as given to the service processor in the shire cache
+//   configuration. All levels are write-back and write-allocate with LRU
+//   replacement.
+// - Prefetches fill up to the requested level and mark the line there; the
+//   first demand hit makes the prefetch useful, and evicting the line first
+//   makes it unused.
+// - EvictVA and FlushVA write back (and evict) the line down to their
+//   destination level. Set/way cache operations are not modeled.
+//
+// The statistics are kept per hart and per kernel, where a kernel is an
+// executable segment of one of the loaded ELFs, selected by the PC of the
+// hart that makes the access.
+class cacheSim
+{
+public:
+    enum level : unsigned { L1, L2, L3, MEM, kNumLevels };
+
+    struct config {
+        unsigned scpSize  = 80;     // MiB of all the compute shires
+        unsigned l2Size   = 16;
+        unsigned l3Size   = 32;
+        unsigned l2Ways   = 16;
+        unsigned l3Ways   = 16;
+        std::array<uint64_t, kNumLevels> latency = {{ 3, 22, 60, 250 }};
+
+        // Same limits as the service processor: the SCP, L2 and L3 share the
+        // 1 MiB of each shire cache bank of the 32 compute shires, and the
+        // L2 gets at least 64 KiB of each bank
+        bool valid() const { return (scpSize + l2Size + l3Size <= 128) && (l2Size >= 8); }
+    };
+
+    // Throws std::invalid_argument if the cache split is not valid
+    explicit cacheSim(const config& cfg);
+
+    cacheSim(const cacheSim&) = delete;
+    cacheSim& operator=(const cacheSim&) = delete;
+
+    // Adds the executable segments of an ELF image as a kernel, returns false
+    // if the image cannot be parsed
+    bool addKernel(std::istream& image, const std::string& name);
+
+    // An access to DRAM
+    void access(const bemu::Hart& cpu, uint64_t paddr, size_t size,
+                bemu::mem_access_type macc, bemu::cacheop_type cop);
+
+    // An access to the L2 scratchpad
+    void scratchpad(const bemu::Hart& cpu);
+
+    void report(std::ostream& os) const;
+
+private:
+    struct entry {
+        uint64_t line     = ~0ull;
+        uint64_t used     = 0;
+        bool     dirty    = false;
+        bool     prefetch = false;
+    };
+
+    // Set associative tag array with LRU replacement
+    struct tags {
+        tags(size_t sets, size_t ways) : sets(sets), ways(ways), entries(sets * ways) {}
+        entry* find(size_t set, uint64_t line);
+        entry& victim(size_t set);
+        void touch(entry& e) { e.used = ++clock; }
+
+        size_t sets;
+        size_t ways;
+        uint64_t clock = 0;
+        std::vector<entry> entries;
+    };
+
+    struct stats {
+        uint64_t accesses   = 0;
+        uint64_t hits       = 0;
+        uint64_t evictions  = 0;
+        uint64_t writebacks = 0;
+        uint64_t prefetches = 0;    // prefetches that target this level
+        uint64_t redundant  = 0;    // ... of lines it already had
+        uint64_t useful     = 0;
+        uint64_t unused     = 0;
+    };
+
+    struct counters {
+        std::array<stats, kNumLevels> levels;
+        uint64_t scratchpad = 0;
+        uint64_t cycles     = 0;
+
+        bool empty() const {
+            return !levels[L1].accesses && !levels[L2].accesses && !levels[L3].accesses
+                && !levels[L1].prefetches && !levels[L2].prefetches && !levels[L3].prefetches
+                && !scratchpad;
+        }
+        counters& operator+=(const counters& other);
+    };
+
+    struct kernel {
+        uint64_t start;
+        uint64_t end;
+        size_t   index;
+    };
+
+    // The caches and counters an access goes through
+    struct context {
+        unsigned  minion;
+        unsigned  shire;
+        unsigned  thread;
+        uint8_t   mode;
+        counters* hart;
+        counters* kernel;
+    };
+
+    bool has(level lvl) const { return (lvl != L3) || l3Sets_; }
+    tags& cache(level lvl, const context& ctx);
+    size_t set(level lvl, const context& ctx, uint64_t line) const;
+    void count(const context& ctx, level lvl, uint64_t stats::*field);
+
+    void demand(const context& ctx, level first, uint64_t line, bool write);
+    void prefetch(const context& ctx, level target, uint64_t line);
+    void evict(const context& ctx, level dest, uint64_t line, bool invalidate);
+    level lookup(const context& ctx, level first, uint64_t line, bool prefetch);
+    entry& fill(const context& ctx, level lvl, uint64_t line);
+    void writeback(const context& ctx, level lvl, uint64_t line);
+
+    size_t kernelOf(uint64_t pc);
+    void writeCounters(std::ostream& os, const char* name, const counters& c) const;
+
+    config cfg_;
+    size_t l2Sets_;
+    size_t l3Sets_;
+
+    std::vector<std::unique_ptr<tags>> l1_;   // per minion
+    std::vector<std::unique_ptr<tags>> l2_;   // per shire
+    std::unique_ptr<tags> l3_;
+
+    std::vector<counters> harts_;
+    std::vector<counters> kernelCounters_;
+    std::vector<std::string> kernelNames_;    // the first one collects unknown PCs
+    std::vector<kernel> kernels_;
+    size_t lastKernel_ = 0;
+};
+
+#endif
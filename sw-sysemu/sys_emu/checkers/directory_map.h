@@ -0,0 +1,141 @@
+/*-------------------------------------------------------------------------
+* Copyright (c) 2025 Ainekko, Co.
+* SPDX-License-Identifier: Apache-2.0
+*-------------------------------------------------------------------------*/
+
+#ifndef _DIRECTORY_MAP_H_
+#define _DIRECTORY_MAP_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+// Open addressing hash table keyed by cache line address, used for the
+// coherence directories of the checkers. It implements the subset of the
+// std::map interface they need, with the following differences:
+//  - Iteration order is unspecified
+//  - insert() invalidates all iterators
+//  - erase() does not move other entries, so erasing while iterating is safe
+// Erased entries leave a tombstone behind that is reclaimed on the next
+// rehash. Tables start empty and do not allocate until the first insert.
+template <class T>
+class directory_map
+{
+private:
+    enum : uint8_t { SLOT_EMPTY, SLOT_FULL, SLOT_ERASED };
+
+    struct slot_t
+    {
+        uint64_t first;
+        T        second;
+        uint8_t  state;
+    };
+
+public:
+    typedef std::pair<uint64_t, T> value_type;
+
+    class iterator
+    {
+    public:
+        iterator() = default;
+        iterator(slot_t* slot, slot_t* last) : m_slot(slot), m_last(last) { skip(); }
+
+        slot_t& operator*() const { return *m_slot; }
+        slot_t* operator->() const { return m_slot; }
+
+        iterator& operator++() { ++m_slot; skip(); return *this; }
+        iterator operator++(int) { iterator tmp = *this; ++*this; return tmp; }
+
+        bool operator==(const iterator& other) const { return m_slot == other.m_slot; }
+        bool operator!=(const iterator& other) const { return m_slot != other.m_slot; }
+
+    private:
+        void skip() { while ((m_slot != m_last) && (m_slot->state != SLOT_FULL)) ++m_slot; }
+
+        slot_t* m_slot = nullptr;
+        slot_t* m_last = nullptr;
+    };
+
+    iterator begin() { return iterator(m_slots.data(), m_slots.data() + m_slots.size()); }
+    iterator end() { return iterator(m_slots.data() + m_slots.size(), m_slots.data() + m_slots.size()); }
+
+    size_t size() const { return m_size; }
+
+    iterator find(uint64_t key)
+    {
+        if (m_slots.empty())
+            return end();
+        for (size_t i = bucket(key); ; i = (i + 1) & mask()) {
+            slot_t& slot = m_slots[i];
+            if (slot.state == SLOT_EMPTY)
+                return end();
+            if ((slot.state == SLOT_FULL) && (slot.first == key))
+                return iterator(&slot, m_slots.data() + m_slots.size());
+        }
+    }
+
+    std::pair<iterator, bool> insert(const value_type& value)
+    {
+        iterator it = find(value.first);
+        if (it != end())
+            return std::make_pair(it, false);
+
+        // Keep at most 3/4 of the slots in use, counting tombstones
+        if (4 * (m_size + m_erased + 1) > 3 * m_slots.size())
+            rehash();
+
+        size_t i = bucket(value.first);
+        while (m_slots[i].state == SLOT_FULL)
+            i = (i + 1) & mask();
+        if (m_slots[i].state == SLOT_ERASED)
+            --m_erased;
+        m_slots[i].first = value.first;
+        m_slots[i].second = value.second;
+        m_slots[i].state = SLOT_FULL;
+        ++m_size;
+        return std::make_pair(iterator(&m_slots[i], m_slots.data() + m_slots.size()), true);
+    }
+
+    iterator erase(iterator it)
+    {
+        it->state = SLOT_ERASED;
+        --m_size;
+        ++m_erased;
+        return ++it;
+    }
+
+private:
+    size_t mask() const { return m_slots.size() - 1; }
+
+    size_t bucket(uint64_t key) const
+    {
+        // Keys are cache line addresses, so the low bits carry no entropy
+        return size_t(((key >> 6) * 0x9E3779B97F4A7C15ull) >> 32) & mask();
+    }
+
+    void rehash()
+    {
+        size_t capacity = 16;
+        while (4 * (m_size + 1) > 3 * capacity / 2)
+            capacity *= 2;
+
+        std::vector<slot_t> old(capacity);
+        std::swap(old, m_slots);
+        m_erased = 0;
+        for (slot_t& slot : old) {
+            if (slot.state != SLOT_FULL)
+                continue;
+            size_t i = bucket(slot.first);
+            while (m_slots[i].state == SLOT_FULL)
+                i = (i + 1) & mask();
+            m_slots[i] = slot;
+        }
+    }
+
+    std::vector<slot_t> m_slots;
+    size_t m_size = 0;
+    size_t m_erased = 0;
+};
+
+#endif
@@ -19,16 +19,18 @@
         } \
     } }
 
-// Returns an int with the mask of a boolean array
-uint64_t bool_array_to_int(bool * array, uint64_t size)
+// Returns a bit of a directory mask
+template <class T>
+static inline bool mask_test(T mask, uint32_t bit)
 {
-    uint64_t ret = 0;
+    return (mask >> bit) & 1;
+}
 
-    for(uint64_t i = 0; i < size; i++)
-    {
-        if(array[i]) ret += 1 << i;
-    }
-    return ret;
+// Sets or clears a bit of a directory mask
+template <class T>
+static inline void mask_assign(T& mask, uint32_t bit, bool value)
+{
+    mask = value ? (mask | (T(1) << bit)) : (mask & ~(T(1) << bit));
 }
 
 /*! \brief Directory update for a memory block write
@@ -77,11 +79,8 @@ bool mem_checker::write(uint64_t pc, uint64_t address, op_location_t location, u
     // Marks the L1 accessed sets
     if(location == COH_MINION)
     {
-        for(uint32_t way = 0; way < L1D_NUM_WAYS; way++)
-        {
-            MD_LOG(address, minion, LOG_AGENT(DEBUG, *this, "mem_checker::write => setting l1 set %i and way %i", l1_set, way));
-            l1_minion_valid[minion][l1_set][way] = true;
-        }
+        MD_LOG(address, minion, LOG_AGENT(DEBUG, *this, "mem_checker::write => setting l1 set %i and all ways", l1_set));
+        l1_minion_valid[minion][l1_set] = l1_all_ways;
     }
 
     // Checks if access is coherent
@@ -90,20 +89,20 @@ bool mem_checker::write(uint64_t pc, uint64_t address, op_location_t location, u
     // Minion access must be coherent
     coherent &= !minion_found                                                                         // Not accessed yet by minion
              || ((l1_minion_control[minion] == 0) && (location == COH_MINION))                        // Cache is shared and access is minion
-             || (!it_minion->second.thread_mask_write[thread_id^1] && (location == COH_MINION))       // Access is minion and other thread is not dirty
-             || (!it_minion->second.thread_mask_write[0] && !it_minion->second.thread_mask_write[1]); // Data is not dirty and accessing beyond minion
+             || (!mask_test(it_minion->second.thread_mask_write, thread_id^1) && (location == COH_MINION))       // Access is minion and other thread is not dirty
+             || (it_minion->second.thread_mask_write == 0);                                          // Data is not dirty and accessing beyond minion
     // Shire access must be coherent
     coherent &= !shire_found                                                                                                                                                      // Not in shire
              || ((it_shire->second.l2_dirty_minion_id == 255)       && !it_shire->second.cb_dirty &&                                                   (location == COH_MINION))  // Writing to minion level, no minion has it dirty in L1 and not in CB
              || ((it_shire->second.l2_dirty_minion_id == minion_id) && !it_shire->second.cb_dirty &&                                                   (location == COH_MINION))  // Writing to minion level, same minion has it dirty in L1 and not in CB
              || ((it_shire->second.l2_dirty_minion_id == 255)       && !it_shire->second.cb_dirty &&                                                   (location == COH_SHIRE))   // Writing to shire level, no minion has dirty data, CB is clean
-             || ((it_shire->second.l2_dirty_minion_id == 255)       && !it_shire->second.l2_dirty && !it_shire->second.cb_dirty_quarter[cb_quarter] && (location == COH_CB))      // CB write, not rewriting same CB quarter, not dirty in minions nor L1
+             || ((it_shire->second.l2_dirty_minion_id == 255)       && !it_shire->second.l2_dirty && !mask_test(it_shire->second.cb_dirty_quarter, cb_quarter) && (location == COH_CB))      // CB write, not rewriting same CB quarter, not dirty in minions nor L1
              || ((it_shire->second.l2_dirty_minion_id == 255)       && !it_shire->second.l2_dirty && !it_shire->second.cb_dirty                     && (location == COH_GLOBAL)); // Globals require shire to be no dirty at all
     // Global access must be coherent
     coherent &= !global_found                                                                                                                               // Not in global
              || ((it_global->second.l2_dirty_shire_id == 255)      && !it_global->second.cb_dirty)                                                          // Still clean
              || ((it_global->second.l2_dirty_shire_id == shire_id) && !it_global->second.cb_dirty && ((location == COH_MINION) || (location == COH_SHIRE))) // Rewriting in same shire
-             || ((it_global->second.l2_dirty_shire_id == 255)      && !it_global->second.cb_dirty_quarter[cb_quarter] && (location == COH_CB));             // CB quarter was still not written and not written in any shire
+             || ((it_global->second.l2_dirty_shire_id == 255)      && !mask_test(it_global->second.cb_dirty_quarter, cb_quarter) && (location == COH_CB));             // CB quarter was still not written and not written in any shire
     if(!coherent && !m_waive_writes[thread]) dump_state(it_global, it_shire, it_minion, shire_id, minion);
 
     bool update_minion = (location == COH_MINION);
@@ -119,14 +118,14 @@ bool mem_checker::write(uint64_t pc, uint64_t address, op_location_t location, u
         if(!minion_found)
         {
             minion_mem_info_t new_entry;
+            new_entry.thread_mask_read  = 0;
+            new_entry.thread_mask_write = 0;
             for(uint32_t thread = 0; thread < EMU_THREADS_PER_MINION; thread++)
             {
-                new_entry.thread_mask_read [thread] = false;
-                new_entry.thread_mask_write[thread] = false;
-                new_entry.thread_set       [thread] = 255;
+                new_entry.thread_set[thread] = 255;
             }
-            new_entry.thread_mask_read [adjusted_thread_id] = true;
-            new_entry.thread_mask_write[adjusted_thread_id] = true;
+            mask_assign(new_entry.thread_mask_read, adjusted_thread_id, true);
+            mask_assign(new_entry.thread_mask_write, adjusted_thread_id, true);
             new_entry.thread_set       [adjusted_thread_id] = l1_set;
             new_entry.time_stamp       [adjusted_thread_id] = global_time_stamp;
 
@@ -136,8 +135,8 @@ bool mem_checker::write(uint64_t pc, uint64_t address, op_location_t location, u
         // Update
         else
         {
-            it_minion->second.thread_mask_read [adjusted_thread_id] = true;
-            it_minion->second.thread_mask_write[adjusted_thread_id] = true;
+            mask_assign(it_minion->second.thread_mask_read, adjusted_thread_id, true);
+            mask_assign(it_minion->second.thread_mask_write, adjusted_thread_id, true);
             it_minion->second.thread_set       [adjusted_thread_id] = l1_set;
             it_minion->second.time_stamp       [adjusted_thread_id] = global_time_stamp;
             dump_minion(&it_minion->second, "write", "update", address, shire_id, minion_id, thread_id);
@@ -161,16 +160,13 @@ bool mem_checker::write(uint64_t pc, uint64_t address, op_location_t location, u
         new_value.time_stamp         = (location == COH_MINION) ? global_found ? it_global->second.time_stamp : global_time_stamp - 1 : global_time_stamp;
 
         // CB dirty
-        new_value.cb_dirty = (location == COH_CB);
-        for(int quarter = 0; quarter < 4; quarter++)
-          new_value.cb_dirty_quarter[quarter] = false;
-        if(new_value.cb_dirty)
-            new_value.cb_dirty_quarter[cb_quarter] = true;
+        new_value.cb_dirty         = (location == COH_CB);
+        new_value.cb_dirty_quarter = 0;
+        mask_assign(new_value.cb_dirty_quarter, cb_quarter, new_value.cb_dirty);
 
         // Minion mask
-        for(uint32_t i = 0; i < EMU_MINIONS_PER_SHIRE; i++)
-            new_value.minion_mask[i] = false;
-        new_value.minion_mask[minion_id] = (location == COH_MINION);
+        new_value.minion_mask = 0;
+        mask_assign(new_value.minion_mask, minion_id, location == COH_MINION);
 
         // Not present, insert
         if(!shire_found)
@@ -191,9 +187,8 @@ bool mem_checker::write(uint64_t pc, uint64_t address, op_location_t location, u
             it_shire->second.l2_dirty_minion_id      = new_value.l2_dirty_minion_id;
             it_shire->second.time_stamp              = (location != COH_MINION) ? global_time_stamp : it_shire->second.time_stamp; // Update to time stamp when not writing to minion
             it_shire->second.cb_dirty               |= new_value.cb_dirty;
-            it_shire->second.minion_mask[minion_id] |= new_value.minion_mask[minion_id];
-            if(new_value.cb_dirty)
-                it_shire->second.cb_dirty_quarter[cb_quarter] = true;
+            it_shire->second.minion_mask            |= new_value.minion_mask;
+            it_shire->second.cb_dirty_quarter       |= new_value.cb_dirty_quarter;
 
             dump_shire(&it_shire->second, "write", "update", address, shire_id, minion);
         }
@@ -205,10 +200,9 @@ bool mem_checker::write(uint64_t pc, uint64_t address, op_location_t location, u
         global_mem_info_t new_value;
 
         // Set CB bits
-        new_value.cb_dirty = (location == COH_CB);
-        for(int quarter = 0; quarter < 4; quarter++)
-          new_value.cb_dirty_quarter[quarter] = false;
-        new_value.cb_dirty_quarter[cb_quarter] = new_value.cb_dirty;
+        new_value.cb_dirty         = (location == COH_CB);
+        new_value.cb_dirty_quarter = 0;
+        mask_assign(new_value.cb_dirty_quarter, cb_quarter, new_value.cb_dirty);
 
         // Sets dirty bits
         new_value.l2_dirty_shire_id = new_value.cb_dirty       ? 255
@@ -218,9 +212,8 @@ bool mem_checker::write(uint64_t pc, uint64_t address, op_location_t location, u
         new_value.time_stamp        = global_time_stamp;
 
         // Shire mask
-        for(uint32_t shire = 0; shire < EMU_NUM_SHIRES; shire++)
-            new_value.shire_mask[shire] = false;
-        new_value.shire_mask[shire_id] = (location != COH_GLOBAL) && l2_change;
+        new_value.shire_mask = 0;
+        mask_assign(new_value.shire_mask, shire_id, (location != COH_GLOBAL) && l2_change);
 
         // Not present, insert
         if(!global_found)
@@ -234,9 +227,9 @@ bool mem_checker::write(uint64_t pc, uint64_t address, op_location_t location, u
             it_global->second.time_stamp                   = (location == COH_GLOBAL) ? global_time_stamp : it_global->second.time_stamp;
             it_global->second.latest_time_stamp             = global_time_stamp;
             it_global->second.l2_dirty_shire_id             = new_value.l2_dirty_shire_id;
-            it_global->second.shire_mask[shire_id]         |= new_value.shire_mask[shire_id];
+            it_global->second.shire_mask                   |= new_value.shire_mask;
             it_global->second.cb_dirty                     |= new_value.cb_dirty;
-            it_global->second.cb_dirty_quarter[cb_quarter] |= new_value.cb_dirty;
+            it_global->second.cb_dirty_quarter             |= new_value.cb_dirty_quarter;
             dump_global(&it_global->second, "write", "update", address, minion);
         }
     }
@@ -286,11 +279,8 @@ bool mem_checker::read(uint64_t pc, uint64_t address, op_location_t location, ui
     // Marks the L1 accessed sets
     if(location == COH_MINION)
     {
-        for(uint32_t way = 0; way < L1D_NUM_WAYS; way++)
-        {
-            MD_LOG(address, minion, LOG_AGENT(DEBUG, *this, "mem_checker::read => setting l1 set %i and way %i", l1_set, way));
-            l1_minion_valid[minion][l1_set][way] = true;
-        }
+        MD_LOG(address, minion, LOG_AGENT(DEBUG, *this, "mem_checker::read => setting l1 set %i and all ways", l1_set));
+        l1_minion_valid[minion][l1_set] = l1_all_ways;
     }
 
     // Computes to which section of the L1 the minion will access
@@ -304,7 +294,7 @@ bool mem_checker::read(uint64_t pc, uint64_t address, op_location_t location, ui
     if(minion_found && (location == COH_MINION)) {
       // Minion case is more complicated. When the access is done at L1 level and an entry is found we need to check if the
       // data is in the section of the cache the minion is accessing
-      if(it_minion->second.thread_mask_write[adjusted_thread_id] || it_minion->second.thread_mask_read[adjusted_thread_id])
+      if(mask_test(it_minion->second.thread_mask_write, adjusted_thread_id) || mask_test(it_minion->second.thread_mask_read, adjusted_thread_id))
       {
         access_time_stamp = it_minion->second.time_stamp[adjusted_thread_id];
       }
@@ -316,8 +306,8 @@ bool mem_checker::read(uint64_t pc, uint64_t address, op_location_t location, ui
     // Minion access must be coherent
     coherent &= !minion_found                                                                         // Data not in minion
              || ((l1_minion_control[minion] == 0) && (location == COH_MINION))                        // Cache is shared and access is minion
-             || (!it_minion->second.thread_mask_write[thread_id^1] && (location == COH_MINION))       // Access is minion and other thread is not dirty
-             || (!it_minion->second.thread_mask_write[0] && !it_minion->second.thread_mask_write[1]); // Data is not dirty and accessing beyond minion
+             || (!mask_test(it_minion->second.thread_mask_write, thread_id^1) && (location == COH_MINION))       // Access is minion and other thread is not dirty
+             || (it_minion->second.thread_mask_write == 0);                                          // Data is not dirty and accessing beyond minion
 
     // Time stamp is coherent
     coherent &= !global_found || (access_time_stamp == it_global->second.latest_time_stamp);
@@ -339,13 +329,13 @@ bool mem_checker::read(uint64_t pc, uint64_t address, op_location_t location, ui
         // Not present, insert
         if(!minion_found)
         {
+            new_entry.thread_mask_read  = 0;
+            new_entry.thread_mask_write = 0;
             for(uint32_t thread = 0; thread < EMU_THREADS_PER_MINION; thread++)
             {
-                new_entry.thread_mask_read [thread] = false;
-                new_entry.thread_mask_write[thread] = false;
-                new_entry.thread_set       [thread] = 255;
+                new_entry.thread_set[thread] = 255;
             }
-            new_entry.thread_mask_read[adjusted_thread_id] = true;
+            mask_assign(new_entry.thread_mask_read, adjusted_thread_id, true);
             new_entry.thread_set      [adjusted_thread_id] = l1_set;
             new_entry.time_stamp      [adjusted_thread_id] = new_time_stamp;
 
@@ -356,11 +346,11 @@ bool mem_checker::read(uint64_t pc, uint64_t address, op_location_t location, ui
         else
         {
             // In case that this section of the L1 didn't have data, get the time stamp as well
-            if(!it_minion->second.thread_mask_read[adjusted_thread_id])
+            if(!mask_test(it_minion->second.thread_mask_read, adjusted_thread_id))
             {
                 it_minion->second.time_stamp[adjusted_thread_id] = new_time_stamp;
             }
-            it_minion->second.thread_mask_read[adjusted_thread_id] = true;
+            mask_assign(it_minion->second.thread_mask_read, adjusted_thread_id, true);
             it_minion->second.thread_set      [adjusted_thread_id] = l1_set;
             dump_minion(&it_minion->second, "read", "update", address, shire_id, minion_id, thread_id);
         }
@@ -383,14 +373,12 @@ bool mem_checker::read(uint64_t pc, uint64_t address, op_location_t location, ui
                                      :                global_time_stamp;
 
         // CB dirty
-        new_value.cb_dirty = false;
-        for(uint32_t i = 0; i < 4; i++)
-            new_value.cb_dirty_quarter[i] = false;
+        new_value.cb_dirty         = false;
+        new_value.cb_dirty_quarter = 0;
 
         // Minion mask
-        for(uint32_t i = 0; i < EMU_MINIONS_PER_SHIRE; i++)
-            new_value.minion_mask[i] = false;
-        new_value.minion_mask[minion_id] = (location == COH_MINION);
+        new_value.minion_mask = 0;
+        mask_assign(new_value.minion_mask, minion_id, location == COH_MINION);
 
         // Not present, insert
         if(!shire_found)
@@ -412,7 +400,7 @@ bool mem_checker::read(uint64_t pc, uint64_t address, op_location_t location, ui
               it_shire->second.time_stamp = new_value.time_stamp;
             }
             it_shire->second.l2                     |= new_value.l2;
-            it_shire->second.minion_mask[minion_id] |= new_value.minion_mask[minion_id];
+            it_shire->second.minion_mask            |= new_value.minion_mask;
             dump_shire(&it_shire->second, "read", "update", address, shire_id, minion);
         }
     }
@@ -426,11 +414,9 @@ bool mem_checker::read(uint64_t pc, uint64_t address, op_location_t location, ui
         new_value.latest_time_stamp = global_time_stamp;
         new_value.cb_dirty          = false;
         new_value.l2_dirty_shire_id = 255;
-        for(int quarter = 0; quarter < 4; quarter++)
-          new_value.cb_dirty_quarter[quarter] = false;
-        for(uint32_t shire = 0; shire < EMU_NUM_SHIRES; shire++)
-            new_value.shire_mask[shire] = false;
-        new_value.shire_mask[shire_id] = (location != COH_GLOBAL) && l2_change;
+        new_value.cb_dirty_quarter  = 0;
+        new_value.shire_mask        = 0;
+        mask_assign(new_value.shire_mask, shire_id, (location != COH_GLOBAL) && l2_change);
 
         // Not present, insert
         if(!global_found)
@@ -441,7 +427,7 @@ bool mem_checker::read(uint64_t pc, uint64_t address, op_location_t location, ui
         // Update
         else
         {
-            it_global->second.shire_mask[shire_id] |= new_value.shire_mask[shire_id];
+            it_global->second.shire_mask |= new_value.shire_mask;
             dump_global(&it_global->second, "read", "update", address, minion);
         }
     }
@@ -501,7 +487,7 @@ bool mem_checker::evict_va(uint64_t pc, uint64_t address, op_location_t location
         MD_LOG(address, minion, LOG_AGENT(DEBUG, *this, "mem_checker::evict_va update minion directory => addr %016llX, shire_id %i, minion_id %i", (long long unsigned int) address, shire_id, minion_id));
 
         // Gets if dirty data from L1 is dirty
-        * dirty_evict = it_minion->second.thread_mask_write[adjusted_thread_id];
+        * dirty_evict = mask_test(it_minion->second.thread_mask_write, adjusted_thread_id);
 
         // Dirty evict: updates time stamp and marks line as dirty in shire
         if(* dirty_evict)
@@ -514,8 +500,8 @@ bool mem_checker::evict_va(uint64_t pc, uint64_t address, op_location_t location
         }
 
         // Clears status bits
-        it_minion->second.thread_mask_read [adjusted_thread_id] = false;
-        it_minion->second.thread_mask_write[adjusted_thread_id] = false;
+        mask_assign(it_minion->second.thread_mask_read, adjusted_thread_id, false);
+        mask_assign(it_minion->second.thread_mask_write, adjusted_thread_id, false);
         dump_minion(&it_minion->second, "evict_va", "update", address, shire_id, minion_id, thread_id);
 
         // Line is no longer dirty in minion, update shire state
@@ -542,7 +528,7 @@ bool mem_checker::evict_va(uint64_t pc, uint64_t address, op_location_t location
         {
             MD_LOG(address, minion, LOG_AGENT(DEBUG, *this, "mem_checker::evict_va => line no longer in minion %i", minion));
 
-            it_shire->second.minion_mask[minion_id] = false;
+            mask_assign(it_shire->second.minion_mask, minion_id, false);
             dump_shire(&it_shire->second, "evict_va", "update", address, shire_id, minion);
 
             // Remove minion entry
@@ -593,7 +579,7 @@ bool mem_checker::evict_va(uint64_t pc, uint64_t address, op_location_t location
         // Line is no longer in shire, update global state and remove in shire
         if(is_shire_clean(it_shire))
         {
-            it_global->second.shire_mask[shire_id] = false;
+            mask_assign(it_global->second.shire_mask, shire_id, false);
             dump_global(&it_global->second, "evict_va", "update", address, minion);
         }
     }
@@ -644,13 +630,14 @@ void mem_checker::l1_clear_set(uint32_t shire_id, uint32_t minion_id, uint32_t s
         {
             if(it_minion->second.thread_set[thread] == set)
             {
-                if (it_minion->second.thread_mask_write[thread])
+                if (mask_test(it_minion->second.thread_mask_write, thread))
                 {
                     minion_evict_time_stamp = it_minion->second.time_stamp[thread];
                     dirty_evict = true;
                 }
-                it_minion->second.thread_mask_write[thread] = false;
-                it_minion->second.thread_mask_read [thread] &= !evict; // Read only cleared for evicts
+                mask_assign(it_minion->second.thread_mask_write, thread, false);
+                if(evict) // Read only cleared for evicts
+                    mask_assign(it_minion->second.thread_mask_read, thread, false);
                 dump_minion(&it_minion->second, "l1_clear_set", "update", addr, shire_id, minion_id, thread);
             }
         }
@@ -698,7 +685,7 @@ void mem_checker::l1_clear_set(uint32_t shire_id, uint32_t minion_id, uint32_t s
         // Line is no longer in minion, update shire state and remove in minion
         if(is_minion_clean(it_minion))
         {
-            it_shire->second.minion_mask[minion_id] = false;
+            mask_assign(it_shire->second.minion_mask, minion_id, false);
             dump_shire(&it_shire->second, "l1_clear_set", "update", addr, shire_id, minion);
 
             // Remove minion entry
@@ -736,7 +723,7 @@ void mem_checker::l1_clear_set(uint32_t shire_id, uint32_t minion_id, uint32_t s
             dump_shire(&it_shire->second, "l1_clear_set", "remove", addr, shire_id, minion);
             shire_directory_map[shire_id].erase(it_shire);
 
-            it_global->second.shire_mask[shire_id] = false;
+            mask_assign(it_global->second.shire_mask, shire_id, false);
             dump_global(&it_global->second, "l1_clear_set", "update", addr, minion);
 
             // Remove global if needed
@@ -762,26 +749,14 @@ void mem_checker::l1_clear_set(uint32_t shire_id, uint32_t minion_id, uint32_t s
 // Private function that returns if a minion entry is clean and can be removed
 bool mem_checker::is_minion_clean(minion_directory_map_t::iterator it_minion)
 {
-    bool is_clean = true;
-    for(uint32_t thread = 0; thread < EMU_THREADS_PER_MINION; thread++)
-    {
-        is_clean &= (!it_minion->second.thread_mask_read[thread] && !it_minion->second.thread_mask_write[thread]);
-    }
-
-    return is_clean;
+    return (it_minion->second.thread_mask_read == 0) && (it_minion->second.thread_mask_write == 0);
 }
 
 // Private function that returns if a minion entry is dirty
 bool mem_checker::is_minion_dirty(minion_directory_map_t::iterator it_minion)
 {
-    bool is_dirty = false;
     // If any thread has the write mask set, it is dirty
-    for(uint32_t thread = 0; thread < EMU_THREADS_PER_MINION; thread++)
-    {
-        is_dirty |= it_minion->second.thread_mask_write[thread];
-    }
-
-    return is_dirty;
+    return it_minion->second.thread_mask_write != 0;
 }
 
 // Private function that returns if a shire entry is clean and can be removed
@@ -791,8 +766,7 @@ bool mem_checker::is_shire_clean(shire_directory_map_t::iterator it_shire)
     // Not in L2 or CB
     is_clean = !it_shire->second.l2 && !it_shire->second.l2_dirty && !it_shire->second.cb_dirty;
     // Not in any minion
-    for(uint32_t i = 0; i < EMU_MINIONS_PER_SHIRE; i++)
-        is_clean &= (!it_shire->second.minion_mask[i]);
+    is_clean &= (it_shire->second.minion_mask == 0);
 
     return is_clean;
 }
@@ -808,11 +782,7 @@ bool mem_checker::is_shire_dirty(shire_directory_map_t::iterator it_shire)
 // Private function that returns if a global entry is clean and can be removed
 bool mem_checker::is_global_clean(global_directory_map_t::iterator it_global)
 {
-    bool is_clean = true;
-    for(uint32_t shire = 0; shire < EMU_NUM_SHIRES; shire++)
-        is_clean &= (it_global->second.shire_mask[shire] == false);
-
-    return is_clean;
+    return it_global->second.shire_mask == 0;
 }
 
 // Dumps the contents of a minion entry
@@ -822,8 +792,8 @@ void mem_checker::dump_minion(minion_mem_info_t * minion_info, std::string func,
     uint32_t adjusted_thread_id = (l1_minion_control[minion] == 0) ? 0 : thread_id;
 
     MD_LOG(addr, minion, LOG_AGENT(DEBUG, *this, "mem_checker::%s %s minion directory => addr %016llX, shire_id %i, minion_id %i, thread_id %i, mask_write: 0x%X, mask_read: 0x%X, set: 0x%X, time_stamp: [ %llu, %llu ]",
-          func.c_str(), op.c_str(), (long long unsigned int) addr, shire_id, minion_id, thread_id, (int32_t) bool_array_to_int(minion_info->thread_mask_write, EMU_THREADS_PER_MINION),
-          (int32_t) bool_array_to_int(minion_info->thread_mask_read, EMU_THREADS_PER_MINION), minion_info->thread_set[adjusted_thread_id], (long long unsigned int) minion_info->time_stamp[0],
+          func.c_str(), op.c_str(), (long long unsigned int) addr, shire_id, minion_id, thread_id, minion_info->thread_mask_write,
+          minion_info->thread_mask_read, minion_info->thread_set[adjusted_thread_id], (long long unsigned int) minion_info->time_stamp[0],
           (long long unsigned int) minion_info->time_stamp[1]));
 }
 
@@ -832,15 +802,15 @@ void mem_checker::dump_shire(shire_mem_info_t * shire_info, std::string func, st
 {
     MD_LOG(addr, minion, LOG_AGENT(DEBUG, *this, "mem_checker::%s %s shire directory => addr %016llX, shire_id %i, l2: %i, l2_dirty: %i, l2_dirty_minion_id: %i, cb_dirty: %i, cb_quarter: 0x%X, minion_mask: 0x%X, time_stamp: %llu",
           func.c_str(), op.c_str(), (long long unsigned int) addr, shire_id, shire_info->l2, shire_info->l2_dirty, shire_info->l2_dirty_minion_id,
-          shire_info->cb_dirty, (int32_t) bool_array_to_int(shire_info->cb_dirty_quarter, 4), (int32_t) bool_array_to_int(shire_info->minion_mask, 32), (long long unsigned int) shire_info->time_stamp));
+          shire_info->cb_dirty, shire_info->cb_dirty_quarter, shire_info->minion_mask, (long long unsigned int) shire_info->time_stamp));
 }
 
 // Dumps the contents of a global entry
 void mem_checker::dump_global(global_mem_info_t * global_info, std::string func, std::string op, uint64_t addr, uint32_t minion)
 {
     MD_LOG(addr, minion, LOG_AGENT(DEBUG, *this, "mem_checker::%s %s global directory => addr %016llX, l2_dirty_shire_id: %i, shire_mask: 0x%llX, cb_dirty: %i, cb_quarter: 0x%X, time_stamp: %llu, latest_time_stamp: %llu",
-          func.c_str(), op.c_str(), (long long unsigned int) addr, global_info->l2_dirty_shire_id, (long long unsigned int) bool_array_to_int(global_info->shire_mask, EMU_NUM_SHIRES),
-          global_info->cb_dirty, (uint32_t) bool_array_to_int(global_info->cb_dirty_quarter, 4), (long long unsigned int) global_info->time_stamp, (long long unsigned int) global_info->latest_time_stamp));
+          func.c_str(), op.c_str(), (long long unsigned int) addr, global_info->l2_dirty_shire_id, (long long unsigned int) global_info->shire_mask,
+          global_info->cb_dirty, global_info->cb_dirty_quarter, (long long unsigned int) global_info->time_stamp, (long long unsigned int) global_info->latest_time_stamp));
 }
 
 // Private function that dumps coherent state
@@ -853,10 +823,10 @@ void mem_checker::dump_state(global_directory_map_t::iterator it_global, shire_d
         MD_LOG(0, minion, LOG_AGENT(DEBUG, *this, "  time_stamp: %llu", (long long unsigned int) it_global->second.time_stamp));
         MD_LOG(0, minion, LOG_AGENT(DEBUG, *this, "  l2_dirty_shire_id: %i", it_global->second.l2_dirty_shire_id));
         MD_LOG(0, minion, LOG_AGENT(DEBUG, *this, "  cb_dirty: %i", it_global->second.cb_dirty));
-        MD_LOG(0, minion, LOG_AGENT(DEBUG, *this, "  cb_dirty_quarter: %i%i%i%i", it_global->second.cb_dirty_quarter[3], it_global->second.cb_dirty_quarter[2], it_global->second.cb_dirty_quarter[1], it_global->second.cb_dirty_quarter[0]));
+        MD_LOG(0, minion, LOG_AGENT(DEBUG, *this, "  cb_dirty_quarter: %i%i%i%i", mask_test(it_global->second.cb_dirty_quarter, 3), mask_test(it_global->second.cb_dirty_quarter, 2), mask_test(it_global->second.cb_dirty_quarter, 1), mask_test(it_global->second.cb_dirty_quarter, 0)));
         for(uint32_t shire = 0; shire < EMU_NUM_SHIRES; shire++)
         {
-            MD_LOG(0, minion, LOG_AGENT(DEBUG, *this, "  shire_mask[%i] = %i", shire, it_global->second.shire_mask[shire]));
+            MD_LOG(0, minion, LOG_AGENT(DEBUG, *this, "  shire_mask[%i] = %i", shire, mask_test(it_global->second.shire_mask, shire)));
         }
     }
     if(it_shire != shire_directory_map[shire_id].end())
@@ -867,10 +837,10 @@ void mem_checker::dump_state(global_directory_map_t::iterator it_global, shire_d
         MD_LOG(0, minion, LOG_AGENT(DEBUG, *this, "  l2_dirty: %i", it_shire->second.l2_dirty));
         MD_LOG(0, minion, LOG_AGENT(DEBUG, *this, "  l2_dirty_minion_id: %i", it_shire->second.l2_dirty_minion_id));
         MD_LOG(0, minion, LOG_AGENT(DEBUG, *this, "  cb_dirty: %i", it_shire->second.cb_dirty));
-        MD_LOG(0, minion, LOG_AGENT(DEBUG, *this, "  cb_dirty_quarter: %i%i%i%i", it_shire->second.cb_dirty_quarter[3], it_shire->second.cb_dirty_quarter[2], it_shire->second.cb_dirty_quarter[1], it_shire->second.cb_dirty_quarter[0]));
+        MD_LOG(0, minion, LOG_AGENT(DEBUG, *this, "  cb_dirty_quarter: %i%i%i%i", mask_test(it_shire->second.cb_dirty_quarter, 3), mask_test(it_shire->second.cb_dirty_quarter, 2), mask_test(it_shire->second.cb_dirty_quarter, 1), mask_test(it_shire->second.cb_dirty_quarter, 0)));
         for(uint32_t i = 0; i < EMU_MINIONS_PER_SHIRE; i++)
         {
-            MD_LOG(0, minion, LOG_AGENT(DEBUG, *this, "  minion_mask[%i] = %i", i, it_shire->second.minion_mask[i]));
+            MD_LOG(0, minion, LOG_AGENT(DEBUG, *this, "  minion_mask[%i] = %i", i, mask_test(it_shire->second.minion_mask, i)));
         }
     }
     if(it_minion != minion_directory_map[minion].end())
@@ -880,8 +850,8 @@ void mem_checker::dump_state(global_directory_map_t::iterator it_global, shire_d
               (long long unsigned int) it_minion->second.time_stamp[1]));
         for(uint32_t thread = 0; thread < EMU_THREADS_PER_MINION; thread++)
         {
-              MD_LOG(0, minion, LOG_AGENT(DEBUG, *this, "  thread_mask_write[%i] = %i", thread, it_minion->second.thread_mask_write[thread]));
-              MD_LOG(0, minion, LOG_AGENT(DEBUG, *this, "  thread_mask_read[%i] = %i", thread, it_minion->second.thread_mask_read[thread]));
+              MD_LOG(0, minion, LOG_AGENT(DEBUG, *this, "  thread_mask_write[%i] = %i", thread, mask_test(it_minion->second.thread_mask_write, thread)));
+              MD_LOG(0, minion, LOG_AGENT(DEBUG, *this, "  thread_mask_read[%i] = %i", thread, mask_test(it_minion->second.thread_mask_read, thread)));
               MD_LOG(0, minion, LOG_AGENT(DEBUG, *this, "  thread_set[%i] = %i", thread, it_minion->second.thread_set[thread]));
         }
     }
@@ -891,17 +861,8 @@ void mem_checker::dump_state(global_directory_map_t::iterator it_global, shire_d
 mem_checker::mem_checker(bemu::System* chip) : bemu::Agent(chip)
 {
     // All set and ways are clear
-    for(uint32_t minion = 0; minion < EMU_NUM_MINIONS; minion++)
-    {
-        for(uint32_t set = 0; set < L1D_NUM_SETS; set++)
-        {
-            for(uint32_t way = 0; way < L1D_NUM_WAYS; way++)
-            {
-                l1_minion_valid[minion][set][way] = false;
-            }
-        }
-        l1_minion_control[minion] = 0;
-    }
+    memset(l1_minion_valid, 0, sizeof(l1_minion_valid));
+    memset(l1_minion_control, 0, sizeof(l1_minion_control));
 }
 
 // Public function to access a memory position
@@ -1116,14 +1077,8 @@ void mem_checker::cb_drain(uint32_t shire_id, uint32_t cache_bank)
             }
 
             // Clears the CB dirty bits in global and shire
-            for(int quarter = 0; quarter < 4; quarter++)
-            {
-                if(it_shire->second.cb_dirty_quarter[quarter])
-                {
-                    it_global->second.cb_dirty_quarter[quarter] = false;
-                    it_shire->second.cb_dirty_quarter[quarter] = false;
-                }
-            }
+            it_global->second.cb_dirty_quarter &= ~it_shire->second.cb_dirty_quarter;
+            it_shire->second.cb_dirty_quarter   = 0;
             // Update time stamp if newer
             if(it_shire->second.time_stamp > it_global->second.time_stamp)
                 it_global->second.time_stamp = it_shire->second.time_stamp;
@@ -1132,11 +1087,7 @@ void mem_checker::cb_drain(uint32_t shire_id, uint32_t cache_bank)
             it_shire->second.cb_dirty = false;
             dump_shire(&it_shire->second, "cb_drain", "update", addr, shire_id, 0xFFFFFFFF);
 
-            bool all_clear = true;
-            for(int quarter = 0; quarter < 4; quarter++)
-                all_clear &= !it_global->second.cb_dirty_quarter[quarter];
-
-            if(all_clear)
+            if(it_global->second.cb_dirty_quarter == 0)
                 it_global->second.cb_dirty = false;
 
             dump_global(&it_global->second, "cb_drain", "update", addr, 0xFFFFFFFF);
@@ -1150,7 +1101,7 @@ void mem_checker::cb_drain(uint32_t shire_id, uint32_t cache_bank)
                 shire_directory_map[shire_id].erase(it_orig);
 
                 // If shire clean, clean bit
-                it_global->second.shire_mask[shire_id] = false;
+                mask_assign(it_global->second.shire_mask, shire_id, false);
                 dump_global(&it_global->second, "cb_drain", "update", addr, 0xFFFFFFFF);
 
                 // Remove from global
@@ -1228,7 +1179,7 @@ void mem_checker::l2_evict(uint32_t shire_id, uint32_t cache_bank)
                 shire_directory_map[shire_id].erase(it_orig);
 
                 // Clean in global
-                it_global->second.shire_mask[shire_id] = false;
+                mask_assign(it_global->second.shire_mask, shire_id, false);
                 dump_global(&it_global->second, "l2_evict", "update", addr, log_minion + 1);
 
                 // Remove from global
@@ -1258,7 +1209,7 @@ void mem_checker::l2_evict(uint32_t shire_id, uint32_t cache_bank)
 void mem_checker::l1_evict_all(uint32_t shire_id, uint32_t minion_id)
 {
     uint32_t minion = shire_id * EMU_MINIONS_PER_SHIRE + minion_id;
-    memset(l1_minion_valid[minion], 0, sizeof(bool) * L1D_NUM_WAYS * L1D_NUM_SETS);
+    memset(l1_minion_valid[minion], 0, sizeof(l1_minion_valid[minion]));
 
     MD_LOG(0, minion, LOG_AGENT(DEBUG, *this, "mem_checker::l1_evict_all => shire_id %i, minion_id %i", shire_id, minion_id));
 
@@ -1273,18 +1224,12 @@ void mem_checker::l1_evict_sw(uint32_t shire_id, uint32_t minion_id, uint32_t se
 {
     // Clears set and way
     uint32_t minion = shire_id * EMU_MINIONS_PER_SHIRE + minion_id;
-    l1_minion_valid[minion][set][way] = false;
+    mask_assign(l1_minion_valid[minion][set], way, false);
 
     MD_LOG(0, minion, LOG_AGENT(DEBUG, *this, "mem_checker::l1_evict_sw => shire_id %i, minion_id %i, set %i, way %i", shire_id, minion_id, set, way));
 
     // Checks if all ways of a set are clear
-    bool all_clear = true;
-    for(uint32_t it_way = 0; it_way < L1D_NUM_WAYS; it_way++)
-    {
-        all_clear &= (l1_minion_valid[minion][set][it_way] == false);
-    }
-
-    if(all_clear)
+    if(l1_minion_valid[minion][set] == 0)
         l1_clear_set(shire_id, minion_id, set, true);
 }
 
@@ -1293,18 +1238,12 @@ void mem_checker::l1_flush_sw(uint32_t shire_id, uint32_t minion_id, uint32_t se
 {
     // Clears set and way
     uint32_t minion = shire_id * EMU_MINIONS_PER_SHIRE + minion_id;
-    l1_minion_valid[minion][set][way] = false;
+    mask_assign(l1_minion_valid[minion][set], way, false);
     MD_LOG(0, minion, LOG_AGENT(DEBUG, *this, "mem_checker::l1_flush_sw => shire_id %i, minion_id %i, set %i, way %i", shire_id, minion_id, set, way));
     LOG_AGENT(FTL, *this, "L1 flush not implemented yet!!%s", "");
 
     // Checks if all ways of a set are clear
-    bool all_clear = true;
-    for(uint32_t it_way = 0; it_way < L1D_NUM_WAYS; it_way++)
-    {
-        all_clear &= (l1_minion_valid[minion][set][it_way] == false);
-    }
-
-    if(all_clear)
+    if(l1_minion_valid[minion][set] == 0)
         l1_clear_set(shire_id, minion_id, set, false);
 }
 
@@ -1318,11 +1257,8 @@ void mem_checker::mcache_control_up(uint32_t shire_id, uint32_t minion_id, uint3
     bool all_clear = true;
     for(uint32_t set = 0; set < L1D_NUM_SETS; set++)
     {
-        for(uint32_t way = 0; way < L1D_NUM_WAYS; way++)
-        {
-            all_clear &= (l1_minion_valid[minion][set][way] == false);
-            l1_minion_valid[minion][set][way] = false;
-        }
+        all_clear &= (l1_minion_valid[minion][set] == 0);
+        l1_minion_valid[minion][set] = 0;
     }
 
     if(!all_clear)
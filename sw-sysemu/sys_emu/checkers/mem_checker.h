@@ -6,22 +6,30 @@
 #ifndef _MEM_CHECKER_H_
 #define _MEM_CHECKER_H_
 
-#include <map>
-
+#include <bitset>
 #include <cassert>
+#include <cstdint>
 
 #include "emu_defines.h"
 #include "cache.h"
 #include "agent.h"
+#include "directory_map.h"
 
 typedef enum {COH_MINION, COH_SHIRE, COH_CB, COH_GLOBAL} op_location_t;
 
+// Masks are indexed by shire, minion in the shire, thread in the minion,
+// 128b quarter of the line and L1 way respectively
+static_assert(EMU_NUM_SHIRES <= 64, "shire_mask is too small");
+static_assert(EMU_MINIONS_PER_SHIRE <= 32, "minion_mask is too small");
+static_assert(EMU_THREADS_PER_MINION <= 8, "thread masks are too small");
+static_assert(L1D_NUM_WAYS <= 8, "l1_minion_valid is too small");
+
 struct global_mem_info_t
 {
     uint8_t  l2_dirty_shire_id;          // Which shire has dirty data
-    bool     shire_mask[EMU_NUM_SHIRES]; // Which shires have the line in l1/l2
     bool     cb_dirty;                   // Data dirty in Coallescing Buffer
-    bool     cb_dirty_quarter[4];        // Chunks of 128b that are dirty
+    uint8_t  cb_dirty_quarter;           // Chunks of 128b that are dirty
+    uint64_t shire_mask;                 // Which shires have the line in l1/l2
     uint64_t time_stamp;                 // Time stamp of the value in the L3
     uint64_t latest_time_stamp;          // Time stamp of the latest written value
 };
@@ -32,22 +40,22 @@ struct shire_mem_info_t
     bool     l2_dirty;                           // Data dirty in L2
     uint8_t  l2_dirty_minion_id;                 // Which minion has the line dirty (255 is none)
     bool     cb_dirty;                           // Data dirty in Coallescing Buffer
-    bool     cb_dirty_quarter[4];                // Chunks of 128b that are dirty
-    bool     minion_mask[EMU_MINIONS_PER_SHIRE]; // Which minions have the line in l1
+    uint8_t  cb_dirty_quarter;                   // Chunks of 128b that are dirty
+    uint32_t minion_mask;                        // Which minions have the line in l1
     uint64_t time_stamp;                         // Time stamp of the value
 };
 
 struct minion_mem_info_t
 {
-    bool     thread_mask_write[EMU_THREADS_PER_MINION]; // Which thread has written the line
-    bool     thread_mask_read[EMU_THREADS_PER_MINION];  // Which thread has read the line
+    uint8_t  thread_mask_write;                         // Which thread has written the line
+    uint8_t  thread_mask_read;                          // Which thread has read the line
     uint8_t  thread_set[EMU_THREADS_PER_MINION];        // Set where each thread stored the line
     uint64_t time_stamp[EMU_THREADS_PER_MINION];        // Time stamp of the value
 };
 
-typedef std::map<uint64_t, global_mem_info_t> global_directory_map_t;
-typedef std::map<uint64_t, shire_mem_info_t>  shire_directory_map_t;
-typedef std::map<uint64_t, minion_mem_info_t> minion_directory_map_t;
+typedef directory_map<global_mem_info_t> global_directory_map_t;
+typedef directory_map<shire_mem_info_t>  shire_directory_map_t;
+typedef directory_map<minion_mem_info_t> minion_directory_map_t;
 
 class mem_checker : public bemu::Agent
 {
@@ -62,8 +70,9 @@ private:
     shire_directory_map_t  shire_directory_map[EMU_NUM_SHIRES];
     minion_directory_map_t minion_directory_map[EMU_NUM_MINIONS];
 
-    // Minion L1 status per set/way
-    bool l1_minion_valid[EMU_NUM_MINIONS][L1D_NUM_SETS][L1D_NUM_WAYS];
+    // Minion L1 status per set, one bit per way
+    static constexpr uint8_t l1_all_ways = (1u << L1D_NUM_WAYS) - 1;
+    uint8_t  l1_minion_valid[EMU_NUM_MINIONS][L1D_NUM_SETS];
     uint32_t l1_minion_control[EMU_NUM_MINIONS];
 
     // Write and read functions
@@ -8,18 +8,24 @@
 #include "emu_gio.h"
 #include "gdb_target_xml.h"
 #include "sys_emu.h"
+#include <algorithm>
 #include <arpa/inet.h>
+#include <deque>
 #include <netinet/in.h>
 #include <netinet/tcp.h>
 #include <poll.h>
 #include <string.h>
+#include <string>
 #include <sys/socket.h>
 #include <unistd.h>
+#include <unordered_set>
+#include <vector>
 
 #define ARRAY_SIZE(x) (sizeof(x) / sizeof(*x))
 
 #define GDBSTUB_DEFAULT_PORT    1337
-#define GDBSTUB_MAX_PACKET_SIZE 4096
+#define GDBSTUB_MAX_PACKET_SIZE 0x10000
+#define GDBSTUB_RX_BUFFER_SIZE  4096
 
 #define RSP_START_TOKEN     '$'
 #define RSP_END_TOKEN       '#'
@@ -28,6 +34,12 @@
 #define RSP_RUNLENGTH_TOKEN '*'
 #define RSP_PACKET_ACK      '+'
 #define RSP_PACKET_NACK     '-'
+#define RSP_NOTIFY_TOKEN    '%'
+#define RSP_INTERRUPT       '\x03'
+
+#define SIGNAL_NONE 0
+#define SIGNAL_INT  2
+#define SIGNAL_TRAP 5
 
 #define THREAD_ID_ALL_THREADS -1
 
@@ -44,6 +56,8 @@ static const unsigned target_csr_list[]{
 #define XREGS_START     0
 #define XREGS_END       (XREGS_START + NUM_XREGS - 1)
 #define PC_REG          (XREGS_END + 1)
+#define RA_REG          (XREGS_START + 1)
+#define SP_REG          (XREGS_START + 2)
 #define TP_REG          (XREGS_START + 4)
 #define FREGS_START     (PC_REG + 1)
 #define FREGS_END       (FREGS_START + NUM_FREGS - 1)
@@ -68,10 +82,27 @@ static enum gdbstub_status g_status             = GDBSTUB_STATUS_NOT_INITIALIZED
 static int                 g_listen_fd          = -1;
 static int                 g_client_fd          = -1;
 static int                 g_cur_general_thread = 1;
-static char*               g_thread_list_xml    = NULL;
+static bool                g_no_ack_mode        = false;
+static bool                g_non_stop           = false;
+static std::string         g_thread_list_xml;
+static std::string         g_memory_map_xml;
 static sys_emu*            g_sys_emu            = nullptr;
 static bemu::Noagent       g_agent(nullptr);
 
+/* Non-stop mode: stop replies not yet acknowledged with vStopped, the front
+ * one is the last notified to the client */
+static std::deque<std::string> g_stop_replies;
+
+/* Packets are received through a buffer instead of a recv() per character */
+static char   g_rx_buf[GDBSTUB_RX_BUFFER_SIZE];
+static size_t g_rx_pos = 0;
+static size_t g_rx_len = 0;
+
+static char    g_packet[GDBSTUB_MAX_PACKET_SIZE + 1];
+static char    g_tx_buf[2 * GDBSTUB_MAX_PACKET_SIZE + 4];
+static char    g_reply[GDBSTUB_MAX_PACKET_SIZE + 1];
+static uint8_t g_memory[GDBSTUB_MAX_PACKET_SIZE];
+
 /** Helper routines ***/
 
 static inline uint64_t bswap64(uint64_t val)
@@ -148,12 +179,8 @@ static inline void u64_to_hexstr_raw(char* str, uint64_t value)
 
 static inline void freg_to_hexstr(char* str, bemu::freg_t freg)
 {
-    char tmp[8 * 2 + 1];
-    str[0] = '\0';
-
     for (unsigned i = 0; i < bemu::VLEN / 64; i++) {
-        u64_to_hexstr(tmp, freg.u64[i]);
-        strcat(str, tmp);
+        u64_to_hexstr(&str[i * 16], freg.u64[i]);
     }
 }
 
@@ -193,14 +220,16 @@ static inline int strsplit(char* str, const char* delimiters, char* tokens[], in
     return n;
 }
 
-static inline char* strconcat(char* dst, const char* suffix)
+static inline bool parse_offset_length(const char* str, unsigned long* offset, unsigned long* length)
 {
-    char*  newstr;
-    size_t dst_len    = strlen(dst);
-    size_t suffix_len = strlen(suffix);
-    newstr            = (char*)realloc((void*)dst, dst_len + suffix_len + 1);
-    strcat(newstr, suffix);
-    return newstr;
+    const char* comma = strchr(str, ',');
+
+    if (!comma)
+        return false;
+
+    *offset = strtoul(str, NULL, 16);
+    *length = strtoul(comma + 1, NULL, 16);
+    return true;
 }
 
 /** Target platform hooks ***/
@@ -222,11 +251,6 @@ static inline int to_gdb_thread(int thread_id)
     return thread_id + 1;
 }
 
-static inline unsigned target_num_threads()
-{
-    return EMU_NUM_THREADS;
-}
-
 /* Returns whether the thread is "physically present" */
 static inline bool target_thread_exists(int thread)
 {
@@ -239,6 +263,35 @@ static inline bool target_thread_is_alive(int thread)
         /* && !g_sys_emu->thread_is_running(to_target_thread(thread)) */;
 }
 
+static inline bool target_thread_is_halted(int thread)
+{
+    return g_sys_emu->thread_is_halted(to_target_thread(thread));
+}
+
+/* Calls fn(thread, shire_id, minion, minion_thread) for each thread that is
+ * simulated and not disabled, in hart ID order. Disabled harts are left out
+ * so that the client does not have to track them on a full chip. */
+template <typename Function>
+static void target_for_each_thread(Function fn)
+{
+    for (unsigned shire = 0; shire < EMU_NUM_SHIRES; shire++) {
+        unsigned minion_count = bemu::shireindex_minions(shire);
+        unsigned thread_count = bemu::shireindex_minionharts(shire);
+        unsigned shire_id     = bemu::shireid(shire);
+
+        for (unsigned minion = 0; minion < minion_count; minion++) {
+            unsigned minion_id = minion + EMU_MINIONS_PER_SHIRE * shire_id;
+
+            for (unsigned thread = 0; thread < thread_count; thread++) {
+                int gdb_thread_id = to_gdb_thread(thread + minion_id * EMU_THREADS_PER_MINION);
+
+                if (target_thread_exists(gdb_thread_id) && target_thread_is_alive(gdb_thread_id))
+                    fn(gdb_thread_id, shire_id, minion, thread);
+            }
+        }
+    }
+}
+
 static bool target_read_memory(int thread, uint64_t addr, uint8_t* buffer, uint64_t size)
 {
     try {
@@ -323,6 +376,12 @@ static void target_continue(int thread)
     g_sys_emu->thread_set_running(to_target_thread(thread));
 }
 
+/* Returns whether the thread was running and is now halted */
+static bool target_halt(int thread)
+{
+    return g_sys_emu->thread_halt(to_target_thread(thread));
+}
+
 static void target_run(int thread, uint64_t start_pc, uint64_t end_pc)
 {
     LOG_GDBSTUB(DEBUG, "run thread %d from 0x%010" PRIx64 " to 0x%010" PRIx64, thread, start_pc, end_pc);
@@ -364,7 +423,20 @@ static void target_remote_command(char* cmd)
 
 static inline ssize_t rsp_get_char(char* ch)
 {
-    return recv(g_client_fd, ch, sizeof(*ch), 0);
+    if (g_rx_pos == g_rx_len) {
+        ssize_t ret = recv(g_client_fd, g_rx_buf, sizeof(g_rx_buf), 0);
+        if (ret <= 0)
+            return (ret < 0) ? ret : -1; /* 0 means the client closed the connection */
+        g_rx_pos = 0;
+        g_rx_len = ret;
+    }
+    *ch = g_rx_buf[g_rx_pos++];
+    return 1;
+}
+
+static inline bool rsp_has_input(void)
+{
+    return g_rx_pos < g_rx_len;
 }
 
 static inline ssize_t rsp_put_char(char ch)
@@ -382,44 +454,45 @@ static inline int rsp_is_token(int ch)
     return (ch == RSP_START_TOKEN || ch == RSP_END_TOKEN || ch == RSP_ESCAPE_TOKEN || ch == RSP_RUNLENGTH_TOKEN);
 }
 
+/* Receives the rest of a packet once its start token has been read. Escaped
+ * characters are unescaped, so the packet can hold binary data; it is also
+ * null terminated for the packets that are plain strings. */
 static ssize_t rsp_receive_packet(char* packet, unsigned int size)
 {
     char         chr;
     char         upper, lower;
     uint8_t      checksum;
-    ssize_t      ret = 0;
-    unsigned int len = 0;
-    unsigned int sum = 0;
+    ssize_t      ret      = 0;
+    unsigned int len      = 0;
+    unsigned int sum      = 0;
+    bool         overflow = false;
 
-    /* Wait until the packet start */
-    do {
-        ret = rsp_get_char(&chr);
-        if (ret < 0)
-            goto failure;
-    } while (chr != RSP_START_TOKEN);
-
-    while (len < size) {
+    while (true) {
         /* Read one character */
         ret = rsp_get_char(&chr);
         if (ret < 0)
             goto failure;
 
-        /* Found escape character, unescape it */
+        /* End of packet */
+        if (chr == RSP_END_TOKEN)
+            break;
+
+        /* The checksum is computed over the escaped data */
+        sum += (uint8_t)chr;
+
+        /* Found escape character, unescape the next one */
         if (chr == RSP_ESCAPE_TOKEN) {
-            sum += chr;
             ret = rsp_get_char(&chr);
             if (ret < 0)
                 goto failure;
-
+            sum += (uint8_t)chr;
             chr ^= RSP_ESCAPE_XOR;
         }
 
-        /* End of packet */
-        if (chr == RSP_END_TOKEN)
-            break;
-
-        sum += chr;
-        packet[len++] = chr;
+        if (len < size)
+            packet[len++] = chr;
+        else
+            overflow = true;
     }
 
     /* Read packet checksum */
@@ -432,57 +505,73 @@ static ssize_t rsp_receive_packet(char* packet, unsigned int size)
 
     /* Checksum is mod 256 of sum of all data */
     checksum = from_hex(upper) << 4 | from_hex(lower);
-    if ((sum & 0xFF) != checksum) {
+    if (!g_no_ack_mode && ((sum & 0xFF) != checksum)) {
         LOG_GDBSTUB(WARN, "read_packet checksum mismatch, "
                           "0x%02X (calc) != 0x%02X (packet)\n",
                     (sum & 0xFF), checksum);
         ret = 0;
         goto failure;
     }
+    if (overflow) {
+        LOG_GDBSTUB(WARN, "read_packet larger than 0x%x bytes", size);
+        ret = 0;
+        goto failure;
+    }
 
     /* Null terminate our string */
     packet[len] = '\0';
-    rsp_put_char(RSP_PACKET_ACK);
+    if (!g_no_ack_mode)
+        rsp_put_char(RSP_PACKET_ACK);
 
     return len;
 
 failure:
-    rsp_put_char(RSP_PACKET_NACK);
+    if (!g_no_ack_mode)
+        rsp_put_char(RSP_PACKET_NACK);
     return ret;
 }
 
-static ssize_t rsp_send_packet_len(const char* packet, size_t len)
+static ssize_t rsp_send_frame(char start, const char* data, size_t len)
 {
-    char         buf[GDBSTUB_MAX_PACKET_SIZE];
     size_t       cnt = 0;
     unsigned int sum = 0;
 
-    LOG_GDBSTUB(DEBUG, "send packet: \"%s\"", packet);
+    if (len > GDBSTUB_MAX_PACKET_SIZE) {
+        LOG_GDBSTUB(WARN, "send packet larger than 0x%x bytes", GDBSTUB_MAX_PACKET_SIZE);
+        return -1;
+    }
 
     /* Write the start token */
-    buf[cnt++] = RSP_START_TOKEN;
+    g_tx_buf[cnt++] = start;
 
     for (size_t i = 0; i < len; i++) {
-        char chr = packet[i];
+        char chr = data[i];
 
         /* Check for any reserved tokens */
         if (rsp_is_token(chr)) {
-            buf[cnt++] = RSP_ESCAPE_TOKEN;
+            g_tx_buf[cnt++] = RSP_ESCAPE_TOKEN;
             sum += RSP_ESCAPE_TOKEN;
             chr ^= RSP_ESCAPE_XOR;
         }
 
-        buf[cnt++] = chr;
-        sum += chr;
+        g_tx_buf[cnt++] = chr;
+        sum += (uint8_t)chr;
     }
 
     /* Done with data, now end + checksum (mod 256) */
     sum &= 0xFF;
-    buf[cnt++] = RSP_END_TOKEN;
-    buf[cnt++] = to_hex((sum >> 4) & 0xF);
-    buf[cnt++] = to_hex(sum & 0xF);
+    g_tx_buf[cnt++] = RSP_END_TOKEN;
+    g_tx_buf[cnt++] = to_hex((sum >> 4) & 0xF);
+    g_tx_buf[cnt++] = to_hex(sum & 0xF);
 
-    return rsp_put_buffer(buf, cnt);
+    return rsp_put_buffer(g_tx_buf, cnt);
+}
+
+static ssize_t rsp_send_packet_len(const char* packet, size_t len)
+{
+    LOG_GDBSTUB(DEBUG, "send packet: \"%.*s\"", (int)len, packet);
+
+    return rsp_send_frame(RSP_START_TOKEN, packet, len);
 }
 
 static inline ssize_t rsp_send_packet(const char* packet)
@@ -490,6 +579,17 @@ static inline ssize_t rsp_send_packet(const char* packet)
     return rsp_send_packet_len(packet, strlen(packet));
 }
 
+/* Asynchronous notification, the client does not acknowledge them */
+static ssize_t rsp_send_notification(const char* name, const char* data)
+{
+    char buffer[256];
+    int  len = snprintf(buffer, sizeof(buffer), "%s:%s", name, data);
+
+    LOG_GDBSTUB(DEBUG, "send notification: \"%s\"", buffer);
+
+    return rsp_send_frame(RSP_NOTIFY_TOKEN, buffer, len);
+}
+
 static int rsp_is_query_packet(const char* p, const char* query, char separator)
 {
     unsigned int query_len = strlen(query);
@@ -500,12 +600,13 @@ static int rsp_is_query_packet(const char* p, const char* query, char separator)
 
 static void gdbstub_handle_qsupported(void)
 {
-    char reply[GDBSTUB_MAX_PACKET_SIZE + 1];
+    char reply[256];
 
     LOG_GDBSTUB(DEBUG, "%s", "handle qSupported");
 
     snprintf(reply, sizeof(reply),
-             "PacketSize=%x;qXfer:features:read+;qXfer:threads:read+;vContSupported+;hwbreak+",
+             "PacketSize=%x;qXfer:features:read+;qXfer:threads:read+;qXfer:memory-map:read+;"
+             "vContSupported+;hwbreak+;binary-upload+;QStartNoAckMode+;QNonStop+",
              GDBSTUB_MAX_PACKET_SIZE);
 
     rsp_send_packet(reply);
@@ -515,7 +616,6 @@ static ssize_t gdbstub_qxfer_send_object(const char* object, size_t object_size,
                                          unsigned long offset, unsigned long length)
 {
     char resp;
-    char reply[GDBSTUB_MAX_PACKET_SIZE + 2];
 
     if (offset == object_size) { /* Offset at the end, no more data to be read */
         rsp_send_packet("l");
@@ -534,21 +634,25 @@ static ssize_t gdbstub_qxfer_send_object(const char* object, size_t object_size,
         resp = 'm'; /* More data to be read */
     }
 
-    if (length > GDBSTUB_MAX_PACKET_SIZE) {
-        length = GDBSTUB_MAX_PACKET_SIZE;
+    if (length > GDBSTUB_MAX_PACKET_SIZE - 1) {
+        length = GDBSTUB_MAX_PACKET_SIZE - 1;
+        resp   = 'm';
     }
-    reply[0] = resp;
-    strncpy(&reply[1], object + offset, length);
-    reply[length + 1] = '\0';
-    return rsp_send_packet_len(reply, length + 1);
+    g_reply[0] = resp;
+    memcpy(&g_reply[1], object + offset, length);
+    return rsp_send_packet_len(g_reply, length + 1);
 }
 
 static void gdbstub_handle_qxfer_features_read(const char* annex, const char* offset_length)
 {
     const char*   annex_data = NULL;
     size_t        annex_size;
-    unsigned long offset = strtoul(offset_length, NULL, 16);
-    unsigned long length = strtoul(strchr(offset_length, ',') + 1, NULL, 16);
+    unsigned long offset, length;
+
+    if (!parse_offset_length(offset_length, &offset, &length)) {
+        rsp_send_packet("E16"); /* EINVAL */
+        return;
+    }
 
     LOG_GDBSTUB(DEBUG, "handle qXfer:features:read annex: %s, offset: 0x%lx, size: 0x%lx",
                 annex, offset, length);
@@ -586,43 +690,6 @@ static void gdbstub_handle_qxfer_threads(char* tokens[], int ntokens)
 {
     unsigned long offset, length;
 
-    /* Generate the list */
-    if (g_thread_list_xml == NULL) {
-        g_thread_list_xml    = (char*)malloc(1);
-        g_thread_list_xml[0] = '\0';
-
-        g_thread_list_xml = strconcat(g_thread_list_xml,
-                                      "<?xml version=\"1.0\"?>\n"
-                                      "<!DOCTYPE threads SYSTEM \"threads.dtd\">\n"
-                                      "<threads>\n");
-
-        for (unsigned shire = 0; shire < EMU_NUM_SHIRES; shire++) {
-            unsigned minion_count = bemu::shireindex_minions(shire);
-            unsigned thread_count = bemu::shireindex_minionharts(shire);
-            unsigned shire_id     = bemu::shireid(shire);
-
-            for (unsigned minion = 0; minion < minion_count; minion++) {
-                unsigned minion_id = minion + EMU_MINIONS_PER_SHIRE * shire_id;
-
-                for (unsigned thread = 0; thread < thread_count; thread++) {
-                    unsigned thread_id     = thread + minion_id * EMU_THREADS_PER_MINION;
-                    bool     is_sp         = bemu::hartid_is_svcproc(thread_id);
-                    unsigned gdb_thread_id = to_gdb_thread(thread_id);
-
-                    if (target_thread_exists(gdb_thread_id)) {
-                        char desc[512];
-                        snprintf(desc, sizeof(desc),
-                                 "    <thread id=\"%X\" core=\"%d\" name=\"S%d:M%d:T%d%s\"></thread>\n",
-                                 gdb_thread_id, minion_id, shire_id, minion, thread, is_sp ? " (SP)" : "");
-                        g_thread_list_xml = strconcat(g_thread_list_xml, desc);
-                    }
-                }
-            }
-        }
-
-        g_thread_list_xml = strconcat(g_thread_list_xml, "</threads>");
-    }
-
     if (ntokens < 4) {
         rsp_send_packet("");
         return;
@@ -634,10 +701,71 @@ static void gdbstub_handle_qxfer_threads(char* tokens[], int ntokens)
         return;
     }
 
-    offset = strtoul(tokens[3], NULL, 16);
-    length = strtoul(strchr(tokens[3], ',') + 1, NULL, 16);
+    if (!parse_offset_length(tokens[3], &offset, &length)) {
+        rsp_send_packet("E16"); /* EINVAL */
+        return;
+    }
+
+    /* Generate the list when the client starts reading it, harts may have
+     * been enabled or disabled since the previous read */
+    if (offset == 0 || g_thread_list_xml.empty()) {
+        g_thread_list_xml = "<?xml version=\"1.0\"?>\n"
+                            "<!DOCTYPE threads SYSTEM \"threads.dtd\">\n"
+                            "<threads>\n";
+
+        target_for_each_thread([](int gdb_thread_id, unsigned shire_id, unsigned minion, unsigned thread) {
+            unsigned minion_id = minion + EMU_MINIONS_PER_SHIRE * shire_id;
+            bool     is_sp     = bemu::hartid_is_svcproc(thread + minion_id * EMU_THREADS_PER_MINION);
+            char     desc[512];
+            snprintf(desc, sizeof(desc),
+                     "    <thread id=\"%X\" core=\"%d\" name=\"S%d:M%d:T%d%s\"></thread>\n",
+                     gdb_thread_id, minion_id, shire_id, minion, thread, is_sp ? " (SP)" : "");
+            g_thread_list_xml += desc;
+        });
+
+        g_thread_list_xml += "</threads>";
+    }
+
+    gdbstub_qxfer_send_object(g_thread_list_xml.data(), g_thread_list_xml.size(), offset, length);
+}
+
+static void gdbstub_handle_qxfer_memory_map(char* tokens[], int ntokens)
+{
+    unsigned long offset, length;
+
+    if (ntokens < 4 || strcmp(tokens[2], "read")) {
+        rsp_send_packet("");
+        return;
+    }
+
+    if (!parse_offset_length(tokens[3], &offset, &length)) {
+        rsp_send_packet("E16"); /* EINVAL */
+        return;
+    }
+
+    /* Only the RAM and ROM ranges are listed, so that the client neither
+     * caches nor probes the device registers and the holes of the address
+     * map. Generate the map when the client starts reading it, it belongs to
+     * the system this stub was initialized with */
+    if (offset == 0 || g_memory_map_xml.empty()) {
+        g_memory_map_xml = "<?xml version=\"1.0\"?>\n"
+                           "<!DOCTYPE memory-map PUBLIC \"+//IDN gnu.org//DTD GDB Memory Map V1.0//EN\" "
+                           "\"http://sourceware.org/gdb/gdb-memory-map.dtd\">\n"
+                           "<memory-map>\n";
+
+        for (const auto& range : g_sys_emu->get_memory().memory_ranges()) {
+            char desc[128];
+            snprintf(desc, sizeof(desc),
+                     "    <memory type=\"%s\" start=\"0x%" PRIx64 "\" length=\"0x%" PRIx64 "\"/>\n",
+                     range.writable ? "ram" : "rom", uint64_t(range.first),
+                     uint64_t(range.last - range.first + 1));
+            g_memory_map_xml += desc;
+        }
 
-    gdbstub_qxfer_send_object(g_thread_list_xml, strlen(g_thread_list_xml), offset, length);
+        g_memory_map_xml += "</memory-map>";
+    }
+
+    gdbstub_qxfer_send_object(g_memory_map_xml.data(), g_memory_map_xml.size(), offset, length);
 }
 
 static void gdbstub_handle_qxfer(char* packet)
@@ -654,6 +782,8 @@ static void gdbstub_handle_qxfer(char* packet)
         gdbstub_handle_qxfer_features(tokens, ntokens);
     else if (strcmp(tokens[1], "threads") == 0)
         gdbstub_handle_qxfer_threads(tokens, ntokens);
+    else if (strcmp(tokens[1], "memory-map") == 0)
+        gdbstub_handle_qxfer_memory_map(tokens, ntokens);
     else
         rsp_send_packet("");
 }
@@ -706,35 +836,32 @@ static void gdbstub_handle_qgettlsaddr(char* packet)
 
 static void gdbstub_handle_read_general_registers(void)
 {
-    char reply[((NUM_XREGS + 1) * 8 + NUM_FREGS * 32 + NUM_CSR_FREGS * 4) * 2 + 1];
-    char tmp[(bemu::VLEN / 8) * 2 + 1];
-    reply[0] = '\0';
+    char  reply[((NUM_XREGS + 1) * 8 + NUM_FREGS * (bemu::VLEN / 8) + NUM_CSR_FREGS * 4) * 2 + 1];
+    char* p = reply;
 
     /* General purpose registers */
-    for (int i = 0; i < NUM_XREGS; i++) {
-        u64_to_hexstr(tmp, target_read_register(g_cur_general_thread, i));
-        strcat(reply, tmp);
+    for (int i = 0; i < NUM_XREGS; i++, p += 16) {
+        u64_to_hexstr(p, target_read_register(g_cur_general_thread, i));
     }
 
     /* PC */
-    u64_to_hexstr(tmp, target_read_pc(g_cur_general_thread));
-    strcat(reply, tmp);
+    u64_to_hexstr(p, target_read_pc(g_cur_general_thread));
+    p += 16;
 
     /* Floating-point vector registers */
-    for (int i = 0; i < NUM_FREGS; i++) {
-        freg_to_hexstr(tmp, target_read_fregister(g_cur_general_thread, i));
-        strcat(reply, tmp);
+    for (int i = 0; i < NUM_FREGS; i++, p += bemu::VLEN / 4) {
+        freg_to_hexstr(p, target_read_fregister(g_cur_general_thread, i));
     }
 
     /* Floating-point related CSRs */
-    u32_to_hexstr(tmp, (uint32_t)target_read_csr(g_cur_general_thread, bemu::CSR_FFLAGS));
-    strcat(reply, tmp);
-    u32_to_hexstr(tmp, (uint32_t)target_read_csr(g_cur_general_thread, bemu::CSR_FRM));
-    strcat(reply, tmp);
-    u32_to_hexstr(tmp, (uint32_t)target_read_csr(g_cur_general_thread, bemu::CSR_FCSR));
-    strcat(reply, tmp);
+    u32_to_hexstr(p, (uint32_t)target_read_csr(g_cur_general_thread, bemu::CSR_FFLAGS));
+    p += 8;
+    u32_to_hexstr(p, (uint32_t)target_read_csr(g_cur_general_thread, bemu::CSR_FRM));
+    p += 8;
+    u32_to_hexstr(p, (uint32_t)target_read_csr(g_cur_general_thread, bemu::CSR_FCSR));
+    p += 8;
 
-    rsp_send_packet(reply);
+    rsp_send_packet_len(reply, p - reply);
 }
 
 static void gdbstub_handle_read_register(const char* packet)
@@ -837,7 +964,7 @@ static void gdbstub_handle_query_thread(void)
 
 static void gdbstub_handle_qrcmd(const char* packet)
 {
-    char        cmd[GDBSTUB_MAX_PACKET_SIZE + 1];
+    static char cmd[GDBSTUB_MAX_PACKET_SIZE / 2 + 1];
     const char* cmd_hex = strchr(packet, ',');
 
     if (!cmd_hex) {
@@ -864,7 +991,102 @@ static void gdbstub_handle_thread_alive(const char* packet)
         rsp_send_packet("E00");
 }
 
-static inline void gdbstub_handle_vcont_action(char* action, int thread)
+/* Stop reply with the PC, SP and RA of the thread, so that the client does
+ * not have to read them one by one after every stop */
+static void gdbstub_stop_reply(char* buffer, size_t size, int signal, int thread)
+{
+    char pc[17], sp[17], ra[17];
+
+    u64_to_hexstr(pc, target_read_pc(thread));
+    u64_to_hexstr(sp, target_read_register(thread, SP_REG));
+    u64_to_hexstr(ra, target_read_register(thread, RA_REG));
+    snprintf(buffer, size, "T%02Xthread:%02X;%02x:%s;%02x:%s;%02x:%s;",
+             signal, thread, PC_REG, pc, SP_REG, sp, RA_REG, ra);
+}
+
+/* In all-stop mode the stop reply answers the pending vCont. In non-stop mode
+ * it is queued and notified, the client drains the queue with vStopped. */
+static void gdbstub_report_stop(int signal, int thread)
+{
+    char reply[128];
+
+    gdbstub_stop_reply(reply, sizeof(reply), signal, thread);
+
+    if (!g_non_stop) {
+        rsp_send_packet(reply);
+        /*
+         * "Whenever GDB stops your program, due to a breakpoint or a signal,
+         * it automatically selects the thread where that breakpoint or signal happened."
+         */
+        g_cur_general_thread = thread;
+        return;
+    }
+
+    g_stop_replies.emplace_back(reply);
+    if (g_stop_replies.size() == 1)
+        rsp_send_notification("Stop", reply);
+}
+
+static void gdbstub_handle_halt_reason(void)
+{
+    char reply[128];
+
+    LOG_GDBSTUB(DEBUG, "%s", "handle halt reason");
+
+    if (!g_non_stop) {
+        gdbstub_stop_reply(reply, sizeof(reply), SIGNAL_TRAP, g_cur_general_thread);
+        rsp_send_packet(reply);
+        return;
+    }
+
+    /* Non-stop mode: one stop reply per halted thread, the first one is the
+     * reply to this packet and the rest are read with vStopped */
+    g_stop_replies.clear();
+    target_for_each_thread([&reply](int thread, unsigned, unsigned, unsigned) {
+        if (target_thread_is_halted(thread)) {
+            gdbstub_stop_reply(reply, sizeof(reply), SIGNAL_NONE, thread);
+            g_stop_replies.emplace_back(reply);
+        }
+    });
+
+    rsp_send_packet(g_stop_replies.empty() ? "OK" : g_stop_replies.front().c_str());
+}
+
+static void gdbstub_handle_vstopped(void)
+{
+    LOG_GDBSTUB(DEBUG, "%s", "handle vStopped");
+
+    /* The front stop reply has been acknowledged */
+    if (!g_stop_replies.empty())
+        g_stop_replies.pop_front();
+
+    rsp_send_packet(g_stop_replies.empty() ? "OK" : g_stop_replies.front().c_str());
+}
+
+/* Stops all the threads, after a Ctrl-C in all-stop mode or vCtrlC in
+ * non-stop mode */
+static void gdbstub_handle_interrupt(void)
+{
+    std::vector<int> halted;
+
+    LOG_GDBSTUB(DEBUG, "%s", "handle interrupt");
+
+    target_for_each_thread([&halted](int thread, unsigned, unsigned, unsigned) {
+        if (target_halt(thread))
+            halted.push_back(thread);
+    });
+
+    if (!g_non_stop) {
+        gdbstub_report_stop(SIGNAL_INT, g_cur_general_thread);
+        return;
+    }
+
+    rsp_send_packet("OK");
+    for (int thread : halted)
+        gdbstub_report_stop(SIGNAL_INT, thread);
+}
+
+static inline void gdbstub_handle_vcont_action(char* action, int thread, std::vector<int>& halted)
 {
     if (target_thread_exists(thread)) {
         switch (action[0]) {
@@ -882,6 +1104,10 @@ static inline void gdbstub_handle_vcont_action(char* action, int thread)
             target_run(thread, start_pc, end_pc);
             break;
         }
+        case 't':
+            if (target_halt(thread))
+                halted.push_back(thread);
+            break;
         default:
             break;
         }
@@ -890,11 +1116,13 @@ static inline void gdbstub_handle_vcont_action(char* action, int thread)
 
 static void gdbstub_handle_vcont(char* packet)
 {
-    char* action;
+    char*                   action;
+    std::unordered_set<int> handled;
+    std::vector<int>        halted;
 
     LOG_GDBSTUB(DEBUG, "%s", "handle vCont");
 
-    /* For each action */
+    /* For each action, a thread takes the leftmost action that matches it */
     action = strtok(packet + 5, ";");
     while (action != NULL) {
         int thread = THREAD_ID_ALL_THREADS;
@@ -908,18 +1136,26 @@ static void gdbstub_handle_vcont(char* packet)
         LOG_GDBSTUB(DEBUG, "vCont action %s, thread: %d", action, thread);
 
         if (thread == THREAD_ID_ALL_THREADS) {
-            for (unsigned id = 1; id <= target_num_threads(); id++) {
-                gdbstub_handle_vcont_action(action, id);
-            }
+            target_for_each_thread([&](int id, unsigned, unsigned, unsigned) {
+                if (handled.insert(id).second)
+                    gdbstub_handle_vcont_action(action, id, halted);
+            });
         }
-        else {
-            gdbstub_handle_vcont_action(action, thread);
+        else if (handled.insert(thread).second) {
+            gdbstub_handle_vcont_action(action, thread, halted);
         }
 
         action = strtok(NULL, ";");
     }
 
-    /* The response is sent when something (such a breakpoint) happens */
+    /* In all-stop mode the response is sent when something (such a
+     * breakpoint) happens. In non-stop mode vCont is acknowledged now, and
+     * the stops are notified. */
+    if (g_non_stop) {
+        rsp_send_packet("OK");
+        for (int thread : halted)
+            gdbstub_report_stop(SIGNAL_NONE, thread);
+    }
 }
 
 static bool parse_breakpoint(char* packet, char* type, uint64_t* addr, uint64_t* kind)
@@ -1004,57 +1240,117 @@ static void gdbstub_handle_breakpoint_remove(char* packet)
     }
 }
 
+static bool parse_memory_range(const char* packet, char** p, uint64_t* addr, uint64_t* length)
+{
+    *addr = strtoull(packet + 1, p, 16);
+    if (**p != ',')
+        return false;
+    *length = strtoull(*p + 1, p, 16);
+    return true;
+}
+
 static void gdbstub_handle_read_memory(const char* packet)
 {
     char*    p;
     uint64_t addr, length;
-    uint8_t  data[GDBSTUB_MAX_PACKET_SIZE / 2];
-    char     send[2 * sizeof(data) + 1];
 
-    addr = strtoull(packet + 1, &p, 16);
-    if (*p == ',')
-        p++;
-    length = strtoull(p, NULL, 16);
+    if (!parse_memory_range(packet, &p, &addr, &length)) {
+        rsp_send_packet("E01");
+        return;
+    }
 
     LOG_GDBSTUB(DEBUG, "read memory: from 0x%" PRIx64 ", size 0x%" PRIx64, addr, length);
 
-    if (!target_read_memory(g_cur_general_thread, addr, data, length))
+    /* The client reads the rest in later packets */
+    length = std::min<uint64_t>(length, GDBSTUB_MAX_PACKET_SIZE / 2);
+
+    if (!target_read_memory(g_cur_general_thread, addr, g_memory, length)) {
         rsp_send_packet("E01");
+        return;
+    }
 
-    memtohex(send, data, length);
+    memtohex(g_reply, g_memory, length);
 
-    rsp_send_packet(send);
+    rsp_send_packet_len(g_reply, 2 * length);
 }
 
-static void gdbstub_handle_write_memory(const char* packet)
+static void gdbstub_handle_write_memory(const char* packet, size_t len)
 {
     char*    p;
     uint64_t addr, length;
-    uint8_t  data[GDBSTUB_MAX_PACKET_SIZE / 2];
 
-    addr = strtoull(packet + 1, &p, 16);
-    if (*p == ',')
-        p++;
-    length = strtoull(p, &p, 16);
+    if (!parse_memory_range(packet, &p, &addr, &length) || (*p != ':') ||
+        (length > (len - (p + 1 - packet)) / 2)) {
+        rsp_send_packet("E01");
+        return;
+    }
 
     LOG_GDBSTUB(DEBUG, "write memory: from 0x%" PRIx64 ", size 0x%" PRIx64, addr, length);
 
-    hextomem(data, p, length);
+    hextomem(g_memory, p + 1, length);
+
+    if (!target_write_memory(g_cur_general_thread, addr, g_memory, length)) {
+        rsp_send_packet("E01");
+        return;
+    }
+
+    rsp_send_packet("OK");
+}
+
+static void gdbstub_handle_read_memory_binary(const char* packet)
+{
+    char*    p;
+    uint64_t addr, length;
+
+    if (!parse_memory_range(packet, &p, &addr, &length)) {
+        rsp_send_packet("E01");
+        return;
+    }
+
+    LOG_GDBSTUB(DEBUG, "read memory binary: from 0x%" PRIx64 ", size 0x%" PRIx64, addr, length);
+
+    /* The client reads the rest in later packets */
+    length = std::min<uint64_t>(length, GDBSTUB_MAX_PACKET_SIZE - 1);
+
+    if (!target_read_memory(g_cur_general_thread, addr, (uint8_t*)&g_reply[1], length)) {
+        rsp_send_packet("E01");
+        return;
+    }
+
+    g_reply[0] = 'b';
+    rsp_send_packet_len(g_reply, length + 1);
+}
+
+static void gdbstub_handle_write_memory_binary(const char* packet, size_t len)
+{
+    char*    p;
+    uint64_t addr, length;
+
+    if (!parse_memory_range(packet, &p, &addr, &length) || (*p != ':') ||
+        (length > len - (p + 1 - packet))) {
+        rsp_send_packet("E01");
+        return;
+    }
+
+    LOG_GDBSTUB(DEBUG, "write memory binary: from 0x%" PRIx64 ", size 0x%" PRIx64, addr, length);
 
-    if (!target_write_memory(g_cur_general_thread, addr, data, length))
+    /* A zero length write probes for the packet support */
+    if (length && !target_write_memory(g_cur_general_thread, addr, (const uint8_t*)(p + 1), length)) {
         rsp_send_packet("E01");
+        return;
+    }
 
     rsp_send_packet("OK");
 }
 
-static int gdbstub_handle_packet(char* packet)
+static int gdbstub_handle_packet(char* packet, size_t len)
 {
     switch (packet[0]) {
     case '!': /* Enable extended mode */
         rsp_send_packet("OK");
         break;
     case '?': /* Halt reason */
-        rsp_send_packet("S05"); /* SIGTRAP */
+        gdbstub_handle_halt_reason();
         break;
     case 'c': /* Continue */
         /* We support vCont, this is deprecated */
@@ -1077,7 +1373,7 @@ static int gdbstub_handle_packet(char* packet)
         gdbstub_handle_read_memory(packet);
         break;
     case 'M': /* Write memory */
-        gdbstub_handle_write_memory(packet);
+        gdbstub_handle_write_memory(packet, len);
         break;
     case 'p': /* Read register */
         gdbstub_handle_read_register(packet);
@@ -1106,7 +1402,18 @@ static int gdbstub_handle_packet(char* packet)
             rsp_send_packet("");
         break;
     case 'Q': /* General set */
-        rsp_send_packet("");
+        if (strcmp(packet, "QStartNoAckMode") == 0) {
+            rsp_send_packet("OK");
+            g_no_ack_mode = true;
+        }
+        else if (strncmp(packet, "QNonStop:", 9) == 0) {
+            g_non_stop = (packet[9] == '1');
+            g_stop_replies.clear();
+            rsp_send_packet("OK");
+        }
+        else {
+            rsp_send_packet("");
+        }
         break;
     case 's': /* Single step */
         /* We support vCont, this is deprecated */
@@ -1118,14 +1425,26 @@ static int gdbstub_handle_packet(char* packet)
     case 'v': /* Multi-letter name packet */
         if (strncmp(packet, "vCont", 5) == 0) {
             if (packet[5] == '?')
-                rsp_send_packet("vCont;c;C;s;S;r");
+                rsp_send_packet("vCont;c;C;s;S;t;r");
             else
                 gdbstub_handle_vcont(packet);
         }
+        else if (strcmp(packet, "vStopped") == 0) {
+            gdbstub_handle_vstopped();
+        }
+        else if (strcmp(packet, "vCtrlC") == 0) {
+            gdbstub_handle_interrupt();
+        }
         else {
             rsp_send_packet("");
         }
         break;
+    case 'x': /* Read memory (binary) */
+        gdbstub_handle_read_memory_binary(packet);
+        break;
+    case 'X': /* Write memory (binary) */
+        gdbstub_handle_write_memory_binary(packet, len);
+        break;
     case 'z': /* Remove breakpoint */
         gdbstub_handle_breakpoint_remove(packet);
         break;
@@ -1268,6 +1587,12 @@ int gdbstub_close_client()
     close(g_client_fd);
     g_client_fd = -1;
 
+    g_rx_pos        = 0;
+    g_rx_len        = 0;
+    g_no_ack_mode   = false;
+    g_non_stop      = false;
+    g_stop_replies.clear();
+
     LOG_GDBSTUB(INFO, "%s", "Client connection closed");
 
     g_status = GDBSTUB_STATUS_WAITING_CLIENT;
@@ -1286,10 +1611,8 @@ void gdbstub_fini()
 
     (void)gdbstub_close_client();
 
-    if (g_thread_list_xml) {
-        free(g_thread_list_xml);
-        g_thread_list_xml = NULL;
-    }
+    g_thread_list_xml.clear();
+    g_memory_map_xml.clear();
 
     g_status  = GDBSTUB_STATUS_NOT_INITIALIZED;
     g_sys_emu = nullptr;
@@ -1299,21 +1622,33 @@ int gdbstub_io()
 {
     ssize_t       ret;
     struct pollfd pollfd;
-    char          packet[GDBSTUB_MAX_PACKET_SIZE + 1];
+    char          chr;
 
     if (g_status != GDBSTUB_STATUS_RUNNING)
         return -1;
 
-    memset(&pollfd, 0, sizeof(pollfd));
-    pollfd.fd     = g_client_fd;
-    pollfd.events = POLLIN;
+    if (!rsp_has_input()) {
+        memset(&pollfd, 0, sizeof(pollfd));
+        pollfd.fd     = g_client_fd;
+        pollfd.events = POLLIN;
 
-    /* Return immediately */
-    ret = poll(&pollfd, 1, 0);
-    if (ret <= 0)
-        return ret;
+        /* Return immediately */
+        ret = poll(&pollfd, 1, 0);
+        if (ret <= 0)
+            return ret;
+    }
 
-    ret = rsp_receive_packet(packet, sizeof(packet) - 1);
+    ret = rsp_get_char(&chr);
+    if (ret >= 0) {
+        if (chr == RSP_INTERRUPT) {
+            gdbstub_handle_interrupt();
+            return 0;
+        }
+        /* Skip the acknowledgments until the next packet */
+        if (chr != RSP_START_TOKEN)
+            return 0;
+        ret = rsp_receive_packet(g_packet, sizeof(g_packet) - 1);
+    }
     if (ret < 0) {
         LOG_GDBSTUB(WARN, "RSP: error receiving packet: %s",
                     strerror(ret));
@@ -1324,26 +1659,19 @@ int gdbstub_io()
         return 0;
     }
 
-    LOG_GDBSTUB(DEBUG, "recv packet: \"%s\"", packet);
+    LOG_GDBSTUB(DEBUG, "recv packet: \"%.*s\"", (int)ret, g_packet);
 
-    return gdbstub_handle_packet(packet);
+    return gdbstub_handle_packet(g_packet, ret);
 }
 
 void gdbstub_signal_break(int thread)
 {
-    const int signal = 5;
-    char      buffer[32];
-    int       len;
-    int       gdb_thread = to_gdb_thread(thread);
-
-    len = snprintf(buffer, sizeof(buffer), "T%02Xthread:%02X;", signal, gdb_thread);
-    rsp_send_packet_len(buffer, len);
+    gdbstub_report_stop(SIGNAL_TRAP, to_gdb_thread(thread));
+}
 
-    /*
-     * "Whenever GDB stops your program, due to a breakpoint or a signal,
-     * it automatically selects the thread where that breakpoint or signal happened."
-     */
-    g_cur_general_thread = gdb_thread;
+bool gdbstub_non_stop()
+{
+    return g_non_stop;
 }
 
 enum gdbstub_status gdbstub_get_status()
@@ -21,6 +21,7 @@ int gdbstub_close_client();
 void gdbstub_fini();
 int gdbstub_io();
 void gdbstub_signal_break(int thread);
+bool gdbstub_non_stop();
 enum gdbstub_status gdbstub_get_status();
 
 #endif
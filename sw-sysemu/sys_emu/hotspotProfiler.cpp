@@ -0,0 +1,205 @@
+/*-------------------------------------------------------------------------
+* Copyright (c) 2025 Ainekko, Co.
+* SPDX-License-Identifier: Apache-2.0
+*-------------------------------------------------------------------------*/
+
+#include <algorithm>
+#include <cinttypes>
+#include <cstdio>
+#include <stdexcept>
+
+#include "elfio/elfio.hpp"
+#include "hotspotProfiler.h"
+#include "processor.h"
+
+hotspotProfiler::hotspotProfiler(uint64_t interval)
+    : interval_(std::max<uint64_t>(interval, 1)),
+      counters_(EMU_NUM_NEIGHS),
+      slotHits_(EMU_NUM_NEIGHS * EMU_THREADS_PER_MINION, 0)
+{
+    symbols_.push_back(symbol{0, 0, "[unknown]", "[unknown]"});
+}
+
+bool hotspotProfiler::loadSymbols(std::istream& image, const std::string& dso)
+{
+    ELFIO::elfio elf;
+    if (!elf.load(image)) {
+        return false;
+    }
+
+    for (ELFIO::section* sec : elf.sections) {
+        if (sec->get_type() != SHT_SYMTAB) {
+            continue;
+        }
+        ELFIO::symbol_section_accessor symtab(elf, sec);
+        for (ELFIO::Elf_Xword i = 0; i < symtab.get_symbols_num(); ++i) {
+            std::string name;
+            ELFIO::Elf64_Addr value;
+            ELFIO::Elf_Xword size;
+            unsigned char bind, type, other;
+            ELFIO::Elf_Half shndx;
+            if (!symtab.get_symbol(i, name, value, size, bind, type, shndx, other)) {
+                continue;
+            }
+            // Functions, and labels of hand written assembly, in code sections
+            if ((type != STT_FUNC) && (type != STT_NOTYPE)) {
+                continue;
+            }
+            if ((shndx == SHN_UNDEF) || (shndx >= elf.sections.size())
+                || !(elf.sections[shndx]->get_flags() & SHF_EXECINSTR)) {
+                continue;
+            }
+            if (name.empty() || (name[0] == '$') || (name.compare(0, 2, ".L") == 0)) {
+                continue;
+            }
+            symbols_.push_back(symbol{value, value + size, name, dso});
+        }
+    }
+    sorted_ = false;
+    return true;
+}
+
+void hotspotProfiler::setPerfOutput(const std::string& path)
+{
+    perf_.open(path);
+    if (!perf_.is_open()) {
+        throw std::runtime_error("Unable to open profiler output file: " + path);
+    }
+}
+
+void hotspotProfiler::sortSymbols()
+{
+    // The [unknown] entry stays first
+    std::stable_sort(symbols_.begin() + 1, symbols_.end(), [](const symbol& a, const symbol& b) {
+        return a.start < b.start;
+    });
+    // Symbols without a size extend up to the next one
+    for (size_t i = 1; i < symbols_.size(); ++i) {
+        if (symbols_[i].end > symbols_[i].start) {
+            continue;
+        }
+        size_t next = i + 1;
+        while ((next < symbols_.size()) && (symbols_[next].start == symbols_[i].start)) {
+            ++next;
+        }
+        symbols_[i].end = (next < symbols_.size()) ? symbols_[next].start : symbols_[i].start + 4;
+    }
+    stats_.assign(symbols_.size(), stats{});
+    sorted_ = true;
+}
+
+size_t hotspotProfiler::lookup(uint64_t pc) const
+{
+    auto it = std::upper_bound(symbols_.begin() + 1, symbols_.end(), pc, [](uint64_t addr, const symbol& sym) {
+        return addr < sym.start;
+    });
+    // Nested or aliased symbols: pick the closest one that contains the PC
+    while (it != symbols_.begin() + 1) {
+        --it;
+        if (pc < it->end) {
+            return it - symbols_.begin();
+        }
+        if (pc - it->start > (1ull << 24)) {
+            break;
+        }
+    }
+    return 0;
+}
+
+void hotspotProfiler::sample(const bemu::System& chip, uint64_t cycle)
+{
+    nextSample_ = cycle + interval_;
+    if (!sorted_) {
+        sortSymbols();
+    }
+
+    hits_.clear();
+    for (const auto& cpu : chip.active) {
+        if (cpu.pending_unlink || cpu.is_waiting() || cpu.is_halted()) {
+            continue;
+        }
+        size_t sym = lookup(cpu.pc);
+        unsigned slot = bemu::neigh_index(cpu) * EMU_THREADS_PER_MINION + bemu::index_in_core(cpu);
+        hits_.push_back(hit{slot, sym});
+        ++slotHits_[slot];
+        ++stats_[sym].samples;
+        ++totalSamples_;
+        if (perf_.is_open()) {
+            writePerfSample(cpu, cycle, sym);
+        }
+    }
+
+    // Split the counter increments among the harts sampled on each slot
+    for (const auto& h : hits_) {
+        unsigned neigh = h.slot / EMU_THREADS_PER_MINION;
+        unsigned thread = h.slot % EMU_THREADS_PER_MINION;
+        for (size_t i = 0; i < kNumCounters; ++i) {
+            uint64_t value = chip.neigh_pmu_counters[neigh][i][thread];
+            uint64_t last = counters_[neigh][i][thread];
+            // Counters written by software restart the count
+            uint64_t delta = (value >= last) ? value - last : value;
+            stats_[h.symbol].events[i] += double(delta) / slotHits_[h.slot];
+        }
+    }
+    for (const auto& h : hits_) {
+        slotHits_[h.slot] = 0;
+    }
+    std::copy(chip.neigh_pmu_counters.begin(), chip.neigh_pmu_counters.end(), counters_.begin());
+}
+
+void hotspotProfiler::writePerfSample(const bemu::Hart& cpu, uint64_t cycle, size_t sym)
+{
+    // "comm pid/tid [cpu] time: period event:" followed by the call chain.
+    // Cycles are reported as nanoseconds.
+    unsigned hart = bemu::hart_index(cpu);
+    char line[256];
+    std::snprintf(line, sizeof(line), "H%u %u/%u [%03u] %" PRIu64 ".%09" PRIu64 ": %" PRIu64 " cycles:\n\t%16" PRIx64 " ",
+                  hart, hart, hart, bemu::shire_index(cpu), cycle / 1000000000, cycle % 1000000000, interval_, cpu.pc);
+    perf_ << line << symbols_[sym].name;
+    if (sym != 0) {
+        std::snprintf(line, sizeof(line), "+0x%" PRIx64, cpu.pc - symbols_[sym].start);
+        perf_ << line;
+    }
+    perf_ << " (" << symbols_[sym].dso << ")\n\n";
+}
+
+void hotspotProfiler::report(std::ostream& os)
+{
+    if (!sorted_) {
+        sortSymbols();
+    }
+    if (perf_.is_open()) {
+        perf_.flush();
+    }
+
+    std::vector<size_t> order;
+    for (size_t i = 0; i < stats_.size(); ++i) {
+        if (stats_[i].samples) {
+            order.push_back(i);
+        }
+    }
+    std::sort(order.begin(), order.end(), [this](size_t a, size_t b) {
+        return stats_[a].samples > stats_[b].samples;
+    });
+
+    char line[512];
+    std::snprintf(line, sizeof(line), "# %" PRIu64 " samples, one every %" PRIu64 " cycles\n", totalSamples_, interval_);
+    os << line;
+    os << "#  samples      %         cycles";
+    for (size_t i = 0; i < kNumCounters; ++i) {
+        std::snprintf(line, sizeof(line), "  mhpmcounter%zu", i + 3);
+        os << line;
+    }
+    os << "  symbol\n";
+    for (size_t i : order) {
+        const stats& s = stats_[i];
+        std::snprintf(line, sizeof(line), "%10" PRIu64 " %6.2f %14" PRIu64, s.samples,
+                      100.0 * double(s.samples) / double(totalSamples_), s.samples * interval_);
+        os << line;
+        for (size_t j = 0; j < kNumCounters; ++j) {
+            std::snprintf(line, sizeof(line), " %14.0f", s.events[j]);
+            os << line;
+        }
+        os << "  " << symbols_[i].name << " (" << symbols_[i].dso << ")\n";
+    }
+}
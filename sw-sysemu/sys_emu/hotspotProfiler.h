@@ -0,0 +1,89 @@
+/*-------------------------------------------------------------------------
+* Copyright (c) 2025 Ainekko, Co.
+* SPDX-License-Identifier: Apache-2.0
+*-------------------------------------------------------------------------*/
+
+#ifndef _HOTSPOTPROFILER_H_
+#define _HOTSPOTPROFILER_H_
+
+#include <cstdint>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "system.h"
+
+// Sampling profiler
+//
+// Every <interval> cycles the PC of each running hart is sampled and
+// attributed to the function symbol that contains it, taken from the symbol
+// tables of the loaded ELFs. Each sample stands for <interval> cycles of the
+// hart. The neighborhood PMU counters (mhpmcounter3-8) are shared by the
+// harts with the same index in their minion, so their increments since the
+// previous sample are split evenly among the sampled harts that share them.
+//
+// The results can be written as a text report sorted by samples, and the
+// samples themselves can be streamed in the format of "perf script", which
+// flame graph and pprof conversion tools understand.
+class hotspotProfiler
+{
+public:
+    explicit hotspotProfiler(uint64_t interval);
+
+    hotspotProfiler(const hotspotProfiler&) = delete;
+    hotspotProfiler& operator=(const hotspotProfiler&) = delete;
+
+    // Adds the function symbols of an ELF image, returns false if the image
+    // cannot be parsed
+    bool loadSymbols(std::istream& image, const std::string& dso);
+
+    // Streams every sample to path in perf script format
+    void setPerfOutput(const std::string& path);
+
+    bool due(uint64_t cycle) const { return cycle >= nextSample_; }
+    void sample(const bemu::System& chip, uint64_t cycle);
+
+    void report(std::ostream& os);
+
+private:
+    static constexpr size_t kNumCounters = std::tuple_size<bemu::System::neigh_pmu_counters_t>::value;
+
+    struct symbol {
+        uint64_t start;
+        uint64_t end;
+        std::string name;
+        std::string dso;
+    };
+
+    struct stats {
+        uint64_t samples = 0;
+        double   events[kNumCounters] = {};
+    };
+
+    struct hit {
+        unsigned slot;   // neighborhood * EMU_THREADS_PER_MINION + index in minion
+        size_t   symbol;
+    };
+
+    void sortSymbols();
+    size_t lookup(uint64_t pc) const;
+    void writePerfSample(const bemu::Hart& cpu, uint64_t cycle, size_t symbol);
+
+    uint64_t interval_;
+    uint64_t nextSample_ = 0;
+    uint64_t totalSamples_ = 0;
+
+    bool sorted_ = true;
+    std::vector<symbol> symbols_;     // the first entry collects unknown PCs
+    std::vector<stats> stats_;
+
+    std::vector<bemu::System::neigh_pmu_counters_t> counters_;
+    std::vector<unsigned> slotHits_;
+    std::vector<hit> hits_;
+
+    std::ofstream perf_;
+};
+
+#endif
@@ -12,6 +12,37 @@ void notify_freg_read(const bemu::Hart&, uint8_t) { }
 
 #else // !SDK_RELEASE
 
+void trace_trap(const bemu::Hart& cpu, uint64_t, uint64_t cause, uint64_t tval, uint64_t epc)
+{
+    auto emu = cpu.chip->emu();
+    emu->get_retire_trace()->trap(cpu, emu->get_emu_cycle(), cause, tval, epc);
+}
+
+
+void trace_xreg_write(const bemu::Hart& cpu, uint8_t xd, uint64_t value)
+{
+    cpu.chip->emu()->get_retire_trace()->xregWrite(cpu, xd, value);
+}
+
+
+void trace_mem_write(const bemu::Hart& cpu, int size, uint64_t vaddr, uint64_t data)
+{
+    cpu.chip->emu()->get_retire_trace()->memAccess(cpu, rtrace::RETIRE_MEM_STORE, size, vaddr, data);
+}
+
+
+void trace_mem_read(const bemu::Hart& cpu, int size, uint64_t vaddr)
+{
+    cpu.chip->emu()->get_retire_trace()->memAccess(cpu, rtrace::RETIRE_MEM_LOAD, size, vaddr, 0);
+}
+
+
+void trace_mem_read_write(const bemu::Hart& cpu, int size, uint64_t vaddr, uint64_t data)
+{
+    cpu.chip->emu()->get_retire_trace()->memAccess(cpu, rtrace::RETIRE_MEM_LOAD | rtrace::RETIRE_MEM_STORE, size, vaddr, data);
+}
+
+
 void notify_pc_update(const bemu::Hart& cpu, uint64_t)
 {
     auto emu = cpu.chip->emu();
@@ -11,10 +11,29 @@
 
 // Run control
 void notify_pc_update(const bemu::Hart&, uint64_t);
+#ifdef SDK_RELEASE
 inline void notify_trap(const bemu::Hart&,  uint64_t, uint64_t, uint64_t, uint64_t) {}
+#else
+// The trace_* hooks are only called for the harts in the retire trace
+void trace_trap(const bemu::Hart&,  uint64_t, uint64_t, uint64_t, uint64_t);
+inline void notify_trap(const bemu::Hart& cpu,  uint64_t status, uint64_t cause, uint64_t tval, uint64_t epc) {
+    if (cpu.retire_traced) {
+        trace_trap(cpu, status, cause, tval, epc);
+    }
+}
+#endif
 
 // General purpose registers (late writes are operations that take more than one cycle)
+#ifdef SDK_RELEASE
 inline void notify_xreg_write(const bemu::Hart&, uint8_t, uint64_t) {}
+#else
+void trace_xreg_write(const bemu::Hart&, uint8_t, uint64_t);
+inline void notify_xreg_write(const bemu::Hart& cpu, uint8_t xd, uint64_t value) {
+    if (cpu.retire_traced) {
+        trace_xreg_write(cpu, xd, value);
+    }
+}
+#endif
 inline void notify_xreg_late_write(const bemu::Hart&, uint8_t, uint64_t) {}
 
 // Different flavors of writes to the VPU register file (or fregs)
@@ -24,9 +43,30 @@ void notify_freg_write(const bemu::Hart&, uint8_t, const bemu::mreg_t&, const be
 void notify_freg_read(const bemu::Hart&, uint8_t);
 
 // Memory write backs
+#ifdef SDK_RELEASE
 inline void notify_mem_write(const bemu::Hart&, bool, int, uint64_t, uint64_t, uint64_t) {}
 inline void notify_mem_read(const bemu::Hart&, bool, int, uint64_t, uint64_t) {}
 inline void notify_mem_read_write(const bemu::Hart&, bool, int, uint64_t, uint64_t, uint64_t) {}
+#else
+void trace_mem_write(const bemu::Hart&, int, uint64_t, uint64_t);
+void trace_mem_read(const bemu::Hart&, int, uint64_t);
+void trace_mem_read_write(const bemu::Hart&, int, uint64_t, uint64_t);
+inline void notify_mem_write(const bemu::Hart& cpu, bool enabled, int size, uint64_t vaddr, uint64_t, uint64_t data) {
+    if (enabled && cpu.retire_traced) {
+        trace_mem_write(cpu, size, vaddr, data);
+    }
+}
+inline void notify_mem_read(const bemu::Hart& cpu, bool enabled, int size, uint64_t vaddr, uint64_t) {
+    if (enabled && cpu.retire_traced) {
+        trace_mem_read(cpu, size, vaddr);
+    }
+}
+inline void notify_mem_read_write(const bemu::Hart& cpu, bool enabled, int size, uint64_t vaddr, uint64_t, uint64_t data) {
+    if (enabled && cpu.retire_traced) {
+        trace_mem_read_write(cpu, size, vaddr, data);
+    }
+}
+#endif
 
 // Mask registers and misc CSRs
 inline void notify_mreg_write(const bemu::Hart&, uint8_t, const bemu::mreg_t&) {}
@@ -0,0 +1,113 @@
+/*-------------------------------------------------------------------------
+* Copyright (c) 2025 Ainekko, Co.
+* SPDX-License-Identifier: Apache-2.0
+*-------------------------------------------------------------------------*/
+
+#include <algorithm>
+#include <cinttypes>
+#include <cstdio>
+
+#include "cache.h"
+#include "memContention.h"
+#include "processor.h"
+
+memContention::memContention(bemu::System* chip, const config& cfg)
+    : chip_(chip),
+      cfg_(cfg),
+      shires_(std::max(cfg.shires, 1u)),
+      done_(EMU_NUM_THREADS, 0)
+{
+    cfg_.shires = shires_.size();
+}
+
+void memContention::access(const bemu::Hart& cpu, uint64_t paddr, bemu::mem_access_type macc, uint64_t cycle)
+{
+    shire& s = shires_[(paddr >> cfg_.interleave) % cfg_.shires];
+    uint64_t start = std::max(cycle, s.free);
+    s.free = start + cfg_.shireInterval;
+
+    line& l = lines_[paddr / L1D_LINE_SIZE];
+    start = std::max(start, l.free);
+    l.free = start + cfg_.lineOccupancy;
+
+    uint64_t wait = start - cycle;
+    ++s.requests;
+    ++l.requests;
+    if (macc == bemu::Mem_Access_AtomicG) {
+        ++l.atomics;
+    }
+    if (wait) {
+        ++s.queued;
+        s.wait += wait;
+        ++l.queued;
+        l.wait += wait;
+        l.maxWait = std::max(l.maxWait, wait);
+    }
+
+    uint64_t& done = done_[bemu::hart_index(cpu)];
+    done = std::max(done, start + cfg_.latency);
+}
+
+void memContention::stall(bemu::Hart& cpu, uint64_t cycle)
+{
+    unsigned hart = bemu::hart_index(cpu);
+    uint64_t done = done_[hart];
+    if (!done) {
+        return;
+    }
+    done_[hart] = 0;
+    // The next instruction would issue the next cycle anyway
+    if ((done <= cycle + 1) || !(cpu.is_active() || cpu.is_sleeping())) {
+        return;
+    }
+    cpu.start_waiting(bemu::Hart::Waiting::memory);
+    wakeups_.emplace(done, hart);
+    ++stalls_;
+    stallCycles_ += done - cycle - 1;
+}
+
+void memContention::tick(uint64_t cycle)
+{
+    while (!wakeups_.empty() && (wakeups_.top().first <= cycle)) {
+        chip_->cpu[wakeups_.top().second].stop_waiting(bemu::Hart::Waiting::memory);
+        wakeups_.pop();
+    }
+}
+
+void memContention::report(std::ostream& os, size_t top) const
+{
+    char buf[256];
+
+    std::snprintf(buf, sizeof(buf), "# %" PRIu64 " stalls, %" PRIu64 " stall cycles\n", stalls_, stallCycles_);
+    os << buf;
+
+    os << "# memshire     requests       queued    queued cycles\n";
+    for (size_t i = 0; i < shires_.size(); ++i) {
+        const shire& s = shires_[i];
+        std::snprintf(buf, sizeof(buf), "%10zu %12" PRIu64 " %12" PRIu64 " %16" PRIu64 "\n",
+                      i, s.requests, s.queued, s.wait);
+        os << buf;
+    }
+
+    std::vector<std::pair<uint64_t, const line*>> order;
+    order.reserve(lines_.size());
+    for (const auto& l : lines_) {
+        if (l.second.queued) {
+            order.emplace_back(l.first, &l.second);
+        }
+    }
+    top = std::min(top, order.size());
+    std::partial_sort(order.begin(), order.begin() + top, order.end(), [](const auto& a, const auto& b) {
+        return (a.second->wait != b.second->wait) ? (a.second->wait > b.second->wait) : (a.first < b.first);
+    });
+
+    std::snprintf(buf, sizeof(buf), "# %zu lines accessed, %zu contended\n", lines_.size(), order.size());
+    os << buf;
+    os << "#            line     requests      atomics       queued    queued cycles  max wait\n";
+    for (size_t i = 0; i < top; ++i) {
+        const line& l = *order[i].second;
+        std::snprintf(buf, sizeof(buf), "0x%014" PRIx64 " %12" PRIu64 " %12" PRIu64 " %12" PRIu64 " %16" PRIu64 " %9" PRIu64 "\n",
+                      order[i].first * L1D_LINE_SIZE, l.requests, l.atomics, l.queued, l.wait, l.maxWait);
+        os << buf;
+    }
+}
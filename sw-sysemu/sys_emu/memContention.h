@@ -0,0 +1,103 @@
+/*-------------------------------------------------------------------------
+* Copyright (c) 2025 Ainekko, Co.
+* SPDX-License-Identifier: Apache-2.0
+*-------------------------------------------------------------------------*/
+
+#ifndef _MEMCONTENTION_H_
+#define _MEMCONTENTION_H_
+
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <queue>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "emu_defines.h"
+#include "system.h"
+
+// Contention model for global memory accesses
+//
+// Global atomics, and global loads and stores, bypass the minion caches and
+// are served by the memory shire that owns the cache line. The model sends
+// every such access to DRAM through two queues, each of which is a server
+// that becomes free a fixed number of cycles after it accepts a request:
+//
+//  - the memory shire selected by (paddr >> interleave) % shires, which
+//    accepts a request every <shire_interval> cycles (its bandwidth), and
+//  - the cache line, which is busy for <line_occupancy> cycles per request
+//    (the read-modify-write of an atomic unit).
+//
+// A request completes <latency> cycles after the line accepts it. The
+// accesses are still performed when the instruction executes; the hart then
+// waits (Hart::Waiting::memory) until all the requests of the instruction
+// have completed. The number of requests, how many of them queued, and the
+// cycles they spent queued are kept per line and per memory shire.
+class memContention
+{
+public:
+    struct config {
+#if EMU_HAS_MEMSHIRE
+        unsigned shires         = NUM_MEM_SHIRES;
+#else
+        unsigned shires         = 1;
+#endif
+        unsigned interleave     = 10;   // log2 of the memory shire interleave in bytes
+        uint64_t latency        = 0;
+        uint64_t lineOccupancy  = 4;
+        uint64_t shireInterval  = 1;
+    };
+
+    memContention(bemu::System* chip, const config& cfg);
+
+    memContention(const memContention&) = delete;
+    memContention& operator=(const memContention&) = delete;
+
+    // Queues a global access of the instruction that cpu executes this cycle
+    void access(const bemu::Hart& cpu, uint64_t paddr, bemu::mem_access_type macc, uint64_t cycle);
+
+    // Stalls cpu until the requests of its last instruction complete
+    void stall(bemu::Hart& cpu, uint64_t cycle);
+
+    // Wakes up the harts whose requests complete by this cycle
+    void tick(uint64_t cycle);
+
+    // Whether some hart is stalled
+    bool busy() const { return !wakeups_.empty(); }
+
+    // Writes the counters of the <top> most contended lines and of the
+    // memory shires
+    void report(std::ostream& os, size_t top = 32) const;
+
+private:
+    struct line {
+        uint64_t free     = 0;
+        uint64_t requests = 0;
+        uint64_t atomics  = 0;
+        uint64_t queued   = 0;
+        uint64_t wait     = 0;
+        uint64_t maxWait  = 0;
+    };
+
+    struct shire {
+        uint64_t free     = 0;
+        uint64_t requests = 0;
+        uint64_t queued   = 0;
+        uint64_t wait     = 0;
+    };
+
+    using wakeup = std::pair<uint64_t, unsigned>;   // cycle, hart
+
+    bemu::System* chip_;
+    config cfg_;
+
+    std::unordered_map<uint64_t, line> lines_;
+    std::vector<shire> shires_;
+    std::vector<uint64_t> done_;    // per hart, completion of its pending requests
+    std::priority_queue<wakeup, std::vector<wakeup>, std::greater<wakeup>> wakeups_;
+    uint64_t stalls_ = 0;
+    uint64_t stallCycles_ = 0;
+};
+
+#endif
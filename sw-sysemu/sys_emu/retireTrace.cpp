@@ -0,0 +1,109 @@
+/*-------------------------------------------------------------------------
+* Copyright (c) 2025 Ainekko, Co.
+* SPDX-License-Identifier: Apache-2.0
+*-------------------------------------------------------------------------*/
+
+#include <stdexcept>
+
+#include "retireTrace.h"
+#include "processor.h"
+
+retireTrace::retireTrace(const std::string& path)
+    : out_(path, "retire trace", rtrace::kMagic, rtrace::kFormatVersion, sizeof(rtrace::retireRecord)),
+      pending_(EMU_NUM_THREADS)
+{
+    harts_.set();
+}
+
+bool retireTrace::traced(const bemu::Hart& cpu) const
+{
+    return harts_[bemu::hart_index(cpu)];
+}
+
+void retireTrace::xregWrite(const bemu::Hart& cpu, uint8_t rd, uint64_t value)
+{
+    rtrace::retireRecord& record = pending_[bemu::hart_index(cpu)];
+    record.flags |= rtrace::RETIRE_RD_WRITE;
+    record.rd = rd;
+    record.rdValue = value;
+}
+
+void retireTrace::memAccess(const bemu::Hart& cpu, uint8_t kind, int size, uint64_t vaddr, uint64_t data)
+{
+    rtrace::retireRecord& record = pending_[bemu::hart_index(cpu)];
+    // Vector accesses report one access per element, only the first one is kept
+    if (record.memCount == 0) {
+        record.memSize = size;
+        record.memAddr = vaddr;
+        if (kind & rtrace::RETIRE_MEM_STORE) {
+            record.memData = data;
+        }
+    }
+    if (record.memCount < UINT8_MAX) {
+        ++record.memCount;
+    }
+    record.flags |= kind;
+}
+
+void retireTrace::trap(const bemu::Hart& cpu, uint64_t cycle, uint64_t cause, uint64_t tval, uint64_t epc)
+{
+    rtrace::retireRecord& record = pending_[bemu::hart_index(cpu)];
+    bool interrupt = (cause >> 63) != 0;
+    record.cycle = cycle;
+    record.pc = epc;
+    record.hart = bemu::hart_index(cpu);
+    record.bits = interrupt ? 0 : cpu.inst.bits;
+    record.flags |= rtrace::RETIRE_TRAP;
+    record.cause = cause;
+    record.tval = tval;
+    if (inPcWindow(epc)) {
+        write(record);
+    }
+    record = rtrace::retireRecord{};
+}
+
+void retireTrace::retire(const bemu::Hart& cpu, uint64_t cycle)
+{
+    rtrace::retireRecord& record = pending_[bemu::hart_index(cpu)];
+    record.cycle = cycle;
+    record.pc = cpu.pc;
+    record.hart = bemu::hart_index(cpu);
+    record.bits = cpu.inst.bits;
+    if (inPcWindow(cpu.pc)) {
+        write(record);
+    }
+    record = rtrace::retireRecord{};
+}
+
+void retireTrace::discard(const bemu::Hart& cpu)
+{
+    pending_[bemu::hart_index(cpu)] = rtrace::retireRecord{};
+}
+
+void retireTrace::write(const rtrace::retireRecord& record)
+{
+    out_.write(record);
+}
+
+
+namespace rtrace {
+
+reader::reader(const std::string& path)
+    : in_(path, "retire trace", kMagic, kFormatVersion)
+{
+    if (in_.info() < sizeof(retireRecord)) {
+        throw std::runtime_error("Unsupported retire trace record size " + std::to_string(in_.info()));
+    }
+    // Fields past the ones known to this reader are skipped
+    skip_.resize(in_.info() - sizeof(retireRecord));
+}
+
+bool reader::next(retireRecord& record)
+{
+    if (!in_.read(record)) {
+        return false;
+    }
+    return skip_.empty() || in_.read(skip_.data(), skip_.size());
+}
+
+} // namespace rtrace
@@ -0,0 +1,118 @@
+/*-------------------------------------------------------------------------
+* Copyright (c) 2025 Ainekko, Co.
+* SPDX-License-Identifier: Apache-2.0
+*-------------------------------------------------------------------------*/
+
+#ifndef _RETIRETRACE_H_
+#define _RETIRETRACE_H_
+
+#include <bitset>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "emu_defines.h"
+#include "support/lz4_record_file.h"
+
+namespace bemu {
+struct Hart;
+}
+
+// Retire trace format
+//
+// The retire trace is an LZ4 record file (support/lz4_record_file.h) whose
+// header info is sizeof(retireRecord), followed by one fixed size
+// retireRecord per retired instruction or taken trap of the traced harts, in
+// execution order. All values are stored in host endianness.
+// scripts/retire_trace.py reads the same format from Python.
+
+namespace rtrace {
+
+constexpr char     kMagic[8]      = {'B', 'E', 'M', 'U', 'R', 'T', 'R', '\0'};
+constexpr uint32_t kFormatVersion = 1;
+
+enum retireFlags : uint8_t {
+    RETIRE_RD_WRITE  = 1 << 0, // rd and rdValue are valid
+    RETIRE_MEM_LOAD  = 1 << 1, // the instruction read memory
+    RETIRE_MEM_STORE = 1 << 2, // the instruction wrote memory, memData is valid
+    RETIRE_TRAP      = 1 << 3, // a trap was taken, cause and tval are valid
+};
+
+struct retireRecord {
+    uint64_t cycle;
+    uint64_t pc;       // for traps, the xepc of the trap
+    uint32_t hart;     // hart index
+    uint32_t bits;     // instruction bits, 0 for interrupts
+    uint8_t  flags;    // retireFlags
+    uint8_t  rd;
+    uint8_t  memSize;  // size in bytes of the first memory access
+    uint8_t  memCount; // number of memory accesses, saturates at 255
+    uint32_t reserved;
+    uint64_t rdValue;
+    uint64_t memAddr;  // virtual address of the first memory access
+    uint64_t memData;  // data of the first memory write
+    uint64_t cause;
+    uint64_t tval;
+};
+
+static_assert(sizeof(retireRecord) == 72, "retireRecord layout changed");
+
+// Streaming reader of a retire trace file
+class reader
+{
+public:
+    explicit reader(const std::string& path);
+
+    reader(const reader&) = delete;
+    reader& operator=(const reader&) = delete;
+
+    // Reads the next record, returns false at the end of the trace
+    bool next(retireRecord& record);
+
+private:
+    bemu::lz4_record_reader in_;
+    std::vector<char> skip_;
+};
+
+} // namespace rtrace
+
+
+// Collects what each traced hart does while executing an instruction, from
+// the notify_* hooks, and writes it out as a retireRecord when the
+// instruction retires or traps.
+class retireTrace
+{
+public:
+    explicit retireTrace(const std::string& path);
+
+    retireTrace(const retireTrace&) = delete;
+    retireTrace& operator=(const retireTrace&) = delete;
+
+    // Filters, by default every hart and every PC is traced
+    void setHarts(const std::bitset<EMU_NUM_THREADS>& harts) { harts_ = harts; }
+    void setPcWindow(uint64_t start, uint64_t end) { pcStart_ = start; pcEnd_ = end; }
+
+    bool traced(const bemu::Hart& cpu) const;
+
+    void xregWrite(const bemu::Hart& cpu, uint8_t rd, uint64_t value);
+    void memAccess(const bemu::Hart& cpu, uint8_t kind, int size, uint64_t vaddr, uint64_t data);
+    void trap(const bemu::Hart& cpu, uint64_t cycle, uint64_t cause, uint64_t tval, uint64_t epc);
+
+    // Writes the record of the instruction the hart just executed
+    void retire(const bemu::Hart& cpu, uint64_t cycle);
+
+    // Drops what was collected for an instruction that will not retire
+    void discard(const bemu::Hart& cpu);
+
+private:
+    bool inPcWindow(uint64_t pc) const { return (pc >= pcStart_) && (pc < pcEnd_); }
+    void write(const rtrace::retireRecord& record);
+
+    bemu::lz4_record_writer out_;
+    std::bitset<EMU_NUM_THREADS> harts_;
+    uint64_t pcStart_ = 0;
+    uint64_t pcEnd_ = ~0ull;
+    std::vector<rtrace::retireRecord> pending_;
+};
+
+#endif
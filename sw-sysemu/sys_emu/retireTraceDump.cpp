@@ -0,0 +1,52 @@
+/*-------------------------------------------------------------------------
+* Copyright (c) 2025 Ainekko, Co.
+* SPDX-License-Identifier: Apache-2.0
+*-------------------------------------------------------------------------*/
+
+#include <cinttypes>
+#include <cstdio>
+#include <exception>
+
+#include "retireTrace.h"
+
+// Prints a retire trace written with sys_emu -rt as text, in the same format
+// as scripts/retire_trace.py
+int main(int argc, char* argv[])
+{
+    if (argc != 2) {
+        std::fprintf(stderr, "Usage: %s <retire trace>\n", argv[0]);
+        return 1;
+    }
+
+    try {
+        rtrace::reader trace(argv[1]);
+        rtrace::retireRecord r;
+        while (trace.next(r)) {
+            std::printf("%" PRIu64 ": H%u 0x%016" PRIx64 " (0x%08x)", r.cycle, r.hart, r.pc, r.bits);
+            if (r.flags & rtrace::RETIRE_RD_WRITE) {
+                std::printf(" x%u=0x%016" PRIx64, r.rd, r.rdValue);
+            }
+            if (r.flags & (rtrace::RETIRE_MEM_LOAD | rtrace::RETIRE_MEM_STORE)) {
+                std::printf(" %s%s%u[0x%016" PRIx64 "]",
+                            (r.flags & rtrace::RETIRE_MEM_LOAD) ? "R" : "",
+                            (r.flags & rtrace::RETIRE_MEM_STORE) ? "W" : "",
+                            r.memSize, r.memAddr);
+                if (r.flags & rtrace::RETIRE_MEM_STORE) {
+                    std::printf("=0x%" PRIx64, r.memData);
+                }
+                if (r.memCount > 1) {
+                    std::printf(" (+%u)", r.memCount - 1);
+                }
+            }
+            if (r.flags & rtrace::RETIRE_TRAP) {
+                std::printf(" trap cause=0x%" PRIx64 " tval=0x%" PRIx64, r.cause, r.tval);
+            }
+            std::printf("\n");
+        }
+    }
+    catch (const std::exception& e) {
+        std::fprintf(stderr, "%s: %s\n", argv[1], e.what());
+        return 1;
+    }
+    return 0;
+}
@@ -10,11 +10,16 @@
 #include <cstdio>
 #include <cstdlib>
 #include <cstring>
+#include <deque>
 #include <exception>
 #include <fcntl.h>
 #include <iostream>
 #include <list>
 #include <locale>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <string_view>
 #include <sys/stat.h>
 #include <sys/types.h>
 #include <tuple>
@@ -40,6 +45,49 @@
 #endif
 
 
+// Returns the image of the I-th preloaded ELF. Compressed images are only
+// decompressed once per process and kept around for later runs.
+static std::string_view
+preloaded_elf(int i)
+{
+#ifdef PRELOAD_LZ4
+    static std::mutex mutex;
+    static std::deque<std::string> images;
+
+    std::lock_guard<std::mutex> lock(mutex);
+    while (images.size() <= size_t(i)) {
+        std::string str{g_preload[images.size()]};
+        std::istringstream buf{str};
+        lz4_stream::istream decomp{buf};
+        std::stringstream image;
+        image << decomp.rdbuf();
+        images.push_back(image.str());
+    }
+    return images[i];
+#else
+    return g_preload[i];
+#endif
+}
+
+
+// Calls fn(stream, name) for each preloaded ELF and each ELF file, in the
+// order they are loaded
+template <typename Function>
+static void
+for_each_elf(const std::vector<std::string>& elf_files, Function fn)
+{
+    for (int i = 0; !g_preload[i].empty(); ++i) {
+        std::string_view image = preloaded_elf(i);
+        std::istringstream is(std::string(image.data(), image.size()));
+        fn(is, "preload[" + std::to_string(i) + "]");
+    }
+    for (const auto &elf: elf_files) {
+        std::ifstream is(elf, std::ios::binary);
+        fn(is, elf);
+    }
+}
+
+
 static void
 halt_all_threads(bemu::System& chip)
 {
@@ -221,9 +269,21 @@ sys_emu::sys_emu(const sys_emu_cmd_options &cmd_options, api_communicate *api_co
         }
         chip.log.setOutputStream(&log_file);
     }
+    chip.log.setBinaryOutput(nullptr);
+    binary_log.reset();
+    if (!cmd_options.log_binary_path.empty()) {
+        try {
+            binary_log.reset(new binaryLog(cmd_options.log_binary_path, "EMU"));
+            chip.log.setBinaryOutput(binary_log.get());
+        }
+        catch (const std::exception& e) {
+            LOG_AGENT(FTL, agent, "%s", e.what());
+        }
+    }
 
     // Reset the SoC
     emu_cycle = 0;
+    emu_instret = 0;
 #ifndef SDK_RELEASE
     if (cmd_options.vpurf_check || cmd_options.vpurf_warn) {
         vpurf_checker = std::unique_ptr<Vpurf_checker>(new Vpurf_checker(&chip));
@@ -253,6 +313,23 @@ sys_emu::sys_emu(const sys_emu_cmd_options &cmd_options, api_communicate *api_co
     tstore_checker_ = tstore_checker{&chip};
     tstore_checker_.log_addr = cmd_options.tstore_checker_log_addr;
     tstore_checker_.log_thread = cmd_options.tstore_checker_log_thread;
+    retire_trace.reset();
+#ifndef SDK_RELEASE
+    if (!cmd_options.retire_trace_path.empty()) {
+        try {
+            retire_trace.reset(new retireTrace(cmd_options.retire_trace_path));
+            retire_trace->setHarts(cmd_options.retire_trace_harts);
+            retire_trace->setPcWindow(cmd_options.retire_trace_pc_start, cmd_options.retire_trace_pc_end);
+        }
+        catch (const std::exception& e) {
+            LOG_AGENT(FTL, agent, "%s", e.what());
+        }
+    }
+#endif
+    // The notify_* hooks only call out of line for the traced harts
+    for (auto& hart : chip.cpu) {
+        hart.retire_traced = retire_trace && retire_trace->traced(hart);
+    }
     breakpoints.clear();
     single_step.reset();
 
@@ -264,22 +341,18 @@ sys_emu::sys_emu(const sys_emu_cmd_options &cmd_options, api_communicate *api_co
     // Init emu
     chip.init(bemu::System::Stepping::A0);
     memcpy(&chip.memory_reset_value, &cmd_options.mem_reset, MEM_RESET_PATTERN_SIZE);
+#if EMU_ETSOC1
+    // Reloading the ELFs of the shared DRAM image does not copy it
+    if (cmd_options.dram_image) {
+        chip.memory.dram_share(cmd_options.dram_image);
+    }
+#endif
 
     for (int i = 0; !g_preload[i].empty(); ++i) {
         LOG_AGENT(INFO, agent, "Preloading ELF[%d]", i);
         try {
-            std::string str{g_preload[i]};
-            std::istringstream buf{str};
-#ifdef PRELOAD_LZ4
-            lz4_stream::istream decomp{buf};
-            // NB: There seems to be a bug in either lz4_stream or elfio...
-            // Filtering through an extra stringstream works though :)
-            std::stringstream buf2;
-            buf2 << decomp.rdbuf();
-            chip.load_elf(buf2);
-#else
-            chip.load_elf(buf);
-#endif
+            std::string_view image = preloaded_elf(i);
+            chip.load_elf(image.data(), image.size());
         }
         catch (...) {
             LOG_AGENT(FTL, agent, "Error preloading ELF[%d]", i);
@@ -300,6 +373,42 @@ sys_emu::sys_emu(const sys_emu_cmd_options &cmd_options, api_communicate *api_co
         parse_mem_file(cmd_options.mem_desc_file.c_str());
     }
 
+    // Sampling profiler, symbols come from the same ELF files
+    profiler.reset();
+    if (!cmd_options.profile_path.empty() || !cmd_options.profile_perf_path.empty()) {
+        profiler.reset(new hotspotProfiler(cmd_options.profile_interval));
+        for_each_elf(cmd_options.elf_files, [this](std::istream& is, const std::string& name) {
+            if (!profiler->loadSymbols(is, name)) {
+                LOG_AGENT(WARN, agent, "Profiler: cannot read the symbols of \"%s\"", name.c_str());
+            }
+        });
+        if (!cmd_options.profile_perf_path.empty()) {
+            try {
+                profiler->setPerfOutput(cmd_options.profile_perf_path);
+            }
+            catch (const std::exception& e) {
+                LOG_AGENT(FTL, agent, "%s", e.what());
+            }
+        }
+    }
+
+    // Cache hierarchy simulator, kernels come from the same ELF files
+    cache_sim.reset();
+    if (!cmd_options.cache_sim_path.empty()) {
+        cache_sim.reset(new cacheSim(cmd_options.cache_sim));
+        for_each_elf(cmd_options.elf_files, [this](std::istream& is, const std::string& name) {
+            if (!cache_sim->addKernel(is, name)) {
+                LOG_AGENT(WARN, agent, "Cache simulator: cannot read \"%s\"", name.c_str());
+            }
+        });
+    }
+
+    // Global memory contention model
+    contention.reset();
+    if (!cmd_options.contention_path.empty()) {
+        contention.reset(new memContention(&chip, cmd_options.contention));
+    }
+
     // Load files
     for (const auto &info: cmd_options.file_load_files) {
         LOG_AGENT(INFO, agent, "Loading file @ 0x%" PRIx64 ": \"%s\"", info.addr, info.file.c_str());
@@ -511,7 +620,8 @@ int sys_emu::main_internal() {
            && (chip.has_active_harts()
                || (chip.has_sleeping_harts()
                    && ((api_listener != nullptr)
-                       || chip.timers_active()))))
+                       || chip.timers_active()
+                       || (contention && contention->busy())))))
     {
         if (gdb_enabled) {
             switch (gdbstub_get_status()) {
@@ -553,6 +663,11 @@ int sys_emu::main_internal() {
         // Update peripherals/devices
         chip.tick_peripherals(emu_cycle);
 
+        // Wake up the harts whose global memory requests completed
+        if (contention) {
+            contention->tick(emu_cycle);
+        }
+
         chip.active.splice(chip.active.cend(), chip.awaking);
 
         auto current_hart = chip.active.begin();
@@ -620,7 +735,11 @@ int sys_emu::main_internal() {
                     if ((gdbstub_get_status() == GDBSTUB_STATUS_RUNNING) && breakpoint_exists(hart->pc)) {
                         LOG_AGENT(DEBUG, *hart, "Hit breakpoint at address 0x%" PRIx64, hart->pc);
                         gdbstub_signal_break(thread_id);
-                        halt_all_threads(chip);
+                        if (gdbstub_non_stop()) {
+                            hart->enter_debug_mode(bemu::Debug_entry::Cause::haltreq);
+                        } else {
+                            halt_all_threads(chip);
+                        }
                         continue;
                     }
 
@@ -641,10 +760,20 @@ int sys_emu::main_internal() {
                     // Executes the instruction
                     hart->execute();
                     hart->notify_pmu_minion_event(PMU_MINION_EVENT_RETIRED_INST0 + (thread_id & 1));
+                    ++emu_instret;
+                    if (hart->retire_traced) {
+                        retire_trace->retire(*hart, emu_cycle);
+                    }
                     hart->advance_pc();
+                } else {
+                    // Sleep until another hart unblocks the coprocessors
+                    hart->maybe_sleep();
                 }
             }
             catch (const bemu::Debug_entry& e) {
+                if (hart->retire_traced) {
+                    retire_trace->discard(*hart);
+                }
                 hart->enter_debug_mode(e.cause);
             }
             catch (const bemu::Trap& t) {
@@ -659,8 +788,14 @@ int sys_emu::main_internal() {
             }
             catch (const bemu::instruction_restart) {
                 LOG_AGENT(DEBUG, *hart, "%s", "Instruction killed and will be restarted");
+                if (hart->retire_traced) {
+                    retire_trace->discard(*hart);
+                }
             }
             catch (const bemu::memory_error& e) {
+                if (hart->retire_traced) {
+                    retire_trace->retire(*hart, emu_cycle);
+                }
                 hart->advance_pc();
                 hart->raise_interrupt(BUS_ERROR_INTERRUPT, e.addr);
             }
@@ -668,6 +803,11 @@ int sys_emu::main_internal() {
                 LOG_AGENT(FTL, *hart, "%s", e.what());
             }
 
+            // Wait for the global memory requests of the instruction
+            if (contention) {
+                contention->stall(*hart, emu_cycle);
+            }
+
             // Check for single-step mode
             if ((gdbstub_get_status() == GDBSTUB_STATUS_RUNNING) && single_step[thread_id]) {
                 if (!step_range[thread_id].contains(hart->pc)) {
@@ -675,6 +815,9 @@ int sys_emu::main_internal() {
                     gdbstub_signal_break(thread_id);
                     single_step[thread_id] = false;
                     hart->enter_debug_mode(bemu::Debug_entry::Cause::haltreq);
+                    if (!gdbstub_non_stop()) {
+                        halt_all_threads(chip);
+                    }
                     continue;
                 }
             }
@@ -698,6 +841,10 @@ int sys_emu::main_internal() {
             }
         }
 
+        if (profiler && profiler->due(emu_cycle)) {
+            profiler->sample(chip, emu_cycle);
+        }
+
         ++emu_cycle;
     }
 
@@ -793,6 +940,9 @@ int sys_emu::main_internal() {
             if (hart.is_waiting(bemu::Hart::Waiting::tload_tenb)) {
                 pos += snprintf(&waitreasons[pos], 1023-pos, " tload_tenb");
             }
+            if (hart.is_waiting(bemu::Hart::Waiting::memory)) {
+                pos += snprintf(&waitreasons[pos], 1023-pos, " memory");
+            }
             waitreasons[pos] = waitreasons[1023] = '\0';
             LOG_AGENT(INFO, agent, "\tThread H%u, PC: 0x%" PRIx64 " waits for%s",
                       hart.mhartid, hart.pc, pos ? waitreasons : " nothing");
@@ -815,6 +965,47 @@ int sys_emu::main_internal() {
     if(tstore_check)
         tstore_checker_.is_empty();
 
+    // Completes the retire trace file
+    for (auto& hart : chip.cpu) {
+        hart.retire_traced = false;
+    }
+    retire_trace.reset();
+
+    // Writes the profile
+    if (profiler) {
+        if (!cmd_options.profile_path.empty()) {
+            std::ofstream os(cmd_options.profile_path);
+            if (os.is_open()) {
+                profiler->report(os);
+            } else {
+                LOG_AGENT(ERR, agent, "Unable to open profile file \"%s\"", cmd_options.profile_path.c_str());
+            }
+        }
+        profiler.reset();
+    }
+
+    // Writes the contention counters
+    if (contention) {
+        std::ofstream os(cmd_options.contention_path);
+        if (os.is_open()) {
+            contention->report(os);
+        } else {
+            LOG_AGENT(ERR, agent, "Unable to open contention file \"%s\"", cmd_options.contention_path.c_str());
+        }
+        contention.reset();
+    }
+
+    // Writes the cache simulation statistics
+    if (cache_sim) {
+        std::ofstream os(cmd_options.cache_sim_path);
+        if (os.is_open()) {
+            cache_sim->report(os);
+        } else {
+            LOG_AGENT(ERR, agent, "Unable to open cache simulation file \"%s\"", cmd_options.cache_sim_path.c_str());
+        }
+        cache_sim.reset();
+    }
+
     LOG_AGENT(INFO, agent, "%s", "Finishing emulation");
 
     if (cmd_options.gdb)
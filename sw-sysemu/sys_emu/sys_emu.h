@@ -19,6 +19,11 @@
 
 #include "emu_defines.h"
 #include "api_communicate.h"
+#include "binaryLog.h"
+#include "cacheSim.h"
+#include "hotspotProfiler.h"
+#include "memContention.h"
+#include "retireTrace.h"
 #include "system.h"
 #include "checkers/flb_checker.h"
 #include "checkers/l1_scp_checker.h"
@@ -82,6 +87,7 @@ struct sys_emu_cmd_options {
     bool        second_thread                = true;
     bool        log_en                       = false;
     std::string log_path;
+    std::string log_binary_path;
     std::bitset<EMU_NUM_THREADS> log_thread;
     uint32_t    log_trigger_insn             = 0;
     uint64_t    log_trigger_hart             = 0;
@@ -140,6 +146,28 @@ struct sys_emu_cmd_options {
     uint64_t    tstore_checker_log_addr      = 1;
     uint32_t    tstore_checker_log_thread    = 4096;
 
+#ifndef SDK_RELEASE
+    std::string retire_trace_path;
+    std::bitset<EMU_NUM_THREADS> retire_trace_harts;
+    uint64_t    retire_trace_pc_start        = 0;
+    uint64_t    retire_trace_pc_end          = ~0ull;
+#endif
+
+    std::string profile_path;
+    std::string profile_perf_path;
+    uint64_t    profile_interval             = 1000;
+
+    std::string contention_path;
+    memContention::config contention;
+
+    std::string cache_sim_path;
+    cacheSim::config cache_sim;
+
+#if EMU_ETSOC1
+    // Initial DRAM contents shared with other instances (see sysemu_farm)
+    std::shared_ptr<const bemu::MainMemory::dram_image> dram_image;
+#endif
+
 #ifdef SYSEMU_PROFILING
     std::string dump_prof_file;
 #endif
@@ -199,6 +227,7 @@ public:
     SW_SYSEMU_EXPORT int main_internal();
 
     uint64_t get_emu_cycle()  { return emu_cycle; }
+    uint64_t get_emu_instret() { return emu_instret; }
     double   get_total_exe_time() { return total_exe_time; }
 
     // gdbstub needs these
@@ -213,6 +242,15 @@ public:
             chip.cpu[thread].start_running();
         }
     }
+    bool thread_is_halted(unsigned thread) { return chip.cpu[thread].is_halted(); }
+    bool thread_halt(unsigned thread) {
+        // Only halt harts that are running, unavailable harts stay disabled
+        if (!chip.cpu[thread].is_running()) {
+            return false;
+        }
+        chip.cpu[thread].enter_debug_mode(bemu::Debug_entry::Cause::haltreq);
+        return true;
+    }
     void thread_read_memory(int thread, uint64_t addr, uint64_t size, uint8_t* buffer) {
         chip.memory.read(chip.cpu[thread], addr, size, buffer);
     }
@@ -245,6 +283,9 @@ public:
     flb_checker& get_flb_checker() { return flb_checker_; }
     bool get_tstore_check() { return tstore_check; }
     tstore_checker& get_tstore_checker() { return tstore_checker_; }
+    memContention* get_mem_contention() { return contention.get(); }
+    cacheSim* get_cache_sim() { return cache_sim.get(); }
+    retireTrace* get_retire_trace() { return retire_trace.get(); }
     bool get_display_trap_info() { return cmd_options.display_trap_info; }
 
     void breakpoint_insert(uint64_t addr);
@@ -278,10 +319,14 @@ private:
         }
     };
 
+    // Declared before chip, which refers to it, so that it is destroyed last
+    std::unique_ptr<binaryLog> binary_log;
+
     bemu::System    chip;
 
     std::ofstream   log_file;
     uint64_t        emu_cycle = 0;
+    uint64_t        emu_instret = 0;
     double          total_exe_time = 0;
 #ifndef SDK_RELEASE
     std::unique_ptr<Vpurf_checker> vpurf_checker = nullptr;
@@ -296,6 +341,10 @@ private:
     flb_checker     flb_checker_{&chip};
     bool            tstore_check = false;
     tstore_checker  tstore_checker_{&chip};
+    std::unique_ptr<retireTrace> retire_trace;
+    std::unique_ptr<hotspotProfiler> profiler;
+    std::unique_ptr<memContention> contention;
+    std::unique_ptr<cacheSim> cache_sim;
     std::unordered_set<uint64_t> breakpoints;
     std::bitset<EMU_NUM_THREADS> single_step;
     std::array<Addr_range, EMU_NUM_THREADS> step_range;
@@ -23,6 +23,7 @@ static const char * help_msg =
 "     -lm <minion>             Log a given Minion. Can be used multiple times. (default: all)\n"
 "     -ls <shire>,<threads>    Log given Threads of a Shire. Can be used multiple times. (default: all)\n"
 "     -lp <path>               Redirect log output to path. (default: stdout)\n"
+"     -lb <path>               Write the log to path in compressed binary form, decode it with sysemu_log_decode\n"
 "     -ltrigger_insn <instn>   Logging verbosity will be set to DEBUG after finding this instruction. (hex format, default: 0)\n"
 "     -ltrigger_hart <hart>    Logging verbosity will be set to DEBUG after this hart finds the trigger instruction. (default: 0)\n"
 "     -ltrigger_start <count>  Logging verbosity will be set to DEBUG after finding the trigger instruction this many times. (default: 0)\n"
@@ -105,6 +106,23 @@ static const char * help_msg =
 "     -tstore_check            Enables TensorStore checks\n"
 "     -tstore_check_addr       Enables TensorStore check prints for a specific address (default: 0x1 [none])\n"
 "     -tstore_check_thread     Enables TensorStore check prints for a specific thread (default: 4096 [4096 => no thread, -1 => all threads])\n"
+#ifndef SDK_RELEASE
+"     -rt <path>               Write a compressed binary record of every retired instruction to path\n"
+"     -rt_hart <hart>          Trace a given Hart. Can be used multiple times. (default: all)\n"
+"     -rt_pc <start>,<end>     Only trace instructions with start <= PC < end (hex format, default: all)\n"
+#endif
+"     -prof <path>             Sample the PC of the running harts and write a profile by function symbol to path\n"
+"     -prof_perf <path>        Write every profiler sample to path in perf script format\n"
+"     -prof_interval <cycles>  Cycles between profiler samples (default: 1000)\n"
+"     -contention <path>       Stall harts on contended global atomics, loads and stores, and write the per line and per memshire counters to path\n"
+"     -contention_shires <n>   Number of memshires that serve global accesses (default: all memshires)\n"
+"     -contention_interleave <bits> Log2 of the bytes interleaved on each memshire (default: 10)\n"
+"     -contention_latency <cycles> Cycles from the start of a global access until the hart can continue (default: 0)\n"
+"     -contention_line <cycles> Cycles a cache line is busy per global access (default: 4)\n"
+"     -contention_shire <cycles> Cycles between global accesses accepted by a memshire (default: 1)\n"
+"     -cache_sim <path>        Simulate the L1, L2 and L3 caches and write the hit, eviction and prefetch statistics per kernel and hart to path\n"
+"     -cache_sim_config <scp>,<l2>,<l3> Shire cache split in MiB for all the compute shires (default: 80,16,32)\n"
+"     -cache_sim_latency <l1>,<l2>,<l3>,<mem> Cycles charged to an access served by each level (default: 3,22,60,250)\n"
 "     -gdb                     Start the GDB stub for remote debugging at the start of simulation\n"
 "     -gdb_at_pc <PC>          Start the GDB stub for remote debugging at a given PC\n"
 "     -gdb_on_umode            Start the GDB stub once any hart enters in user mode\n"
@@ -167,6 +185,7 @@ sys_emu::parse_command_line_arguments(int argc, char* argv[])
         {"lm",                     required_argument, nullptr, 0},
         {"ls",                     required_argument, nullptr, 0},
         {"lp",                     required_argument, nullptr, 0},
+        {"lb",                     required_argument, nullptr, 0},
         {"ltrigger_insn",          required_argument, nullptr, 0},
         {"ltrigger_hart",          required_argument, nullptr, 0},
         {"ltrigger_start",         required_argument, nullptr, 0},
@@ -243,6 +262,23 @@ sys_emu::parse_command_line_arguments(int argc, char* argv[])
         {"tstore_check",           no_argument,       nullptr, 0},
         {"tstore_check_addr",      required_argument, nullptr, 0},
         {"tstore_check_thread",    required_argument, nullptr, 0},
+#ifndef SDK_RELEASE
+        {"rt",                     required_argument, nullptr, 0},
+        {"rt_hart",                required_argument, nullptr, 0},
+        {"rt_pc",                  required_argument, nullptr, 0},
+#endif
+        {"prof",                   required_argument, nullptr, 0},
+        {"prof_perf",              required_argument, nullptr, 0},
+        {"prof_interval",          required_argument, nullptr, 0},
+        {"contention",             required_argument, nullptr, 0},
+        {"contention_shires",      required_argument, nullptr, 0},
+        {"contention_interleave",  required_argument, nullptr, 0},
+        {"contention_latency",     required_argument, nullptr, 0},
+        {"contention_line",        required_argument, nullptr, 0},
+        {"contention_shire",       required_argument, nullptr, 0},
+        {"cache_sim",              required_argument, nullptr, 0},
+        {"cache_sim_config",       required_argument, nullptr, 0},
+        {"cache_sim_latency",      required_argument, nullptr, 0},
         {"gdb",                    no_argument,       nullptr, 0},
         {"gdb_at_pc",              required_argument, nullptr, 0},
         {"gdb_on_umode",           no_argument,       nullptr, 0},   
@@ -327,6 +363,10 @@ sys_emu::parse_command_line_arguments(int argc, char* argv[])
         {
             cmd_options.log_path = optarg;
         }
+        else if (!strcmp(name, "lb"))
+        {
+            cmd_options.log_binary_path = optarg;
+        }
         else if (!strcmp(name, "ltrigger_insn"))
         {
             uint64_t instruction;
@@ -608,6 +648,96 @@ sys_emu::parse_command_line_arguments(int argc, char* argv[])
         {
             cmd_options.tstore_checker_log_thread = atoi(optarg);
         }
+#ifndef SDK_RELEASE
+        else if (!strcmp(name, "rt"))
+        {
+            cmd_options.retire_trace_path = optarg;
+        }
+        else if (!strcmp(name, "rt_hart"))
+        {
+            unsigned hart = atoi(optarg);
+            if (hart >= EMU_NUM_THREADS) {
+                SE_ERROR("Command line option '-rt_hart': Invalid hart");
+            }
+            cmd_options.retire_trace_harts[hart] = true;
+        }
+        else if (!strcmp(name, "rt_pc"))
+        {
+            if (sscanf(optarg, "%" PRIx64 ",%" PRIx64, &cmd_options.retire_trace_pc_start,
+                       &cmd_options.retire_trace_pc_end) != 2) {
+                SE_ERROR("Command line option '-rt_pc': Wrong number of arguments");
+            }
+        }
+#endif
+        else if (!strcmp(name, "prof"))
+        {
+            cmd_options.profile_path = optarg;
+        }
+        else if (!strcmp(name, "prof_perf"))
+        {
+            cmd_options.profile_perf_path = optarg;
+        }
+        else if (!strcmp(name, "prof_interval"))
+        {
+            if ((sscanf(optarg, "%" SCNu64, &cmd_options.profile_interval) != 1) || !cmd_options.profile_interval) {
+                SE_ERROR("Command line option '-prof_interval': Invalid interval");
+            }
+        }
+        else if (!strcmp(name, "contention"))
+        {
+            cmd_options.contention_path = optarg;
+        }
+        else if (!strcmp(name, "contention_shires"))
+        {
+            if ((sscanf(optarg, "%u", &cmd_options.contention.shires) != 1) || !cmd_options.contention.shires) {
+                SE_ERROR("Command line option '-contention_shires': Invalid number of memshires");
+            }
+        }
+        else if (!strcmp(name, "contention_interleave"))
+        {
+            if ((sscanf(optarg, "%u", &cmd_options.contention.interleave) != 1) || (cmd_options.contention.interleave > 40)) {
+                SE_ERROR("Command line option '-contention_interleave': Invalid interleave");
+            }
+        }
+        else if (!strcmp(name, "contention_latency"))
+        {
+            if (sscanf(optarg, "%" SCNu64, &cmd_options.contention.latency) != 1) {
+                SE_ERROR("Command line option '-contention_latency': Invalid latency");
+            }
+        }
+        else if (!strcmp(name, "contention_line"))
+        {
+            if (sscanf(optarg, "%" SCNu64, &cmd_options.contention.lineOccupancy) != 1) {
+                SE_ERROR("Command line option '-contention_line': Invalid occupancy");
+            }
+        }
+        else if (!strcmp(name, "contention_shire"))
+        {
+            if (sscanf(optarg, "%" SCNu64, &cmd_options.contention.shireInterval) != 1) {
+                SE_ERROR("Command line option '-contention_shire': Invalid interval");
+            }
+        }
+        else if (!strcmp(name, "cache_sim"))
+        {
+            cmd_options.cache_sim_path = optarg;
+        }
+        else if (!strcmp(name, "cache_sim_config"))
+        {
+            auto& cfg = cmd_options.cache_sim;
+            if (sscanf(optarg, "%u,%u,%u", &cfg.scpSize, &cfg.l2Size, &cfg.l3Size) != 3) {
+                SE_ERROR("Command line option '-cache_sim_config': Wrong number of arguments");
+            }
+            if (!cfg.valid()) {
+                SE_ERROR("Command line option '-cache_sim_config': Invalid shire cache split");
+            }
+        }
+        else if (!strcmp(name, "cache_sim_latency"))
+        {
+            auto& lat = cmd_options.cache_sim.latency;
+            if (sscanf(optarg, "%" SCNu64 ",%" SCNu64 ",%" SCNu64 ",%" SCNu64, &lat[0], &lat[1], &lat[2], &lat[3]) != 4) {
+                SE_ERROR("Command line option '-cache_sim_latency': Wrong number of arguments");
+            }
+        }
         else if (!strcmp(name, "gdb"))
         {
             cmd_options.gdb = true;
@@ -639,6 +769,9 @@ sys_emu::parse_command_line_arguments(int argc, char* argv[])
 
     // Enable logging for all threads if no filter has been specified
     if (cmd_options.log_thread.none()) cmd_options.log_thread.set();
+#ifndef SDK_RELEASE
+    if (cmd_options.retire_trace_harts.none()) cmd_options.retire_trace_harts.set();
+#endif
 
     return std::make_pair(true, cmd_options);
 }
@@ -3,6 +3,10 @@
 
 sysemu_hdrs := \
     sys_emu/api_communicate.h \
+    sys_emu/apiTrace.h \
+    sys_emu/binaryLog.h \
+    sys_emu/cacheSim.h \
+    sys_emu/checkers/directory_map.h \
     sys_emu/checkers/flb_checker.h \
     sys_emu/checkers/l1_scp_checker.h \
     sys_emu/checkers/l2_scp_checker.h \
@@ -10,12 +14,19 @@ sysemu_hdrs := \
     sys_emu/checkers/tstore_checker.h \
     sys_emu/checkers/vpurf_checker.h \
     sys_emu/gdbstub.h \
+    sys_emu/hotspotProfiler.h \
     sys_emu/log.h \
+    sys_emu/memContention.h \
+    sys_emu/retireTrace.h \
     sys_emu/sys_emu.h \
     sys_emu/testLog.h \
-    sys_emu/utils.h
+    sys_emu/utils.h \
+    support/lz4_record_file.h
 
 sysemu_cpp_srcs := \
+    sys_emu/apiTrace.cpp \
+    sys_emu/binaryLog.cpp \
+    sys_emu/cacheSim.cpp \
     sys_emu/checkers/flb_checker.cpp \
     sys_emu/checkers/l1_scp_checker.cpp \
     sys_emu/checkers/l2_scp_checker.cpp \
@@ -23,12 +34,16 @@ sysemu_cpp_srcs := \
     sys_emu/checkers/tstore_checker.cpp \
     sys_emu/checkers/vpurf_checker.cpp \
     sys_emu/gdbstub.cpp \
+    sys_emu/hotspotProfiler.cpp \
 	sys_emu/log.cpp \
+    sys_emu/memContention.cpp \
+    sys_emu/retireTrace.cpp \
     sys_emu/sys_emu.cpp \
     sys_emu/sys_emu_main.cpp \
     sys_emu/sys_emu_parse_args.cpp \
     sys_emu/testLog.cpp \
-    sys_emu/utils.cpp
+    sys_emu/utils.cpp \
+    support/lz4_record_file.cpp
 
 ifneq ($(PROFILING),0)
   sysemu_hdrs     += sys_emu/profiling.h
@@ -0,0 +1,333 @@
+/*-------------------------------------------------------------------------
+* Copyright (c) 2025 Ainekko, Co.
+* SPDX-License-Identifier: Apache-2.0
+*-------------------------------------------------------------------------*/
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cinttypes>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <exception>
+#include <fstream>
+#include <getopt.h>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "sys_emu.h"
+#include "testLog.h"
+
+// Runs a queue of sys_emu jobs on a pool of threads, one emulator instance
+// per job, and writes the outcome of every job as JSON.
+//
+// The options after "--" apply to every job, and usually load the firmware.
+// Each line of the jobs file is a job: a name followed by more sys_emu
+// options, typically the -elf_load of the kernel test. Blank lines and lines
+// that start with '#' are ignored.
+//
+// Before running the jobs, the farm loads the common options once and keeps
+// a read-only copy of the resulting DRAM contents. The jobs start from that
+// copy and only allocate the DRAM buckets they write, so reloading the
+// firmware ELFs does not copy them again.
+
+namespace {
+
+struct job {
+    std::string name;
+    sys_emu_cmd_options options;
+
+    // Results
+    bool        passed = false;
+    int         status = EXIT_FAILURE;
+    std::string error;
+    uint64_t    cycles = 0;
+    uint64_t    instret = 0;
+    double      seconds = 0;
+};
+
+
+void usage(const char* argv0)
+{
+    std::fprintf(stderr,
+                 "Usage: %s [-j <threads>] [-o <results.json>] [-log_dir <dir>] <jobs file> [-- <sys_emu options>]\n"
+                 "     -j <threads>             Number of jobs to run in parallel (default: number of host CPUs)\n"
+                 "     -o <path>                Write the results to <path> instead of the standard output\n"
+                 "     -log_dir <dir>           Directory of the <job>.log files of the jobs without -l_path (default: .)\n"
+                 "     -no_share                Do not share the DRAM contents of the common options between jobs\n",
+                 argv0);
+}
+
+
+std::vector<std::string> split(const std::string& line)
+{
+    std::vector<std::string> words;
+    std::istringstream is(line);
+    std::string word;
+    while (is >> word) {
+        words.push_back(word);
+    }
+    return words;
+}
+
+
+// Parses sys_emu options; getopt is not reentrant, so only the main thread
+// calls this
+bool parse_options(const char* argv0, const std::vector<std::string>& args, sys_emu_cmd_options& options)
+{
+    std::vector<std::string> strings{argv0};
+    strings.insert(strings.end(), args.begin(), args.end());
+    std::vector<char*> argv;
+    for (auto& str : strings) {
+        argv.push_back(&str[0]);
+    }
+    argv.push_back(nullptr);
+
+    optind = 0; // rescan from the start, sys_emu permutes its arguments
+    auto result = sys_emu::parse_command_line_arguments(argv.size() - 1, argv.data());
+    options = std::get<1>(result);
+    return std::get<0>(result);
+}
+
+
+std::string json_string(const std::string& str)
+{
+    std::string out = "\"";
+    for (char c : str) {
+        switch (c) {
+        case '"':  out += "\\\""; break;
+        case '\\': out += "\\\\"; break;
+        case '\n': out += "\\n"; break;
+        case '\t': out += "\\t"; break;
+        default:
+            if (static_cast<unsigned char>(c) < 0x20) {
+                char buf[8];
+                std::snprintf(buf, sizeof(buf), "\\u%04x", unsigned(c));
+                out += buf;
+            } else {
+                out += c;
+            }
+        }
+    }
+    return out + "\"";
+}
+
+
+void run(job& j)
+{
+    testLog::resetErrors();
+    std::unique_ptr<sys_emu> emu;
+    const auto start = std::chrono::steady_clock::now();
+    try {
+        emu = std::make_unique<sys_emu>(j.options);
+        j.status = emu->main_internal();
+        if (j.status != EXIT_SUCCESS) {
+            j.error = "test failed";
+        }
+    }
+    catch (const endSimException&) {
+        j.error = "simulation stopped on a fatal error";
+    }
+    catch (const std::exception& e) {
+        j.error = e.what();
+    }
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+    j.seconds = std::chrono::duration<double>(elapsed).count();
+    j.passed = j.error.empty();
+    if (emu) {
+        j.cycles = emu->get_emu_cycle();
+        j.instret = emu->get_emu_instret();
+    }
+}
+
+
+void report(std::ostream& os, const std::vector<job>& jobs, unsigned threads, double seconds)
+{
+    char buf[64];
+    size_t passed = 0;
+
+    os << "{\n  \"jobs\": [";
+    for (size_t i = 0; i < jobs.size(); ++i) {
+        const job& j = jobs[i];
+        passed += j.passed;
+        os << (i ? ",\n" : "\n") << "    {"
+           << "\"name\": " << json_string(j.name)
+           << ", \"result\": \"" << (j.passed ? "pass" : "fail") << "\""
+           << ", \"status\": " << j.status;
+        if (!j.error.empty()) {
+            os << ", \"error\": " << json_string(j.error);
+        }
+        std::snprintf(buf, sizeof(buf), "%.6f", j.seconds);
+        os << ", \"cycles\": " << j.cycles
+           << ", \"instructions\": " << j.instret
+           << ", \"seconds\": " << buf;
+        std::snprintf(buf, sizeof(buf), "%.1f", j.seconds > 0 ? j.instret / j.seconds : 0.0);
+        os << ", \"instructions_per_second\": " << buf
+           << ", \"log\": " << json_string(j.options.log_path) << "}";
+    }
+    std::snprintf(buf, sizeof(buf), "%.6f", seconds);
+    os << "\n  ],\n"
+       << "  \"passed\": " << passed << ",\n"
+       << "  \"failed\": " << (jobs.size() - passed) << ",\n"
+       << "  \"threads\": " << threads << ",\n"
+       << "  \"seconds\": " << buf << "\n"
+       << "}\n";
+}
+
+} // namespace
+
+
+int main(int argc, char* argv[])
+{
+    static const struct option farm_options[] = {
+        {"j",        required_argument, nullptr, 'j'},
+        {"o",        required_argument, nullptr, 'o'},
+        {"log_dir",  required_argument, nullptr, 'l'},
+        {"no_share", no_argument,       nullptr, 'n'},
+        {"help",     no_argument,       nullptr, 'h'},
+        {nullptr,    0,                 nullptr,  0 }
+    };
+
+    unsigned threads = std::max(1u, std::thread::hardware_concurrency());
+    std::string output_path;
+    std::string log_dir = ".";
+    bool share = true;
+
+    int opt;
+    while ((opt = getopt_long_only(argc, argv, "+", farm_options, nullptr)) != -1) {
+        switch (opt) {
+        case 'j':
+            if ((std::sscanf(optarg, "%u", &threads) != 1) || !threads) {
+                std::fprintf(stderr, "Invalid number of threads: %s\n", optarg);
+                return EXIT_FAILURE;
+            }
+            break;
+        case 'o':
+            output_path = optarg;
+            break;
+        case 'l':
+            log_dir = optarg;
+            break;
+        case 'n':
+            share = false;
+            break;
+        default:
+            usage(argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+    if (optind >= argc) {
+        usage(argv[0]);
+        return EXIT_FAILURE;
+    }
+    const std::string jobs_path = argv[optind++];
+    if (optind < argc) {
+        if (strcmp(argv[optind], "--")) {
+            usage(argv[0]);
+            return EXIT_FAILURE;
+        }
+        ++optind;
+    }
+    const std::vector<std::string> common(argv + optind, argv + argc);
+
+    // Parse all the jobs up front
+    sys_emu_cmd_options base;
+    if (!parse_options(argv[0], common, base)) {
+        std::fprintf(stderr, "Invalid common sys_emu options\n");
+        return EXIT_FAILURE;
+    }
+    std::ifstream jobs_file(jobs_path);
+    if (!jobs_file.is_open()) {
+        std::fprintf(stderr, "Unable to open jobs file \"%s\"\n", jobs_path.c_str());
+        return EXIT_FAILURE;
+    }
+    std::vector<job> jobs;
+    std::string line;
+    unsigned lineno = 0;
+    while (std::getline(jobs_file, line)) {
+        ++lineno;
+        std::vector<std::string> words = split(line);
+        if (words.empty() || (words[0][0] == '#')) {
+            continue;
+        }
+        job j;
+        j.name = words[0];
+        std::vector<std::string> args = common;
+        args.insert(args.end(), words.begin() + 1, words.end());
+        if (!parse_options(argv[0], args, j.options)) {
+            std::fprintf(stderr, "%s:%u: invalid sys_emu options for job \"%s\"\n",
+                         jobs_path.c_str(), lineno, j.name.c_str());
+            return EXIT_FAILURE;
+        }
+        if (j.options.gdb || !j.options.api_comm_path.empty()) {
+            std::fprintf(stderr, "%s:%u: job \"%s\": the farm does not support -gdb or -api_comm\n",
+                         jobs_path.c_str(), lineno, j.name.c_str());
+            return EXIT_FAILURE;
+        }
+        if (j.options.log_path.empty()) {
+            j.options.log_path = log_dir + "/" + j.name + ".log";
+        }
+        jobs.push_back(std::move(j));
+    }
+
+    // A failing job stops its own simulation, not the farm
+    endSimThrows(true);
+
+#if EMU_ETSOC1
+    // Load the common options once and share the resulting DRAM contents
+    if (share && (!base.elf_files.empty() || !base.file_load_files.empty() || !base.mem_write32s.empty())) {
+        base.log_path = log_dir + "/farm_image.log";
+        try {
+            auto image = std::make_unique<sys_emu>(base);
+            auto dram = image->get_memory().dram_snapshot();
+            for (auto& j : jobs) {
+                // Memory that the image did not write reads as its reset pattern
+                if (j.options.mem_reset == base.mem_reset) {
+                    j.options.dram_image = dram;
+                }
+            }
+        }
+        catch (...) {
+            std::fprintf(stderr, "Unable to load the common options, see %s\n", base.log_path.c_str());
+            return EXIT_FAILURE;
+        }
+    }
+#else
+    (void) share;
+#endif
+
+    const auto start = std::chrono::steady_clock::now();
+    std::atomic<size_t> next{0};
+    std::vector<std::thread> pool;
+    threads = std::min<size_t>(threads, std::max<size_t>(jobs.size(), 1));
+    for (unsigned i = 0; i < threads; ++i) {
+        pool.emplace_back([&]() {
+            endSimThrows(true);
+            for (size_t k = next++; k < jobs.size(); k = next++) {
+                run(jobs[k]);
+            }
+        });
+    }
+    for (auto& t : pool) {
+        t.join();
+    }
+    const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    bool passed = std::all_of(jobs.cbegin(), jobs.cend(), [](const job& j) { return j.passed; });
+    if (output_path.empty()) {
+        report(std::cout, jobs, threads, seconds);
+    } else {
+        std::ofstream os(output_path);
+        if (!os.is_open()) {
+            std::fprintf(stderr, "Unable to open \"%s\"\n", output_path.c_str());
+            return EXIT_FAILURE;
+        }
+        report(os, jobs, threads, seconds);
+    }
+    return passed ? EXIT_SUCCESS : EXIT_FAILURE;
+}
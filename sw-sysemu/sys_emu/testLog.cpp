@@ -21,23 +21,32 @@ namespace filesystem = std::experimental::filesystem;
 namespace fs = std::filesystem;
 
 // static members of testLog
-logLevel testLog::globalLogLevel_ = LOG_DEBUG;
-logLevel testLog::defaultLogLevel_ = LOG_INFO;
-bool testLog::logLevelsSet_ = false;
-unsigned testLog::errors_ = 0;
+thread_local logLevel testLog::globalLogLevel_ = LOG_DEBUG;
+thread_local logLevel testLog::defaultLogLevel_ = LOG_INFO;
+thread_local bool testLog::logLevelsSet_ = false;
+thread_local unsigned testLog::errors_ = 0;
 
 // set maxErrors_ to 1 because sys_emu does not use testMain/testBase
 unsigned testLog::maxErrors_ = 1u;
 
 // nearly empty implementation of testLog functions, that only make sense in RTL simulations
 
+static thread_local bool endSimThrows_ = false;
+
+void endSimThrows(bool enable)
+{
+    endSimThrows_ = enable;
+}
+
 void endSimAt(uint32_t extraTime __attribute__((unused)))
 {
-    exit(1);
+    endSim();
 }
 
 void endSim()
 {
+    if (endSimThrows_)
+        throw endSimException{};
     exit(1);
 }
 
@@ -7,6 +7,7 @@
 #define _TESTLOG_H_
 
 class sys_emu;
+class binaryLog;
 
 #include <cstdint>
 #include <iostream>
@@ -21,6 +22,12 @@ void set_stop_time(uint64_t t);
 void endSim();
 bool simEnded();
 
+// Thrown by endSim() and endSimAt() instead of exiting the process, on the
+// threads that called endSimThrows(true). Hosts that run several simulations
+// in one process use it to stop only the one that failed.
+struct endSimException {};
+void endSimThrows(bool enable);
+
 
 #define DEFAULT_CLOCK_PERIOD 1000
 #define time2Cycles(x) (x/DEFAULT_CLOCK_PERIOD)
@@ -42,6 +49,9 @@ public:
   {
     outputStream_ = output;
   }
+  // When set, messages are recorded in binary form instead of being formatted
+  void setBinaryOutput(binaryLog* output) { binaryOutput_ = output; }
+  binaryLog* getBinaryOutput() { return binaryOutput_; }
 
   testLog(const testLog&) = delete;
   testLog& operator=(const testLog&) = delete;
@@ -101,10 +111,11 @@ private:
   bool msgStarted_;
   bool msgInLogLevel_;
   bool fatal_;
-  static unsigned errors_;
-  static logLevel globalLogLevel_;
-  static logLevel defaultLogLevel_;
-  static bool logLevelsSet_;
+  // per thread, as are the simulations
+  static thread_local unsigned errors_;
+  static thread_local logLevel globalLogLevel_;
+  static thread_local logLevel defaultLogLevel_;
+  static thread_local bool logLevelsSet_;
  public:
   static logLevel getGlobalLogLevel() {
     if (!logLevelsSet_) setLogLevels();
@@ -116,6 +127,7 @@ private:
   }
   static unsigned maxErrors_;
   static unsigned getErrors() {return errors_;}
+  static void resetErrors() {errors_ = 0;}
 
   uint64_t simTime();
   unsigned simCycle() { return time2Cycles(simTime()); }
@@ -125,6 +137,7 @@ private:
  private:
   logLevel logLevel_;
   sys_emu* device_ = nullptr;
+  binaryLog* binaryOutput_ = nullptr;
 };
 
 
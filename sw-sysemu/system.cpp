@@ -4,9 +4,18 @@
 *-------------------------------------------------------------------------*/
 
 #include <algorithm>
+#include <cerrno>
 #include <cfenv>        // FIXME: remove this when we purge std::fesetround() from the code!
 #include <cstring>
 #include <fstream>
+#include <istream>
+#include <streambuf>
+#include <system_error>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
 
 #include "elfio/elfio.hpp"
 #include "emu_gio.h"
@@ -30,10 +39,12 @@ void System::init(Stepping ver)
     // FIXME: remove '#include <cfenv>' when we purge this function from the code
     std::fesetround(FE_TONEAREST);  // set rne for host
 
-    // Init harts & cores
+    // Init harts & cores, cores are allocated by config_simulated_harts()
+    for (auto& cores : core) {
+        cores.reset();
+    }
     for (unsigned tid = 0; tid < EMU_NUM_THREADS; ++tid) {
-        unsigned cid = tid / EMU_THREADS_PER_MINION;
-        cpu[tid].core = &core[cid];
+        cpu[tid].core = &unused_core;
         cpu[tid].chip = this;
         // Do this here so that logging messages can show the correct hartid
         cpu[tid].mhartid = hartid(tid);
@@ -118,6 +129,32 @@ void System::cold_reset_shire(unsigned shire)
 }
 
 
+void System::allocate_shire_cores(unsigned shire)
+{
+    if (core[shire]) {
+        return;
+    }
+
+    unsigned mcount = shireindex_minions(shire);
+    unsigned hcount = shireindex_harts(shire);
+
+    // Harts skip the core-shared state while their core is not allocated,
+    // so reset it here. That also points the TensorReduce partner of the
+    // core at its first hart, as Hart::warm_reset() does.
+    core[shire].reset(new Core[mcount]());
+    for (unsigned h = 0; h < hcount; ++h) {
+        Hart& hart = cpu[h + shire * EMU_THREADS_PER_SHIRE];
+        hart.core = &core[shire][h / EMU_THREADS_PER_MINION];
+        if (index_in_core(hart) == 0) {
+            hart.warm_reset_core();
+        }
+    }
+
+    // Nothing may have written to the placeholder, see has_core()
+    assert(unused_core.reduce.hart == nullptr);
+}
+
+
 void System::cold_reset(void)
 {
     for (unsigned shire = 0; shire < EMU_NUM_SHIRES; ++shire) {
@@ -479,6 +516,7 @@ void System::recalculate_thread0_enable(unsigned shire)
                 cpu[thread].become_unavailable();
             }
             else if (cpu[thread].is_unavailable()) {
+                allocate_shire_cores(shire);
                 if (should_halt_on_reset(cpu[thread])) {
                     cpu[thread].enter_debug_mode(Debug_entry::Cause::haltreq);
                 } else {
@@ -508,6 +546,7 @@ void System::recalculate_thread1_enable(unsigned shire)
                 cpu[thread].become_unavailable();
             }
             else if (cpu[thread].is_unavailable()) {
+                allocate_shire_cores(shire);
                 if (should_halt_on_reset(cpu[thread])) {
                     cpu[thread].enter_debug_mode(Debug_entry::Cause::haltreq);
                 } else {
@@ -545,6 +584,9 @@ void System::config_simulated_harts(unsigned shire, uint32_t minionmask,
     if (!multithreaded) {
         shire_other_esrs[shire].minion_feature |= 0x10;
     }
+    if (disabled[0] != ((1ul << minion_count) - 1)) {
+        allocate_shire_cores(shire);
+    }
     for (unsigned m = 0; m < minion_count; ++m) {
         unsigned h = m * EMU_THREADS_PER_MINION + shire * EMU_THREADS_PER_SHIRE;
         for (unsigned t = 0; t < hart_count; ++t) {
@@ -609,13 +651,74 @@ void System::load_elf(std::istream& stream)
 }
 
 
-void System::load_elf(const char* filename)
+// Read-only stream buffer over an ELF image in memory, so that ELFIO reads
+// it in place instead of through a copy of the image
+class elf_imagebuf : public std::streambuf
 {
-    std::ifstream file;
+public:
+    elf_imagebuf(const char* data, size_t size) {
+        char* begin = const_cast<char*>(data);
+        setg(begin, begin, begin + size);
+    }
 
-    file.exceptions(std::ifstream::failbit | std::ifstream::badbit);
-    file.open(filename, std::ios::in | std::ios::binary);
-    load_elf(file);
+protected:
+    pos_type seekoff(off_type off, std::ios_base::seekdir dir, std::ios_base::openmode which) override {
+        if (!(which & std::ios_base::in))
+            return pos_type(off_type(-1));
+        char* base = (dir == std::ios_base::beg) ? eback()
+                   : (dir == std::ios_base::cur) ? gptr()
+                   : egptr();
+        off_type pos = (base - eback()) + off;
+        if ((pos < 0) || (pos > egptr() - eback()))
+            return pos_type(off_type(-1));
+        setg(eback(), eback() + pos, egptr());
+        return pos_type(pos);
+    }
+
+    pos_type seekpos(pos_type pos, std::ios_base::openmode which) override {
+        return seekoff(off_type(pos), std::ios_base::beg, which);
+    }
+};
+
+
+void System::load_elf(const char* data, size_t size)
+{
+    elf_imagebuf buf{data, size};
+    std::istream stream{&buf};
+    load_elf(stream);
+}
+
+
+void System::load_elf(const char* filename)
+{
+    // Map the file instead of reading it through an ifstream
+    int fd = ::open(filename, O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        throw std::system_error(errno, std::generic_category(), filename);
+    }
+    struct stat st;
+    if (::fstat(fd, &st) < 0) {
+        int err = errno;
+        ::close(fd);
+        throw std::system_error(err, std::generic_category(), filename);
+    }
+    size_t size = st.st_size;
+    void* addr = size ? ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0) : MAP_FAILED;
+    int err = errno;
+    ::close(fd);
+    if (addr == MAP_FAILED) {
+        throw std::system_error(size ? err : EINVAL, std::generic_category(), filename);
+    }
+    ::madvise(addr, size, MADV_SEQUENTIAL);
+
+    try {
+        load_elf(static_cast<const char*>(addr), size);
+    }
+    catch (...) {
+        ::munmap(addr, size);
+        throw;
+    }
+    ::munmap(addr, size);
 }
 
 
@@ -9,6 +9,7 @@
 #include <cstddef>
 #include <cstdint>
 #include <array>
+#include <memory>
 #include <vector>
 #include <bitset>
 
@@ -116,6 +117,7 @@ public:
 
     // Preload memory
     void load_elf(std::istream&);
+    void load_elf(const char* data, size_t size);
     void load_elf(const char* filename);
     void load_raw(const char* filename, unsigned long long addr);
 
@@ -249,14 +251,19 @@ public:
 
     uint64_t emu_cycle() const noexcept;
 
+    // Whether the core of the hart is allocated, see allocate_shire_cores()
+    bool has_core(const Hart& hart) const noexcept { return hart.core != &unused_core; }
+
     // ----- Public system state -----
 
     // Configuration
     Stepping stepping = Stepping::unknown;
 
-    // Harts and cores
-    std::array<Hart, EMU_NUM_THREADS>  cpu {};
-    std::array<Core, EMU_NUM_MINIONS>  core {};
+    // Harts and cores. The cores of a shire are only allocated when some of
+    // its harts are simulated, until then its harts share `unused_core` and
+    // must not write to it, see has_core().
+    std::array<Hart, EMU_NUM_THREADS>                    cpu {};
+    std::array<std::unique_ptr<Core[]>, EMU_NUM_SHIRES>  core {};
 
     // `active` holds all harts in the running state that arehave actions to
     // peform. This includes harts that can execute RISC-V instruction (i.e.,
@@ -329,11 +336,17 @@ private:
     // Reset helpers
     void cold_reset_shire(unsigned shire);
 
+    // Lazy core allocation
+    void allocate_shire_cores(unsigned shire);
+
     // Message ports
     void write_msg_port_data_to_scp(Hart& cpu, unsigned id, uint32_t *data, uint8_t oob);
 
     // ----- Private system state -----
 
+    // Placeholder core for harts of shires that are not simulated
+    Core unused_core {};
+
     // Simulation control
     bool m_emu_done {false};
     bool m_emu_fail {false};
@@ -0,0 +1,201 @@
+/*-------------------------------------------------------------------------
+* Copyright (c) 2025 Ainekko, Co.
+* SPDX-License-Identifier: Apache-2.0
+*-------------------------------------------------------------------------*/
+
+// Checks the host SIMD packed single operations (fpu/fpu_ps.h) against the
+// element-wise softfloat operations the instructions use otherwise.
+//
+// The operands are random, biased towards the cases the fast path has to
+// reject or get exactly right: special values, subnormals, results near
+// overflow and underflow, small integers, and equal operands. Every call
+// that takes the fast path must produce the same elements and exception
+// flags as softfloat, and every call that does not must leave the
+// destination and the flags untouched.
+
+#include <cinttypes>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+
+#include "fpu/fpu.h"
+#include "fpu/fpu_ps.h"
+
+namespace {
+
+enum op : unsigned {
+    OP_ADD, OP_SUB, OP_MUL, OP_MULADD, OP_MULSUB, OP_SUBMULADD, OP_SUBMULSUB,
+    OP_MIN, OP_MAX, OP_EQ, OP_LT, OP_LE, OP_FROM_I32, OP_TO_I32, OP_COUNT
+};
+
+const char* const op_names[OP_COUNT] = {
+    "add", "sub", "mul", "mulAdd", "mulSub", "subMulAdd", "subMulSub",
+    "min", "max", "eq", "lt", "le", "from_i32", "to_i32"
+};
+
+const uint32_t special_values[] = {
+    0x00000000, 0x80000000, 0x7F800000, 0xFF800000, 0x7FC00000, 0x7F800001,
+    0x00000001, 0x807FFFFF, 0x00800000, 0x80800000, 0x3F800000, 0xBF800000,
+    0x7F7FFFFF, 0xFF7FFFFF, 0x01000000, 0x00FFFFFF, 0x4F000000, 0xCF000000,
+    0x4EFFFFFF, 0x80000001,
+};
+
+std::mt19937_64 rng(0x5EEDF00D);
+
+uint32_t random_operand()
+{
+    const uint32_t sign_mantissa = uint32_t(rng()) & 0x807FFFFF;
+    switch (rng() % 16) {
+    case 0:
+        return special_values[rng() % (sizeof(special_values) / sizeof(special_values[0]))];
+    case 1: case 2: case 3:
+        return uint32_t(rng());
+    case 4: case 5:     // subnormal and tiny
+        return sign_mantissa | (uint32_t(rng() % 8) << 23);
+    case 6: case 7:     // huge
+        return sign_mantissa | (uint32_t(0xF8 + rng() % 7) << 23);
+    case 8: case 9:     // small integers, for the conversions
+        return uint32_t(int32_t(rng() % 2001) - 1000);
+    default:            // around 1.0
+        return sign_mantissa | (uint32_t(100 + rng() % 56) << 23);
+    }
+}
+
+float32_t f32(uint32_t x)
+{
+    float32_t f;
+    f.v = x;
+    return f;
+}
+
+bool fast(unsigned op, uint32_t* d, const uint32_t* a, const uint32_t* b, const uint32_t* c, unsigned mask)
+{
+    switch (op) {
+    case OP_ADD:       return fpu::ps_add(d, a, b, mask);
+    case OP_SUB:       return fpu::ps_sub(d, a, b, mask);
+    case OP_MUL:       return fpu::ps_mul(d, a, b, mask);
+    case OP_MULADD:    return fpu::ps_mulAdd(d, a, b, c, mask);
+    case OP_MULSUB:    return fpu::ps_mulSub(d, a, b, c, mask);
+    case OP_SUBMULADD: return fpu::ps_subMulAdd(d, a, b, c, mask);
+    case OP_SUBMULSUB: return fpu::ps_subMulSub(d, a, b, c, mask);
+    case OP_MIN:       return fpu::ps_min(d, a, b, mask);
+    case OP_MAX:       return fpu::ps_max(d, a, b, mask);
+    case OP_EQ:        return fpu::ps_eq(d, a, b, mask);
+    case OP_LT:        return fpu::ps_lt(d, a, b, mask);
+    case OP_LE:        return fpu::ps_le(d, a, b, mask);
+    case OP_FROM_I32:  return fpu::ps_from_i32(d, a, mask);
+    default:           return fpu::ps_to_i32(d, a, mask);
+    }
+}
+
+uint32_t reference(unsigned op, uint32_t a, uint32_t b, uint32_t c)
+{
+    switch (op) {
+    case OP_ADD:       return fpu::f32_add(f32(a), f32(b)).v;
+    case OP_SUB:       return fpu::f32_sub(f32(a), f32(b)).v;
+    case OP_MUL:       return fpu::f32_mul(f32(a), f32(b)).v;
+    case OP_MULADD:    return fpu::f32_mulAdd(f32(a), f32(b), f32(c)).v;
+    case OP_MULSUB:    return fpu::f32_mulSub(f32(a), f32(b), f32(c)).v;
+    case OP_SUBMULADD: return fpu::f32_subMulAdd(f32(a), f32(b), f32(c)).v;
+    case OP_SUBMULSUB: return fpu::f32_subMulSub(f32(a), f32(b), f32(c)).v;
+    case OP_MIN:       return fpu::f32_minimumNumber(f32(a), f32(b)).v;
+    case OP_MAX:       return fpu::f32_maximumNumber(f32(a), f32(b)).v;
+    case OP_EQ:        return fpu::f32_eq(f32(a), f32(b)) ? UINT32_MAX : 0;
+    case OP_LT:        return fpu::f32_lt(f32(a), f32(b)) ? UINT32_MAX : 0;
+    case OP_LE:        return fpu::f32_le(f32(a), f32(b)) ? UINT32_MAX : 0;
+    case OP_FROM_I32:  return fpu::i32_to_f32(int32_t(a)).v;
+    default:           return uint32_t(fpu::f32_to_i32(f32(a)));
+    }
+}
+
+bool host_has_fma()
+{
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+    return __builtin_cpu_supports("fma");
+#else
+    return false;
+#endif
+}
+
+} // namespace
+
+
+int main(int argc, char* argv[])
+{
+    const long iterations = (argc > 1) ? std::atol(argv[1]) : 1000000;
+    const unsigned lanes = fpu::PS_LANES;
+
+    long taken[OP_COUNT] = {};
+    long calls[OP_COUNT] = {};
+    long failures = 0;
+
+    for (long it = 0; it < iterations; ++it) {
+        uint32_t a[lanes], b[lanes], c[lanes], expected[lanes], d[lanes];
+        const bool equal = (rng() % 8) == 0;
+        for (unsigned e = 0; e < lanes; ++e) {
+            a[e] = random_operand();
+            b[e] = equal ? a[e] : random_operand();
+            c[e] = random_operand();
+            d[e] = uint32_t(rng());
+        }
+        // The destination may alias the first operand
+        const bool alias = (rng() % 8) == 0;
+        if (alias) {
+            std::memcpy(d, a, sizeof(d));
+        }
+        std::memcpy(expected, d, sizeof(d));
+        const unsigned mask = ((rng() % 4) == 0) ? 0xFF : unsigned(rng() % 256);
+        const unsigned op = rng() % OP_COUNT;
+
+        softfloat_roundingMode = uint_fast8_t(rng() % 5);
+        const uint_fast8_t flags = (rng() % 2) ? softfloat_flag_overflow : 0;
+        softfloat_exceptionFlags = flags;
+
+        ++calls[op];
+        const bool ok = fast(op, d, alias ? d : a, b, c, mask);
+        const uint_fast8_t fast_flags = softfloat_exceptionFlags;
+
+        if (ok) {
+            ++taken[op];
+            softfloat_exceptionFlags = flags;
+            for (unsigned e = 0; e < lanes; ++e) {
+                if ((mask >> e) & 1) {
+                    expected[e] = reference(op, a[e], b[e], c[e]);
+                }
+            }
+        } else {
+            softfloat_exceptionFlags = flags;
+        }
+
+        if (std::memcmp(expected, d, sizeof(d)) || (fast_flags != softfloat_exceptionFlags)) {
+            if (failures++ < 16) {
+                std::printf("%s mismatch (%s path): rounding mode %u, mask 0x%02x, flags 0x%x, expected 0x%x\n",
+                            op_names[op], ok ? "fast" : "fallback", unsigned(softfloat_roundingMode), mask,
+                            unsigned(fast_flags), unsigned(softfloat_exceptionFlags));
+                for (unsigned e = 0; e < lanes; ++e) {
+                    std::printf("  [%u] a 0x%08" PRIx32 " b 0x%08" PRIx32 " c 0x%08" PRIx32
+                                " expected 0x%08" PRIx32 " got 0x%08" PRIx32 "\n",
+                                e, a[e], b[e], c[e], expected[e], d[e]);
+                }
+            }
+        }
+    }
+
+    // The fast path has to be exercised where the host can take it
+#if defined(__SSE2__) && defined(__GNUC__)
+    for (unsigned op = 0; op < OP_COUNT; ++op) {
+        const bool fma = (op >= OP_MULADD) && (op <= OP_SUBMULSUB);
+        if (calls[op] && !taken[op] && (!fma || host_has_fma())) {
+            std::printf("%s never took the host SIMD path\n", op_names[op]);
+            ++failures;
+        }
+    }
+#endif
+
+    for (unsigned op = 0; op < OP_COUNT; ++op) {
+        std::printf("%-10s %8ld of %8ld calls on the host SIMD path\n", op_names[op], taken[op], calls[op]);
+    }
+    std::printf("%ld failures\n", failures);
+    return failures ? EXIT_FAILURE : EXIT_SUCCESS;
+}